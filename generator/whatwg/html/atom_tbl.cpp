@@ -12,6 +12,8 @@
 #include <fstream>
 
 #include <iostream>
+#include <limits>
+#include <map>
 #include <vector>
 #include <string>
 #include <type_traits>
@@ -234,6 +236,55 @@ int main()
 		}
 	}
 
+	// 名前指定文字参照照合オートマトンを作成
+	// 状態は幅優先で番号付けし、状態 s の遷移は edge[base[s]] から edge[base[s + 1]] の手前まで文字順に並ぶ
+	std::vector<std::uint32_t> named_character_reference_dfa_base_tbl;
+	std::vector<std::array<std::uint32_t, 2>> named_character_reference_dfa_edge_tbl;
+	std::vector<std::uint32_t> named_character_reference_dfa_accept_tbl;
+	{
+		std::vector<std::map<char32_t, std::uint32_t>> trans(1);
+		std::vector<std::uint32_t> accept(1, 0);
+		std::uint32_t i = 0;
+		for (auto const& a : named_character_reference)
+		{
+			std::uint32_t state = 0;
+			for (char32_t cp : a[0])
+			{
+				assert(cp < 0x80);
+				auto it = trans[state].find(cp);
+				if (it == trans[state].end())
+				{
+					it = trans[state].insert({ cp, static_cast<std::uint32_t>(trans.size()) }).first;
+					trans.emplace_back();
+					accept.push_back(0);
+				}
+				state = it->second;
+			}
+			accept[state] = ++i;
+		}
+
+		std::vector<std::uint32_t> order(1, 0);
+		std::vector<std::uint32_t> renumber(trans.size(), 0);
+		for (std::uint32_t j = 0; j < order.size(); ++j)
+		{
+			for (auto const& pair : trans[order[j]])
+			{
+				renumber[pair.second] = static_cast<std::uint32_t>(order.size());
+				order.push_back(pair.second);
+			}
+		}
+
+		for (std::uint32_t state : order)
+		{
+			named_character_reference_dfa_base_tbl.push_back(static_cast<std::uint32_t>(named_character_reference_dfa_edge_tbl.size()));
+			named_character_reference_dfa_accept_tbl.push_back(accept[state]);
+			for (auto const& pair : trans[state]) named_character_reference_dfa_edge_tbl.push_back({ static_cast<std::uint32_t>(pair.first), renumber[pair.second] });
+		}
+		named_character_reference_dfa_base_tbl.push_back(static_cast<std::uint32_t>(named_character_reference_dfa_edge_tbl.size()));
+
+		assert(named_character_reference_dfa_edge_tbl.size() <= std::numeric_limits<std::uint16_t>::max());
+	}
+
 	// atom_defs.hpp
 	{
 		using namespace wordring::whatwg;
@@ -324,6 +375,11 @@ int main()
 		hpp << "\t" << "extern wordring::trie<char32_t> const named_character_reference_idx_tbl;" << std::endl;
 		hpp << "\t" << "extern std::array<std::array<char32_t, 2>, " << named_character_reference_map_tbl.size() << "> const named_character_reference_map_tbl;" << std::endl;
 		hpp << std::endl;
+		// 名前指定文字参照照合オートマトン
+		hpp << "\t" << "extern std::array<std::uint16_t, " << named_character_reference_dfa_base_tbl.size() << "> const named_character_reference_dfa_base_tbl;" << std::endl;
+		hpp << "\t" << "extern std::array<std::array<std::uint16_t, 2>, " << named_character_reference_dfa_edge_tbl.size() << "> const named_character_reference_dfa_edge_tbl;" << std::endl;
+		hpp << "\t" << "extern std::array<std::uint16_t, " << named_character_reference_dfa_accept_tbl.size() << "> const named_character_reference_dfa_accept_tbl;" << std::endl;
+		hpp << std::endl;
 		// 文字参照コード変換表
 		hpp << "\t" << "extern std::unordered_map<char32_t, char32_t> const character_reference_code_tbl;" << std::endl;
 		hpp << std::endl;
@@ -476,6 +532,64 @@ int main()
 		cpp << "}};" << std::endl;
 		cpp << std::endl;
 
+		// 名前指定文字参照照合オートマトン
+		cpp << "std::array<std::uint16_t, " << named_character_reference_dfa_base_tbl.size() << "> const wordring::whatwg::html::parsing::named_character_reference_dfa_base_tbl = {{" << std::endl;
+		{
+			std::uint32_t n = 0;
+			for (std::uint32_t j : named_character_reference_dfa_base_tbl)
+			{
+				++n;
+				if (n == 1) cpp << "\t";
+				cpp << j << ", ";
+				if (n == 20)
+				{
+					cpp << std::endl;
+					n = 0;
+				}
+			}
+		}
+		cpp << std::endl;
+		cpp << "}};" << std::endl;
+		cpp << std::endl;
+
+		cpp << "std::array<std::array<std::uint16_t, 2>, " << named_character_reference_dfa_edge_tbl.size() << "> const wordring::whatwg::html::parsing::named_character_reference_dfa_edge_tbl = {{" << std::endl;
+		{
+			std::uint32_t n = 0;
+			for (std::array<std::uint32_t, 2> const& a : named_character_reference_dfa_edge_tbl)
+			{
+				++n;
+				if (n == 1) cpp << "\t";
+				cpp << "{ " << a[0] << ", " << a[1] << " }, ";
+				if (n == 20)
+				{
+					cpp << std::endl;
+					n = 0;
+				}
+			}
+		}
+		cpp << std::endl;
+		cpp << "}};" << std::endl;
+		cpp << std::endl;
+
+		cpp << "std::array<std::uint16_t, " << named_character_reference_dfa_accept_tbl.size() << "> const wordring::whatwg::html::parsing::named_character_reference_dfa_accept_tbl = {{" << std::endl;
+		{
+			std::uint32_t n = 0;
+			for (std::uint32_t j : named_character_reference_dfa_accept_tbl)
+			{
+				++n;
+				if (n == 1) cpp << "\t";
+				cpp << j << ", ";
+				if (n == 20)
+				{
+					cpp << std::endl;
+					n = 0;
+				}
+			}
+		}
+		cpp << std::endl;
+		cpp << "}};" << std::endl;
+		cpp << std::endl;
+
 		// 文字参照コード変換表
 		cpp << "std::unordered_map<char32_t, char32_t> const wordring::whatwg::html::parsing::character_reference_code_tbl = {" << std::endl;
 		{
@@ -0,0 +1,185 @@
+﻿#pragma once
+
+#include <wordring/html/simple_html.hpp>
+#include <wordring/html/simple_parser.hpp>
+
+#include <wordring/html/html_defs.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace wordring::html
+{
+	/*! @brief parse_batch() が文書ごとに返す解析情報
+	*/
+	struct batch_result
+	{
+		/*! @brief 解析に用いた文字エンコーディング */
+		encoding_name m_encoding_name = static_cast<encoding_name>(0);
+
+		/*! @brief 文字エンコーディングの確かさ */
+		encoding_confidence_name m_confidence = static_cast<encoding_confidence_name>(0);
+
+		/*! @brief 解析中に送出された例外、成功した場合 nullptr */
+		std::exception_ptr m_exception;
+
+		/*! @brief 解析エラー。エラー方針が collect_parse_errors の場合のみ格納される */
+		std::vector<parse_error> m_errors;
+
+		/*! @brief 資源の上限に達したか */
+		parse_limit_status m_limit_status;
+	};
+
+	namespace detail
+	{
+		/*! @brief 作業者スレッドが受け持つ文書番号の範囲
+
+		所有者は先頭から取り出し、他の作業者は後半を盗む。
+		*/
+		struct batch_work_range
+		{
+			std::mutex  m_mutex;
+			std::size_t m_first = 0;
+			std::size_t m_last  = 0;
+
+			/*! @brief 先頭の文書番号を取り出す */
+			bool pop(std::size_t& i)
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if (m_first == m_last) return false;
+				i = m_first++;
+				return true;
+			}
+
+			/*! @brief victim が受け持つ範囲の後半を盗む
+
+			@return 盗めた場合 true
+			*/
+			bool steal(batch_work_range& victim)
+			{
+				std::scoped_lock lock(m_mutex, victim.m_mutex);
+				std::size_t n = victim.m_last - victim.m_first;
+				if (n == 0) return false;
+
+				m_last  = victim.m_last;
+				m_first = victim.m_last - (n + 1) / 2;
+				victim.m_last = m_first;
+				return true;
+			}
+		};
+	}
+
+	/*! @brief 複数の文字列から HTML 文書を並列に作成する
+
+	@tparam Container   HTML 文書を格納する木コンテナ
+	@tparam ErrorPolicy 解析エラーの扱い。有効な方針は m_errors メンバを持たなければならない
+	@tparam InputRange  文字列の範囲。要素は begin() と end() で前方向イテレータを返さなければならない
+
+	@param [in]  inputs     入力文字列の範囲
+	@param [out] outputs    作成した文書を受け取る木コンテナの配列。 inputs と同じ大きさに変更される
+	@param [in]  threads    作業者スレッドの数。 0 の場合、 std::thread::hardware_concurrency() を用いる
+	@param [in]  enc        エンコーディング名
+	@param [in]  confidence エンコーディングの確かさ
+	@param [in]  limits     文書ごとに適用する資源の上限
+
+	@return 文書ごとの解析情報
+
+	文書番号の範囲を作業者ごとに等分し、自分の範囲を使い切った作業者は他の作業者の残りの後半を盗む。
+	作業者はそれぞれパーサーを一つだけ持ち、文書ごとに clear() して再利用するため、
+	トークン化器とスタックの記憶域は文書間で使い回される。
+	呼び出し元のスレッドも作業者の一つとして働く。
+
+	解析中に例外が送出された場合、その文書の木コンテナは空となり、例外は batch_result に格納される。
+	他の文書の解析は続けられる。
+
+	@sa make_document()
+	*/
+	template <typename Container, typename ErrorPolicy = ignore_parse_errors, typename InputRange, typename std::enable_if_t<is_simple_tree_v<Container>, std::nullptr_t> = nullptr>
+	inline std::vector<batch_result> parse_batch(
+		InputRange const&        inputs,
+		std::vector<Container>&  outputs,
+		std::uint32_t            threads    = 0,
+		encoding_name            enc        = encoding_name::UTF_8,
+		encoding_confidence_name confidence = encoding_confidence_name::tentative,
+		parse_limits const&      limits     = parse_limits())
+	{
+		using input_iterator = decltype(std::begin(*std::begin(inputs)));
+		using parser = basic_simple_parser<Container, input_iterator, ErrorPolicy>;
+
+		static_assert(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<input_iterator>::iterator_category>);
+
+		std::vector<std::decay_t<decltype(std::begin(inputs))>> docs;
+		for (auto it = std::begin(inputs); it != std::end(inputs); ++it) docs.push_back(it);
+
+		std::size_t n = docs.size();
+		outputs.resize(n);
+		std::vector<batch_result> results(n);
+		if (n == 0) return results;
+
+		if (threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+		threads = static_cast<std::uint32_t>(std::min<std::size_t>(threads, n));
+
+		std::unique_ptr<detail::batch_work_range[]> ranges(new detail::batch_work_range[threads]);
+		for (std::uint32_t i = 0; i < threads; ++i)
+		{
+			ranges[i].m_first = n * i / threads;
+			ranges[i].m_last  = n * (i + 1) / threads;
+		}
+
+		// まだ誰も取り出していない文書の数
+		std::atomic<std::size_t> unclaimed(n);
+
+		auto work = [&](std::uint32_t self)
+		{
+			parser p(confidence, enc);
+			p.set_limits(limits);
+
+			while (true)
+			{
+				std::size_t i;
+				if (!ranges[self].pop(i))
+				{
+					// 巡回中に他の作業者間で範囲が移ることがあるため、盗めなくても仕事が残っている場合がある
+					// 終了は残りの文書数で判断する
+					if (unclaimed.load() == 0) break;
+					bool stolen = false;
+					for (std::uint32_t j = 1; j < threads && !stolen; ++j) stolen = ranges[self].steal(ranges[(self + j) % threads]);
+					if (!stolen) std::this_thread::yield();
+					continue;
+				}
+				--unclaimed;
+
+				try
+				{
+					p.clear(confidence, enc);
+					p.parse(std::begin(*docs[i]), std::end(*docs[i]));
+					results[i].m_encoding_name = p.current_encoding();
+					results[i].m_confidence    = p.current_confidence();
+					if constexpr (ErrorPolicy::enabled) results[i].m_errors = p.get_error_policy().m_errors;
+					results[i].m_limit_status = p.limit_status();
+					p.get(outputs[i]);
+				}
+				catch (...)
+				{
+					results[i].m_exception = std::current_exception();
+					outputs[i].clear();
+				}
+			}
+		};
+
+		std::vector<std::thread> workers;
+		for (std::uint32_t i = 1; i < threads; ++i) workers.emplace_back(work, i);
+		work(0);
+		for (std::thread& t : workers) t.join();
+
+		return results;
+	}
+}
@@ -0,0 +1,429 @@
+﻿#pragma once
+
+// https://html.spec.whatwg.org/multipage/parsing.html
+// https://triple-underscore.github.io/HTML-parsing-ja.html
+
+#include <wordring/html/html_defs.hpp>
+
+#include <wordring/whatwg/html/parsing/token.hpp>
+#include <wordring/whatwg/html/parsing/tokenization.hpp>
+#include <wordring/whatwg/infra/infra.hpp>
+#include <wordring/whatwg/infra/unicode.hpp>
+
+#include <cassert>
+#include <deque>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace wordring::html
+{
+	using DOCTYPE_token   = wordring::whatwg::html::parsing::DOCTYPE_token;
+	using token_attribute = wordring::whatwg::html::parsing::token_attribute;
+	using tag_token       = wordring::whatwg::html::parsing::tag_token;
+	using start_tag_token = wordring::whatwg::html::parsing::start_tag_token;
+	using end_tag_token   = wordring::whatwg::html::parsing::end_tag_token;
+	using comment_token   = wordring::whatwg::html::parsing::comment_token;
+
+	/*! @brief SAX パーサー用のノード・トレイツ
+
+	SAX パーサーはノードを作成しないため、ノード・ポインタの代わりに要素の名前空間を扱う。
+	*/
+	struct sax_node_traits
+	{
+		using node_pointer = ns_name;
+
+		static ns_name get_namespace_name(node_pointer ns) { return ns; }
+	};
+
+	/*! @class sax_parser_base sax_parser.hpp wordring/html/sax_parser.hpp
+
+	@brief 木を構築せず、トークンをイベントとして通知する HTML5 パーサー
+
+	@tparam T CRTP に基づく派生クラス
+
+	トークン化器の上に、 RAWTEXT 等への状態切り替えと外来コンテンツの判定に必要な最小限の木構築状態のみを持つ。
+	ノードを一切作成しないため、リンクやメタ要素の抽出など、トークン列だけが必要な処理に向く。
+
+	@par コールバック
+
+	派生クラスは、必要に応じて以下のメンバを実装する。
+	実装しないコールバックは何もしない。
+
+	- void on_start_tag(start_tag_token const& token)
+	- void on_end_tag(end_tag_token const& token)
+	- void on_text(std::u32string const& text)
+	- void on_comment(std::u32string const& data)
+	- void on_doctype(DOCTYPE_token const& token)
+	- void on_end_of_file()
+	- void on_report_error(error_name e)
+
+	連続する文字は一つのテキストとしてまとめて通知される。
+
+	@par 木構築状態の近似
+
+	title 、 textarea 、 style 、 script などの開始タグの後は、規格の木構築段階と同様にトークン化器の状態を切り替える。
+	svg 、 math 要素内では外来要素のスタックを保持し、トークン化器へ調整済みカレント・ノードを提供するとともに、 RAWTEXT 等への切り替えを抑止する。
+	暗黙に閉じられる要素や誤った入れ子の修正は行わない。
+	*/
+	template <typename T>
+	class sax_parser_base : public wordring::whatwg::html::parsing::tokenizer<T, sax_node_traits>
+	{
+		friend wordring::whatwg::html::parsing::tokenizer<T, sax_node_traits>;
+		friend wordring::whatwg::html::parsing::input_stream<T>;
+
+	public:
+		using base_type = wordring::whatwg::html::parsing::tokenizer<T, sax_node_traits>;
+		using this_type = T;
+
+		using node_pointer = typename sax_node_traits::node_pointer;
+
+		using character_token   = wordring::whatwg::html::parsing::character_token;
+		using end_of_file_token = wordring::whatwg::html::parsing::end_of_file_token;
+
+		/*! @brief 外来要素のスタックの項目
+		*/
+		struct stack_entry
+		{
+			node_pointer   m_it;
+			std::u32string m_name;
+			/*! @brief encoding 属性の値が text/html あるいは application/xhtml+xml である annotation-xml 要素 */
+			bool           m_html_encoding = false;
+		};
+
+	public:
+		sax_parser_base()
+			: m_html_entry({ ns_name::HTML, std::u32string() })
+		{
+		}
+
+		/*! @brief 初期状態に戻し、パーサーを再利用可能とする
+		*/
+		void clear()
+		{
+			base_type::clear();
+			m_stack.clear();
+			m_text.clear();
+		}
+
+		/*! @brief 文字列を解析し、イベントを通知する
+
+		@param [in] first HTML ソース文字列の最初を指すイテレータ
+		@param [in] last  HTML ソース文字列の終端を指すイテレータ
+
+		1 バイト文字列は UTF-8 、 2 バイト文字列は UTF-16 として扱う。
+		最後に push_eof() を呼び出し、ストリーム終端を通知する。
+		*/
+		template <typename ForwardIterator>
+		void parse(ForwardIterator first, ForwardIterator last)
+		{
+			if constexpr (sizeof(*first) == 4)
+			{
+				while (first != last) base_type::push_code_point(*first++);
+			}
+			else
+			{
+				std::u32string s;
+				wordring::whatwg::encoding_cast(first, last, std::back_inserter(s));
+				for (char32_t cp : s) base_type::push_code_point(cp);
+			}
+
+			base_type::push_eof();
+		}
+
+		// ----------------------------------------------------------------------------------------
+		// コールバック
+		// ----------------------------------------------------------------------------------------
+
+		void on_start_tag(start_tag_token const& token) {}
+
+		void on_end_tag(end_tag_token const& token) {}
+
+		void on_text(std::u32string const& text) {}
+
+		void on_comment(std::u32string const& data) {}
+
+		void on_doctype(DOCTYPE_token const& token) {}
+
+		void on_end_of_file() {}
+
+		void on_report_error(error_name e) {}
+
+	protected:
+		// ----------------------------------------------------------------------------------------
+		// トークン化器から呼び出されるメンバ
+		// ----------------------------------------------------------------------------------------
+
+		stack_entry const& adjusted_current_node() const
+		{
+			return m_stack.empty() ? m_html_entry : m_stack.back();
+		}
+
+		void on_emit_token(character_token const& token)
+		{
+			m_text.push_back(token.m_data);
+		}
+
+		void on_emit_token(DOCTYPE_token const& token)
+		{
+			flush_text();
+			static_cast<this_type*>(this)->on_doctype(token);
+		}
+
+		void on_emit_token(start_tag_token& token)
+		{
+			flush_text();
+			process_start_tag(token);
+			static_cast<this_type*>(this)->on_start_tag(token);
+		}
+
+		void on_emit_token(end_tag_token& token)
+		{
+			flush_text();
+			process_end_tag(token);
+			static_cast<this_type*>(this)->on_end_tag(token);
+		}
+
+		void on_emit_token(comment_token const& token)
+		{
+			flush_text();
+			static_cast<this_type*>(this)->on_comment(token.m_data);
+		}
+
+		void on_emit_token(end_of_file_token const&)
+		{
+			flush_text();
+			static_cast<this_type*>(this)->on_end_of_file();
+		}
+
+		// ----------------------------------------------------------------------------------------
+		// 木構築状態の近似
+		// ----------------------------------------------------------------------------------------
+
+		void flush_text()
+		{
+			if (m_text.empty()) return;
+			static_cast<this_type*>(this)->on_text(m_text);
+			m_text.clear();
+		}
+
+		/*! @brief 現在の要素の子を HTML として扱うか調べる
+
+		外来要素のスタックが空の場合と、 HTML 統合点あるいは MathML テキスト統合点の直下の場合、 true を返す。
+		*/
+		bool in_html_content() const
+		{
+			if (m_stack.empty()) return true;
+
+			stack_entry const& entry = m_stack.back();
+			if (entry.m_it == ns_name::HTML) return true;
+			if (entry.m_it == ns_name::SVG)
+			{
+				// トークナイザはタグ名を小文字にするため、 foreignObject も小文字で比較する
+				return entry.m_name == U"foreignobject" || entry.m_name == U"desc" || entry.m_name == U"title";
+			}
+			if (entry.m_it == ns_name::MathML)
+			{
+				return is_mathml_text_integration_point(entry) || entry.m_html_encoding;
+			}
+
+			return false;
+		}
+
+		/*! @brief 開始タグを HTML の規則で処理するか調べる
+
+		MathML テキスト統合点の直下でも mglyph 、 malignmark は外来要素のままとなる。
+		annotation-xml 要素の直下の svg 要素は、 HTML の規則で SVG 要素として作成される。
+
+		@sa https://html.spec.whatwg.org/multipage/parsing.html#tree-construction-dispatcher
+		*/
+		bool in_html_content(start_tag_token const& token) const
+		{
+			if (m_stack.empty()) return true;
+
+			stack_entry const& entry = m_stack.back();
+			if (is_mathml_text_integration_point(entry))
+			{
+				return token.m_tag_name_id != tag_name::Mglyph && token.m_tag_name_id != tag_name::Malignmark;
+			}
+			if (entry.m_it == ns_name::MathML && entry.m_name == U"annotation-xml" && token.m_tag_name_id == tag_name::Svg) return true;
+
+			return in_html_content();
+		}
+
+		static bool is_mathml_text_integration_point(stack_entry const& entry)
+		{
+			return entry.m_it == ns_name::MathML
+				&& (entry.m_name == U"mi" || entry.m_name == U"mo" || entry.m_name == U"mn"
+					|| entry.m_name == U"ms" || entry.m_name == U"mtext");
+		}
+
+		/*! @brief annotation-xml 開始タグの encoding 属性が HTML を示すか調べる
+		*/
+		static bool is_html_encoding(start_tag_token const& token)
+		{
+			auto it = token.find(attribute_name::Encoding);
+			if (it == token.end()) return false;
+
+			std::u32string s;
+			wordring::whatwg::to_ascii_lowercase(it->m_value.begin(), it->m_value.end(), std::back_inserter(s));
+			return s == U"text/html" || s == U"application/xhtml+xml";
+		}
+
+		/*! @brief 外来コンテンツから抜け出す開始タグか調べる
+
+		@sa https://html.spec.whatwg.org/multipage/parsing.html#parsing-main-inforeign
+		*/
+		bool is_breakout(start_tag_token const& token) const
+		{
+			switch (token.m_tag_name_id)
+			{
+			case tag_name::B:      case tag_name::Big:    case tag_name::Blockquote: case tag_name::Body:   case tag_name::Br:
+			case tag_name::Center: case tag_name::Code:   case tag_name::Dd:         case tag_name::Div:    case tag_name::Dl:
+			case tag_name::Dt:     case tag_name::Em:     case tag_name::Embed:      case tag_name::H1:     case tag_name::H2:
+			case tag_name::H3:     case tag_name::H4:     case tag_name::H5:         case tag_name::H6:     case tag_name::Head:
+			case tag_name::Hr:     case tag_name::I:      case tag_name::Img:        case tag_name::Li:     case tag_name::Listing:
+			case tag_name::Menu:   case tag_name::Meta:   case tag_name::Nobr:       case tag_name::Ol:     case tag_name::P:
+			case tag_name::Pre:    case tag_name::Ruby:   case tag_name::S:          case tag_name::Small:  case tag_name::Span:
+			case tag_name::Strong: case tag_name::Strike: case tag_name::Sub:        case tag_name::Sup:    case tag_name::Table:
+			case tag_name::Tt:     case tag_name::U:      case tag_name::Ul:         case tag_name::Var:
+				return true;
+			case tag_name::Font:
+				return token.find(attribute_name::Color) != token.end()
+					|| token.find(U"face") != token.end()
+					|| token.find(attribute_name::Size) != token.end();
+			default:
+				break;
+			}
+
+			return false;
+		}
+
+		void process_start_tag(start_tag_token& token)
+		{
+			using namespace wordring::whatwg::html::parsing;
+
+			if (!in_html_content(token))
+			{
+				if (!is_breakout(token))
+				{
+					ns_name ns = adjusted_current_node().m_it;
+					bool html_encoding = ns == ns_name::MathML && token.m_tag_name_id == tag_name::Annotation_xml && is_html_encoding(token);
+					if (!token.m_self_closing_flag) m_stack.push_back({ ns, token.m_tag_name, html_encoding });
+					else token.m_acknowledged_self_closing_flag = true;
+					return;
+				}
+				while (!in_html_content()) m_stack.pop_back();
+			}
+
+			switch (token.m_tag_name_id)
+			{
+			case tag_name::Svg:
+				if (!token.m_self_closing_flag) m_stack.push_back({ ns_name::SVG, token.m_tag_name });
+				else token.m_acknowledged_self_closing_flag = true;
+				return;
+			case tag_name::Math:
+				if (!token.m_self_closing_flag) m_stack.push_back({ ns_name::MathML, token.m_tag_name });
+				else token.m_acknowledged_self_closing_flag = true;
+				return;
+			case tag_name::Title: case tag_name::Textarea:
+				base_type::change_state(base_type::RCDATA_state);
+				break;
+			case tag_name::Style:   case tag_name::Xmp: case tag_name::Iframe: case tag_name::Noembed:
+			case tag_name::Noframes:
+				base_type::change_state(base_type::RAWTEXT_state);
+				break;
+			case tag_name::Script:
+				base_type::change_state(base_type::script_data_state);
+				break;
+			case tag_name::Plaintext:
+				base_type::change_state(base_type::PLAINTEXT_state);
+				break;
+			default:
+				break;
+			}
+
+			// 統合点の中の HTML 要素は、終了タグで外来要素のスタックを正しく戻せるよう積んでおく
+			if (!m_stack.empty() && !token.m_self_closing_flag && !is_void(token.m_tag_name_id))
+			{
+				m_stack.push_back({ ns_name::HTML, token.m_tag_name });
+			}
+		}
+
+		void process_end_tag(end_tag_token const& token)
+		{
+			for (auto it = m_stack.rbegin(); it != m_stack.rend(); ++it)
+			{
+				if (wordring::whatwg::is_ascii_case_insensitive_match(
+					it->m_name.begin(), it->m_name.end(), token.m_tag_name.begin(), token.m_tag_name.end()))
+				{
+					m_stack.erase(std::prev(it.base()), m_stack.end());
+					return;
+				}
+			}
+		}
+
+		static bool is_void(tag_name tag)
+		{
+			switch (tag)
+			{
+			case tag_name::Area:  case tag_name::Base:  case tag_name::Br:     case tag_name::Col:    case tag_name::Embed:
+			case tag_name::Hr:    case tag_name::Img:   case tag_name::Input:  case tag_name::Link:   case tag_name::Meta:
+			case tag_name::Param: case tag_name::Source: case tag_name::Track: case tag_name::Wbr:
+				return true;
+			default:
+				break;
+			}
+			return false;
+		}
+
+	protected:
+		/*! @brief 外来要素のスタック
+
+		svg 、 math 要素の中でのみ要素が積まれる。
+		*/
+		std::deque<stack_entry> m_stack;
+
+		/*! @brief 外来要素のスタックが空の場合の調整済みカレント・ノード */
+		stack_entry m_html_entry;
+
+		/*! @brief 通知前の連続する文字 */
+		std::u32string m_text;
+	};
+
+	/*! @brief 関数オブジェクトへイベントを通知する SAX パーサー
+
+	@tparam Handler イベントを受け取る型
+
+	Handler は sax_parser_base のコールバックと同名のメンバを全て持たなければならない。
+	*/
+	template <typename Handler>
+	class basic_sax_parser : public sax_parser_base<basic_sax_parser<Handler>>
+	{
+	public:
+		using base_type = sax_parser_base<basic_sax_parser<Handler>>;
+
+	public:
+		explicit basic_sax_parser(Handler& handler)
+			: m_handler(handler)
+		{
+		}
+
+		void on_start_tag(start_tag_token const& token) { m_handler.on_start_tag(token); }
+
+		void on_end_tag(end_tag_token const& token) { m_handler.on_end_tag(token); }
+
+		void on_text(std::u32string const& text) { m_handler.on_text(text); }
+
+		void on_comment(std::u32string const& data) { m_handler.on_comment(data); }
+
+		void on_doctype(DOCTYPE_token const& token) { m_handler.on_doctype(token); }
+
+		void on_end_of_file() { m_handler.on_end_of_file(); }
+
+		void on_report_error(error_name e) { m_handler.on_report_error(e); }
+
+	protected:
+		Handler& m_handler;
+	};
+}
@@ -2,16 +2,24 @@
 
 #include <wordring/html/simple_node.hpp>
 #include <wordring/html/simple_parser.hpp>
+#include <wordring/html/simple_serializer.hpp>
+#include <wordring/html/simple_text_content.hpp>
+#include <wordring/html/simple_text_index.hpp>
 
 #include <wordring/html/html_defs.hpp>
 
 #include <wordring/encoding/encoding_defs.hpp>
 #include <wordring/whatwg/html/parsing/serializing.hpp>
 
+#include <wordring/tag_tree/frozen_tag_tree.hpp>
 #include <wordring/tag_tree/tag_tree.hpp>
+#include <wordring/tag_tree/tag_tree_pool.hpp>
 #include <wordring/compatibility.hpp>
 
 #include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <string>
 #include <type_traits>
 
 namespace wordring::html
@@ -36,37 +44,76 @@ namespace wordring::html
 	/*! @brief 文字列としてstd::u32string を使用する HTML 木コンテナ */
 	using u32simple_tree = tag_tree<u32simple_node>;
 
+	namespace pmr
+	{
+		/*! @brief 文字列としてstd::pmr::u8string を使用する HTML ノード */
+		using u8simple_node  = simple_node<std::pmr::basic_string<char8_t>>;
+
+		/*! @brief 文字列としてstd::pmr::u16string を使用する HTML ノード */
+		using u16simple_node = simple_node<std::pmr::u16string>;
+
+		/*! @brief 文字列としてstd::pmr::u32string を使用する HTML ノード */
+		using u32simple_node = simple_node<std::pmr::u32string>;
+
+		/*! @brief std::pmr::polymorphic_allocator を使用する HTML 木コンテナ
+
+		木を構築する際に与えた memory_resource から、ノードの配列、文字列、属性の配列を確保する。
+
+		@par 例
+		@code
+			std::pmr::monotonic_buffer_resource arena;
+			html::pmr::u8simple_tree tree{ html::pmr::u8simple_tree::allocator_type(&arena) };
+		@endcode
+		*/
+		using u8simple_tree  = tag_tree<u8simple_node, std::pmr::polymorphic_allocator<wordring::detail::tag_node<u8simple_node>>>;
+
+		/*! @brief std::pmr::polymorphic_allocator を使用する HTML 木コンテナ */
+		using u16simple_tree = tag_tree<u16simple_node, std::pmr::polymorphic_allocator<wordring::detail::tag_node<u16simple_node>>>;
+
+		/*! @brief std::pmr::polymorphic_allocator を使用する HTML 木コンテナ */
+		using u32simple_tree = tag_tree<u32simple_node, std::pmr::polymorphic_allocator<wordring::detail::tag_node<u32simple_node>>>;
+	}
+
+	/*! @brief 文字列としてstd::u8string を使用する、変更できない HTML 木コンテナ */
+	using u8frozen_simple_tree  = frozen_tag_tree<u8simple_node>;
+
+	/*! @brief 文字列としてstd::u16string を使用する、変更できない HTML 木コンテナ */
+	using u16frozen_simple_tree = frozen_tag_tree<u16simple_node>;
+
+	/*! @brief 文字列としてstd::u32string を使用する、変更できない HTML 木コンテナ */
+	using u32frozen_simple_tree = frozen_tag_tree<u32simple_node>;
+
 	template <typename T> struct is_simple_tree : std::false_type {};
 
-	template <> struct is_simple_tree<u8simple_tree> : public std::true_type {};
-	template <> struct is_simple_tree<u16simple_tree> : public std::true_type {};
-	template <> struct is_simple_tree<u32simple_tree> : public std::true_type {};
+	template <typename String, typename Allocator> struct is_simple_tree<tag_tree<simple_node<String>, Allocator>> : public std::true_type {};
 
 	template <typename T> constexpr bool is_simple_tree_v = is_simple_tree<T>::value;
 
-	template <typename String>
-	using const_simple_tag_tree_iterator = typename wordring::detail::const_tag_tree_iterator<simple_node<String>>;
+	template <typename String, typename Allocator = std::allocator<wordring::detail::tag_node<simple_node<String>>>>
+	using const_simple_tag_tree_iterator = typename wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator>;
 
-	template <typename String>
-	using simple_tag_tree_iterator = typename wordring::detail::tag_tree_iterator<simple_node<String>>;
+	template <typename String, typename Allocator = std::allocator<wordring::detail::tag_node<simple_node<String>>>>
+	using simple_tag_tree_iterator = typename wordring::detail::tag_tree_iterator<simple_node<String>, Allocator>;
 
-	template<>
-	struct node_traits<simple_tag_tree_iterator<std::u8string>> : public simple_node_traits<simple_tag_tree_iterator<std::u8string>> {};
+	template <typename String, typename Allocator>
+	struct node_traits<wordring::detail::tag_tree_iterator<simple_node<String>, Allocator>>
+		: public simple_node_traits<simple_tag_tree_iterator<String, Allocator>> {};
 
-	template<>
-	struct node_traits<const_simple_tag_tree_iterator<std::u8string>> : public simple_node_traits<const_simple_tag_tree_iterator<std::u8string>> {};
+	template <typename String, typename Allocator>
+	struct node_traits<wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator>>
+		: public simple_node_traits<const_simple_tag_tree_iterator<String, Allocator>> {};
 
-	template<>
-	struct node_traits<simple_tag_tree_iterator<std::u16string>> : public simple_node_traits<simple_tag_tree_iterator<std::u16string>> {};
+	template <typename String>
+	using const_simple_frozen_tag_tree_iterator = typename wordring::detail::const_frozen_tag_tree_iterator<simple_node<String>>;
 
 	template<>
-	struct node_traits<const_simple_tag_tree_iterator<std::u16string>> : public simple_node_traits<const_simple_tag_tree_iterator<std::u16string>> {};
+	struct node_traits<const_simple_frozen_tag_tree_iterator<std::u8string>> : public frozen_simple_node_traits<const_simple_frozen_tag_tree_iterator<std::u8string>> {};
 
 	template<>
-	struct node_traits<simple_tag_tree_iterator<std::u32string>> : public simple_node_traits<simple_tag_tree_iterator<std::u32string>> {};
+	struct node_traits<const_simple_frozen_tag_tree_iterator<std::u16string>> : public frozen_simple_node_traits<const_simple_frozen_tag_tree_iterator<std::u16string>> {};
 
 	template<>
-	struct node_traits<const_simple_tag_tree_iterator<std::u32string>> : public simple_node_traits<const_simple_tag_tree_iterator<std::u32string>> {};
+	struct node_traits<const_simple_frozen_tag_tree_iterator<std::u32string>> : public frozen_simple_node_traits<const_simple_frozen_tag_tree_iterator<std::u32string>> {};
 
 	/*! @brief 文字列から HTML 文書を作成する便利関数
 	*
@@ -8,12 +8,78 @@
 #include <wordring/whatwg/infra/infra.hpp>
 
 #include <iterator>
+#include <memory>
 #include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
 namespace wordring::html
 {
+	namespace detail
+	{
+		/*! @brief 複写できる所有ポインタ
+
+		稀にしか値を持たないメンバをノードの外へ置き、ノードを小さく保つために使う。
+		複写すると、指す値も複写する。
+		*/
+		template <typename T>
+		class simple_box
+		{
+		public:
+			simple_box() = default;
+
+			simple_box(simple_box const& rhs)
+				: m_p(rhs.m_p ? std::make_unique<T>(*rhs.m_p) : nullptr)
+			{
+			}
+
+			simple_box(simple_box&&) = default;
+
+			simple_box& operator=(simple_box const& rhs)
+			{
+				if (!rhs.m_p) m_p.reset();
+				else if (m_p) *m_p = *rhs.m_p; // 記憶域を使い回す
+				else m_p = std::make_unique<T>(*rhs.m_p);
+				return *this;
+			}
+
+			simple_box& operator=(simple_box&&) = default;
+
+			explicit operator bool() const { return static_cast<bool>(m_p); }
+
+			T const& operator*() const { return *m_p; }
+
+			T const* operator->() const { return m_p.get(); }
+
+			T* operator->() { return m_p.get(); }
+
+			/*! @brief 値を返す。値が無ければ作成する
+			*/
+			T& get()
+			{
+				if (!m_p) m_p = std::make_unique<T>();
+				return *m_p;
+			}
+
+		private:
+			std::unique_ptr<T> m_p;
+		};
+
+		/*! @brief 空の文字列を返す
+
+		文字列への参照を返す関数が、値を持たない場合に返す。
+		*/
+		template <typename String>
+		inline String const& simple_empty_string()
+		{
+			static String const s;
+			return s;
+		}
+	}
+
 	// ---------------------------------------------------------------------------------------------
 	// 属性
 	// ---------------------------------------------------------------------------------------------
@@ -56,16 +122,29 @@ namespace wordring::html
 		friend bool operator!=(String1 const&, simple_attr<String1> const&);
 
 	public:
-		using string_type = String;
+		using string_type    = String;
+		using allocator_type = typename string_type::allocator_type;
 
 		using namespace_uri_type = basic_html_atom<string_type, ns_name>;
 		using local_name_type    = basic_html_atom<string_type, attribute_name>;
 
+	protected:
+		/*! @brief 列挙体に無い名前空間 URI とローカル名、および接頭辞
+
+		ほとんどの属性は名前が列挙体に有り、接頭辞を持たないため、ノードの外へ置く。
+		*/
+		struct extension
+		{
+			string_type m_namespace_uri;
+			string_type m_prefix;
+			string_type m_local_name;
+		};
+
 	public:
 		simple_attr()
 			: m_namespace_uri(static_cast<ns_name>(0))
-			, m_prefix()
 			, m_local_name(static_cast<attribute_name>(0))
+			, m_ext()
 			, m_value()
 		{
 		}
@@ -73,16 +152,39 @@ namespace wordring::html
 		simple_attr(simple_attr const&) = default;
 		simple_attr(simple_attr&&) = default;
 
+		/*! @brief 値の文字列を alloc で確保して複写する
+
+		名前の拡張部は alloc を使わない。
+		*/
+		simple_attr(simple_attr const& rhs, allocator_type const& alloc)
+			: m_namespace_uri(rhs.m_namespace_uri)
+			, m_local_name(rhs.m_local_name)
+			, m_ext(rhs.m_ext)
+			, m_value(rhs.m_value, alloc)
+		{
+		}
+
+		/*! @brief 値の文字列を alloc で確保して移動する
+		*/
+		simple_attr(simple_attr&& rhs, allocator_type const& alloc)
+			: m_namespace_uri(rhs.m_namespace_uri)
+			, m_local_name(rhs.m_local_name)
+			, m_ext(std::move(rhs.m_ext))
+			, m_value(std::move(rhs.m_value), alloc)
+		{
+		}
+
 		/*! @brief 名前空間付き属性を構築する
 		* 
 		* 外来属性で必要となる。
 		*/
 		simple_attr(ns_name ns, string_type const& prefix, attribute_name name, string_type const& val = string_type())
 			: m_namespace_uri(ns)
-			, m_prefix(prefix)
 			, m_local_name(name)
+			, m_ext()
 			, m_value(val)
 		{
+			this->prefix(prefix);
 		}
 
 		/*! @brief 名前空間付き属性を構築する
@@ -91,50 +193,77 @@ namespace wordring::html
 		*/
 		simple_attr(ns_name ns, string_type const& prefix, string_type const& name, string_type const& val = string_type())
 			: m_namespace_uri(ns)
-			, m_prefix(prefix)
-			, m_local_name(name)
+			, m_local_name(static_cast<attribute_name>(0))
+			, m_ext()
 			, m_value(val)
 		{
+			this->prefix(prefix);
+			local_name(name);
 		}
 
 		simple_attr(attribute_name name, string_type const& val = string_type())
 			: m_namespace_uri(static_cast<ns_name>(0))
-			, m_prefix()
 			, m_local_name(name)
+			, m_ext()
 			, m_value(val)
 		{
 		}
 
 		simple_attr(string_type const& name, string_type const& val = string_type())
 			: m_namespace_uri(static_cast<ns_name>(0))
-			, m_prefix()
-			, m_local_name(name)
+			, m_local_name(static_cast<attribute_name>(0))
+			, m_ext()
 			, m_value(val)
 		{
+			local_name(name);
 		}
 
 		simple_attr& operator=(simple_attr const& rhs) = default;
 		simple_attr& operator=(simple_attr&& rhs) = default;
 		
-		string_type namespace_uri() const { return static_cast<string_type>(m_namespace_uri); }
+		string_type namespace_uri() const
+		{
+			if (m_namespace_uri == static_cast<ns_name>(0) && m_ext) return m_ext->m_namespace_uri;
+			return static_cast<string_type>(namespace_uri_type(m_namespace_uri));
+		}
 
-		void namespace_uri(string_type const& uri) { m_namespace_uri = uri; }
+		void namespace_uri(string_type const& uri)
+		{
+			m_namespace_uri = namespace_uri_type(uri);
+			unknown(&extension::m_namespace_uri, m_namespace_uri == static_cast<ns_name>(0) ? uri : string_type());
+		}
 
 		ns_name namespace_uri_name() const { return m_namespace_uri; }
 
-		void namespace_uri_name(ns_name uri) { m_namespace_uri = uri; }
+		void namespace_uri_name(ns_name uri)
+		{
+			m_namespace_uri = uri;
+			unknown(&extension::m_namespace_uri, string_type());
+		}
 
-		string_type const& prefix() const { return m_prefix; }
+		string_type const& prefix() const { return m_ext ? m_ext->m_prefix : detail::simple_empty_string<string_type>(); }
 
-		void prefix(string_type const& s) { m_prefix = s; }
+		void prefix(string_type const& s) { unknown(&extension::m_prefix, s); }
 
-		string_type local_name() const { return static_cast<string_type>(m_local_name); }
+		string_type local_name() const
+		{
+			if (m_local_name == static_cast<attribute_name>(0) && m_ext) return m_ext->m_local_name;
+			return static_cast<string_type>(local_name_type(m_local_name));
+		}
 
-		void local_name(string_type const& name) { m_local_name = name; }
+		void local_name(string_type const& name)
+		{
+			m_local_name = local_name_type(name);
+			unknown(&extension::m_local_name, m_local_name == static_cast<attribute_name>(0) ? name : string_type());
+		}
 
 		attribute_name local_name_name() const { return m_local_name; }
 
-		void local_name_name(attribute_name name) { m_local_name = name; }
+		void local_name_name(attribute_name name)
+		{
+			m_local_name = name;
+			unknown(&extension::m_local_name, string_type());
+		}
 
 		string_type qualified_name() const
 		{
@@ -150,9 +279,21 @@ namespace wordring::html
 		void value(string_type const& s) { m_value = s; }
 
 	protected:
-		namespace_uri_type m_namespace_uri;
-		string_type        m_prefix;
-		local_name_type    m_local_name;
+		/*! @brief 列挙体に無い名前あるいは接頭辞を設定する
+
+		空文字列を設定する場合、ノードの外の記憶域を作成しない。
+		*/
+		void unknown(string_type extension::* m, string_type const& s)
+		{
+			if (!s.empty()) m_ext.get().*m = s;
+			else if (m_ext) (m_ext.get().*m).clear();
+		}
+
+	protected:
+		ns_name        m_namespace_uri;
+		attribute_name m_local_name;
+
+		detail::simple_box<extension> m_ext;
 
 		string_type m_value;
 	};
@@ -167,9 +308,12 @@ namespace wordring::html
 	template <typename String1>
 	inline bool operator==(simple_attr<String1> const& lhs, simple_attr<String1> const& rhs)
 	{
+		// 列挙体に有る名前は文字列を持たないため、列挙体に無い場合のみ文字列を比べる
 		return lhs.m_namespace_uri == rhs.m_namespace_uri
-			&& lhs.m_prefix == rhs.m_prefix
-			&& lhs.m_local_name == rhs.m_local_name;
+			&& lhs.m_local_name == rhs.m_local_name
+			&& lhs.prefix() == rhs.prefix()
+			&& (lhs.m_namespace_uri != static_cast<ns_name>(0) || lhs.namespace_uri() == rhs.namespace_uri())
+			&& (lhs.m_local_name != static_cast<attribute_name>(0) || lhs.local_name() == rhs.local_name());
 	}
 
 	template <typename String1>
@@ -314,30 +458,41 @@ namespace wordring::html
 	public:
 		using string_type = String;
 
+	protected:
+		/*! @brief 文書型の文字列
+
+		文書型は文書に一つしか無いため、ノードの外へ置く。
+		*/
+		struct extension
+		{
+			string_type m_name;
+			string_type m_public_id;
+			string_type m_system_id;
+		};
+
 	public:
 		simple_document_type(string_type const& name, string_type const& public_id, string_type const& system_id)
-			: m_name(name)
-			, m_public_id(public_id)
-			, m_system_id(system_id)
+			: m_ext()
 		{
+			m_ext.get() = extension{ name, public_id, system_id };
 		}
 
-		string_type const& name() const { return m_name; }
+		// ムーブ元の文書型は文字列を持たないため、空の文字列として扱う
+
+		string_type const& name() const { return m_ext ? m_ext->m_name : detail::simple_empty_string<string_type>(); }
 
-		void name(string_type const& s) { m_name = s; }
+		void name(string_type const& s) { m_ext.get().m_name = s; }
 
-		string_type const& public_id() const { return m_public_id; }
+		string_type const& public_id() const { return m_ext ? m_ext->m_public_id : detail::simple_empty_string<string_type>(); }
 
-		void public_id(string_type const& s) { m_public_id = s; }
+		void public_id(string_type const& s) { m_ext.get().m_public_id = s; }
 
-		string_type const& system_id() const { return m_system_id; }
+		string_type const& system_id() const { return m_ext ? m_ext->m_system_id : detail::simple_empty_string<string_type>(); }
 
-		void system_id(string_type const& s) { m_system_id = s; }
+		void system_id(string_type const& s) { m_ext.get().m_system_id = s; }
 
 	protected:
-		string_type m_name;
-		string_type m_public_id;
-		string_type m_system_id;
+		detail::simple_box<extension> m_ext;
 	};
 
 	static_assert(std::is_copy_constructible_v<simple_document_type<std::u32string>>);
@@ -411,88 +566,160 @@ namespace wordring::html
 		friend bool operator!=(simple_element<String1> const&, simple_element<String1> const&);
 
 	public:
-		using string_type = String;
+		using string_type    = String;
+		using allocator_type = typename string_type::allocator_type;
 
 		using namespace_uri_type = basic_html_atom<string_type, ns_name>;
 		using local_name_type    = basic_html_atom<string_type, tag_name>;
 
 		using attribute_type = simple_attr<string_type>;
-		using container      = std::vector<attribute_type>;
+		using container      = std::vector<attribute_type, typename std::allocator_traits<allocator_type>::template rebind_alloc<attribute_type>>;
 		using iterator       = typename container::iterator;
 		using const_iterator = typename container::const_iterator;
 
+	protected:
+		/*! @brief 列挙体に無い名前空間 URI とローカル名、および名前空間接頭辞
+
+		ほとんどの要素は名前が列挙体に有り、接頭辞を持たないため、ノードの外へ置く。
+		*/
+		struct extension
+		{
+			string_type m_namespace_uri;
+			string_type m_namespace_prefix;
+			string_type m_local_name;
+		};
+
 	public:
 		simple_element()
 			: m_namespace_uri(static_cast<ns_name>(0))
-			, m_namespace_prefix()
 			, m_local_name(static_cast<tag_name>(0))
+			, m_ext()
 			, m_attributes()
 		{
 		}
 
 		simple_element(string_type const& ns, string_type const& prefix, string_type const& name)
-			: m_namespace_uri(ns)
-			, m_namespace_prefix(prefix)
-			, m_local_name(name)
+			: m_namespace_uri(static_cast<ns_name>(0))
+			, m_local_name(static_cast<tag_name>(0))
+			, m_ext()
 			, m_attributes()
 		{
+			namespace_uri(ns);
+			namespace_prefix(prefix);
+			local_name(name);
 		}
 
 		simple_element(ns_name ns, string_type const& prefix, string_type const& name)
 			: m_namespace_uri(ns)
-			, m_namespace_prefix(prefix)
-			, m_local_name(name)
+			, m_local_name(static_cast<tag_name>(0))
+			, m_ext()
 			, m_attributes()
 		{
+			namespace_prefix(prefix);
+			local_name(name);
 		}
 
 		simple_element(ns_name ns, string_type const& prefix, tag_name name)
 			: m_namespace_uri(ns)
-			, m_namespace_prefix(prefix)
 			, m_local_name(name)
+			, m_ext()
 			, m_attributes()
 		{
+			namespace_prefix(prefix);
 		}
 
 		simple_element(string_type const& name)
 			: m_namespace_uri(ns_name::HTML)
-			, m_namespace_prefix()
-			, m_local_name(name)
+			, m_local_name(static_cast<tag_name>(0))
+			, m_ext()
 			, m_attributes()
 		{
+			local_name(name);
 		}
 
 		simple_element(tag_name name)
 			: m_namespace_uri(ns_name::HTML)
-			, m_namespace_prefix()
 			, m_local_name(name)
+			, m_ext()
 			, m_attributes()
 		{
 		}
 
+		simple_element(simple_element const&) = default;
+		simple_element(simple_element&&) = default;
+
+		/*! @brief 属性の配列と値を alloc で確保して複写する
+
+		名前の拡張部は alloc を使わない。
+		*/
+		simple_element(simple_element const& rhs, allocator_type const& alloc)
+			: m_namespace_uri(rhs.m_namespace_uri)
+			, m_local_name(rhs.m_local_name)
+			, m_ext(rhs.m_ext)
+			, m_attributes(rhs.m_attributes, alloc)
+		{
+		}
+
+		/*! @brief 属性の配列と値を alloc で確保して移動する
+		*/
+		simple_element(simple_element&& rhs, allocator_type const& alloc)
+			: m_namespace_uri(rhs.m_namespace_uri)
+			, m_local_name(rhs.m_local_name)
+			, m_ext(std::move(rhs.m_ext))
+			, m_attributes(std::move(rhs.m_attributes), alloc)
+		{
+		}
+
+		simple_element& operator=(simple_element const&) = default;
+		simple_element& operator=(simple_element&&) = default;
+
 		/*! @brief 名前空間 URI を返す
 		 
 		@sa https://triple-underscore.github.io/DOM4-ja.html#locate-a-namespace-prefix
 		*/
-		string_type namespace_uri() const { return static_cast<string_type>(m_namespace_uri); }
+		string_type namespace_uri() const
+		{
+			if (m_namespace_uri == static_cast<ns_name>(0) && m_ext) return m_ext->m_namespace_uri;
+			return static_cast<string_type>(namespace_uri_type(m_namespace_uri));
+		}
 
-		void namespace_uri(string_type const& uri) { m_namespace_uri = uri; }
+		void namespace_uri(string_type const& uri)
+		{
+			m_namespace_uri = namespace_uri_type(uri);
+			unknown(&extension::m_namespace_uri, m_namespace_uri == static_cast<ns_name>(0) ? uri : string_type());
+		}
 
 		ns_name  namespace_uri_name() const { return m_namespace_uri; }
 
-		void  namespace_uri_name(ns_name ns) { m_namespace_uri = ns; }
+		void  namespace_uri_name(ns_name ns)
+		{
+			m_namespace_uri = ns;
+			unknown(&extension::m_namespace_uri, string_type());
+		}
 
-		string_type namespace_prefix() const { return m_namespace_prefix; }
+		string_type namespace_prefix() const { return m_ext ? m_ext->m_namespace_prefix : string_type(); }
 
-		void namespace_prefix(string_type const& prefix) { m_namespace_prefix = prefix; }
+		void namespace_prefix(string_type const& prefix) { unknown(&extension::m_namespace_prefix, prefix); }
 
-		string_type local_name() const { return static_cast<string_type>(m_local_name); }
+		string_type local_name() const
+		{
+			if (m_local_name == static_cast<tag_name>(0) && m_ext) return m_ext->m_local_name;
+			return static_cast<string_type>(local_name_type(m_local_name));
+		}
 
-		void local_name(string_type const& name) { m_local_name = name; }
+		void local_name(string_type const& name)
+		{
+			m_local_name = local_name_type(name);
+			unknown(&extension::m_local_name, m_local_name == static_cast<tag_name>(0) ? name : string_type());
+		}
 
 		tag_name local_name_name() const { return m_local_name; }
 
-		void local_name_name(tag_name name) { m_local_name = name; }
+		void local_name_name(tag_name name)
+		{
+			m_local_name = name;
+			unknown(&extension::m_local_name, string_type());
+		}
 
 		string_type qualified_name() const
 		{
@@ -551,10 +778,22 @@ namespace wordring::html
 			return find(static_cast<ns_name>(0), string_type(), name);
 		}
 
+	protected:
+		/*! @brief 列挙体に無い名前あるいは接頭辞を設定する
+
+		空文字列を設定する場合、ノードの外の記憶域を作成しない。
+		*/
+		void unknown(string_type extension::* m, string_type const& s)
+		{
+			if (!s.empty()) m_ext.get().*m = s;
+			else if (m_ext) (m_ext.get().*m).clear();
+		}
+
 	private:
-		namespace_uri_type m_namespace_uri;
-		string_type        m_namespace_prefix;
-		local_name_type    m_local_name;
+		ns_name  m_namespace_uri;
+		tag_name m_local_name;
+
+		detail::simple_box<extension> m_ext;
 
 		container m_attributes;
 	};
@@ -601,17 +840,33 @@ namespace wordring::html
 		friend bool operator!=(simple_text<String1> const&, simple_text<String1> const&);
 
 	public:
-		using string_type = String;
-		using value_type = typename string_type::value_type;
+		using string_type    = String;
+		using value_type     = typename string_type::value_type;
+		using allocator_type = typename string_type::allocator_type;
 
 	public:
 		simple_text() = default;
+		simple_text(simple_text const&) = default;
+		simple_text(simple_text&&) = default;
 
 		simple_text(string_type const& s)
 			: m_data(s)
 		{
 		}
 
+		simple_text(simple_text const& rhs, allocator_type const& alloc)
+			: m_data(rhs.m_data, alloc)
+		{
+		}
+
+		simple_text(simple_text&& rhs, allocator_type const& alloc)
+			: m_data(std::move(rhs.m_data), alloc)
+		{
+		}
+
+		simple_text& operator=(simple_text const&) = default;
+		simple_text& operator=(simple_text&&) = default;
+
 		string_type const& data() const { return m_data; }
 
 		/*
@@ -663,9 +918,33 @@ namespace wordring::html
 		friend bool operator!=(simple_processing_instruction<String1> const&, simple_processing_instruction<String1> const&);
 
 	public:
-		using string_type = String;
+		using string_type    = String;
+		using allocator_type = typename string_type::allocator_type;
 
 	public:
+		simple_processing_instruction() = default;
+		simple_processing_instruction(simple_processing_instruction const&) = default;
+		simple_processing_instruction(simple_processing_instruction&&) = default;
+
+		/*! @brief データを alloc で確保して複写する
+
+		ターゲットは alloc を使わない。
+		*/
+		simple_processing_instruction(simple_processing_instruction const& rhs, allocator_type const& alloc)
+			: m_data(rhs.m_data, alloc)
+			, m_target(rhs.m_target)
+		{
+		}
+
+		simple_processing_instruction(simple_processing_instruction&& rhs, allocator_type const& alloc)
+			: m_data(std::move(rhs.m_data), alloc)
+			, m_target(std::move(rhs.m_target))
+		{
+		}
+
+		simple_processing_instruction& operator=(simple_processing_instruction const&) = default;
+		simple_processing_instruction& operator=(simple_processing_instruction&&) = default;
+
 		string_type const& data() const { return m_data; }
 
 		string_type& data() { return m_data; }
@@ -674,17 +953,19 @@ namespace wordring::html
 
 		void data(string_type&& s) { m_data = std::move(s); }
 
-		string_type const& target() const { return m_target; }
+		string_type const& target() const { return m_target ? *m_target : detail::simple_empty_string<string_type>(); }
 
-		string_type& target() { return m_target; }
+		string_type& target() { return m_target.get(); }
 
-		void target(string_type const& s) { m_target = s; }
+		void target(string_type const& s) { m_target.get() = s; }
 
-		void target(string_type&& s) { m_target = std::move(s); }
+		void target(string_type&& s) { m_target.get() = std::move(s); }
 
 	protected:
 		string_type m_data;
-		string_type m_target;
+
+		/*! @brief 処理命令は HTML 文書に現れないため、ターゲットはノードの外へ置く */
+		detail::simple_box<string_type> m_target;
 	};
 
 	static_assert(std::is_copy_constructible_v<simple_processing_instruction<std::u32string>>);
@@ -721,13 +1002,30 @@ namespace wordring::html
 		friend bool operator!=(simple_comment<String1> const&, simple_comment<String1> const&);
 
 	public:
-		using string_type = String;
+		using string_type    = String;
+		using allocator_type = typename string_type::allocator_type;
 
 	public:
 		simple_comment()
 		{
 		}
 
+		simple_comment(simple_comment const&) = default;
+		simple_comment(simple_comment&&) = default;
+
+		simple_comment(simple_comment const& rhs, allocator_type const& alloc)
+			: m_data(rhs.m_data, alloc)
+		{
+		}
+
+		simple_comment(simple_comment&& rhs, allocator_type const& alloc)
+			: m_data(std::move(rhs.m_data), alloc)
+		{
+		}
+
+		simple_comment& operator=(simple_comment const&) = default;
+		simple_comment& operator=(simple_comment&&) = default;
+
 		simple_comment(string_type const& s)
 			: m_data(s)
 		{
@@ -781,7 +1079,8 @@ namespace wordring::html
 		friend bool operator!=(simple_node<String1> const lhs, simple_node<String1> const& rhs);
 
 	public:
-		using string_type = std::remove_cv_t<String>;
+		using string_type    = std::remove_cv_t<String>;
+		using allocator_type = typename string_type::allocator_type;
 
 		using element_type                = simple_element<string_type>;
 		using text_type                   = simple_text<string_type>;
@@ -837,6 +1136,22 @@ namespace wordring::html
 		simple_node(simple_node const&) = default;
 		simple_node(simple_node&&) = default;
 
+		/*! @brief 文字列を alloc で確保して複写する
+
+		tag_tree がアロケータを持つ場合、挿入するノードはこのコンストラクタで木のアロケータへ移される。
+		*/
+		simple_node(simple_node const& rhs, allocator_type const& alloc)
+			: m_value(std::visit([&](auto const& v) { return rebind(v, alloc); }, rhs.m_value))
+		{
+		}
+
+		/*! @brief 文字列を alloc で確保して移動する
+		*/
+		simple_node(simple_node&& rhs, allocator_type const& alloc)
+			: m_value(std::visit([&](auto& v) { return rebind(std::move(v), alloc); }, rhs.m_value))
+		{
+		}
+
 		simple_node(element_type const& val) : m_value(val) {}
 		simple_node(element_type && val) : m_value(std::move(val)) {}
 
@@ -901,7 +1216,7 @@ namespace wordring::html
 		{
 			if (is_element()) return std::get_if<element_type>(&m_value)->namespace_uri();
 			assert(false);
-			return m_string;
+			return string_type();
 		}
 
 		/*! @brief 要素のローカル名を返す
@@ -919,14 +1234,14 @@ namespace wordring::html
 		{
 			if (is_element()) return std::get_if<element_type>(&m_value)->local_name();
 			assert(false);
-			return m_string;
+			return string_type();
 		}
 
 		string_type qualified_name() const
 		{
 			if (is_element()) return std::get_if<element_type>(&m_value)->qualified_name();
 			assert(false);
-			return m_string;
+			return string_type();
 		}
 
 		/*! @brief 属性の開始を返す
@@ -1080,7 +1395,7 @@ namespace wordring::html
 				break;
 			}
 			assert(false);
-			return m_string;
+			return detail::simple_empty_string<string_type>();
 		}
 
 		/*! @brief ノードの文字列データを参照する
@@ -1090,9 +1405,12 @@ namespace wordring::html
 		- comment_type
 		- processing_instruction_type
 
+		@throw std::invalid_argument 文字列データを持たないノードの場合
+
 		@internal
 		<hr>
 		std::back_inserterを使うには、可変な文字列コンテナへの参照が必要になる。
+		書き換えられる共有の文字列を返すと、ノード間あるいはスレッド間で書き込みが漏れるため、例外を送出する。
 		*/
 		string_type& data()
 		{
@@ -1107,27 +1425,37 @@ namespace wordring::html
 			default:
 				break;
 			}
-			assert(false);
-			return m_string;
+			throw std::invalid_argument("");
 		}
 
 		string_type const& target() const
 		{
 			if (is_processing_instruction()) return std::get_if<processing_instruction_type>(&m_value)->target();
 			assert(false);
-			return m_string;
+			return detail::simple_empty_string<string_type>();
 		}
 
 		string_type const& name() const
 		{
 			if (is_document_type()) return std::get_if<document_type_type>(&m_value)->name();
 			assert(false);
-			return m_string;
+			return detail::simple_empty_string<string_type>();
+		}
+
+	private:
+		/*! @brief 共用体の値を、 alloc を使えるものは alloc で構築し直す
+		*/
+		template <typename T>
+		static value_type rebind(T&& v, allocator_type const& alloc)
+		{
+			using type = std::remove_cv_t<std::remove_reference_t<T>>;
+
+			if constexpr (std::uses_allocator_v<type, allocator_type>) return value_type(std::in_place_type<type>, std::forward<T>(v), alloc);
+			else return value_type(std::in_place_type<type>, std::forward<T>(v));
 		}
 
 	private:
-		value_type  m_value;
-		string_type m_string;
+		value_type m_value;
 	};
 
 	static_assert(std::is_copy_constructible_v<simple_node<std::u32string>>);
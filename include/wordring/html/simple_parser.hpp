@@ -8,12 +8,22 @@
 #include <wordring/html/simple_node.hpp>
 #include <wordring/html/simple_traits.hpp>
 
+#include <wordring/whatwg/html/parsing/input_byte_stream.hpp>
+#include <wordring/whatwg/html/parsing/speculative_tokenizer.hpp>
 #include <wordring/whatwg/html/parsing/tree_construction_dispatcher.hpp>
 #include <wordring/whatwg/encoding/api.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace wordring::html
 {
@@ -68,7 +78,25 @@ namespace wordring::html
 			m_temporary = m_c.insert(m_c.end(), node_type());
 		}
 
+		/*! @brief 木コンテナのアロケータを指定してパーサーを構築する
+
+		解析結果のノードは alloc から確保される。
+		*/
+		simple_parser_base(
+			typename container::allocator_type const& alloc,
+			encoding_confidence_name confidence = encoding_confidence_name::irrelevant,
+			encoding_name enc = static_cast<encoding_name>(0),
+			bool fragments_parser = false)
+				: base_type(confidence, enc, fragments_parser)
+				, m_c(alloc)
+		{
+			m_document  = m_c.insert(m_c.end(), document_type());
+			m_temporary = m_c.insert(m_c.end(), node_type());
+		}
+
 		/*! @brief 初期状態に戻し、パーサーを再利用可能とする
+
+		木コンテナとトークン化器、スタックが確保した記憶域は解放せず、次の解析で再利用する。
 		*/
 		void clear(encoding_confidence_name confidence, encoding_name enc)
 		{
@@ -78,6 +106,28 @@ namespace wordring::html
 			m_temporary = m_c.insert(m_c.end(), node_type());
 		}
 
+		// ----------------------------------------------------------------------------------------
+		// HTML 断片
+		//
+		// 12.4 Parsing HTML fragments
+		// https://html.spec.whatwg.org/multipage/parsing.html#parsing-html-fragments
+		// ----------------------------------------------------------------------------------------
+
+		/*! @brief 文脈要素を指定し、 HTML 断片の解析を開始する
+
+		@param [in] tag 文脈要素のタグ名
+		@param [in] ns  文脈要素の名前空間
+
+		@return 断片の根となる html 要素
+
+		解析前に呼び出す。
+		文脈要素は一時領域に作成され、解析結果には含まれない。
+		*/
+		node_pointer set_context(tag_name tag, ns_name ns = ns_name::HTML)
+		{
+			return base_type::start_fragment(create_element(m_document, tag, ns));
+		}
+
 		// ----------------------------------------------------------------------------------------
 		// 文書
 		// ----------------------------------------------------------------------------------------
@@ -94,7 +144,9 @@ namespace wordring::html
 
 		node_pointer insert_document_type(node_pointer pos, document_type_type&& doctype)
 		{
-			return m_c.insert(pos, std::move(doctype));
+			node_pointer it = m_c.insert(pos, std::move(doctype));
+			static_cast<this_type*>(this)->on_insert_node(it);
+			return it;
 		}
 
 		// ----------------------------------------------------------------------------------------
@@ -108,12 +160,16 @@ namespace wordring::html
 		*/
 		node_pointer create_element(node_pointer doc, std::u32string name, ns_name ns)
 		{
-			return m_c.insert(m_temporary.end(), element_type(ns, string_type(), encoding_cast<string_type>(name)));
+			node_pointer it = m_c.insert(m_temporary.end(), element_type(ns, string_type(), encoding_cast<string_type>(name)));
+			static_cast<this_type*>(this)->on_insert_node(it);
+			return it;
 		}
 
 		node_pointer create_element(node_pointer doc, tag_name name, ns_name ns)
 		{	
-			return m_c.insert(m_temporary.end(), element_type(ns, string_type(), name));
+			node_pointer it = m_c.insert(m_temporary.end(), element_type(ns, string_type(), name));
+			static_cast<this_type*>(this)->on_insert_node(it);
+			return it;
 		}
 
 		node_pointer insert_element(node_pointer pos, node_pointer it)
@@ -165,7 +221,17 @@ namespace wordring::html
 
 		node_pointer insert_text(node_pointer pos, text_type&& text)
 		{
-			return m_c.insert(pos, std::move(text));
+			node_pointer it = m_c.insert(pos, std::move(text));
+			static_cast<this_type*>(this)->on_insert_node(it);
+			return it;
+		}
+
+		/*! @brief テキスト・ノードの末尾に文字を追加する
+		*/
+		void append_text(node_pointer it, char32_t cp)
+		{
+			traits::append_text(it, cp);
+			static_cast<this_type*>(this)->on_append_text(it);
 		}
 
 		// ----------------------------------------------------------------------------------------
@@ -174,9 +240,40 @@ namespace wordring::html
 
 		node_pointer insert_comment(node_pointer pos, comment_type&& comment)
 		{
-			return m_c.insert(pos, std::move(comment));
+			node_pointer it = m_c.insert(pos, std::move(comment));
+			static_cast<this_type*>(this)->on_insert_node(it);
+			return it;
 		}
 
+		// ----------------------------------------------------------------------------------------
+		// ノードの作成と終了の通知
+		// ----------------------------------------------------------------------------------------
+
+		/*! @brief 要素、テキスト、コメント、文書型ノードを作成した時に呼び出されるコールバック
+
+		ソース位置の記録などが必要な場合、派生クラスで実装する。
+		*/
+		void on_insert_node(node_pointer it) {}
+
+		/*! @brief テキスト・ノードへ文字を追加した時に呼び出されるコールバック
+		*/
+		void on_append_text(node_pointer it) {}
+
+		/*! @brief 要素がオープン要素のスタックから取り除かれた時に呼び出されるコールバック
+		*/
+		void on_pop_element(node_pointer it) {}
+
+		/*! @brief アクティブ整形要素のリストを操作した時に呼び出されるコールバック
+		*/
+		void on_formatting_operation(typename base_type::formatting_operation_name op) {}
+
+		/*! @brief オープン要素のスタックの深さの上限を返す
+
+		上限の深さに達した後に作成される要素は、上限の深さにある要素の子として挿入される。
+		既定では上限を設けない。
+		*/
+		std::uint32_t open_element_depth_limit() const { return std::numeric_limits<std::uint32_t>::max(); }
+
 		// ----------------------------------------------------------------------------------------
 		// 解析エラー
 		//
@@ -209,25 +306,365 @@ namespace wordring::html
 		node_pointer m_temporary;
 	};
 
+	using input_position = wordring::whatwg::html::parsing::input_position;
+
+	/*! @brief 解析エラーとその位置
+	*/
+	struct parse_error
+	{
+		error_name     m_name;
+		input_position m_position;
+	};
+
+	/*! @brief 解析エラーを無視するエラー方針
+
+	basic_simple_parser の既定。
+	入力位置の追跡を含め、エラー処理のコードはコンパイルされない。
+	*/
+	struct ignore_parse_errors
+	{
+		static bool constexpr enabled = false;
+
+		void clear() {}
+
+		void report(parse_error const&) {}
+	};
+
+	/*! @brief 解析エラーを位置とともに収集するエラー方針
+
+	入力位置の追跡のため、 ignore_parse_errors より解析が遅くなる。
+	*/
+	struct collect_parse_errors
+	{
+		static bool constexpr enabled = true;
+
+		void clear() { m_errors.clear(); }
+
+		void report(parse_error const& e) { m_errors.push_back(e); }
+
+		std::vector<parse_error> m_errors;
+	};
+
+	/*! @brief ノードに対応するソース文字列の範囲
+
+	parse() あるいは feed() へ与えた入力における半開区間 [m_begin, m_end) 。
+	位置は入力の要素単位で数え、バイト列の場合はバイト位置となる。
+	入力を読み直さずに、範囲で切り出した部分がノードのソースとなる。
+	*/
+	struct source_range
+	{
+		std::uint32_t m_begin = 0;
+		std::uint32_t m_end   = 0;
+	};
+
+	/*! @brief ソース位置を記録しないソース位置方針
+
+	basic_simple_parser の既定。
+	*/
+	struct ignore_source_ranges
+	{
+		static bool constexpr enabled = false;
+
+		void clear() {}
+	};
+
+	/*! @brief 要素、テキスト、コメント、文書型ノードのソース位置を記録するソース位置方針
+
+	範囲はノード自身に持たせず、 tag_tree::index() が返す格納位置を添え字とする配列に格納する。
+	そのため、木コンテナは tag_tree でなければならない。
+
+	要素の範囲は開始タグの「<」から終了タグの「>」の直後まで。空要素は開始タグの範囲となる。
+	終了タグを持たずに閉じられた要素は、閉じる原因となったトークンの直前までとなる。
+	暗黙に作成された要素は、作成の原因となったトークンの位置に置かれる空の範囲を持つ。
+
+	トークン化器が数える位置は改行文字の正規化後のコード・ポイント単位であるため、
+	入力位置との対応表を持ち、記録時に入力位置へ変換する。
+	対応表は同じ幅の文字が続く区間ごとに一つの記録を持ち、 ASCII のみの入力では記録は一つで済む。
+	バイト列は入力位置を得るため 1 バイトずつデコードするので、 ignore_source_ranges より解析が遅くなる。
+	*/
+	struct record_source_ranges
+	{
+		static bool constexpr enabled = true;
+
+		/*! @brief 対応表の記録
+
+		コード・ポイント位置 m_position 以降、一文字あたり m_width 要素ずつ入力位置が進む。
+		*/
+		struct checkpoint
+		{
+			std::uint32_t m_position;
+			std::uint32_t m_offset;
+			std::uint32_t m_width;
+		};
+
+		void clear()
+		{
+			m_ranges.clear();
+			m_checkpoints.assign(1, { 0, 0, 1 });
+			m_positions = 1;
+		}
+
+		/*! @brief コード・ポイント位置 n が入力位置 offset に当たることを記録する
+
+		n は 0 から順に与える。最後に記録した位置を再び与えた場合、記録を置き換える。
+		記録が無い位置は、コード・ポイント位置をそのまま入力位置とする。
+		*/
+		void map(std::uint32_t n, std::uint32_t offset)
+		{
+			if (n < m_positions)
+			{
+				m_positions = n;
+				if (!m_checkpoints.empty() && m_checkpoints.back().m_position == n) m_checkpoints.pop_back();
+			}
+
+			if (!m_checkpoints.empty())
+			{
+				checkpoint& c = m_checkpoints.back();
+				std::uint32_t d = n - c.m_position;
+				if (d == 1) c.m_width = offset - c.m_offset;
+				if (c.m_offset + d * c.m_width == offset)
+				{
+					m_positions = n + 1;
+					return;
+				}
+			}
+
+			m_checkpoints.push_back({ n, offset, 0 });
+			m_positions = n + 1;
+		}
+
+		/*! @brief 記録したコード・ポイント位置の数を返す */
+		std::uint32_t positions() const { return m_positions; }
+
+		/*! @brief コード・ポイント位置 n を入力位置へ変換する */
+		std::uint32_t offset(std::uint32_t n) const
+		{
+			auto it = std::upper_bound(m_checkpoints.begin(), m_checkpoints.end(), n,
+				[](std::uint32_t n, checkpoint const& c) { return n < c.m_position; });
+			if (it == m_checkpoints.begin()) return n;
+			--it;
+			return it->m_offset + (n - it->m_position) * it->m_width;
+		}
+
+		/*! @brief 格納位置 i のノードの範囲を返す
+
+		記録が無い場合、空の範囲を返す。
+		*/
+		source_range range(std::uint32_t i) const
+		{
+			return i < m_ranges.size() ? m_ranges[i] : source_range();
+		}
+
+		source_range& operator[](std::uint32_t i)
+		{
+			if (m_ranges.size() <= i) m_ranges.resize(i + 1);
+			return m_ranges[i];
+		}
+
+		/*! @brief 木コンテナの compact() が返す対応表で、範囲の添え字を付け替える
+
+		@param [in] map 旧格納位置を添え字とし、新格納位置を値とする対応表
+		*/
+		void remap(std::vector<std::uint32_t> const& map)
+		{
+			std::vector<source_range> ranges;
+			std::uint32_t n = static_cast<std::uint32_t>(std::min(m_ranges.size(), map.size()));
+			for (std::uint32_t i = 0; i < n; ++i)
+			{
+				std::uint32_t j = map[i];
+				if (j == 0) continue;
+				if (ranges.size() <= j) ranges.resize(j + 1);
+				ranges[j] = m_ranges[i];
+			}
+			m_ranges = std::move(ranges);
+		}
+
+		std::vector<source_range> m_ranges;
+
+		std::vector<checkpoint> m_checkpoints = { { 0, 0, 1 } };
+		std::uint32_t m_positions = 1;
+	};
+
+	/*! @brief 解析に用いる資源の上限
+
+	敵対的な文書に対してもパーサーの記憶域を予測可能とするために使う。
+	既定値はすべて上限なし。
+
+	- m_max_depth 上限を超えて入れ子になった要素は、上限の深さにある要素の子として平坦に挿入される。
+	  木の処理はそのまま続くため、文書の構造以外は変わらない
+	- m_max_nodes ノード数が上限に達した後のトークンは、 EOF を除きすべて捨てられる。
+	  上限に達したトークンの処理は最後まで行われるため、暗黙に作成される要素の分だけ上限を超えることがある
+	- m_max_attributes 上限を超える属性は、重複する属性と同じく無視される
+	- m_max_attribute_value_length 上限を超える属性値は、上限の長さ (コード・ポイント数) に切り詰められる
+	- m_max_text_bytes 文字とコメントの UTF-8 でのバイト数の合計。上限を超える文字トークンとコメント・トークンは捨てられる
+	*/
+	struct parse_limits
+	{
+		std::uint32_t m_max_depth                  = std::numeric_limits<std::uint32_t>::max();
+		std::uint64_t m_max_nodes                  = std::numeric_limits<std::uint64_t>::max();
+		std::uint32_t m_max_attributes             = std::numeric_limits<std::uint32_t>::max();
+		std::uint32_t m_max_attribute_value_length = std::numeric_limits<std::uint32_t>::max();
+		std::uint64_t m_max_text_bytes             = std::numeric_limits<std::uint64_t>::max();
+	};
+
+	/*! @brief 解析中に資源の上限に達したかを示す
+
+	それぞれ parse_limits の同名の上限に対応する。
+	*/
+	struct parse_limit_status
+	{
+		bool m_depth           = false;
+		bool m_nodes           = false;
+		bool m_attributes      = false;
+		bool m_attribute_value = false;
+		bool m_text            = false;
+
+		/*! @brief いずれかの上限に達し、文書が切り詰められた場合 true を返す */
+		bool truncated() const { return m_depth || m_nodes || m_attributes || m_attribute_value || m_text; }
+	};
+
+	/*! @brief basic_simple_parser::resume() が一度に行う仕事の量
+
+	いずれかに達すると resume() は戻る。
+	一つのコード・ポイントから複数のトークンが発送されることがあるため、トークン数は超えることがある。
+	*/
+	struct parse_budget
+	{
+		std::uint64_t m_tokens      = std::numeric_limits<std::uint64_t>::max();
+		std::uint64_t m_code_points = std::numeric_limits<std::uint64_t>::max();
+	};
+
+	/*! @brief 解析の計測結果
+
+	時間は steady_clock で測る。
+	挿入モードの時間と回数は、トークンが到着した時点の挿入モードに計上する。
+	再処理によって別の挿入モードへ渡された分も、到着時の挿入モードに含まれる。
+	*/
+	struct parse_statistics
+	{
+		/*! @brief 挿入モードの数 */
+		static std::size_t constexpr insertion_mode_count = 23;
+
+		/*! @brief アクティブ整形要素のリストに対する操作の種類の数 */
+		static std::size_t constexpr formatting_operation_count = 5;
+
+		/*! @brief 入力ストリームがトークン化器を呼び出した回数
+
+		コード・ポイントと EOF ごとに一回、またバッファに残った文字を再発送するごとに一回数える。
+		*/
+		std::uint64_t m_tokenizer_calls = 0;
+
+		std::uint64_t m_character_tokens   = 0;
+		std::uint64_t m_DOCTYPE_tokens     = 0;
+		std::uint64_t m_start_tag_tokens   = 0;
+		std::uint64_t m_end_tag_tokens     = 0;
+		std::uint64_t m_comment_tokens     = 0;
+		std::uint64_t m_end_of_file_tokens = 0;
+
+		/*! @brief 挿入モードごとのトークン数 */
+		std::array<std::uint64_t, insertion_mode_count> m_mode_tokens = {};
+
+		/*! @brief 挿入モードごとの木構築時間 */
+		std::array<std::chrono::nanoseconds, insertion_mode_count> m_mode_time = {};
+
+		/*! @brief 木構築時間の合計 */
+		std::chrono::nanoseconds m_tree_time = {};
+
+		/*! @brief 木構築を除いたトークン化時間 */
+		std::chrono::nanoseconds m_tokenizer_time = {};
+
+		/*! @brief オープン要素のスタックの最大の深さ */
+		std::uint32_t m_max_stack_depth = 0;
+
+		/*! @brief アクティブ整形要素のリストに対する操作の回数
+
+		push 、 push_marker 、 reconstruct 、 clear 、 adoption_agency の順に並ぶ。
+		*/
+		std::array<std::uint64_t, formatting_operation_count> m_formatting_operations = {};
+
+		/*! @brief 作成したノードの数
+
+		汎用の木コンテナではノードごとに記憶域を確保するため、確保回数の目安となる。
+		*/
+		std::uint64_t m_nodes_created = 0;
+	};
+
+	/*! @brief 計測を行わない計測方針
+
+	basic_simple_parser の既定。
+	*/
+	struct no_instrumentation
+	{
+		static bool constexpr enabled = false;
+
+		void clear() {}
+	};
+
+	/*! @brief 解析の計測結果を parse_statistics に集める計測方針
+
+	コード・ポイントとトークンごとに時刻を取得するため、解析は大きく遅くなる。
+	*/
+	struct collect_parse_statistics
+	{
+		static bool constexpr enabled = true;
+
+		void clear() { m_statistics = parse_statistics(); }
+
+		parse_statistics m_statistics;
+	};
+
 	/* @brief 文字エンコーディングに対応する HTML パーサー
 	* 
 	* @tparam Container 木コンテナ
 	* @tparam ForwardIterator 入力文字列に対するイテレータ
+	* @tparam ErrorPolicy 解析エラーの扱い。 ignore_parse_errors あるいは collect_parse_errors
+	* @tparam SourcePolicy ソース位置の扱い。 ignore_source_ranges あるいは record_source_ranges
+	* @tparam InstrumentationPolicy 計測の扱い。 no_instrumentation あるいは collect_parse_statistics
 	* 
 	* 木コンテナは、 wordring::tree と wordring::tag_tree でテストされています。
 	* 
-	* 文書内にエンコーディングの指定を発見した場合、入力文字列を最初から読み直します。
+	* エンコーディングの確かさが tentative の場合、解析前に BOM と先頭 1024 バイトを走査してエンコーディングを決定します。
+	* それ以降で異なるエンコーディングの指定を発見した場合、入力文字列を最初から読み直します。
+	* 入力は分割してデコードされるため、読み直しにかかる費用は発見までに解析した範囲に比例します。
 	*/
-	template <typename Container, typename ForwardIterator>
-	class basic_simple_parser : public simple_parser_base<basic_simple_parser<Container, ForwardIterator>, Container>
+	template <
+		typename Container,
+		typename ForwardIterator,
+		typename ErrorPolicy           = ignore_parse_errors,
+		typename SourcePolicy          = ignore_source_ranges,
+		typename InstrumentationPolicy = no_instrumentation>
+	class basic_simple_parser : public simple_parser_base<basic_simple_parser<Container, ForwardIterator, ErrorPolicy, SourcePolicy, InstrumentationPolicy>, Container>
 	{
 	public:
-		using base_type = simple_parser_base<basic_simple_parser<Container, ForwardIterator>, Container>;
-		using container = Container;
-		using iterator  = ForwardIterator;
+		using base_type              = simple_parser_base<basic_simple_parser<Container, ForwardIterator, ErrorPolicy, SourcePolicy, InstrumentationPolicy>, Container>;
+		using container              = Container;
+		using iterator               = ForwardIterator;
+		using error_policy           = ErrorPolicy;
+		using source_policy          = SourcePolicy;
+		using instrumentation_policy = InstrumentationPolicy;
+
+		using traits       = typename base_type::traits;
+		using node_pointer = typename base_type::node_pointer;
 
 		static_assert(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<iterator>::iterator_category>);
 
+		/*! @brief 一度にデコードするバイト数
+		*/
+		static std::uint32_t constexpr decode_chunk_length = 4096;
+
+		/*! @brief 文字エンコーディングの変更時に、最初から読み直す入力の上限 (バイト数)
+
+		meta 要素より前に ASCII 以外のバイトがあり、変換器をその場で切り替えられない場合、最初から解析し直す。
+		この上限より後で見つかった meta 要素による変更は無視し、それまでのエンコーディングを確定する。
+		*/
+		static std::uint32_t constexpr replay_buffer_length = 64 * 1024;
+
+		/*! @brief 入力ストリームに位置の追跡を求める
+		*/
+		static bool constexpr tracks_input_position = error_policy::enabled || source_policy::enabled;
+
+		static_assert(static_cast<std::size_t>(base_type::mode_name::after_after_frameset_insertion_mode) + 1 == parse_statistics::insertion_mode_count);
+
 	public:
 		/*! @brief パーサー・インスタンスを構築する
 		*
@@ -240,20 +677,105 @@ namespace wordring::html
 			encoding_name enc = static_cast<encoding_name>(0),
 			bool fragments_parser = false)
 			: base_type(confidence, enc, fragments_parser)
+			, m_default_encoding_name(enc)
+			, m_updated_encoding_name(static_cast<encoding_name>(0))
+			, m_reparse_count(0)
+			, m_current_tag(nullptr)
+			, m_current_is_end(false)
+			, m_node_count(0)
+			, m_text_bytes(0)
+			, m_token_count(0)
+			, m_pending_pos(0)
+			, m_consumed(0)
+			, m_input_position(0)
+			, m_input_cr(false)
+			, m_input_bom(false)
+			, m_ascii(0)
+			, m_decoding(false)
+			, m_finishing(false)
+			, m_finished(false)
+			, m_first()
+			, m_last()
+		{
+			if (fragments_parser) base_type::set_context(tag_name::Body);
+		}
+
+		/*! @brief 木コンテナのアロケータを指定してパーサー・インスタンスを構築する
+		*
+		* @param [in] alloc            木コンテナのアロケータ
+		* @param [in] confidence       エンコーディングの確かさ
+		* @param [in] enc              エンコーディング名
+		* @param [in] fragments_parser フラグメント・パーサーを構築する場合、 true を設定します
+		*
+		* 解析結果のノードは alloc から確保されます。
+		* get() で取り出す木コンテナも同じアロケータを持ちます。
+		*/
+		basic_simple_parser(
+			typename container::allocator_type const& alloc,
+			encoding_confidence_name confidence = encoding_confidence_name::irrelevant,
+			encoding_name enc = static_cast<encoding_name>(0),
+			bool fragments_parser = false)
+			: base_type(alloc, confidence, enc, fragments_parser)
+			, m_default_encoding_name(enc)
 			, m_updated_encoding_name(static_cast<encoding_name>(0))
+			, m_reparse_count(0)
+			, m_current_tag(nullptr)
+			, m_current_is_end(false)
+			, m_node_count(0)
+			, m_text_bytes(0)
+			, m_token_count(0)
+			, m_pending_pos(0)
+			, m_consumed(0)
+			, m_input_position(0)
+			, m_input_cr(false)
+			, m_input_bom(false)
+			, m_ascii(0)
+			, m_decoding(false)
+			, m_finishing(false)
+			, m_finished(false)
 			, m_first()
 			, m_last()
 		{
+			if (fragments_parser) base_type::set_context(tag_name::Body);
 		}
 
 		/*! @brief 初期状態に戻し、パーサーを再利用可能とする
+
+		フラグメント・パーサーとして構築した場合、 body 要素を文脈要素として断片の解析を開始し直す。
 		*/
 		void clear(encoding_confidence_name confidence, encoding_name enc)
 		{
-			base_type::clear(confidence, enc);
-			m_updated_encoding_name = static_cast<encoding_name>(0);
+			reset(confidence, enc);
+			if (base_type::m_fragments_parser) base_type::set_context(tag_name::Body);
+		}
+
+		/*! @brief 文脈要素を指定し、 HTML 断片の解析を開始する
+
+		@param [in] tag 文脈要素のタグ名
+		@param [in] ns  文脈要素の名前空間
+
+		@return 断片の根となる html 要素
+
+		解析前に呼び出す。
+		既に文脈要素が設定されている場合、初期状態に戻してから文脈要素を設定し直す。
+		*/
+		node_pointer set_context(tag_name tag, ns_name ns = ns_name::HTML)
+		{
+			if (base_type::m_context_entry.m_it != node_pointer()) reset(base_type::m_encoding_confidence, base_type::m_encoding_name);
+			return base_type::set_context(tag, ns);
 		}
 
+		/*! @brief 資源の上限を設定する
+
+		上限は clear() で初期化されず、以降の解析すべてに適用される。
+		*/
+		void set_limits(parse_limits const& limits) { m_limits = limits; }
+
+		parse_limits const& get_limits() const { return m_limits; }
+
+		/*! @brief 直前の解析で資源の上限に達したかを返す */
+		parse_limit_status const& limit_status() const { return m_limit_status; }
+
 		/*! @brief 文字列を解析し、 HTML 木を作成する
 		* 
 		* @param [in] first HTML ソース文字列の最初を指すイテレータ
@@ -267,6 +789,7 @@ namespace wordring::html
 			{
 				while (first != last)
 				{
+					if constexpr (source_policy::enabled) map_input_position(*first, ++m_input_position);
 					push_back(*first);
 					++first;
 				}
@@ -275,48 +798,880 @@ namespace wordring::html
 			{
 				std::u32string s;
 				encoding_cast(first, last, std::back_inserter(s));
-				for (char32_t cp : s) push_back(cp);
+				for (char32_t cp : s)
+				{
+					if constexpr (source_policy::enabled) map_input_position(cp, m_input_position += (cp < 0x10000 ? 1 : 2));
+					push_back(cp);
+				}
 			}
 			else if constexpr (sizeof(*first) == 1)
 			{
 				using namespace wordring::whatwg::encoding;
 
+				sniff_encoding(first, last);
+
 				text_decoder dec;
+				iterator    pos      = first; // デコードを始める位置
+				std::size_t consumed = 0;     // 解析したコード・ポイント数
+				std::size_t scanned  = 0;     // デコードしたバイト数
+				std::size_t ascii    = 0;     // 先頭から続く ASCII バイトの数
+				std::vector<std::uint32_t> ends; // ソース位置を記録する場合、各コード・ポイントが終わる入力位置
 			Start:
 				if (base_type::m_encoding_name == static_cast<encoding_name>(0)) base_type::m_encoding_name = encoding_name::UTF_8;
-				dec = text_decoder(base_type::m_encoding_name, false, false);
-				std::u32string s = dec.decode(first, last);
-				for (auto cp : s)
+				dec = text_decoder(base_type::m_encoding_name, false, source_policy::enabled || pos != first);
+				if constexpr (source_policy::enabled)
+				{
+					m_input_position = static_cast<std::uint32_t>(consumed);
+					m_input_bom      = pos == first;
+				}
+				// 分割してデコードし、再解析時に読み直す範囲を解析済みの部分までに抑える
+				for (iterator it = pos; ; )
 				{
-					base_type::push_code_point(cp);
-					if (m_updated_encoding_name != static_cast<encoding_name>(0))
+					iterator chunk = it;
+					for (std::uint32_t n = 0; n < decode_chunk_length && it != last; ++n, ++it, ++scanned)
+					{
+						if (ascii == scanned && static_cast<unsigned char>(*it) < 0x80) ++ascii;
+					}
+					bool stream = it != last;
+					ends.clear();
+					std::u32string s = decode(dec, chunk, it, stream, ends);
+					for (std::size_t i = 0; i < s.size(); ++i)
 					{
-						clear(base_type::m_encoding_confidence, m_updated_encoding_name);
-						goto Start;
+						if constexpr (source_policy::enabled) map_input_position(s[i], ends[i]);
+						base_type::push_code_point(s[i]);
+						++consumed;
+						if (m_updated_encoding_name == static_cast<encoding_name>(0)) continue;
+
+						encoding_name enc = std::exchange(m_updated_encoding_name, static_cast<encoding_name>(0));
+						if (consumed <= ascii && is_ascii_compatible(base_type::m_encoding_name) && is_ascii_compatible(enc))
+						{
+							// 解析済みの部分は ASCII のみで、どちらのエンコーディングでも同じ文字となるため、変換器をその場で切り替える
+							base_type::m_encoding_name = enc;
+							pos = std::next(first, consumed);
+							scanned = ascii = consumed;
+							goto Start;
+						}
+						if (scanned <= replay_buffer_length)
+						{
+							restart(enc);
+							pos = first;
+							consumed = scanned = ascii = 0;
+							goto Start;
+						}
+						// 読み直す範囲を超えた変更は無視する
 					}
+					if (!stream) break;
 				}
 			}
 			else assert(false);
 		}
 
-		container get()
+		/*! @brief 文字列を投機的に並列トークン化して解析し、 HTML 木を作成する
+
+		@param [in] first        HTML ソース文字列の最初を指すイテレータ
+		@param [in] last         HTML ソース文字列の終端を指すイテレータ
+		@param [in] threads      スレッド数。 0 の場合、 std::thread::hardware_concurrency() を用いる
+		@param [in] chunk_length 一つのスレッドが受け持つコード・ポイント数の目安
+
+		数メガバイトを超えるような大きな文書の解析時間を短縮するための、 parse() の代替。
+		入力全体をデコードした後、 wordring::whatwg::html::parsing::speculative_tokenize() でトークン化する。
+		作成される HTML 木は parse() と同じである。
+
+		再生したトークンは入力位置を進めないため、エラーを記録する場合、また計測する場合は並列化せずに解析する。
+		ソース位置を記録する場合、入力位置との対応を得るため parse() で解析する。
+
+		文書内の meta 要素によって文字エンコーディングが変更された場合、 parse() で解析し直す。
+
+		@sa wordring::whatwg::html::parsing::speculative_tokenize()
+		*/
+		void parse_speculative(
+			iterator      first,
+			iterator      last,
+			std::uint32_t threads      = 0,
+			std::uint32_t chunk_length = wordring::whatwg::html::parsing::speculative_chunk_length)
 		{
-			base_type::m_c.erase(base_type::m_temporary);
-			container c;
-			std::swap(base_type::m_c, c);
-			return c;
+			using namespace wordring::whatwg::encoding;
+
+			if constexpr (source_policy::enabled)
+			{
+				parse(first, last);
+				return;
+			}
+
+			std::u32string s;
+			if constexpr (sizeof(*first) == 4) s.assign(first, last);
+			else if constexpr (sizeof(*first) == 2) encoding_cast(first, last, std::back_inserter(s));
+			else if constexpr (sizeof(*first) == 1)
+			{
+				sniff_encoding(first, last);
+				if (base_type::m_encoding_name == static_cast<encoding_name>(0)) base_type::m_encoding_name = encoding_name::UTF_8;
+				s = text_decoder(base_type::m_encoding_name, false, false).decode(first, last, false);
+			}
+			else assert(false);
+
+			if constexpr (tracks_input_position || instrumentation_policy::enabled) threads = 1;
+			wordring::whatwg::html::parsing::speculative_tokenize(*this, s, threads, chunk_length);
+
+			if (m_updated_encoding_name != static_cast<encoding_name>(0))
+			{
+				restart(m_updated_encoding_name);
+				parse(first, last);
+			}
 		}
 
-		void push_back(char32_t cp) { base_type::push_code_point(cp); }
+		// ----------------------------------------------------------------------------------------
+		// 段階的な解析
+		// ----------------------------------------------------------------------------------------
 
-		void on_change_encoding(encoding_name name)
+		/*! @brief 入力の一部を追加する
+
+		@param [in] first 追加する入力の最初を指すイテレータ
+		@param [in] last  追加する入力の終端を指すイテレータ
+
+		到着した順に入力を追加し、 resume() で少しずつ解析する。
+		すべての入力を追加した後、 finish() を呼び出す。
+		parse() と混ぜて使ってはならない。
+
+		バイト列の場合、エンコーディングの確かさが tentative であれば、 meta 要素の走査のため先頭 1024 バイトが揃うまでデコードを待つ。
+		文書内の meta 要素によってエンコーディングが変更された場合に読み直すため、確かさが確定するまで受け取ったバイト列を保持する。
+		保持するバイト列が replay_buffer_length を超えた場合、それまでのエンコーディングを確定し、バイト列を捨てる。
+		UTF-16 の入力は、サロゲート・ペアの途中で区切ってはならない。
+		*/
+		void feed(iterator first, iterator last)
 		{
-			m_updated_encoding_name = name;
-		}
+			using namespace wordring::whatwg::encoding;
+
+			if constexpr (sizeof(*first) == 4)
+			{
+				std::size_t n = m_pending.size();
+				m_pending.append(first, last);
+				count_pending_ends(n);
+			}
+			else if constexpr (sizeof(*first) == 2)
+			{
+				std::size_t n = m_pending.size();
+				encoding_cast(first, last, std::back_inserter(m_pending));
+				count_pending_ends(n);
+			}
+			else if constexpr (sizeof(*first) == 1)
+			{
+				if (!m_decoding)
+				{
+					receive(first, last);
+					if (base_type::m_encoding_confidence != encoding_confidence_name::tentative || 1024 <= m_received.size()) start_decoding();
+				}
+				else
+				{
+					if (base_type::m_encoding_confidence == encoding_confidence_name::tentative) receive(first, last);
+					m_pending += decode(m_decoder, first, last, true, m_pending_ends);
+				}
+				if (m_decoding) release_received();
+			}
+			else assert(false);
+		}
+
+		/*! @brief 入力の終わりを通知する
+
+		残りの入力は、 resume() によって解析される。
+		*/
+		void finish()
+		{
+			if constexpr (sizeof(typename std::iterator_traits<iterator>::value_type) == 1)
+			{
+				if (!m_decoding) start_decoding();
+				m_pending += flush(m_decoder, m_pending_ends);
+			}
+			m_finishing = true;
+		}
+
+		/*! @brief 追加された入力を、予算の範囲で解析する
+
+		@param [in] budget 一度に行う仕事の量
+
+		@return 追加された入力をすべて解析した場合 true 、予算を使い切って中断した場合 false
+
+		中断した位置から再び呼び出すことで解析を続けられる。
+		戻った時点の木は get_document() から参照でき、 is_open() が false を返す要素は閉じている。
+		ただし、閉じた要素も養子縁組アルゴリズムや里親による挿入で後から移動されることがある。
+		finish() の後にすべての入力を解析すると、 EOF を送り、解析を終える。
+		*/
+		bool resume(parse_budget const& budget = parse_budget())
+		{
+			std::uint64_t tokens      = m_token_count;
+			std::uint64_t code_points = 0;
+
+			while (m_pending_pos < m_pending.size())
+			{
+				if (budget.m_tokens <= m_token_count - tokens || budget.m_code_points <= code_points) return false;
+
+				if constexpr (source_policy::enabled) map_input_position(m_pending[m_pending_pos], m_pending_ends[m_pending_pos]);
+				base_type::push_code_point(m_pending[m_pending_pos++]);
+				++m_consumed;
+				++code_points;
+				if (m_updated_encoding_name != static_cast<encoding_name>(0))
+				{
+					restart_decoding();
+					tokens = m_token_count;
+				}
+			}
+
+			m_pending.clear();
+			m_pending_ends.clear();
+			m_pending_pos = 0;
+			if (m_decoding) release_received();
+
+			if (m_finishing && !m_finished)
+			{
+				base_type::push_eof();
+				m_finished = true;
+			}
+
+			return true;
+		}
+
+		/*! @brief 要素がオープン要素のスタックにあり、まだ子を受け取る可能性があるか調べる
+		*/
+		bool is_open(node_pointer it) const { return base_type::m_stack.find(it) != base_type::m_stack.end(); }
+
+		/*! @brief finish() の後、すべての入力を解析し終えたか調べる */
+		bool finished() const { return m_finished; }
+
+		container get()
+		{
+			close_source_ranges();
+			base_type::m_c.erase(base_type::m_temporary);
+			container c;
+			std::swap(base_type::m_c, c);
+			return c;
+		}
+
+		/*! @brief 解析結果を利用者が用意した木コンテナへ取り出す
+
+		@param [in,out] c 解析結果を受け取る木コンテナ
+
+		c の内容は破棄され、その記憶域はパーサーが次の解析に用いる。
+		同じパーサーと木コンテナで解析を繰り返すと、記憶域を確保し直さずに済む。
+		次の解析の前に clear() を呼び出さなければならない。
+
+		HTML 断片を解析した場合、文書ノードと根の html 要素を取り除き、断片のノードを最上位に置く。
+		*/
+		void get(container& c)
+		{
+			close_source_ranges();
+			base_type::m_c.erase(base_type::m_temporary);
+
+			if (base_type::m_fragments_parser)
+			{
+				node_pointer doc = base_type::m_document;
+				for (auto it = doc.begin(); it != doc.end(); ++it)
+				{
+					if (!traits::is_element(it)) continue;
+					while (it.begin() != it.end()) base_type::m_c.move(base_type::m_c.end(), it.begin());
+					break;
+				}
+				base_type::m_c.erase(doc);
+			}
+
+			c.clear();
+			std::swap(base_type::m_c, c);
+		}
+
+		/*! @brief HTML 断片を解析し、利用者が用意した木コンテナへ取り出す
+
+		@param [in]     first   HTML ソース文字列の最初を指すイテレータ
+		@param [in]     last    HTML ソース文字列の終端を指すイテレータ
+		@param [out]    c       解析結果を受け取る木コンテナ
+		@param [in]     context 文脈要素のタグ名
+
+		断片は文字列として与えられるため、エンコーディングの確かさを irrelevant として解析する。
+		同じパーサーと木コンテナで繰り返し呼び出すことで、断片ごとの記憶域の確保を避けられる。
+
+		@sa https://html.spec.whatwg.org/multipage/parsing.html#parsing-html-fragments
+		*/
+		void parse_fragment(iterator first, iterator last, container& c, tag_name context = tag_name::Body)
+		{
+			reset(encoding_confidence_name::irrelevant, m_default_encoding_name);
+			base_type::set_context(context);
+			parse(first, last);
+			get(c);
+		}
+
+		/*! @brief 解析に用いた文字エンコーディングを返す
+
+		文書内の meta 要素によって変更された場合、変更後の文字エンコーディングを返す。
+		*/
+		encoding_name current_encoding() const { return base_type::m_encoding_name; }
+
+		/*! @brief 文字エンコーディングの確かさを返す */
+		encoding_confidence_name current_confidence() const { return base_type::m_encoding_confidence; }
+
+		/*! @brief 文書内の meta 要素による文字エンコーディングの変更で、最初から解析し直した回数を返す
+
+		変換器をその場で切り替えた場合は数えない。
+		*/
+		std::uint32_t reparse_count() const { return m_reparse_count; }
+
+		/*! @brief エラー方針を返す
+
+		collect_parse_errors の場合、 m_errors から解析エラーを取り出せる。
+		*/
+		error_policy& get_error_policy() { return m_error_policy; }
+
+		error_policy const& get_error_policy() const { return m_error_policy; }
+
+		/*! @brief ソース位置方針を返す
+
+		record_source_ranges の場合、 get() で取り出した木コンテナの index() を添え字としてノードの範囲を引ける。
+		木コンテナの compact() を呼び出した場合、戻り値を record_source_ranges::remap() に渡す。
+		*/
+		source_policy& get_source_policy() { return m_source_policy; }
+
+		source_policy const& get_source_policy() const { return m_source_policy; }
+
+		/*! @brief 計測方針を返す
+
+		collect_parse_statistics の場合、 m_statistics から計測結果を取り出せる。
+		*/
+		instrumentation_policy& get_instrumentation_policy() { return m_instrumentation_policy; }
+
+		instrumentation_policy const& get_instrumentation_policy() const { return m_instrumentation_policy; }
+
+		void push_back(char32_t cp) { base_type::push_code_point(cp); }
+
+		/*! @brief 解析エラーを、現在の入力文字の位置とともにエラー方針へ渡す
+		*/
+		void on_report_error(error_name e)
+		{
+			if constexpr (error_policy::enabled) m_error_policy.report({ e, base_type::current_position() });
+		}
+
+		void on_change_encoding(encoding_name name)
+		{
+			m_updated_encoding_name = name;
+		}
+
+		/*! @brief トークン化器から呼び出され、資源の上限を適用し、トークンを計測してから木構築段階へ渡す
+		*/
+		template <typename Token>
+		void on_emit_token(Token& token)
+		{
+			++m_token_count;
+			if (!apply_limits(token)) return;
+
+			if constexpr (instrumentation_policy::enabled)
+			{
+				using namespace wordring::whatwg::html::parsing;
+
+				parse_statistics& st = m_instrumentation_policy.m_statistics;
+
+				if constexpr (std::is_same_v<Token, character_token>) ++st.m_character_tokens;
+				else if constexpr (std::is_same_v<Token, DOCTYPE_token>) ++st.m_DOCTYPE_tokens;
+				else if constexpr (std::is_same_v<Token, start_tag_token>) ++st.m_start_tag_tokens;
+				else if constexpr (std::is_same_v<Token, end_tag_token>) ++st.m_end_tag_tokens;
+				else if constexpr (std::is_same_v<Token, comment_token>) ++st.m_comment_tokens;
+				else if constexpr (std::is_same_v<Token, end_of_file_token>) ++st.m_end_of_file_tokens;
+
+				std::size_t mode = static_cast<std::size_t>(base_type::m_insertion_mode);
+				auto start = std::chrono::steady_clock::now();
+				construct_tree(token);
+				std::chrono::nanoseconds d = std::chrono::steady_clock::now() - start;
+				st.m_mode_time[mode] += d;
+				st.m_tree_time += d;
+				++st.m_mode_tokens[mode];
+
+				record_stack_depth();
+			}
+			else construct_tree(token);
+		}
+
+		/*! @brief 入力ストリームから呼び出され、コード・ポイントをトークン化器へ渡す
+		*/
+		void on_emit_code_point()
+		{
+			if constexpr (instrumentation_policy::enabled)
+			{
+				parse_statistics& st = m_instrumentation_policy.m_statistics;
+
+				++st.m_tokenizer_calls;
+				auto start = std::chrono::steady_clock::now();
+				std::chrono::nanoseconds tree = st.m_tree_time;
+				base_type::on_emit_code_point();
+				// 木構築に費やした時間を除く
+				st.m_tokenizer_time += (std::chrono::steady_clock::now() - start) - (st.m_tree_time - tree);
+			}
+			else base_type::on_emit_code_point();
+		}
+
+		void on_formatting_operation(typename base_type::formatting_operation_name op)
+		{
+			if constexpr (instrumentation_policy::enabled) ++m_instrumentation_policy.m_statistics.m_formatting_operations[static_cast<std::size_t>(op)];
+		}
+
+		void on_insert_node(node_pointer it)
+		{
+			if (++m_node_count >= m_limits.m_max_nodes) m_limit_status.m_nodes = true;
+			if (traits::is_element(it) && m_limits.m_max_depth < base_type::m_stack.size()) m_limit_status.m_depth = true;
+
+			if constexpr (instrumentation_policy::enabled) ++m_instrumentation_policy.m_statistics.m_nodes_created;
+
+			if constexpr (source_policy::enabled)
+			{
+				std::uint32_t begin = m_source_policy.offset(base_type::token_begin());
+				std::uint32_t end   = m_source_policy.offset(base_type::current_position().m_offset + 1);
+				// 暗黙に作成された要素
+				if (traits::is_element(it) && !(m_current_tag && !m_current_is_end && is_current_tag(it))) end = begin;
+				m_source_policy[base_type::m_c.index(it)] = { begin, end };
+			}
+		}
+
+		void on_append_text(node_pointer it)
+		{
+			if constexpr (source_policy::enabled)
+			{
+				m_source_policy[base_type::m_c.index(it)].m_end = m_source_policy.offset(base_type::current_position().m_offset + 1);
+			}
+		}
+
+		void on_pop_element(node_pointer it)
+		{
+			if constexpr (instrumentation_policy::enabled) record_stack_depth();
+
+			if constexpr (source_policy::enabled)
+			{
+				// 対応する終了タグ、あるいは空要素が自身の開始タグで閉じられた場合はその「>」の直後まで、
+				// その他の場合は閉じる原因となったトークンの直前まで
+				source_range& r = m_source_policy[base_type::m_c.index(it)];
+				std::uint32_t begin = m_source_policy.offset(base_type::token_begin());
+				bool closed = m_current_tag && is_current_tag(it) && (m_current_is_end || r.m_begin == begin);
+				std::uint32_t end = closed ? m_source_policy.offset(base_type::current_position().m_offset + 1) : begin;
+				r.m_end = std::max(r.m_begin, end);
+			}
+		}
+
+		std::uint32_t open_element_depth_limit() const { return m_limits.m_max_depth; }
 
 	protected:
+		/*! @brief feed() で受け取ったバイト列から文字エンコーディングを決定し、デコードを始める
+		*/
+		void start_decoding()
+		{
+			using namespace wordring::whatwg::encoding;
+
+			sniff_encoding(m_received.cbegin(), m_received.cend());
+			if (base_type::m_encoding_name == static_cast<encoding_name>(0)) base_type::m_encoding_name = encoding_name::UTF_8;
+
+			m_decoder = text_decoder(base_type::m_encoding_name, false, source_policy::enabled);
+			if constexpr (source_policy::enabled)
+			{
+				m_input_position = 0;
+				m_input_bom      = true;
+			}
+			m_pending += decode(m_decoder, m_received.cbegin(), m_received.cend(), !m_finishing, m_pending_ends);
+			m_decoding = true;
+			if (base_type::m_encoding_confidence != encoding_confidence_name::tentative) m_received.clear();
+		}
+
+		/*! @brief feed() で受け取ったバイト列を、読み直しに備えて保持する
+		*/
+		void receive(iterator first, iterator last)
+		{
+			m_received.append(first, last);
+			count_ascii();
+		}
+
+		/*! @brief m_received の先頭から続く ASCII バイトを数える
+		*/
+		void count_ascii()
+		{
+			while (m_ascii < m_received.size() && static_cast<unsigned char>(m_received[m_ascii]) < 0x80) ++m_ascii;
+		}
+
+		/*! @brief 読み直しに備えて保持するバイト列が不要になった場合、あるいは上限を超えた場合に捨てる
+
+		上限を超えた場合、それ以降の meta 要素による変更を受け付けないよう、エンコーディングを確定する。
+		*/
+		void release_received()
+		{
+			if (base_type::m_encoding_confidence == encoding_confidence_name::tentative)
+			{
+				if (m_received.size() <= replay_buffer_length) return;
+				base_type::m_encoding_confidence = encoding_confidence_name::certain;
+			}
+			m_received.clear();
+			m_ascii = 0;
+		}
+
+		/*! @brief 文書内の meta 要素によって変更されたエンコーディングで、受け取ったバイト列を読み直す
+
+		解析済みの部分が ASCII のみであれば、未解析の部分だけを新しいエンコーディングでデコードし直す。
+		そうでなければ、最初から解析し直す。
+		*/
+		void restart_decoding()
+		{
+			using namespace wordring::whatwg::encoding;
+
+			encoding_name enc = std::exchange(m_updated_encoding_name, static_cast<encoding_name>(0));
+			if (m_consumed <= m_ascii && is_ascii_compatible(base_type::m_encoding_name) && is_ascii_compatible(enc))
+			{
+				base_type::m_encoding_name = enc;
+				m_decoder = text_decoder(enc, false, true);
+				m_pending.erase(m_pending_pos);
+				if constexpr (source_policy::enabled)
+				{
+					m_pending_ends.resize(m_pending_pos);
+					m_input_position = static_cast<std::uint32_t>(m_consumed);
+					m_input_bom      = false;
+				}
+				m_pending += decode(m_decoder, std::next(m_received.cbegin(), m_consumed), m_received.cend(), !m_finishing, m_pending_ends);
+				return;
+			}
+
+			std::string received;
+			std::swap(received, m_received);
+			bool finishing = m_finishing;
+
+			restart(enc);
+
+			std::swap(received, m_received);
+			m_finishing = finishing;
+			count_ascii();
+			start_decoding();
+		}
+
+		/*! @brief バイト列をデコードする
+
+		ソース位置を記録する場合、入力位置との対応を得るため 1 バイトずつデコードし、
+		取り出したコード・ポイントが終わる入力位置を ends へ追加する。
+		BOM はデコーダに取り除かせず、ここで取り除いて文書の始まりを BOM の直後に置く。
+		*/
+		template <typename InputIterator>
+		std::u32string decode(
+			wordring::whatwg::encoding::text_decoder& dec, InputIterator first, InputIterator last, bool stream, std::vector<std::uint32_t>& ends)
+		{
+			if constexpr (source_policy::enabled)
+			{
+				std::u32string s;
+				for (; first != last; ++first)
+				{
+					std::uint32_t pos = m_input_position++;
+					std::u32string cps = dec.decode(first, std::next(first), true);
+					if (m_input_bom && !cps.empty())
+					{
+						m_input_bom = false;
+						if (cps.front() == U'\xFEFF' && has_byte_order_mark(base_type::m_encoding_name))
+						{
+							cps.erase(0, 1);
+							m_source_policy.map(0, pos + 1);
+						}
+					}
+					append_ends(cps.size(), pos, pos + 1, ends);
+					s += cps;
+				}
+				if (!stream) s += flush(dec, ends);
+				return s;
+			}
+			else return dec.decode(first, last, stream);
+		}
+
+		/*! @brief デコーダに残るバイト列を取り出す
+		*/
+		std::u32string flush(wordring::whatwg::encoding::text_decoder& dec, std::vector<std::uint32_t>& ends)
+		{
+			std::u32string s = dec.decode();
+			if constexpr (source_policy::enabled) append_ends(s.size(), m_input_position, m_input_position, ends);
+			return s;
+		}
+
+		/*! @brief 一度のデコードで取り出した n 個のコード・ポイントが終わる入力位置を ends へ追加する
+
+		最後のコード・ポイントは end で終わる。
+		不正なバイト列の後に続くバイトを読み直した場合など、それより前のコード・ポイントはデコードしたバイトの直前 pos で終わる。
+		*/
+		static void append_ends(std::size_t n, std::uint32_t pos, std::uint32_t end, std::vector<std::uint32_t>& ends)
+		{
+			for (std::size_t i = 1; i < n; ++i) ends.push_back(pos);
+			if (n != 0) ends.push_back(end);
+		}
+
+		/*! @brief m_pending の位置 i 以降に追加したコード・ポイントが終わる入力位置を、入力の要素単位で数える
+		*/
+		void count_pending_ends(std::size_t i)
+		{
+			if constexpr (source_policy::enabled)
+			{
+				for (; i < m_pending.size(); ++i)
+				{
+					bool pair = sizeof(typename std::iterator_traits<iterator>::value_type) == 2 && 0x10000 <= m_pending[i];
+					m_pending_ends.push_back(m_input_position += (pair ? 2 : 1));
+				}
+			}
+		}
+
+		/*! @brief デコーダが先頭の BOM を取り除くエンコーディングか調べる
+		*/
+		static bool has_byte_order_mark(encoding_name enc)
+		{
+			return enc == encoding_name::UTF_8 || enc == encoding_name::UTF_16BE || enc == encoding_name::UTF_16LE;
+		}
+
+		/*! @brief 次に入力ストリームへ渡すコード・ポイントが、入力位置 end で終わることを記録する
+
+		CR に続く LF は改行文字の正規化で CR とともに一文字となるため、 CR の終わりを置き換える。
+		*/
+		void map_input_position(char32_t cp, std::uint32_t end)
+		{
+			std::uint32_t n = m_source_policy.positions();
+			if (m_input_cr && cp == U'\n') --n;
+			m_source_policy.map(n, end);
+			m_input_cr = cp == U'\r';
+		}
+
+		/*! @brief 文脈要素を設定せずに初期状態へ戻す
+		*/
+		void reset(encoding_confidence_name confidence, encoding_name enc)
+		{
+			base_type::clear(confidence, enc);
+			m_updated_encoding_name = static_cast<encoding_name>(0);
+			m_reparse_count         = 0;
+			m_error_policy.clear();
+			m_source_policy.clear();
+			m_instrumentation_policy.clear();
+			m_limit_status = parse_limit_status();
+			m_node_count   = 0;
+			m_text_bytes   = 0;
+			m_token_count  = 0;
+
+			m_pending.clear();
+			m_pending_pos = 0;
+			m_consumed    = 0;
+			m_input_position = 0;
+			m_input_cr       = false;
+			m_input_bom      = false;
+			m_pending_ends.clear();
+			m_received.clear();
+			m_ascii       = 0;
+			m_decoding  = false;
+			m_finishing = false;
+			m_finished  = false;
+		}
+
+		/*! @brief 変更されたエンコーディングで最初から解析し直すため、状態を初期化する
+
+		HTML 断片を解析している場合、同じ名前の文脈要素を作り直し、断片の解析を続ける。
+		*/
+		void restart(encoding_name enc)
+		{
+			std::uint32_t n = m_reparse_count;
+
+			bool fragment = base_type::m_fragments_parser;
+			tag_name tag  = static_cast<tag_name>(0);
+			ns_name  ns   = static_cast<ns_name>(0);
+			if (fragment)
+			{
+				node_pointer context = base_type::m_context_entry.m_it;
+				tag = traits::get_local_name_name(context);
+				ns  = traits::get_namespace_name(context);
+			}
+
+			reset(base_type::m_encoding_confidence, enc);
+			if (fragment) base_type::set_context(tag, ns);
+			m_reparse_count = n + 1;
+		}
+
+		/*! @brief ASCII のバイトを ASCII の文字へデコードするエンコーディングか調べる
+		*/
+		static bool is_ascii_compatible(encoding_name enc)
+		{
+			switch (enc)
+			{
+			case encoding_name::UTF_16BE: case encoding_name::UTF_16LE: case encoding_name::ISO_2022_JP: case encoding_name::replacement:
+				return false;
+			default:
+				break;
+			}
+
+			return true;
+		}
+
+		/*! @brief トークンに資源の上限を適用する
+
+		@return トークンを木構築段階へ渡す場合 true 、捨てる場合 false
+		*/
+		template <typename Token>
+		bool apply_limits(Token& token)
+		{
+			using namespace wordring::whatwg::html::parsing;
+
+			if constexpr (std::is_same_v<Token, end_of_file_token>) return true;
+			else
+			{
+				if (m_limit_status.m_nodes) return false;
+
+				if constexpr (std::is_same_v<Token, character_token>) return count_text(utf8_length(token.m_data));
+				else if constexpr (std::is_same_v<Token, comment_token>)
+				{
+					std::uint64_t n = 0;
+					for (char32_t cp : token.m_data) n += utf8_length(cp);
+					return count_text(n);
+				}
+				else if constexpr (std::is_same_v<Token, start_tag_token>)
+				{
+					std::uint32_t n = 0;
+					for (token_attribute& a : token.m_attributes)
+					{
+						if (a.m_omitted) continue;
+						if (m_limits.m_max_attributes <= n)
+						{
+							a.m_omitted = true;
+							m_limit_status.m_attributes = true;
+							continue;
+						}
+						++n;
+						if (m_limits.m_max_attribute_value_length < a.m_value.size())
+						{
+							a.m_value.resize(m_limits.m_max_attribute_value_length);
+							m_limit_status.m_attribute_value = true;
+						}
+					}
+				}
+
+				return true;
+			}
+		}
+
+		/*! @brief 文字数の上限に照らして、 n バイトのテキストを受け入れるか調べる
+		*/
+		bool count_text(std::uint64_t n)
+		{
+			if (m_limits.m_max_text_bytes - m_text_bytes < n)
+			{
+				m_limit_status.m_text = true;
+				return false;
+			}
+			m_text_bytes += n;
+			return true;
+		}
+
+		static std::uint32_t utf8_length(char32_t cp)
+		{
+			return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+		}
+
+		/*! @brief 処理中のタグ・トークンを覚えてから木構築段階へ渡す
+		*/
+		template <typename Token>
+		void construct_tree(Token& token)
+		{
+			if constexpr (source_policy::enabled && std::is_base_of_v<wordring::whatwg::html::parsing::tag_token, Token>)
+			{
+				m_current_tag    = &token;
+				m_current_is_end = std::is_same_v<Token, wordring::whatwg::html::parsing::end_tag_token>;
+				base_type::on_emit_token(token);
+				m_current_tag = nullptr;
+			}
+			else base_type::on_emit_token(token);
+		}
+
+		void record_stack_depth()
+		{
+			parse_statistics& st = m_instrumentation_policy.m_statistics;
+			st.m_max_stack_depth = std::max(st.m_max_stack_depth, static_cast<std::uint32_t>(base_type::m_stack.size()));
+		}
+
+		/*! @brief 要素の名前が処理中のタグ・トークンと等しいか調べる
+		*/
+		bool is_current_tag(node_pointer it) const
+		{
+			if (m_current_tag->m_tag_name_id != static_cast<tag_name>(0)) return m_current_tag->m_tag_name_id == traits::get_local_name_name(it);
+			return encoding_cast<std::u32string>(traits::get_local_name(it)) == m_current_tag->m_tag_name;
+		}
+
+		/*! @brief オープン要素のスタックに残る要素の範囲を、消費済みの入力の終わりまでとする
+
+		parse() は EOF を送らないため、木を取り出す前に呼び出す。
+		*/
+		void close_source_ranges()
+		{
+			if constexpr (source_policy::enabled)
+			{
+				for (auto const& entry : base_type::m_stack)
+				{
+					m_source_policy[base_type::m_c.index(entry.m_it)].m_end = m_source_policy.offset(base_type::m_next_position.m_offset);
+				}
+			}
+		}
+
+		/*! @brief 解析前に BOM と文書先頭の meta 要素から文字エンコーディングを決定し、再解析を避ける
+		*/
+		template <typename InputIterator>
+		void sniff_encoding(InputIterator first, InputIterator last)
+		{
+			using namespace wordring::whatwg::html::parsing;
+
+			if (base_type::m_encoding_confidence != encoding_confidence_name::tentative) return;
+
+			if (encoding_name enc = sniff_byte_order_mark(first, last); enc != static_cast<encoding_name>(0))
+			{
+				base_type::m_encoding_name       = enc;
+				base_type::m_encoding_confidence = encoding_confidence_name::certain;
+			}
+			else if (encoding_name enc = prescan_byte_stream(first, last); enc != static_cast<encoding_name>(0))
+			{
+				base_type::m_encoding_name = enc;
+			}
+		}
+
+	protected:
+		error_policy  m_error_policy;
+		source_policy m_source_policy;
+
+		instrumentation_policy m_instrumentation_policy;
+
+		/*! @brief 構築時のエンコーディング名 */
+		encoding_name m_default_encoding_name;
+
 		encoding_name m_updated_encoding_name;
 
+		std::uint32_t m_reparse_count;
+
+		/*! @brief 木構築段階で処理中のタグ・トークン。ソース位置を記録する場合のみ設定される */
+		wordring::whatwg::html::parsing::tag_token const* m_current_tag;
+		bool m_current_is_end;
+
+		parse_limits       m_limits;
+		parse_limit_status m_limit_status;
+		std::uint64_t      m_node_count;
+		std::uint64_t      m_text_bytes;
+
+		/*! @brief 木構築段階へ渡したトークンの数 */
+		std::uint64_t m_token_count;
+
+		/*! @brief feed() で受け取り、まだ解析していないコード・ポイント */
+		std::u32string m_pending;
+		std::size_t    m_pending_pos;
+		/*! @brief デコードを始めてから解析したコード・ポイントの数 */
+		std::size_t    m_consumed;
+
+		/*! @brief デコーダあるいは入力ストリームへ渡した入力の終わりの位置。ソース位置を記録する場合のみ用いる */
+		std::uint32_t m_input_position;
+		/*! @brief 直前に入力ストリームへ渡したコード・ポイントが CR か */
+		bool m_input_cr;
+		/*! @brief デコーダに代わって先頭の BOM を取り除くか。ソース位置を記録する場合のみ用いる */
+		bool m_input_bom;
+		/*! @brief m_pending の各コード・ポイントが終わる入力位置。ソース位置を記録する場合のみ用いる */
+		std::vector<std::uint32_t> m_pending_ends;
+
+		/*! @brief feed() で受け取ったバイト列。エンコーディングが確定するまで保持する */
+		std::string m_received;
+		/*! @brief m_received の先頭から続く ASCII バイトの数 */
+		std::size_t m_ascii;
+
+		wordring::whatwg::encoding::text_decoder m_decoder;
+
+		bool m_decoding;
+		bool m_finishing;
+		bool m_finished;
+
 		iterator m_first;
 		iterator m_last;
 	};
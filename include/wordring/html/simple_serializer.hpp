@@ -0,0 +1,418 @@
+﻿#pragma once
+
+// https://html.spec.whatwg.org/multipage/parsing.html#serialising-html-fragments
+// https://triple-underscore.github.io/HTML-writing-ja.html#serialising-html-fragments
+
+#include <wordring/html/simple_node.hpp>
+
+#include <wordring/html/html_defs.hpp>
+
+#include <wordring/tag_tree/serial_iterator.hpp>
+#include <wordring/tag_tree/tag_tree_iterator.hpp>
+
+#include <wordring/whatwg/html/parsing/atom_tbl.hpp>
+#include <wordring/whatwg/infra/unicode.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+namespace wordring::html::detail
+{
+	/*! @brief 出力イテレータが書き込む文字の型
+
+	std::back_insert_iterator<> の場合、 container_type::value_type を参照する。
+	*/
+	template <typename OutputIterator, typename = void>
+	struct simple_output_character
+	{
+		using type = typename std::iterator_traits<OutputIterator>::value_type;
+	};
+
+	template <typename OutputIterator>
+	struct simple_output_character<OutputIterator, std::void_t<typename OutputIterator::container_type>>
+	{
+		using type = typename OutputIterator::container_type::value_type;
+	};
+
+	/*! @brief 直列化の出力先。文字列の末尾へ追加する
+	*/
+	template <typename String>
+	class simple_string_sink
+	{
+	public:
+		using string_type    = String;
+		using character_type = typename string_type::value_type;
+
+	public:
+		explicit simple_string_sink(string_type& s) : m_s(s) {}
+
+		/*! @brief 木の文字エンコーディングの文字列を追加する */
+		void append(character_type const* first, character_type const* last) { m_s.append(first, last); }
+
+		void append(string_type const& s) { m_s.append(s); }
+
+		/*! @brief ASCII のみから成る、ヌル終端の文字列を追加する */
+		template <typename Character>
+		void ascii(Character const* s)
+		{
+			for (; *s != 0; ++s) m_s.push_back(static_cast<character_type>(*s));
+		}
+
+	protected:
+		string_type& m_s;
+	};
+
+	/*! @brief 直列化の出力先。出力イテレータへ書き込む
+
+	出力イテレータの文字の大きさが木の文字列と同じ場合、変換せずに複写する。
+	異なる場合、コード・ポイントを介して文字エンコーディングを変換する。
+	*/
+	template <typename String, typename OutputIterator>
+	class simple_iterator_sink
+	{
+	public:
+		using string_type    = String;
+		using character_type = typename string_type::value_type;
+		using output_type    = typename simple_output_character<OutputIterator>::type;
+
+	public:
+		explicit simple_iterator_sink(OutputIterator out) : m_out(out) {}
+
+		void append(character_type const* first, character_type const* last)
+		{
+			if constexpr (sizeof(output_type) == sizeof(character_type)) m_out = std::copy(first, last, m_out);
+			else wordring::whatwg::encoding_cast(first, last, m_out);
+		}
+
+		void append(string_type const& s) { append(s.data(), s.data() + s.size()); }
+
+		template <typename Character>
+		void ascii(Character const* s)
+		{
+			for (; *s != 0; ++s) *m_out++ = static_cast<output_type>(*s);
+		}
+
+	protected:
+		OutputIterator m_out;
+	};
+
+	/*! @brief 8 バイト中に c と等しいバイトが有るか調べる
+
+	@param [in] x 調べる 8 バイト
+	@param [in] c 探すバイトを 8 個並べた値
+	*/
+	inline bool simple_has_byte(std::uint64_t x, std::uint64_t c)
+	{
+		std::uint64_t v = x ^ c;
+		return ((v - 0x0101010101010101ull) & ~v & 0x8080808080808080ull) != 0;
+	}
+
+	/*! @brief 文字参照へ置き換える必要の有る文字か調べる
+
+	UTF-8 の場合、 NO-BREAK SPACE の先頭バイト 0xC2 を候補として返す。
+	*/
+	template <bool AttributeMode, typename Character>
+	inline bool is_simple_escape(Character ch)
+	{
+		std::uint32_t c = static_cast<std::make_unsigned_t<Character>>(ch);
+
+		if (c == U'&' || c == (sizeof(Character) == 1 ? 0xC2u : 0xA0u)) return true;
+		if constexpr (AttributeMode) return c == U'"';
+		else return c == U'<' || c == U'>';
+	}
+
+	/*! @brief 文字参照へ置き換える必要の有る最初の文字を探す
+
+	@return 見つからない場合 last
+
+	UTF-8 の場合、 8 バイトずつ読み、候補のバイトが無いブロックを一度に読み飛ばす。
+	*/
+	template <bool AttributeMode, typename Character>
+	inline Character const* find_simple_escape(Character const* first, Character const* last)
+	{
+		if constexpr (sizeof(Character) == 1)
+		{
+			std::uint64_t constexpr ones = 0x0101010101010101ull;
+
+			while (8 <= last - first)
+			{
+				std::uint64_t x;
+				std::memcpy(&x, first, 8);
+
+				bool found = simple_has_byte(x, ones * '&') || simple_has_byte(x, ones * 0xC2u);
+				if constexpr (AttributeMode) found = found || simple_has_byte(x, ones * '"');
+				else found = found || simple_has_byte(x, ones * '<') || simple_has_byte(x, ones * '>');
+				if (found) break;
+
+				first += 8;
+			}
+		}
+
+		for (; first != last; ++first) if (is_simple_escape<AttributeMode>(*first)) break;
+
+		return first;
+	}
+
+	/*! @brief 文字列をエスケープして出力する
+
+	@sa https://html.spec.whatwg.org/multipage/parsing.html#escapingString
+	@sa https://triple-underscore.github.io/HTML-writing-ja.html#escapingString
+	*/
+	template <bool AttributeMode, typename Character, typename Sink>
+	inline void simple_escape_string(Character const* first, Character const* last, Sink& sink)
+	{
+		using unsigned_type = std::make_unsigned_t<Character>;
+
+		Character const* run = first; // まだ出力していない区間の先頭
+
+		while (true)
+		{
+			Character const* it = find_simple_escape<AttributeMode>(first, last);
+			if (it == last) break;
+
+			std::uint32_t c = static_cast<unsigned_type>(*it);
+			first = it + 1;
+
+			// UTF-8 の 0xC2 は、 NO-BREAK SPACE 以外の文字の先頭バイトでもある
+			if (c == 0xC2u)
+			{
+				if (first == last || static_cast<unsigned_type>(*first) != 0xA0u) continue;
+				++first;
+			}
+
+			sink.append(run, it);
+			switch (c)
+			{
+			case U'&': sink.ascii("&amp;"); break;
+			case U'"': sink.ascii("&quot;"); break;
+			case U'<': sink.ascii("&lt;"); break;
+			case U'>': sink.ascii("&gt;"); break;
+			case 0xA0u: case 0xC2u: sink.ascii("&nbsp;"); break;
+			default:
+				assert(false);
+				break;
+			}
+			run = first;
+		}
+
+		sink.append(run, last);
+	}
+
+	/*! @brief VOIDとして直列化する要素か調べる
+
+	@sa wordring::whatwg::html::serializes_as_void()
+	*/
+	template <typename String>
+	inline bool simple_serializes_as_void(simple_node<String> const& node)
+	{
+		if (!node.is_element() || node.namespace_uri_name() != ns_name::HTML) return false;
+
+		switch (node.local_name_name())
+		{
+		case tag_name::Area:     case tag_name::Base:    case tag_name::Br:    case tag_name::Col:
+		case tag_name::Embed:    case tag_name::Hr:      case tag_name::Img:   case tag_name::Input:
+		case tag_name::Link:     case tag_name::Meta:    case tag_name::Param: case tag_name::Source:
+		case tag_name::Track:    case tag_name::Wbr:
+		case tag_name::Basefont: case tag_name::Bgsound: case tag_name::Frame: case tag_name::Keygen:
+			return true;
+		default:
+			break;
+		}
+
+		return false;
+	}
+
+	template <typename String, typename Sink>
+	inline void simple_tag_name(simple_node<String> const& node, Sink& sink)
+	{
+		using namespace wordring::whatwg::html::parsing;
+
+		ns_name ns = node.namespace_uri_name();
+		if (ns == ns_name::HTML || ns == ns_name::MathML || ns == ns_name::SVG)
+		{
+			tag_name tag = node.local_name_name();
+			if (tag != static_cast<tag_name>(0)) sink.ascii(tag_name_tbl[static_cast<std::uint32_t>(tag)].c_str());
+			else sink.append(node.local_name());
+		}
+		else sink.append(node.qualified_name());
+	}
+
+	template <typename String, typename Sink>
+	inline void simple_attribute_name(simple_attr<String> const& attr, Sink& sink)
+	{
+		using namespace wordring::whatwg::html::parsing;
+
+		auto local_name = [&]() {
+			attribute_name name = attr.local_name_name();
+			if (name != static_cast<attribute_name>(0)) sink.ascii(attribute_name_tbl[static_cast<std::uint32_t>(name)].c_str());
+			else sink.append(attr.local_name());
+		};
+
+		ns_name ns = attr.namespace_uri_name();
+		if (ns == static_cast<ns_name>(0))
+		{
+			local_name();
+			return;
+		}
+
+		switch (ns)
+		{
+		case ns_name::XML:
+			sink.ascii("xml:");
+			local_name();
+			return;
+		case ns_name::XMLNS:
+			if (attr.local_name_name() == attribute_name::Xmlns)
+			{
+				sink.ascii("xmlns");
+				return;
+			}
+			sink.ascii("xmlns:");
+			local_name();
+			return;
+		case ns_name::XLink:
+			sink.ascii("xlink:");
+			local_name();
+			return;
+		default:
+			sink.append(attr.qualified_name());
+			return;
+		}
+	}
+
+	/*! @brief tag_tree の子孫を行きがかり順に直列化する
+
+	tag_tree は要素の終了タグ相当の位置を連結リストに持つため、行きがかり順のイテレータで前から辿るだけで開始タグと終了タグを出力できる。
+	スタックを持たず、親は格納されている添え字から求める。
+	*/
+	template <typename String, typename Allocator, typename Sink>
+	inline void serialize_simple_tree(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator> it, Sink& sink)
+	{
+		using node_type       = simple_node<String>;
+		using node_pointer    = wordring::detail::const_tag_tree_iterator<node_type, Allocator>;
+		using serial_iterator = wordring::detail::const_tag_tree_serial_iterator<node_type, Allocator>;
+
+		// 1.
+		if (simple_serializes_as_void(*it)) return;
+
+		serial_iterator first(it);
+		if (!first.is_start_tag()) return; // 子を持たない
+		serial_iterator last = first.end_tag();
+
+		for (++first; first != last; ++first)
+		{
+			if (first.is_end_tag())
+			{
+				node_type const& node = *first.start_tag();
+				if (!node.is_element()) continue;
+
+				sink.ascii("</");
+				simple_tag_name(node, sink);
+				sink.ascii(">");
+				continue;
+			}
+
+			node_type const& node = *first;
+			switch (node.type())
+			{
+			case node_type::type_name::Element:
+				sink.ascii("<");
+				simple_tag_name(node, sink);
+				for (auto const& attr : node)
+				{
+					sink.ascii(" ");
+					simple_attribute_name(attr, sink);
+					sink.ascii("=\"");
+					String const& s = attr.value();
+					simple_escape_string<true>(s.data(), s.data() + s.size(), sink);
+					sink.ascii("\"");
+				}
+				sink.ascii(">");
+				// VOIDとして直列化する要素は、子も終了タグも出力しない
+				if (simple_serializes_as_void(node) && first.is_start_tag()) first = first.end_tag();
+				break;
+			case node_type::type_name::Text:
+			{
+				String const& s = node.data();
+				node_type const& parent = *node_pointer(first).parent();
+				if (parent.is_element() && parent.namespace_uri_name() == ns_name::HTML)
+				{
+					switch (parent.local_name_name())
+					{
+					case tag_name::Style:   case tag_name::Script:   case tag_name::Xmp:       case tag_name::Iframe:
+					case tag_name::Noembed: case tag_name::Noframes: case tag_name::Plaintext:
+						sink.append(s);
+						continue;
+					default:
+						break;
+					}
+				}
+				simple_escape_string<false>(s.data(), s.data() + s.size(), sink);
+				break;
+			}
+			case node_type::type_name::Comment:
+				sink.ascii("<!--");
+				sink.append(node.data());
+				sink.ascii("-->");
+				break;
+			case node_type::type_name::ProcessingInstruction:
+				sink.ascii("<?");
+				sink.append(node.target());
+				sink.ascii(" ");
+				sink.append(node.data());
+				sink.ascii(">");
+				break;
+			case node_type::type_name::DocumentType:
+				sink.ascii("<!DOCTYPE ");
+				sink.append(node.name());
+				sink.ascii(">");
+				break;
+			default:
+				break;
+			}
+		}
+	}
+}
+
+namespace wordring::html
+{
+	/*! @brief ノードを直列化する
+
+	tag_tree 用の多重定義。
+	木を行きがかり順に一度だけ辿り、エスケープの不要な区間はまとめて出力する。
+	出力イテレータの文字が木の文字列と同じ大きさの場合、文字エンコーディングを変換しない。
+
+	@sa wordring::whatwg::html::to_string()
+	*/
+	template <typename String, typename Allocator, typename OutputIterator>
+	inline void to_string(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator> it, OutputIterator out)
+	{
+		detail::simple_iterator_sink<String, OutputIterator> sink(out);
+		detail::serialize_simple_tree(it, sink);
+	}
+
+	template <typename String, typename Allocator, typename OutputIterator>
+	inline void to_string(wordring::detail::tag_tree_iterator<simple_node<String>, Allocator> it, OutputIterator out)
+	{
+		to_string(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator>(it), out);
+	}
+
+	/*! @brief ノードを直列化し、文字列の末尾へ追加する
+
+	@param [in]     it  直列化するノード。子孫が出力される
+	@param [in,out] buf 出力先の文字列
+
+	木の文字エンコーディングのまま buf へ書き込む。
+	buf を clear() して使い回すと、複数のノードを記憶域を確保し直さずに直列化できる。
+	*/
+	template <typename String, typename Allocator>
+	inline void serialize(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator> it, String& buf)
+	{
+		detail::simple_string_sink<String> sink(buf);
+		detail::serialize_simple_tree(it, sink);
+	}
+}
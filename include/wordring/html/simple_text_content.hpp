@@ -0,0 +1,224 @@
+﻿#pragma once
+
+// https://dom.spec.whatwg.org/#dom-node-textcontent
+// https://triple-underscore.github.io/DOM4-ja.html#dom-node-textcontent
+
+#include <wordring/html/simple_node.hpp>
+
+#include <wordring/html/html_defs.hpp>
+
+#include <wordring/tag_tree/serial_iterator.hpp>
+#include <wordring/tag_tree/tag_tree_iterator.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace wordring::html
+{
+	/*! @brief visible_text() の動作を指定する
+	*/
+	struct text_options
+	{
+		/*! @brief 連続する ASCII 空白を一つの空白にまとめ、前後の空白を取り除く */
+		bool m_collapse_whitespace = true;
+
+		/*! @brief script 、 style 、 template 要素の部分木を読み飛ばす */
+		bool m_skip_hidden = true;
+	};
+}
+
+namespace wordring::html::detail
+{
+	/*! @brief 内容を表示しない要素か調べる
+	*/
+	template <typename String>
+	inline bool is_simple_hidden(simple_node<String> const& node)
+	{
+		if (!node.is_element() || node.namespace_uri_name() != ns_name::HTML) return false;
+
+		switch (node.local_name_name())
+		{
+		case tag_name::Script: case tag_name::Style: case tag_name::Template:
+			return true;
+		default:
+			break;
+		}
+
+		return false;
+	}
+
+	/*! @brief 子孫のテキスト・ノードを文書順に f へ渡す
+
+	@param [in] it   部分木の根
+	@param [in] skip 真の場合、 script 、 style 、 template 要素の部分木を読み飛ばす
+	@param [in] f    テキスト・ノードを指すイテレータを受け取る関数
+
+	行きがかり順のイテレータで前から辿るだけなので、スタックを持たない。
+	*/
+	template <typename String, typename Allocator, typename Function>
+	inline void for_each_simple_text_node(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator> it, bool skip, Function f)
+	{
+		using node_type       = simple_node<String>;
+		using node_pointer    = wordring::detail::const_tag_tree_iterator<node_type, Allocator>;
+		using serial_iterator = wordring::detail::const_tag_tree_serial_iterator<node_type, Allocator>;
+
+		serial_iterator first(it);
+		if (!first.is_start_tag()) return;
+		serial_iterator last = first.end_tag();
+
+		for (++first; first != last; ++first)
+		{
+			if (first.is_end_tag()) continue;
+
+			node_type const& node = *first;
+			if (node.is_text()) f(node_pointer(first));
+			else if (skip && first.is_start_tag() && is_simple_hidden(node)) first = first.end_tag();
+		}
+	}
+
+	/*! @brief 子孫のテキスト・ノードの文字列を文書順に f へ渡す
+	*/
+	template <typename String, typename Allocator, typename Function>
+	inline void for_each_simple_text(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator> it, bool skip, Function f)
+	{
+		for_each_simple_text_node(it, skip, [&](auto np) { f(np->data()); });
+	}
+
+	template <typename Character>
+	inline bool is_simple_ascii_whitespace(Character ch)
+	{
+		switch (static_cast<std::uint32_t>(static_cast<std::make_unsigned_t<Character>>(ch)))
+		{
+		case 0x9u: case 0xAu: case 0xCu: case 0xDu: case 0x20u:
+			return true;
+		default:
+			break;
+		}
+
+		return false;
+	}
+}
+
+namespace wordring::html
+{
+	/*! @brief ノードのテキスト内容を文字列の末尾へ追加する
+
+	@param [in]     it  ノード
+	@param [in,out] out 出力先の文字列
+
+	要素、文書、文書片の場合、子孫のテキスト・ノードの文字列を文書順に連結する。
+	テキスト、コメント、処理命令の場合、そのデータを追加する。
+	文書型の場合、何も追加しない。
+
+	先に子孫の文字数を数えて out の記憶域を一度だけ確保し、各テキスト・ノードの文字列を丸ごと複写する。
+
+	@sa https://dom.spec.whatwg.org/#dom-node-textcontent
+	*/
+	template <typename String, typename Allocator>
+	inline void text_content(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator> it, String& out)
+	{
+		if (it->is_text() || it->is_comment() || it->is_processing_instruction())
+		{
+			out.append(it->data());
+			return;
+		}
+
+		std::size_t n = out.size();
+		detail::for_each_simple_text(it, false, [&](String const& s) { n += s.size(); });
+		out.reserve(n);
+
+		detail::for_each_simple_text(it, false, [&](String const& s) { out.append(s); });
+	}
+
+	/*! @brief ノードのテキスト内容を返す
+
+	@sa text_content(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator>, String&)
+	*/
+	template <typename String, typename Allocator>
+	inline String text_content(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator> it)
+	{
+		String s;
+		text_content(it, s);
+		return s;
+	}
+
+	/*! @brief 表示されるテキストを文字列の末尾へ追加する
+
+	@param [in]     it  部分木の根
+	@param [in,out] out 出力先の文字列
+	@param [in]     opt 動作の指定
+
+	子孫のテキスト・ノードを文書順に連結する。
+	m_skip_hidden が真の場合、 script 、 style 、 template 要素の内容を含めない。
+	m_collapse_whitespace が真の場合、テキスト・ノードの境界をまたいで連続する ASCII 空白を一つの空白とし、
+	追加する文字列の前後の空白を取り除く。
+
+	ブラウザの innerText と異なり、 CSS による表示状態やブロック境界の改行は扱わない。
+	*/
+	template <typename String, typename Allocator>
+	inline void visible_text(
+		wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator> it,
+		String&                                                                   out,
+		text_options const&                                                       opt = text_options())
+	{
+		using character_type = typename String::value_type;
+
+		auto each = [&](auto f)
+		{
+			if (it->is_text()) f(it->data());
+			else detail::for_each_simple_text(it, opt.m_skip_hidden, f);
+		};
+
+		std::size_t n = out.size();
+		each([&](String const& s) { n += s.size(); });
+		out.reserve(n);
+
+		if (!opt.m_collapse_whitespace)
+		{
+			each([&](String const& s) { out.append(s); });
+			return;
+		}
+
+		std::size_t const start = out.size();
+		bool space = false; // 空白を保留している
+
+		auto collapse = [&](String const& s)
+		{
+			character_type const* first = s.data();
+			character_type const* last  = first + s.size();
+
+			while (first != last)
+			{
+				character_type const* it1 = first;
+				while (it1 != last && detail::is_simple_ascii_whitespace(*it1)) ++it1;
+				if (it1 != first) space = true;
+				if (it1 == last) break;
+
+				character_type const* it2 = it1;
+				while (it2 != last && !detail::is_simple_ascii_whitespace(*it2)) ++it2;
+
+				if (space && out.size() != start) out.push_back(static_cast<character_type>(0x20));
+				space = false;
+				out.append(it1, it2 - it1);
+
+				first = it2;
+			}
+		};
+
+		each(collapse);
+	}
+
+	/*! @brief 表示されるテキストを返す
+
+	@sa visible_text(wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator>, String&, text_options const&)
+	*/
+	template <typename String, typename Allocator>
+	inline String visible_text(
+		wordring::detail::const_tag_tree_iterator<simple_node<String>, Allocator> it,
+		text_options const&                                                       opt = text_options())
+	{
+		String s;
+		visible_text(it, s, opt);
+		return s;
+	}
+}
@@ -0,0 +1,215 @@
+﻿#pragma once
+
+#include <wordring/html/simple_text_content.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace wordring::html
+{
+	/*! @brief 部分木のテキストを一つの文字列に連結し、文字列上の位置とテキスト・ノードを対応付ける索引
+
+	@tparam Container HTML 文書を格納する tag_tree
+
+	テキストを連続した記憶域に置くため、文字列検索や正規表現をポインタ上で実行できる。
+	見つかった位置は locate() でテキスト・ノードとノード内の位置へ戻せる。
+
+	テキスト・ノードのデータを変更した場合、 update() でそのノードの区間のみを置き換える。
+	テキスト・ノードを挿入、削除した場合、あるいは木の compact() を呼び出した場合、 rebuild() で作り直す。
+
+	@par 例
+	@code
+		auto idx = simple_text_index<u8simple_tree>(tree, tree.begin());
+		std::size_t pos = idx.view().find(u8"needle");
+		if (pos != idx.npos)
+		{
+			auto [node, offset] = idx.locate(pos);
+		}
+	@endcode
+	*/
+	template <typename Container>
+	class simple_text_index
+	{
+	public:
+		using container      = Container;
+		using const_iterator = typename container::const_iterator;
+		using string_type    = typename container::value_type::string_type;
+		using character_type = typename string_type::value_type;
+		using view_type      = std::basic_string_view<character_type>;
+		using size_type      = std::size_t;
+
+		/*! @brief テキスト・ノードと、ノード内の位置 */
+		using position_type = std::pair<const_iterator, size_type>;
+
+		static size_type constexpr npos = static_cast<size_type>(-1);
+
+	protected:
+		/*! @brief テキスト・ノードと、その文字列の連結後の開始位置 */
+		struct entry
+		{
+			size_type      m_offset;
+			const_iterator m_node;
+		};
+
+	public:
+		simple_text_index()
+			: m_tree(nullptr)
+			, m_root()
+			, m_skip_hidden(false)
+		{
+		}
+
+		/*! @brief 索引を作成する
+
+		@param [in] tree        木
+		@param [in] root        部分木の根
+		@param [in] skip_hidden 真の場合、 script 、 style 、 template 要素の内容を含めない
+		*/
+		simple_text_index(container const& tree, const_iterator root, bool skip_hidden = false)
+			: m_tree(&tree)
+			, m_root(root)
+			, m_skip_hidden(skip_hidden)
+		{
+			rebuild();
+		}
+
+		void assign(container const& tree, const_iterator root, bool skip_hidden = false)
+		{
+			m_tree        = &tree;
+			m_root        = root;
+			m_skip_hidden = skip_hidden;
+			rebuild();
+		}
+
+		/*! @brief 部分木を辿り直し、索引を作り直す
+
+		木を一度だけ辿ってテキスト・ノードを集め、文字列の記憶域を一度だけ確保する。
+		*/
+		void rebuild()
+		{
+			m_text.clear();
+			m_entries.clear();
+			m_map.clear();
+
+			if (m_tree == nullptr) return;
+
+			size_type n = 0;
+			detail::for_each_simple_text_node(m_root, m_skip_hidden, [&](const_iterator it) {
+				n += it->data().size();
+				m_entries.push_back({ 0, it });
+			});
+
+			m_text.reserve(n);
+			for (entry& e : m_entries)
+			{
+				e.m_offset = m_text.size();
+				m_text.append(e.m_node->data());
+			}
+		}
+
+		/*! @brief データを変更したテキスト・ノードの区間を置き換える
+
+		@param [in] it 索引に含まれるテキスト・ノード
+
+		@return it が索引に含まれない場合、何もせず false を返す
+
+		後続のノードの開始位置をずらすだけで、木は辿らない。
+		*/
+		bool update(const_iterator it)
+		{
+			size_type i = find_entry(it);
+			if (i == npos) return false;
+
+			size_type first = m_entries[i].m_offset;
+			size_type last  = i + 1 < m_entries.size() ? m_entries[i + 1].m_offset : m_text.size();
+
+			string_type const& s = it->data();
+			m_text.replace(first, last - first, s);
+
+			// 符号無し整数の剰余演算で、長さの増減をまとめて扱う
+			size_type delta = s.size() - (last - first);
+			for (++i; i < m_entries.size(); ++i) m_entries[i].m_offset += delta;
+
+			return true;
+		}
+
+		/*! @brief 連結した文字列を返す */
+		string_type const& str() const { return m_text; }
+
+		view_type view() const { return view_type(m_text.data(), m_text.size()); }
+
+		character_type const* data() const { return m_text.data(); }
+
+		/*! @brief 連結した文字列の先頭を指す、ランダム・アクセス可能なイテレータを返す */
+		character_type const* begin() const { return m_text.data(); }
+
+		character_type const* end() const { return m_text.data() + m_text.size(); }
+
+		size_type size() const { return m_text.size(); }
+
+		bool empty() const { return m_text.empty(); }
+
+		/*! @brief 索引に含まれるテキスト・ノードの数を返す */
+		size_type node_count() const { return m_entries.size(); }
+
+		/*! @brief 連結した文字列上の位置を、テキスト・ノードとノード内の位置へ変換する
+
+		@param [in] pos 連結した文字列上の位置。 size() 未満であること
+
+		開始位置の表を二分探索する。
+		*/
+		position_type locate(size_type pos) const
+		{
+			assert(pos < m_text.size());
+
+			auto it = std::upper_bound(m_entries.begin(), m_entries.end(), pos, [](size_type p, entry const& e) {
+				return p < e.m_offset; });
+			--it;
+
+			return { it->m_node, pos - it->m_offset };
+		}
+
+		/*! @brief テキスト・ノードとノード内の位置を、連結した文字列上の位置へ変換する
+
+		@return it が索引に含まれない場合、 npos
+		*/
+		size_type position(const_iterator it, size_type offset = 0) const
+		{
+			size_type i = find_entry(it);
+			return i == npos ? npos : m_entries[i].m_offset + offset;
+		}
+
+	protected:
+		/*! @brief テキスト・ノードの表の添え字を返す
+
+		木の格納位置から表の添え字への対応表は、初めて必要になった時に作成する。
+		*/
+		size_type find_entry(const_iterator it) const
+		{
+			if (m_map.empty() && !m_entries.empty())
+			{
+				m_map.reserve(m_entries.size());
+				for (std::uint32_t i = 0; i < m_entries.size(); ++i) m_map.emplace(m_tree->index(m_entries[i].m_node), i);
+			}
+
+			auto it1 = m_map.find(m_tree->index(it));
+			return it1 == m_map.end() ? npos : it1->second;
+		}
+
+	protected:
+		container const* m_tree;
+		const_iterator   m_root;
+		bool             m_skip_hidden;
+
+		string_type        m_text;
+		std::vector<entry> m_entries;
+
+		/*! @brief 木の格納位置から m_entries の添え字への対応 */
+		mutable std::unordered_map<std::uint32_t, std::uint32_t> m_map;
+	};
+}
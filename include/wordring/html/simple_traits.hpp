@@ -318,4 +318,51 @@ namespace wordring::html
 			return false;
 		}
 	};
+
+	/*! @class frozen_simple_node_traits simple_traits.hpp wordring/html/simple_traits.hpp
+	*
+	* @brief 凍結した木のイテレータ用の node_traits のテンプレート特殊化
+	*
+	* ノードの種類とローカル名を、値ではなくイテレータが指す列から読む。
+	* セレクタの照合で多くのノードを調べる際、値の共用体を参照せずに済む。
+	*
+	* @sa simple_node_traits
+	* @sa frozen_tag_tree
+	*/
+	template <typename NodeIterator>
+	struct frozen_simple_node_traits : public simple_node_traits<NodeIterator>
+	{
+		using base_type = simple_node_traits<NodeIterator>;
+
+		using node_pointer = typename base_type::node_pointer;
+		using node_type    = typename base_type::node_type;
+		using type_name    = typename node_type::type_name;
+
+		using base_type::get_local_name_name;
+		using base_type::get_namespace_name;
+
+		static bool is_element(node_pointer it) { return it.kind() == type_name::Element; }
+
+		static tag_name get_local_name_name(node_pointer it) { return it.local_name_name(); }
+
+		static bool is_html_element_of(node_pointer it, tag_name tag)
+		{
+			return it.local_name_name() == tag && get_namespace_name(it) == ns_name::HTML;
+		}
+
+		static bool is_text(node_pointer it) { return it.kind() == type_name::Text; }
+
+		static bool is_processing_instruction(node_pointer it) { return it.kind() == type_name::ProcessingInstruction; }
+
+		static bool is_comment(node_pointer it) { return it.kind() == type_name::Comment; }
+
+		static bool is_document(node_pointer it) { return it.kind() == type_name::Document; }
+
+		static bool is_document_type(node_pointer it) { return it.kind() == type_name::DocumentType; }
+
+		static bool is_root(node_pointer it)
+		{
+			return is_element(it) && is_html_element_of(it, tag_name::Html);
+		}
+	};
 }
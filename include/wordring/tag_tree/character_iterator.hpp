@@ -10,15 +10,8 @@
 #include <iterator>
 #include <type_traits>
 #include <vector>
-namespace wordring
-{
-	template <typename Value>
-	class tag_tree;
-}
-
 namespace wordring::detail
 {
-	template <typename Value> class tag_tree_character_iterator;
 
 	/*! @brief HTML/XML の文字を巡回するイテレータ
 	* 
@@ -27,20 +20,20 @@ namespace wordring::detail
 	* 
 	* 
 	*/
-	template <typename Value>
+	template <typename Value, typename Allocator>
 	class const_tag_tree_character_iterator
 	{
-		friend class tag_tree_character_iterator<Value>;
+		friend class tag_tree_character_iterator<Value, Allocator>;
 
 	public:
-		using node_traits       = html::node_traits<tag_tree_iterator<Value>>;
+		using node_traits       = html::node_traits<tag_tree_iterator<Value, Allocator>>;
 		using node_type         = typename node_traits::node_type;
 		using node_pointer      = typename node_traits::node_pointer;
 
 		using string_type    = typename node_traits::string_type;
 		using character_type = typename string_type::value_type;
 
-		using base_type = tag_tree_serial_iterator<Value>;
+		using base_type = tag_tree_serial_iterator<Value, Allocator>;
 		using container = typename base_type::container;
 
 		using value_type        = std::remove_cv_t<character_type>;
@@ -71,9 +64,9 @@ namespace wordring::detail
 
 		/*! @brief tag_tree_iterator へ変換する
 		*/
-		operator tag_tree_iterator<Value>() const
+		operator tag_tree_iterator<Value, Allocator>() const
 		{
-			return static_cast<tag_tree_iterator<Value>>(m_it);
+			return static_cast<tag_tree_iterator<Value, Allocator>>(m_it);
 		}
 
 		/*! @brief 文字を返す
@@ -207,11 +200,11 @@ namespace wordring::detail
 
 
 
-	template <typename Value>
-	class tag_tree_character_iterator : public const_tag_tree_character_iterator<Value>
+	template <typename Value, typename Allocator>
+	class tag_tree_character_iterator : public const_tag_tree_character_iterator<Value, Allocator>
 	{
 	public:
-		using node_traits  = html::node_traits<tag_tree_iterator<Value>>;
+		using node_traits  = html::node_traits<tag_tree_iterator<Value, Allocator>>;
 		using node_type    = typename node_traits::node_type;
 		using node_pointer = typename node_traits::node_pointer;
 
@@ -224,7 +217,7 @@ namespace wordring::detail
 		using pointer           = value_type*;
 		using iterator_category = std::bidirectional_iterator_tag;
 
-		using base_type = const_tag_tree_character_iterator<Value>;
+		using base_type = const_tag_tree_character_iterator<Value, Allocator>;
 
 	private:
 		using base_type::m_it;
@@ -248,9 +241,9 @@ namespace wordring::detail
 
 		/*! @brief tag_tree_iterator へ変換する
 		*/
-		operator tag_tree_iterator<Value>() const
+		operator tag_tree_iterator<Value, Allocator>() const
 		{
-			return static_cast<tag_tree_iterator<Value>>(m_it);
+			return static_cast<tag_tree_iterator<Value, Allocator>>(m_it);
 		}
 
 		/*! @brief 文字を返す
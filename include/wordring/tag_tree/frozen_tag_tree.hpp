@@ -0,0 +1,225 @@
+﻿#pragma once
+
+#include <wordring/tag_tree/frozen_tag_tree_iterator.hpp>
+#include <wordring/tag_tree/tag_tree.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace wordring
+{
+	/*! @brief 変更できない HTML/XML 用の木
+
+	解析後に読むだけの木を、走査に向いた配置へ詰め直したもの。
+	freeze() で tag_tree から作成する。
+
+	ノードは文書順に格納し、親、部分木の終端、種類、ローカル名をそれぞれ別の配列に持つ。
+	ノードの子孫は格納位置の区間 [index(it) + 1, subtree_end(it)) となるため、
+	子孫の走査は配列を前から読むだけで済む。
+
+	@sa freeze()
+	*/
+	template <typename Value>
+	class frozen_tag_tree
+	{
+	public:
+		using value_type      = std::remove_cv_t<Value>;
+		using size_type       = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference       = value_type const&;
+		using const_reference = value_type const&;
+		using pointer         = value_type const*;
+		using const_pointer   = value_type const*;
+		using const_iterator  = detail::const_frozen_tag_tree_iterator<value_type>;
+		using iterator        = const_iterator;
+
+		using container = detail::frozen_tag_columns<value_type>;
+		using type_name = typename container::type_name;
+		using tag_name  = typename container::tag_name;
+
+	public:
+		frozen_tag_tree()
+			: m_c(std::make_unique<container>())
+		{
+			push_sentinel();
+			m_c->m_end[0] = 1;
+		}
+
+		/*! @brief 木の値を複写して凍結する
+		*/
+		template <typename Allocator>
+		explicit frozen_tag_tree(tag_tree<value_type, Allocator> const& tree)
+			: m_c(std::make_unique<container>())
+		{
+			assign(tree);
+		}
+
+		/*! @brief 木の値を移動して凍結する
+
+		tree は空となる。
+		*/
+		template <typename Allocator>
+		explicit frozen_tag_tree(tag_tree<value_type, Allocator>&& tree)
+			: m_c(std::make_unique<container>())
+		{
+			assign(tree);
+			tree.clear();
+		}
+
+		frozen_tag_tree(frozen_tag_tree const& rhs)
+			: m_c(std::make_unique<container>(*rhs.m_c))
+		{}
+
+		frozen_tag_tree(frozen_tag_tree&& rhs) = default;
+
+		frozen_tag_tree& operator=(frozen_tag_tree const& rhs)
+		{
+			m_c = std::make_unique<container>(*rhs.m_c);
+			return *this;
+		}
+
+		frozen_tag_tree& operator=(frozen_tag_tree&& rhs) = default;
+
+		const_iterator begin() const { return const_iterator(m_c.get(), 1, 0); }
+
+		const_iterator cbegin() const { return begin(); }
+
+		const_iterator end() const { return const_iterator(m_c.get(), m_c->m_end[0], 0); }
+
+		const_iterator cend() const { return end(); }
+
+		bool empty() const { return m_c->m_end[0] == 1; }
+
+		/*! @brief ノード数を返す
+		*/
+		size_type size() const { return m_c->m_end[0] - 1; }
+
+		/*! @brief ノードの格納位置を返す
+
+		格納位置は文書順に 1 から振られ、木の外に置いた配列からノードごとの情報を引く添え字として使える。
+		*/
+		std::uint32_t index(const_iterator it) const { return it.m_i; }
+
+		/*! @brief 部分木の終端の格納位置を返す
+
+		it の子孫は格納位置の区間 [index(it) + 1, subtree_end(it)) に並ぶ。
+		*/
+		std::uint32_t subtree_end(const_iterator it) const { return m_c->m_end[it.m_i]; }
+
+		/*! @brief 格納位置 idx のノードを指すイテレータを返す
+		*/
+		const_iterator at(std::uint32_t idx) const
+		{
+			assert(0 < idx && idx < m_c->m_end[0]);
+			return const_iterator(m_c.get(), idx, m_c->m_parent[idx]);
+		}
+
+		/*! @brief 格納位置 idx のノードの値を返す
+		*/
+		const_reference operator[](std::uint32_t idx) const { return m_c->m_value[idx]; }
+
+		/*! @brief 格納位置 idx のノードの種類を返す
+		*/
+		type_name kind(std::uint32_t idx) const { return m_c->m_kind[idx]; }
+
+		/*! @brief 格納位置 idx の要素のローカル名を返す
+		*/
+		tag_name local_name_name(std::uint32_t idx) const { return m_c->m_tag[idx]; }
+
+	protected:
+		void push_sentinel()
+		{
+			m_c->m_parent.push_back(0);
+			m_c->m_end.push_back(0);
+			m_c->m_kind.push_back(static_cast<type_name>(0));
+			m_c->m_tag.push_back(static_cast<tag_name>(0));
+			m_c->m_value.push_back(value_type());
+		}
+
+		/*! @brief 木を文書順に辿り、列へ書き込む
+
+		Tree が const でない場合、値を移動する。
+		*/
+		template <typename Tree>
+		void assign(Tree& tree)
+		{
+			using tree_iterator = decltype(tree.begin());
+
+			std::size_t n = tree.size();
+			m_c->m_parent.reserve(n + 1);
+			m_c->m_end.reserve(n + 1);
+			m_c->m_kind.reserve(n + 1);
+			m_c->m_tag.reserve(n + 1);
+			m_c->m_value.reserve(n + 1);
+
+			push_sentinel();
+
+			// 子を辿っている途中の祖先と、その格納位置
+			std::vector<std::pair<tree_iterator, std::uint32_t>> stack;
+
+			tree_iterator it = tree.begin();
+			tree_iterator last = tree.end();
+			while (true)
+			{
+				if (it == last)
+				{
+					if (stack.empty()) break;
+					auto [parent, idx] = stack.back();
+					stack.pop_back();
+					m_c->m_end[idx] = static_cast<std::uint32_t>(m_c->m_value.size());
+					it = ++parent;
+					last = stack.empty() ? tree.end() : stack.back().first.end();
+					continue;
+				}
+
+				std::uint32_t idx = static_cast<std::uint32_t>(m_c->m_value.size());
+				m_c->m_parent.push_back(stack.empty() ? 0 : stack.back().second);
+				m_c->m_end.push_back(idx + 1);
+				m_c->m_kind.push_back(it->type());
+				m_c->m_tag.push_back(it->is_element() ? it->local_name_name() : static_cast<tag_name>(0));
+				if constexpr (std::is_const_v<Tree>) m_c->m_value.push_back(*it);
+				else m_c->m_value.push_back(std::move(*it));
+
+				if (it.begin() != it.end())
+				{
+					stack.emplace_back(it, idx);
+					last = it.end();
+					it = it.begin();
+				}
+				else ++it;
+			}
+
+			m_c->m_end[0] = static_cast<std::uint32_t>(m_c->m_value.size());
+		}
+
+	protected:
+		std::unique_ptr<container> m_c;
+	};
+
+	/*! @brief 木を凍結する
+
+	@param [in] tree 凍結する木
+
+	@return 値を複写した、変更できない木
+	*/
+	template <typename Value, typename Allocator>
+	inline frozen_tag_tree<Value> freeze(tag_tree<Value, Allocator> const& tree)
+	{
+		return frozen_tag_tree<Value>(tree);
+	}
+
+	/*! @brief 木を凍結する
+
+	@param [in] tree 凍結する木。空となる
+
+	@return 値を移動した、変更できない木
+	*/
+	template <typename Value, typename Allocator>
+	inline frozen_tag_tree<Value> freeze(tag_tree<Value, Allocator>&& tree)
+	{
+		return frozen_tag_tree<Value>(std::move(tree));
+	}
+}
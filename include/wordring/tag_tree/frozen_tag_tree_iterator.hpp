@@ -0,0 +1,172 @@
+﻿#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace wordring
+{
+	template <typename Value>
+	class frozen_tag_tree;
+}
+
+namespace wordring::detail
+{
+	/*! @brief 凍結した木の列
+
+	ノードは文書順に格納され、各列はノードの格納位置を添え字とする。
+	格納位置 0 は番兵で、最上位のノードの親として扱う。
+
+	ノード i の子孫は格納位置の区間 [i + 1, m_end[i]) に並ぶ。
+	子は i + 1 から始まり、子 c の次の兄弟は m_end[c] に有る。
+	*/
+	template <typename Value>
+	struct frozen_tag_columns
+	{
+		using value_type = Value;
+		using type_name  = typename value_type::type_name;
+		using tag_name   = decltype(std::declval<value_type const&>().local_name_name());
+
+		/*! @brief 親ノードの格納位置。最上位のノードでは 0 */
+		std::vector<std::uint32_t> m_parent;
+
+		/*! @brief 部分木の終端の格納位置 */
+		std::vector<std::uint32_t> m_end;
+
+		/*! @brief ノードの種類 */
+		std::vector<type_name> m_kind;
+
+		/*! @brief 要素のローカル名。要素以外では 0 */
+		std::vector<tag_name> m_tag;
+
+		std::vector<value_type> m_value;
+	};
+
+	/*! @brief 凍結した木の兄弟ノードを走査するイテレータ
+
+	兄弟を辿るには親の部分木の終端が必要となるため、イテレータは親の格納位置を保持する。
+	tag_tree_iterator と同じく、 end() の親はその要素自身となる。
+	*/
+	template <typename Value>
+	class const_frozen_tag_tree_iterator
+	{
+		friend class wordring::frozen_tag_tree<Value>;
+
+	public:
+		using value_type = std::remove_cv_t<Value>;
+		using container  = frozen_tag_columns<value_type>;
+		using type_name  = typename container::type_name;
+		using tag_name   = typename container::tag_name;
+
+		using difference_type   = std::ptrdiff_t;
+		using reference         = value_type const&;
+		using pointer           = value_type const*;
+		using iterator_category = std::bidirectional_iterator_tag;
+
+	public:
+		const_frozen_tag_tree_iterator()
+			: m_c(nullptr)
+			, m_i(0)
+			, m_p(0) {}
+
+		const_frozen_tag_tree_iterator(container const* c, std::uint32_t i, std::uint32_t p)
+			: m_c(c)
+			, m_i(i)
+			, m_p(p) {}
+
+		reference operator*() const { return m_c->m_value[m_i]; }
+
+		pointer operator->() const { return m_c->m_value.data() + m_i; }
+
+		/*! @brief ノードの種類を返す
+
+		値を参照せず、種類の列のみを読む。
+		*/
+		type_name kind() const { return m_c->m_kind[m_i]; }
+
+		/*! @brief 要素のローカル名を返す
+
+		値を参照せず、ローカル名の列のみを読む。
+		*/
+		tag_name local_name_name() const { return m_c->m_tag[m_i]; }
+
+		/*! @brief 一つ後ろの兄弟ノードを指すように進める
+
+		次の兄弟は部分木の直後に格納されている。
+		*/
+		const_frozen_tag_tree_iterator& operator++()
+		{
+			assert(m_i < m_c->m_end[m_p]);
+			m_i = m_c->m_end[m_i];
+			return *this;
+		}
+
+		const_frozen_tag_tree_iterator operator++(int)
+		{
+			const_frozen_tag_tree_iterator it = *this;
+			operator++();
+			return it;
+		}
+
+		/*! @brief 一つ前の兄弟ノードを指すように戻す
+
+		直前の格納位置は前の兄弟の部分木の最後のノードなので、親が一致するまで祖先を辿る。
+		*/
+		const_frozen_tag_tree_iterator& operator--()
+		{
+			assert(m_p + 1 < m_i);
+			std::uint32_t idx = m_i - 1;
+			while (m_c->m_parent[idx] != m_p) idx = m_c->m_parent[idx];
+			m_i = idx;
+			return *this;
+		}
+
+		const_frozen_tag_tree_iterator operator--(int)
+		{
+			const_frozen_tag_tree_iterator it = *this;
+			operator--();
+			return it;
+		}
+
+		/*! @brief 親ノードへのイテレータを返す
+
+		最上位のノードに「親ノード」は無く、空のイテレータを返す。
+		*/
+		const_frozen_tag_tree_iterator parent() const
+		{
+			return m_p == 0 ? const_frozen_tag_tree_iterator() : const_frozen_tag_tree_iterator(m_c, m_p, m_c->m_parent[m_p]);
+		}
+
+		const_frozen_tag_tree_iterator begin() const
+		{
+			return const_frozen_tag_tree_iterator(m_c, m_i + 1, m_i);
+		}
+
+		const_frozen_tag_tree_iterator end() const
+		{
+			return const_frozen_tag_tree_iterator(m_c, m_c->m_end[m_i], m_i);
+		}
+
+		/*! @brief 二つのイテレータが同じ位置を指すか調べる
+
+		要素の end() と次の兄弟は同じ格納位置を持つため、親の格納位置も比較する。
+		*/
+		bool operator==(const_frozen_tag_tree_iterator const& x) const
+		{
+			assert(m_c == nullptr || x.m_c == nullptr || m_c == x.m_c);
+			return m_i == x.m_i && m_p == x.m_p;
+		}
+
+		bool operator!=(const_frozen_tag_tree_iterator const& x) const
+		{
+			return !operator==(x);
+		}
+
+	protected:
+		container const* m_c;
+		std::uint32_t    m_i;
+		std::uint32_t    m_p;
+	};
+}
@@ -3,28 +3,21 @@
 #include <wordring/tag_tree/tag_node.hpp>
 #include <wordring/tag_tree/tag_tree_iterator.hpp>
 
-namespace wordring
-{
-	template <typename Value>
-	class tag_tree;
-}
-
 namespace wordring::detail
 {
-	template <typename Value> class tag_tree_serial_iterator;
 
-	template <typename Value>
+	template <typename Value, typename Allocator>
 	class const_tag_tree_serial_iterator
 	{
-		friend class wordring::tag_tree<Value>;
+		friend class wordring::tag_tree<Value, Allocator>;
 
-		friend class const_tag_tree_character_iterator<Value>;
-		friend class tag_tree_character_iterator<Value>;
+		friend class const_tag_tree_character_iterator<Value, Allocator>;
+		friend class tag_tree_character_iterator<Value, Allocator>;
 
-		friend class const_tag_tree_iterator<Value>;
-		friend class tag_tree_iterator<Value>;
+		friend class const_tag_tree_iterator<Value, Allocator>;
+		friend class tag_tree_iterator<Value, Allocator>;
 
-		friend class tag_tree_serial_iterator<Value>;
+		friend class tag_tree_serial_iterator<Value, Allocator>;
 
 	public:
 		using value_type = std::remove_cv_t<Value>;
@@ -35,18 +28,18 @@ namespace wordring::detail
 		using pointer           = value_type const*;
 		using iterator_category = std::bidirectional_iterator_tag;
 
-		using container = std::vector<detail::tag_node<value_type>>;
+		using container = std::vector<detail::tag_node<value_type>, Allocator>;
 
 	public:
 		const_tag_tree_serial_iterator()
 			: m_c(nullptr)
 			, m_i(0) {}
 
-		const_tag_tree_serial_iterator(const_tag_tree_iterator<Value> const& x)
+		const_tag_tree_serial_iterator(const_tag_tree_iterator<Value, Allocator> const& x)
 			: m_c(x.m_c)
 			, m_i(x.m_i) {}
 
-		const_tag_tree_serial_iterator(tag_tree_iterator<Value> const& x)
+		const_tag_tree_serial_iterator(tag_tree_iterator<Value, Allocator> const& x)
 			: m_c(x.m_c)
 			, m_i(x.m_i) {}
 
@@ -56,9 +49,9 @@ namespace wordring::detail
 
 		/*! @brief const_tag_tree_iterator へ変換する
 		*/
-		operator const_tag_tree_iterator<Value>() const
+		operator const_tag_tree_iterator<Value, Allocator>() const
 		{
-			return const_tag_tree_iterator<Value>(m_c, m_i);
+			return const_tag_tree_iterator<Value, Allocator>(m_c, m_i);
 		}
 
 		reference operator*() const
@@ -152,13 +145,13 @@ namespace wordring::detail
 		std::uint32_t m_i;
 	};
 
-	template <typename Value>
-	class tag_tree_serial_iterator : public const_tag_tree_serial_iterator<Value>
+	template <typename Value, typename Allocator>
+	class tag_tree_serial_iterator : public const_tag_tree_serial_iterator<Value, Allocator>
 	{
-		friend class wordring::tag_tree<Value>;
+		friend class wordring::tag_tree<Value, Allocator>;
 
-		friend class const_tag_tree_character_iterator<Value>;
-		friend class tag_tree_character_iterator<Value>;
+		friend class const_tag_tree_character_iterator<Value, Allocator>;
+		friend class tag_tree_character_iterator<Value, Allocator>;
 
 	public:
 		using value_type = std::remove_cv_t<Value>;
@@ -169,9 +162,9 @@ namespace wordring::detail
 		using pointer           = value_type*;
 		using iterator_category = std::bidirectional_iterator_tag;
 
-		using container = std::vector<detail::tag_node<value_type>>;
+		using container = std::vector<detail::tag_node<value_type>, Allocator>;
 
-		using base_type = const_tag_tree_serial_iterator<Value>;
+		using base_type = const_tag_tree_serial_iterator<Value, Allocator>;
 
 	private:
 		using base_type::m_c;
@@ -182,7 +175,7 @@ namespace wordring::detail
 			: base_type()
 		{}
 
-		tag_tree_serial_iterator(tag_tree_iterator<Value> const& x)
+		tag_tree_serial_iterator(tag_tree_iterator<Value, Allocator> const& x)
 			: base_type(x)
 		{}
 
@@ -192,9 +185,9 @@ namespace wordring::detail
 
 		/*! @brief tag_tree_iterator へ変換する
 		*/
-		operator tag_tree_iterator<Value>() const
+		operator tag_tree_iterator<Value, Allocator>() const
 		{
-			return tag_tree_iterator<Value>(m_c, m_i);
+			return tag_tree_iterator<Value, Allocator>(m_c, m_i);
 		}
 
 		reference operator*() const
@@ -2,8 +2,43 @@
 
 #include <wordring/html/simple_traits.hpp>
 
+#include <memory>
+#include <type_traits>
+
+namespace wordring::detail
+{
+	template <typename Value>
+	struct tag_node;
+}
+
+// アロケータの既定値は、以下の前方宣言でのみ指定する
+
+namespace wordring
+{
+	template <typename Value, typename Allocator = std::allocator<detail::tag_node<std::remove_cv_t<Value>>>>
+	class tag_tree;
+}
+
 namespace wordring::detail
 {
+	template <typename Value, typename Allocator = std::allocator<tag_node<std::remove_cv_t<Value>>>>
+	class const_tag_tree_iterator;
+
+	template <typename Value, typename Allocator = std::allocator<tag_node<std::remove_cv_t<Value>>>>
+	class tag_tree_iterator;
+
+	template <typename Value, typename Allocator = std::allocator<tag_node<std::remove_cv_t<Value>>>>
+	class const_tag_tree_serial_iterator;
+
+	template <typename Value, typename Allocator = std::allocator<tag_node<std::remove_cv_t<Value>>>>
+	class tag_tree_serial_iterator;
+
+	template <typename Value, typename Allocator = std::allocator<tag_node<std::remove_cv_t<Value>>>>
+	class const_tag_tree_character_iterator;
+
+	template <typename Value, typename Allocator = std::allocator<tag_node<std::remove_cv_t<Value>>>>
+	class tag_tree_character_iterator;
+
 	template <typename Value>
 	struct tag_node
 	{
@@ -15,6 +50,12 @@ namespace wordring::detail
 		std::uint32_t m_head = 0;
 		std::uint32_t m_tail = 0;
 
+		/*! @brief 親ノードの開始タグ。最上位のノードでは 0
+
+		終了タグには、対応する開始タグを格納する。
+		*/
+		std::uint32_t m_parent = 0;
+
 		value_type m_value = value_type();
 	};
 }
@@ -4,6 +4,7 @@
 #include <wordring/tag_tree/character_iterator.hpp>
 #include <wordring/tag_tree/serial_iterator.hpp>
 #include <wordring/tag_tree/tag_node.hpp>
+#include <wordring/tag_tree/tag_tree_cursor.hpp>
 #include <wordring/tag_tree/tag_tree_iterator.hpp>
 
 #include <wordring/html/html_defs.hpp>
@@ -16,23 +17,31 @@
 namespace wordring
 {
 	/*! @brief HTML/XML 用の木
+
+	@tparam Value     ノードの値
+	@tparam Allocator detail::tag_node<Value> のアロケータ
+
+	値がアロケータを使う型の場合、挿入する値は木のアロケータを使って作り直す。
+	std::pmr::polymorphic_allocator と std::pmr::monotonic_buffer_resource を使えば、
+	文書全体をひとつの記憶域へ置き、まとめて解放できる。
 	*/
-	template <typename Value>
+	template <typename Value, typename Allocator>
 	class tag_tree
 	{
 	public:
 		using value_type      = std::remove_cv_t<Value>;
+		using allocator_type  = Allocator;
 		using size_type       = std::size_t;
 		using difference_type = std::ptrdiff_t;
 		using reference       = value_type&;
 		using const_reference = value_type const&;
 		using pointer         = value_type*;
 		using const_pointer   = value_type const*;
-		using iterator        = detail::tag_tree_iterator<value_type>;
-		using const_iterator  = detail::const_tag_tree_iterator<value_type>;
+		using iterator        = detail::tag_tree_iterator<value_type, allocator_type>;
+		using const_iterator  = detail::const_tag_tree_iterator<value_type, allocator_type>;
 
 		using wrapper   = detail::tag_node<value_type>;
-		using container = std::vector<wrapper>;
+		using container = std::vector<wrapper, allocator_type>;
 
 		using node_traits       = html::node_traits<iterator>;
 		using const_node_traits = html::node_traits<const_iterator>;
@@ -54,20 +63,20 @@ namespace wordring
 		/*! @brief 行きがかり順にノードを走査するイテレータ
 		* （空の値を持つ）終了タグ相当の位置へも移動します。
 		*/
-		using const_serial_iterator = detail::const_tag_tree_serial_iterator<Value>;
+		using const_serial_iterator = detail::const_tag_tree_serial_iterator<Value, Allocator>;
 
 		/*! @brief 行きがかり順にノードを走査するイテレータ
 		* （空の値を持つ）終了タグ相当の位置へも移動します。
 		*/
-		using serial_iterator = detail::tag_tree_serial_iterator<Value>;
+		using serial_iterator = detail::tag_tree_serial_iterator<Value, Allocator>;
 
 		/*! @brief 行きがかり順にテキスト・ノードの文字を走査するイテレータ
 		*/
-		using const_character_iterator = detail::const_tag_tree_character_iterator<Value>;
+		using const_character_iterator = detail::const_tag_tree_character_iterator<Value, Allocator>;
 
 		/*! @brief 行きがかり順にテキスト・ノードの文字を走査するイテレータ
 		*/
-		using character_iterator = detail::tag_tree_character_iterator<Value>;
+		using character_iterator = detail::tag_tree_character_iterator<Value, Allocator>;
 
 		/*! @brief 逆参照が wchar_t を返す、行きがかり順にテキスト・ノードの文字を走査するイテレータ
 		* std::regex で必要になり用意しました。
@@ -81,29 +90,54 @@ namespace wordring
 
 	public:
 		tag_tree()
-			: m_c(std::make_unique<container>(1, wrapper{ 0, 0, 0, 0 }))
+			: m_c(std::make_unique<container>(1, wrapper{ 0, 0, 0, 0, 0 }))
+			, m_size(0)
+		{}
+
+		/*! @brief アロケータを指定して空の木を構築する
+
+		@param [in] alloc アロケータ
+		*/
+		explicit tag_tree(allocator_type const& alloc)
+			: m_c(std::make_unique<container>(1, wrapper{ 0, 0, 0, 0, 0 }, alloc))
+			, m_size(0)
 		{}
 
 		tag_tree(tag_tree const& rhs)
 			: m_c(std::make_unique<container>(*rhs.m_c))
+			, m_size(rhs.m_size)
 		{}
 
-		tag_tree(tag_tree&& rhs)
+		tag_tree(tag_tree&& rhs) noexcept
 			: m_c(std::move(rhs.m_c))
+			, m_size(rhs.m_size)
 		{}
 
+		/*! @brief 木を複写する
+
+		既に記憶域を持つ場合、それを使い回して値を複写する。
+		同じ種類のノード同士は代入となるため、文字列や属性の記憶域も使い回される。
+		同じ雛形を何度も複写する場合、複写先の木を捨てずに再利用すると割り当てが減る。
+
+		@sa tag_tree_pool
+		*/
 		tag_tree& operator=(tag_tree const& rhs)
 		{
-			m_c = std::make_unique<container>(*rhs.m_c);
+			if (m_c) *m_c = *rhs.m_c;
+			else m_c = std::make_unique<container>(*rhs.m_c);
+			m_size = rhs.m_size;
 			return *this;
 		}
 
-		tag_tree& operator=(tag_tree&& rhs)
+		tag_tree& operator=(tag_tree&& rhs) noexcept
 		{
 			m_c = std::move(rhs.m_c);
+			m_size = rhs.m_size;
 			return *this;
 		}
 
+		allocator_type get_allocator() const { return m_c->get_allocator(); }
+
 		iterator begin() { return iterator(m_c.get(), m_c->front().m_next); }
 
 		const_iterator begin() const { return const_iterator(m_c.get(), m_c->front().m_next); }
@@ -126,36 +160,77 @@ namespace wordring
 
 		bool empty() const { return m_c->data()->m_next == 0; }
 
-		size_type size() const
+		/*! @brief ノード数を返す
+
+		終了タグは数えない。
+		*/
+		size_type size() const { return m_size; }
+
+		void clear()
+		{
+			m_c->clear();
+			m_c->insert(m_c->begin(), wrapper{ 0, 0, 0, 0, 0 });
+			m_size = 0;
+		}
+
+		void swap(tag_tree& rhs)
 		{
-			size_type n = 0;
+			std::swap(m_c, rhs.m_c);
+			std::swap(m_size, rhs.m_size);
+		}
+
+		/*! @brief ノードを行きがかり順に格納し直す
+
+		挿入と削除を繰り返した木は、格納位置が文書順から離れ、走査のたびにメモリを飛び回る。
+		この関数はノードを文書順に詰め直し、開放済みノードを取り除く。
+		すべてのイテレータと index() の値は無効となる。
 
+		@return 旧格納位置を添え字とし、新格納位置を値とする対応表。開放済みの位置は 0
+
+		index() を添え字として木の外に置いた配列は、戻り値で添え字を付け替えて使い続けられる。
+		*/
+		std::vector<std::uint32_t> compact()
+		{
 			wrapper* d = m_c->data();
+
+			// 旧格納位置から新格納位置への対応
+			std::vector<std::uint32_t> map(m_c->size(), 0);
+			std::uint32_t n = 0;
+			for (std::uint32_t idx = d->m_next; idx != 0; idx = (d + idx)->m_next) map[idx] = ++n;
+
+			container c(m_c->get_allocator());
+			c.reserve(n + 1);
+			c.push_back(wrapper{ n, n == 0 ? 0 : 1u, 0, 0, 0 });
 			for (std::uint32_t idx = d->m_next; idx != 0; idx = (d + idx)->m_next)
 			{
-				std::uint32_t tail = (d + idx)->m_tail;
-				std::uint32_t head = (d + idx)->m_head;
-				if (tail == 0 && head != 0) continue; // 終了タグ
-				++n;
+				std::uint32_t i = c.size();
+				wrapper& w = *(d + idx);
+				c.push_back(wrapper{ i - 1, i == n ? 0 : i + 1, map[w.m_head], map[w.m_tail], map[w.m_parent], std::move(w.m_value) });
 			}
 
-			return n;
-		}
+			// イテレータが保持するコンテナへのポインタは変えない
+			*m_c = std::move(c);
 
-		void clear()
-		{
-			m_c->clear();
-			m_c->insert(m_c->begin(), wrapper{ 0, 0, 0, 0 });
+			return map;
 		}
 
-		void swap(tag_tree& rhs) { std::swap(m_c, rhs.m_c); }
+		/*! @brief ノードの格納位置を返す
+
+		格納位置はノードが削除されるか compact() を呼び出すまで変わらないため、木の外に置いた配列からノードごとの情報を引く添え字として使える。
+		compact() の後は、 compact() が返す対応表で添え字を付け替える。
+		*/
+		std::uint32_t index(const_iterator it) const { return it.m_i; }
 
 		iterator insert(const_iterator pos, value_type&& val)
 		{
 			bool single = node_traits::is_single(val);
 
+			std::uint32_t parent = parent_of_position(pos.m_i);
+
 			std::uint32_t tag = allocate(std::move(val));
 			link(pos.m_i, tag);
+			++m_size;
+			m_c->data()[tag].m_parent = parent;
 			if (!single)
 			{
 				std::uint32_t end_tag = allocate(value_type());
@@ -164,6 +239,7 @@ namespace wordring
 				wrapper* d = m_c->data();
 				(d + tag)->m_tail = end_tag;
 				(d + end_tag)->m_head = tag;
+				(d + end_tag)->m_parent = tag;
 			}
 			return iterator(m_c.get(), tag);
 		}
@@ -194,6 +270,9 @@ namespace wordring
 			(d + sub_before)->m_next = sub_after;
 			(d + sub_after)->m_prev = sub_before;
 
+			// 子孫と終了タグの親は変わらない
+			(d + sub_head)->m_parent = parent_of_position(pos_idx);
+
 			return iterator(m_c.get(), sub_head);
 		}
 
@@ -208,6 +287,7 @@ namespace wordring
 			while (tail != before)
 			{
 				std::uint32_t prev = (d + tail)->m_prev;
+				if ((d + tail)->m_tail != 0 || (d + tail)->m_head == 0) --m_size; // 終了タグ以外
 				unlink(tail);
 				free(tail);
 				tail = prev;
@@ -217,27 +297,51 @@ namespace wordring
 		}
 
 	protected:
-		std::uint32_t allocate(value_type&& val)
+		/*! @brief pos の前へ挿入されるノードの親を返す
+
+		pos が終了タグの場合はその開始タグ、それ以外の場合は pos の兄弟として挿入されるため pos の親。
+		いずれも pos の「PARENT」に格納されている。
+		*/
+		std::uint32_t parent_of_position(std::uint32_t pos) const
 		{
+			return (m_c->data() + pos)->m_parent;
+		}
+
+		/*! @brief 値を木のアロケータで作り直す
+
+		値の型がアロケータを使わない場合、そのまま返す。
+		*/
+		value_type rebind(value_type&& val) const
+		{
+			if constexpr (std::uses_allocator_v<value_type, allocator_type>)
+			{
+				return value_type(std::move(val), typename value_type::allocator_type(m_c->get_allocator()));
+			}
+			else return std::move(val);
+		}
+
+		std::uint32_t allocate(value_type&& v)
+		{
+			value_type val = rebind(std::move(v));
 			wrapper* d = m_c->data();
 			std::uint32_t idx = d->m_tail;
 
 			if (idx == 0) // 開放済みノードが無い
 			{
 				idx = m_c->size();
-				m_c->emplace_back(wrapper{ 0, 0, 0, 0, std::move(val) });
+				m_c->emplace_back(wrapper{ 0, 0, 0, 0, 0, std::move(val) });
 			}
 			else // 開放済みノードが有る
 			{
-				std::uint32_t before = (d + idx)->m_head;
-				std::uint32_t after = (d + idx)->m_tail;
+				// 番兵の「TAIL」を先頭とする単方向リストから取り出す
+				d->m_tail = (d + idx)->m_tail;
+
 				(d + idx)->m_value = std::move(val);
 				// 使わない項目を0に初期化
-				(d + idx)->m_prev = 0;
-				(d + idx)->m_next = 0;
-
-				(d + before)->m_tail = after;
-				(d + after)->m_head = before;
+				(d + idx)->m_prev   = 0;
+				(d + idx)->m_next   = 0;
+				(d + idx)->m_tail   = 0;
+				(d + idx)->m_parent = 0;
 			}
 
 			return idx;
@@ -249,20 +353,10 @@ namespace wordring
 
 			wrapper* d = m_c->data();
 
-			// idx を超えない最後の未使用ノードを探す
-			std::uint32_t before = 0;
-			for (std::uint32_t i = d->m_tail; i != 0 && i < idx; i = (d + before)->m_tail) before = i;
-
-			// idx を超える最初の未使用ノードを探す
-			std::uint32_t after = (d + before)->m_tail;
-
-			// リンクを張り替える
-			(d + before)->m_tail = idx;
-
-			(d + idx)->m_head = before;
-			(d + idx)->m_tail = after;
-
-			(d + after)->m_head = idx;
+			// 番兵の「TAIL」を先頭とする単方向リストの先頭へ繋ぐ
+			(d + idx)->m_head = 0;
+			(d + idx)->m_tail = d->m_tail;
+			d->m_tail = idx;
 
 			// 使わない項目を0に初期化
 			(d + idx)->m_prev = 0;
@@ -314,5 +408,8 @@ namespace wordring
 
 	protected:
 		std::unique_ptr<container> m_c;
+
+		/*! @brief 終了タグを除くノード数 */
+		size_type m_size;
 	};
 }
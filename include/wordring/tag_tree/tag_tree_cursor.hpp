@@ -0,0 +1,241 @@
+﻿#pragma once
+
+#include <wordring/tag_tree/serial_iterator.hpp>
+#include <wordring/tag_tree/tag_node.hpp>
+#include <wordring/tag_tree/tag_tree_iterator.hpp>
+
+#include <wordring/tree/tree_cursor.hpp>
+
+#include <iterator>
+
+namespace wordring::detail
+{
+	/*! @brief tag_tree をプレ・オーダーで走査するカーソルの実装
+
+	@tparam Iterator       const_tag_tree_iterator あるいは tag_tree_iterator
+	@tparam SerialIterator Iterator に対応する行きがかり順のイテレータ
+
+	tag_tree のノードは開始タグ、終了タグともに文書順のリンクで繋がっているため、
+	プレ・オーダーは終了タグを読み飛ばしながらリンクを辿るだけとなる。
+	部分木の読み飛ばしは、開始タグから終了タグへ一度で移る。
+	*/
+	template <typename Iterator, typename SerialIterator>
+	class tag_tree_pre_order_cursor
+	{
+		friend bool operator==(tag_tree_pre_order_cursor const& lhs, tag_tree_pre_order_cursor const& rhs)
+		{
+			return (lhs.m_end && rhs.m_end) || (!lhs.m_end && !rhs.m_end && lhs.m_it == rhs.m_it);
+		}
+
+		friend bool operator!=(tag_tree_pre_order_cursor const& lhs, tag_tree_pre_order_cursor const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+	public:
+		using base_type = Iterator;
+
+		using value_type        = typename std::iterator_traits<base_type>::value_type;
+		using difference_type   = typename std::iterator_traits<base_type>::difference_type;
+		using reference         = typename std::iterator_traits<base_type>::reference;
+		using pointer           = typename std::iterator_traits<base_type>::pointer;
+		using iterator_category = std::forward_iterator_tag;
+
+	public:
+		tag_tree_pre_order_cursor()
+			: m_it()
+			, m_last()
+			, m_end(true)
+		{
+		}
+
+		explicit tag_tree_pre_order_cursor(base_type const& root)
+			: m_it(root)
+			, m_last()
+			, m_end(false)
+		{
+			// 部分木の最後の位置。終了タグが無い場合、根そのもの
+			m_last = m_it.is_start_tag() ? m_it.end_tag() : m_it;
+		}
+
+		base_type base() const { return m_it; }
+
+		reference operator*() const { return *m_it; }
+
+		pointer operator->() const { return m_it.operator->(); }
+
+		tag_tree_pre_order_cursor& operator++()
+		{
+			if (m_it == m_last) m_end = true;
+			else advance();
+
+			return *this;
+		}
+
+		base_type operator++(int)
+		{
+			base_type result = m_it;
+			operator++();
+			return result;
+		}
+
+		void skip_subtree()
+		{
+			if (m_it.is_start_tag()) m_it = m_it.end_tag();
+			operator++();
+		}
+
+	private:
+		/*! @brief 次の位置へ進み、終了タグを読み飛ばす
+		*/
+		void advance()
+		{
+			do
+			{
+				++m_it;
+				if (m_it == m_last)
+				{
+					m_end = true;
+					return;
+				}
+			}
+			while (m_it.is_end_tag());
+		}
+
+	private:
+		SerialIterator m_it;
+		SerialIterator m_last;
+		bool           m_end;
+	};
+
+	/*! @brief tag_tree をポスト・オーダーで走査するカーソルの実装
+
+	文書順のリンクを辿り、終了タグの位置で要素を、それ以外の位置で終了タグを持たないノードを訪れる。
+	*/
+	template <typename Iterator, typename SerialIterator>
+	class tag_tree_post_order_cursor
+	{
+		friend bool operator==(tag_tree_post_order_cursor const& lhs, tag_tree_post_order_cursor const& rhs)
+		{
+			return (lhs.m_end && rhs.m_end) || (!lhs.m_end && !rhs.m_end && lhs.m_it == rhs.m_it);
+		}
+
+		friend bool operator!=(tag_tree_post_order_cursor const& lhs, tag_tree_post_order_cursor const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+	public:
+		using base_type = Iterator;
+
+		using value_type        = typename std::iterator_traits<base_type>::value_type;
+		using difference_type   = typename std::iterator_traits<base_type>::difference_type;
+		using reference         = typename std::iterator_traits<base_type>::reference;
+		using pointer           = typename std::iterator_traits<base_type>::pointer;
+		using iterator_category = std::forward_iterator_tag;
+
+	public:
+		tag_tree_post_order_cursor()
+			: m_it()
+			, m_last()
+			, m_end(true)
+		{
+		}
+
+		explicit tag_tree_post_order_cursor(base_type const& root)
+			: m_it(root)
+			, m_last()
+			, m_end(false)
+		{
+			m_last = m_it.is_start_tag() ? m_it.end_tag() : m_it;
+			while (m_it.is_start_tag()) ++m_it;
+		}
+
+		base_type base() const { return m_it.is_end_tag() ? m_it.start_tag() : m_it; }
+
+		reference operator*() const { return *base(); }
+
+		pointer operator->() const { return base().operator->(); }
+
+		tag_tree_post_order_cursor& operator++()
+		{
+			if (m_it == m_last)
+			{
+				m_end = true;
+				return *this;
+			}
+
+			++m_it;
+			while (m_it.is_start_tag()) ++m_it;
+
+			return *this;
+		}
+
+		base_type operator++(int)
+		{
+			base_type result = base();
+			operator++();
+			return result;
+		}
+
+	private:
+		SerialIterator m_it;
+		SerialIterator m_last;
+		bool           m_end;
+	};
+}
+
+namespace wordring
+{
+	/*! @brief tag_tree のイテレータに対する pre_order_cursor の特殊化
+	*/
+	template <typename Value, typename Allocator>
+	class pre_order_cursor<detail::const_tag_tree_iterator<Value, Allocator>>
+		: public detail::tag_tree_pre_order_cursor<
+			detail::const_tag_tree_iterator<Value, Allocator>, detail::const_tag_tree_serial_iterator<Value, Allocator>>
+	{
+		using base_cursor = detail::tag_tree_pre_order_cursor<
+			detail::const_tag_tree_iterator<Value, Allocator>, detail::const_tag_tree_serial_iterator<Value, Allocator>>;
+
+	public:
+		using base_cursor::base_cursor;
+	};
+
+	template <typename Value, typename Allocator>
+	class pre_order_cursor<detail::tag_tree_iterator<Value, Allocator>>
+		: public detail::tag_tree_pre_order_cursor<
+			detail::tag_tree_iterator<Value, Allocator>, detail::tag_tree_serial_iterator<Value, Allocator>>
+	{
+		using base_cursor = detail::tag_tree_pre_order_cursor<
+			detail::tag_tree_iterator<Value, Allocator>, detail::tag_tree_serial_iterator<Value, Allocator>>;
+
+	public:
+		using base_cursor::base_cursor;
+	};
+
+	/*! @brief tag_tree のイテレータに対する post_order_cursor の特殊化
+	*/
+	template <typename Value, typename Allocator>
+	class post_order_cursor<detail::const_tag_tree_iterator<Value, Allocator>>
+		: public detail::tag_tree_post_order_cursor<
+			detail::const_tag_tree_iterator<Value, Allocator>, detail::const_tag_tree_serial_iterator<Value, Allocator>>
+	{
+		using base_cursor = detail::tag_tree_post_order_cursor<
+			detail::const_tag_tree_iterator<Value, Allocator>, detail::const_tag_tree_serial_iterator<Value, Allocator>>;
+
+	public:
+		using base_cursor::base_cursor;
+	};
+
+	template <typename Value, typename Allocator>
+	class post_order_cursor<detail::tag_tree_iterator<Value, Allocator>>
+		: public detail::tag_tree_post_order_cursor<
+			detail::tag_tree_iterator<Value, Allocator>, detail::tag_tree_serial_iterator<Value, Allocator>>
+	{
+		using base_cursor = detail::tag_tree_post_order_cursor<
+			detail::tag_tree_iterator<Value, Allocator>, detail::tag_tree_serial_iterator<Value, Allocator>>;
+
+	public:
+		using base_cursor::base_cursor;
+	};
+}
@@ -2,34 +2,23 @@
 
 #include <wordring/tag_tree/tag_node.hpp>
 
-namespace wordring
-{
-	template <typename Value>
-	class tag_tree;
-}
-
 namespace wordring::detail
 {
-	template <typename Value> class const_tag_tree_serial_iterator;
-	template <typename Value> class tag_tree_serial_iterator;
 
-	template <typename Value> class const_tag_tree_character_iterator;
-	template <typename Value> class tag_tree_character_iterator;
 
-	template <typename Value> class tag_tree_iterator;
 
-	template <typename Value>
+	template <typename Value, typename Allocator>
 	class const_tag_tree_iterator
 	{
-		friend class const_tag_tree_serial_iterator<Value>;
-		friend class tag_tree_serial_iterator<Value>;
+		friend class const_tag_tree_serial_iterator<Value, Allocator>;
+		friend class tag_tree_serial_iterator<Value, Allocator>;
 
-		friend class const_tag_tree_character_iterator<Value>;
-		friend class tag_tree_character_iterator<Value>;
+		friend class const_tag_tree_character_iterator<Value, Allocator>;
+		friend class tag_tree_character_iterator<Value, Allocator>;
 
-		friend class tag_tree_iterator<Value>;
+		friend class tag_tree_iterator<Value, Allocator>;
 
-		friend class wordring::tag_tree<Value>;
+		friend class wordring::tag_tree<Value, Allocator>;
 
 	public:
 		using value_type = std::remove_cv_t<Value>;
@@ -40,7 +29,7 @@ namespace wordring::detail
 		using pointer           = value_type const*;
 		using iterator_category = std::bidirectional_iterator_tag;
 
-		using container = std::vector<detail::tag_node<value_type>>;
+		using container = std::vector<detail::tag_node<value_type>, Allocator>;
 
 	public:
 		const_tag_tree_iterator()
@@ -52,7 +41,7 @@ namespace wordring::detail
 			: m_c(c)
 			, m_i(i) {}
 
-		const_tag_tree_iterator(tag_tree_iterator<Value> const& x)
+		const_tag_tree_iterator(tag_tree_iterator<Value, Allocator> const& x)
 			: m_c(x.m_c)
 			, m_i(x.m_i) {}
 
@@ -103,31 +92,14 @@ namespace wordring::detail
 		* @internal
 		* <hr>
 		*
-		* 対象ノードのひとつ前のノードが開始タグなら、その開始タグは「親ノード」。
-		* それ以外の場合、それはひとつ前の兄弟ノードの終了タグ、あるいはシングルノード。
-		* 「あれば開始タグ無ければ自身」の前のノードを対象ノードとして、開始タグが見つかるまで上のアルゴリズムを繰り返せば、
-		* いずれ、「親ノード」に行き着く。
-		*
-		* - 開始タグは「TAIL」があるノード。
-		* - 終了タグは「HEAD」があるノード。
-		* - 根に「親ノード」は無い。
-		* - 根ノードは「PREV」が 0 のノード。
+		* ノードは挿入と移動の際に「PARENT」へ親の開始タグを記録するため、定数時間で求まる。
+		* 終了タグの「PARENT」は対応する開始タグなので、 end() の親はその要素自身となる。
+		* 最上位のノードに「親ノード」は無く、「PARENT」は 0 。
 		*/
 		const_tag_tree_iterator parent() const
 		{
-			wrapper* d = m_c->data();
-
-			std::uint32_t idx = (d + m_i)->m_prev;
-			while (idx != 0)
-			{
-				if ((d + idx)->m_tail != 0) return const_tag_tree_iterator(m_c, idx);
-
-				std::uint32_t head = (d + idx)->m_head;
-				if (head) idx = head;
-				idx = (d + idx)->m_prev;
-			}
-
-			return const_tag_tree_iterator();
+			std::uint32_t idx = (m_c->data() + m_i)->m_parent;
+			return idx == 0 ? const_tag_tree_iterator() : const_tag_tree_iterator(m_c, idx);
 		}
 
 		const_tag_tree_iterator begin() const
@@ -158,17 +130,17 @@ namespace wordring::detail
 		std::uint32_t m_i;
 	};
 
-	template <typename Value>
-	class tag_tree_iterator : public const_tag_tree_iterator<Value>
+	template <typename Value, typename Allocator>
+	class tag_tree_iterator : public const_tag_tree_iterator<Value, Allocator>
 	{
-		friend class const_tag_tree_serial_iterator<Value>;
-		friend class tag_tree_serial_iterator<Value>;
+		friend class const_tag_tree_serial_iterator<Value, Allocator>;
+		friend class tag_tree_serial_iterator<Value, Allocator>;
 
-		friend class const_tag_tree_character_iterator<Value>;
-		friend class tag_tree_character_iterator<Value>;
+		friend class const_tag_tree_character_iterator<Value, Allocator>;
+		friend class tag_tree_character_iterator<Value, Allocator>;
 
-		friend class const_tag_tree_iterator<Value>;
-		friend class wordring::tag_tree<Value>;
+		friend class const_tag_tree_iterator<Value, Allocator>;
+		friend class wordring::tag_tree<Value, Allocator>;
 
 	public:
 		using value_type = std::remove_cv_t<Value>;
@@ -179,9 +151,9 @@ namespace wordring::detail
 		using pointer           = value_type*;
 		using iterator_category = std::bidirectional_iterator_tag;
 
-		using container = std::vector<detail::tag_node<value_type>>;
+		using container = std::vector<detail::tag_node<value_type>, Allocator>;
 
-		using base_type = const_tag_tree_iterator<Value>;
+		using base_type = const_tag_tree_iterator<Value, Allocator>;
 
 	private:
 		using base_type::m_c;
@@ -196,9 +168,9 @@ namespace wordring::detail
 			: base_type(c, i)
 		{}
 
-		operator const_tag_tree_iterator<Value>() const
+		operator const_tag_tree_iterator<Value, Allocator>() const
 		{
-			return tag_tree_iterator<Value>(m_c, m_i);
+			return tag_tree_iterator<Value, Allocator>(m_c, m_i);
 		}
 
 		reference operator*() const
@@ -250,15 +222,9 @@ namespace wordring::detail
 		* @internal
 		* <hr>
 		*
-		* 対象ノードのひとつ前のノードが開始タグなら、その開始タグは「親ノード」。
-		* それ以外の場合、それはひとつ前の兄弟ノードの終了タグ、あるいはシングルノード。
-		* 「あれば開始タグ無ければ自身」の前のノードを対象ノードとして、開始タグが見つかるまで上のアルゴリズムを繰り返せば、
-		* いずれ、「親ノード」に行き着く。
-		*
-		* - 開始タグは「TAIL」があるノード。
-		* - 終了タグは「HEAD」があるノード。
-		* - 根に「親ノード」は無い。
-		* - 根ノードは「PREV」が 0 のノード。
+		* ノードは挿入と移動の際に「PARENT」へ親の開始タグを記録するため、定数時間で求まる。
+		* 終了タグの「PARENT」は対応する開始タグなので、 end() の親はその要素自身となる。
+		* 最上位のノードに「親ノード」は無く、「PARENT」は 0 。
 		*/
 		tag_tree_iterator parent() const
 		{
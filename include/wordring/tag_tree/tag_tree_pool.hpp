@@ -0,0 +1,83 @@
+﻿#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace wordring
+{
+	/*! @brief 雛形の木を複写するための、使い終わった木の置き場
+
+	@tparam Tree tag_tree
+
+	clone() は返却済みの木があればそれへ雛形を代入し、無ければ雛形を複写して新しい木を作る。
+	tag_tree の代入はノード配列、文字列、属性の記憶域を使い回すため、
+	同じ雛形の複写と返却を繰り返すと、二回目以降の割り当ては編集で増えた分のみとなる。
+
+	ノードの値の複写そのものは省かない。
+	雛形と複写先で記憶域を共有しないため、複写した木はイテレータを含めて通常の tag_tree として扱える。
+
+	@par 例
+	@code
+		tag_tree_pool<u8simple_tree> pool(std::move(prototype));
+		u8simple_tree t = pool.clone();
+		// t を編集して使う
+		pool.release(std::move(t));
+	@endcode
+	*/
+	template <typename Tree>
+	class tag_tree_pool
+	{
+	public:
+		using tree_type = Tree;
+		using size_type = std::size_t;
+
+	public:
+		explicit tag_tree_pool(tree_type const& prototype)
+			: m_prototype(prototype)
+			, m_pool()
+		{
+		}
+
+		explicit tag_tree_pool(tree_type&& prototype)
+			: m_prototype(std::move(prototype))
+			, m_pool()
+		{
+		}
+
+		/*! @brief 雛形を返す */
+		tree_type const& prototype() const { return m_prototype; }
+
+		/*! @brief 雛形の複写を返す
+		*/
+		tree_type clone()
+		{
+			if (m_pool.empty()) return tree_type(m_prototype);
+
+			tree_type t(std::move(m_pool.back()));
+			m_pool.pop_back();
+			t = m_prototype;
+
+			return t;
+		}
+
+		/*! @brief 使い終わった木を返却する
+
+		木の内容は次の clone() で上書きされる。
+		*/
+		void release(tree_type&& t)
+		{
+			m_pool.push_back(std::move(t));
+		}
+
+		/*! @brief 返却済みの木の数を返す */
+		size_type pooled() const { return m_pool.size(); }
+
+		/*! @brief 返却済みの木を捨てる */
+		void shrink() { m_pool.clear(); }
+
+	protected:
+		tree_type              m_prototype;
+		std::vector<tree_type> m_pool;
+	};
+}
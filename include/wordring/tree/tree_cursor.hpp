@@ -0,0 +1,226 @@
+﻿#pragma once
+
+#include <iterator>
+
+namespace wordring
+{
+	/*! @class pre_order_cursor tree_cursor.hpp wordring/tree/tree_cursor.hpp
+	*
+	* @brief スタックを持たずにプレ・オーダーで木を走査するイテレータ・アダプター
+	*
+	* @tparam Iterator ベースとなる木のイテレータ。 begin() 、 end() 、 parent() と前進を持つこと
+	*
+	* basic_tree_iterator と異なり、道順を親へのリンクから求めるため、構築、前進、コピーのいずれもメモリを確保しない。
+	* 走査するのは、構築時に与えた要素とその子孫に限る。
+	* 
+	* skip_subtree() によって、現在の要素の子孫を読み飛ばせる。
+	*
+	* @code
+	* 	for (pre_order_cursor<tree::const_iterator> it(t.begin()), last; it != last; ++it)
+	* 	{
+	* 		if (*it == 2) it.skip_subtree();
+	* 	}
+	* @endcode
+	*
+	* tag_tree のイテレータに対しては、文書順に並ぶリンクを辿る特殊化を tag_tree_cursor.hpp に置く。
+	*/
+	template <typename Iterator>
+	class pre_order_cursor
+	{
+		friend bool operator==(pre_order_cursor const& lhs, pre_order_cursor const& rhs)
+		{
+			return (lhs.m_end && rhs.m_end) || (!lhs.m_end && !rhs.m_end && lhs.m_it == rhs.m_it);
+		}
+
+		friend bool operator!=(pre_order_cursor const& lhs, pre_order_cursor const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+	public:
+		using base_type = Iterator;
+
+		using value_type        = typename std::iterator_traits<base_type>::value_type;
+		using difference_type   = typename std::iterator_traits<base_type>::difference_type;
+		using reference         = typename std::iterator_traits<base_type>::reference;
+		using pointer           = typename std::iterator_traits<base_type>::pointer;
+		using iterator_category = std::forward_iterator_tag;
+
+	public:
+		/*! @brief 終端を構築する
+		*/
+		pre_order_cursor()
+			: m_root()
+			, m_it()
+			, m_end(true)
+		{
+		}
+
+		/*! @brief 走査する部分木の根を指定して構築する
+		*/
+		explicit pre_order_cursor(base_type const& root)
+			: m_root(root)
+			, m_it(root)
+			, m_end(false)
+		{
+		}
+
+		/*! @brief 現在の位置を指す、元となる木のイテレータを返す
+		*/
+		base_type base() const { return m_it; }
+
+		reference operator*() const { return const_cast<reference>(*m_it); }
+
+		pointer operator->() const { return const_cast<pointer>(m_it.operator->()); }
+
+		/*! @brief 次の要素へ進める
+		*
+		* 子が有れば最初の子へ、無ければ skip_subtree() と同じく次の兄弟あるいは祖先の次の兄弟へ進む。
+		*/
+		pre_order_cursor& operator++()
+		{
+			if (m_it.begin() != m_it.end()) m_it = m_it.begin();
+			else skip_subtree();
+
+			return *this;
+		}
+
+		/*! @brief 次の要素へ進める
+		*
+		* @return 進める前の位置を指す元となる木のイテレータ
+		*/
+		base_type operator++(int)
+		{
+			base_type result = m_it;
+			operator++();
+			return result;
+		}
+
+		/*! @brief 現在の要素の子孫を読み飛ばし、次の兄弟あるいは祖先の次の兄弟へ進める
+		*/
+		void skip_subtree()
+		{
+			for (base_type it = m_it; it != m_root;)
+			{
+				base_type parent = it.parent();
+				if (++it != parent.end())
+				{
+					m_it = it;
+					return;
+				}
+				it = parent;
+			}
+
+			m_end = true;
+		}
+
+	private:
+		base_type m_root;
+		base_type m_it;
+		bool      m_end;
+	};
+
+	/*! @class post_order_cursor tree_cursor.hpp wordring/tree/tree_cursor.hpp
+	*
+	* @brief スタックを持たずにポスト・オーダーで木を走査するイテレータ・アダプター
+	*
+	* @tparam Iterator ベースとなる木のイテレータ。 begin() 、 end() 、 parent() と前進を持つこと
+	*
+	* 子孫をすべて訪れた後に親を訪れる。最後に訪れるのは構築時に与えた要素となる。
+	* 構築、前進、コピーのいずれもメモリを確保しない。
+	*/
+	template <typename Iterator>
+	class post_order_cursor
+	{
+		friend bool operator==(post_order_cursor const& lhs, post_order_cursor const& rhs)
+		{
+			return (lhs.m_end && rhs.m_end) || (!lhs.m_end && !rhs.m_end && lhs.m_it == rhs.m_it);
+		}
+
+		friend bool operator!=(post_order_cursor const& lhs, post_order_cursor const& rhs)
+		{
+			return !(lhs == rhs);
+		}
+
+	public:
+		using base_type = Iterator;
+
+		using value_type        = typename std::iterator_traits<base_type>::value_type;
+		using difference_type   = typename std::iterator_traits<base_type>::difference_type;
+		using reference         = typename std::iterator_traits<base_type>::reference;
+		using pointer           = typename std::iterator_traits<base_type>::pointer;
+		using iterator_category = std::forward_iterator_tag;
+
+	public:
+		/*! @brief 終端を構築する
+		*/
+		post_order_cursor()
+			: m_root()
+			, m_it()
+			, m_end(true)
+		{
+		}
+
+		/*! @brief 走査する部分木の根を指定して構築する
+		*/
+		explicit post_order_cursor(base_type const& root)
+			: m_root(root)
+			, m_it(first_leaf(root))
+			, m_end(false)
+		{
+		}
+
+		/*! @brief 現在の位置を指す、元となる木のイテレータを返す
+		*/
+		base_type base() const { return m_it; }
+
+		reference operator*() const { return const_cast<reference>(*m_it); }
+
+		pointer operator->() const { return const_cast<pointer>(m_it.operator->()); }
+
+		/*! @brief 次の要素へ進める
+		*
+		* 次の兄弟が有ればその最初の葉へ、無ければ親へ進む。
+		*/
+		post_order_cursor& operator++()
+		{
+			if (m_it == m_root)
+			{
+				m_end = true;
+				return *this;
+			}
+
+			base_type parent = m_it.parent();
+			base_type next = m_it;
+			if (++next != parent.end()) m_it = first_leaf(next);
+			else m_it = parent;
+
+			return *this;
+		}
+
+		/*! @brief 次の要素へ進める
+		*
+		* @return 進める前の位置を指す元となる木のイテレータ
+		*/
+		base_type operator++(int)
+		{
+			base_type result = m_it;
+			operator++();
+			return result;
+		}
+
+	private:
+		/*! @brief 最初の子を辿り、最初に訪れる子孫を返す
+		*/
+		static base_type first_leaf(base_type it)
+		{
+			while (it.begin() != it.end()) it = it.begin();
+			return it;
+		}
+
+	private:
+		base_type m_root;
+		base_type m_it;
+		bool      m_end;
+	};
+}
@@ -29,6 +29,10 @@ namespace wordring::whatwg::html::parsing
 	extern wordring::trie<char32_t> const named_character_reference_idx_tbl;
 	extern std::array<std::array<char32_t, 2>, 2231> const named_character_reference_map_tbl;
 
+	extern std::array<std::uint16_t, 9855> const named_character_reference_dfa_base_tbl;
+	extern std::array<std::array<std::uint16_t, 2>, 9853> const named_character_reference_dfa_edge_tbl;
+	extern std::array<std::uint16_t, 9854> const named_character_reference_dfa_accept_tbl;
+
 	extern std::unordered_map<char32_t, char32_t> const character_reference_code_tbl;
 
 	extern std::unordered_map<std::u32string, std::u32string> const svg_attributes_conversion_tbl;
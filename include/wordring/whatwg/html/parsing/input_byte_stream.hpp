@@ -0,0 +1,315 @@
+﻿#pragma once
+
+// https://html.spec.whatwg.org/multipage/parsing.html
+// https://triple-underscore.github.io/HTML-parsing-ja.html
+
+#include <wordring/whatwg/html/url.hpp>
+
+#include <wordring/whatwg/encoding/encoding.hpp>
+#include <wordring/whatwg/encoding/encoding_defs.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace wordring::whatwg::html::parsing
+{
+	// --------------------------------------------------------------------------------------------
+	// 入力バイトストリーム
+	//
+	// 12.2.3.2 Determining the character encoding
+	// https://html.spec.whatwg.org/multipage/parsing.html#determining-the-character-encoding
+	// https://triple-underscore.github.io/HTML-parsing-ja.html#determining-the-character-encoding
+	// --------------------------------------------------------------------------------------------
+
+	/*! @brief 事前走査するバイト数の上限
+
+	規格は少なくとも 1024 バイトを走査するよう求めている。
+	*/
+	std::uint32_t constexpr prescan_byte_length = 1024;
+
+	namespace detail
+	{
+		inline bool is_prescan_white_space(unsigned char b)
+		{
+			return b == 0x9 || b == 0xA || b == 0xC || b == 0xD || b == 0x20;
+		}
+
+		/*! @brief 事前走査で見つかった属性
+		*/
+		struct prescan_attribute
+		{
+			std::u32string m_name;
+			std::u32string m_value;
+		};
+
+		/*! @brief 属性を取得する
+
+		@param [in,out] position 走査位置
+		@param [in]     last     走査範囲の終端
+		@param [out]    attr     見つかった属性
+
+		@return 属性が見つかった場合 true 、見つからない場合あるいは終端に達した場合 false を返す
+
+		@sa https://html.spec.whatwg.org/multipage/parsing.html#concept-get-attributes-when-sniffing
+		@sa https://triple-underscore.github.io/HTML-parsing-ja.html#concept-get-attributes-when-sniffing
+		*/
+		template <typename ForwardIterator>
+		inline bool get_prescan_attribute(ForwardIterator& position, ForwardIterator last, prescan_attribute& attr)
+		{
+			attr.m_name.clear();
+			attr.m_value.clear();
+
+			// 1.
+			while (position != last && (is_prescan_white_space(*position) || static_cast<unsigned char>(*position) == 0x2F)) ++position;
+			if (position == last) return false;
+			// 2.
+			if (static_cast<unsigned char>(*position) == 0x3E) return false;
+			// 3. - 5.
+			while (true)
+			{
+				if (position == last) return false;
+				unsigned char b = *position;
+
+				if (b == 0x3D && !attr.m_name.empty())
+				{
+					++position;
+					goto Value;
+				}
+				if (is_prescan_white_space(b)) break;
+				if (b == 0x2F || b == 0x3E) return true;
+
+				attr.m_name.push_back(0x41 <= b && b <= 0x5A ? b + 0x20 : b);
+				++position;
+			}
+			// 6.
+			while (position != last && is_prescan_white_space(*position)) ++position;
+			if (position == last) return false;
+			// 7.
+			if (static_cast<unsigned char>(*position) != 0x3D) return true;
+			// 8.
+			++position;
+
+		Value:
+			// 9.
+			while (position != last && is_prescan_white_space(*position)) ++position;
+			if (position == last) return false;
+			// 10.
+			{
+				unsigned char b = *position;
+				if (b == 0x22 || b == 0x27)
+				{
+					while (true)
+					{
+						if (++position == last) return false;
+						unsigned char c = *position;
+						if (c == b)
+						{
+							++position;
+							return true;
+						}
+						attr.m_value.push_back(0x41 <= c && c <= 0x5A ? c + 0x20 : c);
+					}
+				}
+				if (b == 0x3E) return true;
+
+				attr.m_value.push_back(0x41 <= b && b <= 0x5A ? b + 0x20 : b);
+				++position;
+			}
+			// 11. - 12.
+			while (position != last)
+			{
+				unsigned char b = *position;
+				if (is_prescan_white_space(b) || b == 0x3E) return true;
+				attr.m_value.push_back(0x41 <= b && b <= 0x5A ? b + 0x20 : b);
+				++position;
+			}
+
+			return false;
+		}
+
+		/*! @brief バイト列が ASCII 文字列で始まるか大文字小文字を無視して調べる
+
+		@param [in] label 小文字で指定する ASCII 文字列
+		*/
+		template <typename ForwardIterator>
+		inline bool starts_with_prescan_label(ForwardIterator first, ForwardIterator last, std::string_view label)
+		{
+			for (char c : label)
+			{
+				if (first == last) return false;
+				unsigned char b = *first++;
+				if (0x41 <= b && b <= 0x5A) b += 0x20;
+				if (b != static_cast<unsigned char>(c)) return false;
+			}
+			return true;
+		}
+	}
+
+	/*! @brief バイト・ストリーム先頭の BOM から文字エンコーディングを決定する
+
+	@return BOM が見つかった場合その文字エンコーディング、見つからなかった場合 0 を返す
+
+	@sa https://encoding.spec.whatwg.org/#bom-sniff
+	@sa https://triple-underscore.github.io/Encoding-ja.html#bom-sniff
+	*/
+	template <typename ForwardIterator>
+	inline encoding_name sniff_byte_order_mark(ForwardIterator first, ForwardIterator last)
+	{
+		static_assert(sizeof(*first) == 1);
+
+		unsigned char bom[3] = { 0, 0, 0 };
+		for (std::uint32_t i = 0; i < 3 && first != last; ++i, ++first) bom[i] = *first;
+
+		if (bom[0] == 0xEF && bom[1] == 0xBB && bom[2] == 0xBF) return encoding_name::UTF_8;
+		if (bom[0] == 0xFE && bom[1] == 0xFF) return encoding_name::UTF_16BE;
+		if (bom[0] == 0xFF && bom[1] == 0xFE) return encoding_name::UTF_16LE;
+
+		return static_cast<encoding_name>(0);
+	}
+
+	/*! @brief バイト・ストリームを事前走査し、文字エンコーディングを決定する
+
+	@param [in] first 入力バイト列の先頭
+	@param [in] last  入力バイト列の終端
+
+	@return 見つかった文字エンコーディング、見つからなかった場合 0 を返す
+
+	走査するのは先頭 prescan_byte_length バイトまでである。
+	トークン化の前に呼び出すことで、文書先頭付近の meta 要素による再解析を避けられる。
+
+	@sa https://html.spec.whatwg.org/multipage/parsing.html#prescan-a-byte-stream-to-determine-its-encoding
+	@sa https://triple-underscore.github.io/HTML-parsing-ja.html#prescan-a-byte-stream-to-determine-its-encoding
+	*/
+	template <typename ForwardIterator>
+	inline encoding_name prescan_byte_stream(ForwardIterator first, ForwardIterator last)
+	{
+		static_assert(sizeof(*first) == 1);
+
+		// 走査範囲を先頭 1024 バイトに制限する
+		{
+			ForwardIterator it = first;
+			for (std::uint32_t i = 0; i < prescan_byte_length && it != last; ++i) ++it;
+			last = it;
+		}
+
+		ForwardIterator position = first;
+
+		detail::prescan_attribute attr;
+		std::vector<std::u32string> attribute_list;
+
+		while (position != last)
+		{
+			unsigned char b = *position;
+			if (b != 0x3C)
+			{
+				++position;
+				continue;
+			}
+
+			ForwardIterator next = std::next(position);
+			if (next == last) break;
+			unsigned char b1 = *next;
+
+			if (detail::starts_with_prescan_label(position, last, "<!--"))
+			{
+				// <!-- の二つの - は --> と共有されうる
+				std::advance(position, 2);
+				std::string_view sv = "-->";
+				position = std::search(position, last, sv.begin(), sv.end());
+				if (position == last) break;
+				std::advance(position, 3);
+				continue;
+			}
+
+			if (detail::starts_with_prescan_label(position, last, "<meta"))
+			{
+				ForwardIterator it = std::next(position, 5);
+				if (it != last && (detail::is_prescan_white_space(*it) || static_cast<unsigned char>(*it) == 0x2F))
+				{
+					// 1.
+					position = ++it;
+					// 2. - 5.
+					attribute_list.clear();
+					bool got_pragma = false;
+					std::uint32_t need_pragma = 0; // 0: null, 1: false, 2: true
+					encoding_name charset = static_cast<encoding_name>(0);
+					bool charset_found = false;
+					// 6. - 10.
+					while (detail::get_prescan_attribute(position, last, attr))
+					{
+						if (std::find(attribute_list.begin(), attribute_list.end(), attr.m_name) != attribute_list.end()) continue;
+						attribute_list.push_back(attr.m_name);
+
+						if (attr.m_name == U"http-equiv")
+						{
+							if (attr.m_value == U"content-type") got_pragma = true;
+						}
+						else if (attr.m_name == U"content")
+						{
+							encoding_name en = extract_character_encoding_from_meta_element(attr.m_value);
+							if (en != static_cast<encoding_name>(0) && !charset_found)
+							{
+								charset = en;
+								charset_found = true;
+								need_pragma = 2;
+							}
+						}
+						else if (attr.m_name == U"charset")
+						{
+							charset = get_encoding_name(attr.m_value);
+							charset_found = true;
+							need_pragma = 1;
+						}
+					}
+					if (position == last) break;
+					// 11. - 13.
+					if (need_pragma == 0 || (need_pragma == 2 && !got_pragma) || charset == static_cast<encoding_name>(0))
+					{
+						++position;
+						continue;
+					}
+					// 14.
+					if (charset == encoding_name::UTF_16BE || charset == encoding_name::UTF_16LE) charset = encoding_name::UTF_8;
+					// 15.
+					if (charset == encoding_name::x_user_defined) charset = encoding_name::windows_1252;
+					// 16.
+					return charset;
+				}
+			}
+
+			if (b1 == 0x2F) // </
+			{
+				ForwardIterator it = std::next(next);
+				if (it != last)
+				{
+					unsigned char b2 = *it;
+					if ((0x41 <= b2 && b2 <= 0x5A) || (0x61 <= b2 && b2 <= 0x7A)) goto Tag;
+				}
+			}
+			else if ((0x41 <= b1 && b1 <= 0x5A) || (0x61 <= b1 && b1 <= 0x7A)) goto Tag;
+
+			if (b1 == 0x21 || b1 == 0x2F || b1 == 0x3F) // <! </ <?
+			{
+				position = std::find(next, last, 0x3E);
+				if (position == last) break;
+				++position;
+				continue;
+			}
+
+			++position;
+			continue;
+
+		Tag:
+			position = std::find_if(next, last, [](unsigned char c) { return detail::is_prescan_white_space(c) || c == 0x3E; });
+			while (detail::get_prescan_attribute(position, last, attr)) {}
+			if (position == last) break;
+			++position;
+		}
+
+		return static_cast<encoding_name>(0);
+	}
+}
@@ -10,15 +10,42 @@
 #include <wordring/whatwg/encoding/encoding_defs.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <deque>
 #include <limits>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace wordring::whatwg::html::parsing
 {
+	/*! @brief 入力ストリーム内の位置
+
+	改行文字の正規化後のコード・ポイント列における位置を表す。
+	CR LF は一文字として数える。
+	*/
+	struct input_position
+	{
+		/*! @brief 先頭から 0 で始まるコード・ポイント単位の位置 */
+		std::uint32_t m_offset = 0;
+		/*! @brief 1 から始まる行番号 */
+		std::uint32_t m_line = 1;
+		/*! @brief 1 から始まる桁番号（コード・ポイント単位） */
+		std::uint32_t m_column = 1;
+	};
+
+	namespace detail
+	{
+		template <typename T, typename = void>
+		struct input_position_tracking : std::false_type {};
+
+		template <typename T>
+		struct input_position_tracking<T, std::void_t<decltype(T::tracks_input_position)>>
+			: std::bool_constant<T::tracks_input_position> {};
+	}
+
 	/*! @brief HTML5 パーサー用のユニコード・コード・ポイント入力ストリーム
 	
 	@par コールバック
@@ -27,6 +54,10 @@ namespace wordring::whatwg::html::parsing
 
 	- on_report_error(error_name e)
 	- on_emit_code_point()
+
+	派生クラスが static bool constexpr tracks_input_position = true を持つ場合に限り、
+	消費した文字の位置を数え、 current_position() で返す。
+	持たない場合、位置を数えるコードはコンパイルされない。
 	*/
 	template <typename T>
 	class input_stream
@@ -58,6 +89,13 @@ namespace wordring::whatwg::html::parsing
 		*/
 		bool m_cr_state;
 
+		/*! 位置追跡用状態変数
+
+		m_position は現在の入力文字の位置、 m_next_position は次に消費する文字の位置。
+		*/
+		input_position m_position;
+		input_position m_next_position;
+
 	public:
 
 		/*! @brief 空の入力ストリームを構築する
@@ -86,6 +124,9 @@ namespace wordring::whatwg::html::parsing
 			m_eof_consumed = false;
 
 			m_cr_state = false;
+
+			m_position      = input_position();
+			m_next_position = input_position();
 		}
 
 		/*! @brief エラー報告する
@@ -214,6 +255,18 @@ namespace wordring::whatwg::html::parsing
 			return m_c.front();
 		}
 
+		/*! @brief 追加されたコード・ポイントがすべて消費されているか調べる
+
+		@return バッファが空で、改行文字の正規化による保留も無く、終端も設定されていない場合 true を返す。
+		*/
+		bool idle() const { return m_c.empty() && !m_cr_state && !m_eof; }
+
+		/*! @brief 現在の入力文字の位置を返す
+
+		派生クラスが位置を追跡しない場合、常に初期値を返す。
+		*/
+		input_position const& current_position() const { return m_position; }
+
 		/*! @brief ストリーム終端に達しているか調べる
 
 		@return ストリーム終端に達している場合 <b>true</b> 、その他の場合 <b>false</b> を返す。
@@ -242,6 +295,7 @@ namespace wordring::whatwg::html::parsing
 		{
 			if (m_c.empty() && m_eof)
 			{
+				if constexpr (detail::input_position_tracking<this_type>::value) m_position = m_next_position;
 				m_eof_consumed = true;
 				return 0;
 			}
@@ -250,6 +304,19 @@ namespace wordring::whatwg::html::parsing
 
 			m_current_input_character = m_c.front();
 			m_c.pop_front();
+
+			if constexpr (detail::input_position_tracking<this_type>::value)
+			{
+				m_position = m_next_position;
+				++m_next_position.m_offset;
+				if (m_current_input_character == U'\n')
+				{
+					++m_next_position.m_line;
+					m_next_position.m_column = 1;
+				}
+				else ++m_next_position.m_column;
+			}
+
 			return m_current_input_character;
 		}
 
@@ -270,7 +337,11 @@ namespace wordring::whatwg::html::parsing
 		void reconsume()
 		{
 			if (m_eof_consumed) m_eof_consumed = false;
-			else m_c.push_front(m_current_input_character);
+			else
+			{
+				m_c.push_front(m_current_input_character);
+				if constexpr (detail::input_position_tracking<this_type>::value) m_next_position = m_position;
+			}
 		}
 
 		const_iterator begin() const { return m_c.begin(); }
@@ -331,42 +402,55 @@ namespace wordring::whatwg::html::parsing
 		*/
 		std::array<char32_t, 2> match_named_character_reference(std::uint32_t& len)
 		{
-			len = 0;
+			bool complete = false;
+			return match_named_character_reference(len, complete);
+		}
+
+		/*! @brief 名前付き文字参照とストリーム・バッファ内の文字列を比較する
+
+		@param [out] len      マッチした文字数を返す
+		@param [out] complete 照合が確定した場合 true 、後続の入力で結果が変わりうる場合 false を返す
+
+		@return 0 ～ 2 個の文字参照コードを返す。
 
-			auto it1 = named_character_reference_idx_tbl.begin();
-			auto it2 = named_character_reference_idx_tbl.end();
+		生成された照合オートマトンを用い、バッファを先頭から一度だけ走査して最長一致を求める。
+		遷移先が無くなるか、受理状態から先に遷移が無い場合、それ以上の入力を待たずに照合を確定する。
+		*/
+		std::array<char32_t, 2> match_named_character_reference(std::uint32_t& len, bool& complete)
+		{
+			len = 0;
+			complete = m_eof;
 
-			auto tail = it1;
-			std::uint32_t j = 0;
+			std::uint32_t state = 0;
+			std::uint32_t idx   = 0;
+			std::uint32_t i     = 0;
 
-			for (std::uint32_t i = 0; it1 != it2 && i < m_c.size(); ++i)
+			for (value_type cp : m_c)
 			{
-				it1 = it1[m_c[i]];
-				if (it1)
+				auto it1 = named_character_reference_dfa_edge_tbl.begin() + named_character_reference_dfa_base_tbl[state];
+				auto it2 = named_character_reference_dfa_edge_tbl.begin() + named_character_reference_dfa_base_tbl[state + 1];
+				auto it = std::lower_bound(it1, it2, cp, [](std::array<std::uint16_t, 2> const& e, value_type c) { return e[0] < c; });
+				if (it == it2 || it->front() != cp)
 				{
-					tail = it1;
-					j = i + 1;
+					complete = true;
+					break;
 				}
-			}
-			std::u32string s;
-			tail.string(s);
 
-			while (tail != named_character_reference_idx_tbl.begin())
-			{
-				if (tail)
+				state = it->back();
+				++i;
+				if (named_character_reference_dfa_accept_tbl[state] != 0)
+				{
+					len = i;
+					idx = named_character_reference_dfa_accept_tbl[state] - 1;
+				}
+				if (named_character_reference_dfa_base_tbl[state] == named_character_reference_dfa_base_tbl[state + 1])
 				{
-					len = j;
+					complete = true;
 					break;
 				}
-				tail = tail.parent();
 			}
 
-			if (len != 0)
-			{
-				std::uint32_t idx = named_character_reference_idx_tbl.at(tail);
-				std::array<char32_t, 2> a = named_character_reference_map_tbl[idx];
-				return a;
-			}
+			if (len != 0) return named_character_reference_map_tbl[idx];
 
 			return std::array<char32_t, 2>();
 		}
@@ -0,0 +1,385 @@
+﻿#pragma once
+
+// https://html.spec.whatwg.org/multipage/parsing.html#the-stack-of-open-elements
+// https://triple-underscore.github.io/HTML-parsing-ja.html#the-stack-of-open-elements
+
+#include <wordring/whatwg/html/parsing/atom_tbl.hpp>
+#include <wordring/whatwg/html/html_defs.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace wordring::whatwg::html::parsing
+{
+	/*! @class open_element_stack open_element_stack.hpp wordring/whatwg/html/parsing/open_element_stack.hpp
+
+	@brief オープン要素のスタック
+
+	@tparam NodeTraits ノード・トレイツ
+	@tparam Entry      スタックの項目。 node_pointer 型のメンバ m_it を持たなければならない。
+
+	std::deque と同様に使えるコンテナで、 PUSH/POP のたびに以下の索引を更新する。
+
+	- 名前空間とタグ名ごとの、最も上にある項目の位置
+	- スコープの種類ごとの、最も上にある境界要素の位置
+
+	これにより「特定のスコープ内に要素があるか」の問い合わせを、スタックの深さに依らず定数時間で答えられる。
+	末尾以外への挿入と削除は、索引を作り直すため線形時間となる。
+
+	イテレータを通して項目を書き換えてもよいが、要素の名前空間とタグ名を変えてはならない。
+
+	@sa https://html.spec.whatwg.org/multipage/parsing.html#has-an-element-in-the-specific-scope
+	@sa https://triple-underscore.github.io/HTML-parsing-ja.html#has-an-element-in-the-specific-scope
+	*/
+	template <typename NodeTraits, typename Entry>
+	class open_element_stack
+	{
+	public:
+		using traits       = NodeTraits;
+		using node_pointer = typename traits::node_pointer;
+
+		using container              = std::deque<Entry>;
+		using value_type             = typename container::value_type;
+		using size_type              = typename container::size_type;
+		using reference              = typename container::reference;
+		using const_reference        = typename container::const_reference;
+		using iterator               = typename container::iterator;
+		using const_iterator         = typename container::const_iterator;
+		using reverse_iterator       = typename container::reverse_iterator;
+		using const_reverse_iterator = typename container::const_reverse_iterator;
+
+		/*! @brief スコープの種類 */
+		enum class scope_name : std::uint32_t
+		{
+			default_scope   = 0,
+			list_item_scope = 1,
+			button_scope    = 2,
+			table_scope     = 3,
+			select_scope    = 4,
+		};
+
+		static std::uint32_t constexpr scope_count = 5;
+
+		/*! @brief タグ名アトムの個数（0 を含む） */
+		static std::uint32_t constexpr tag_name_count = std::tuple_size_v<std::remove_const_t<decltype(tag_name_tbl)>>;
+
+		/*! @brief 名前空間アトムの個数（0 を含む） */
+		static std::uint32_t constexpr ns_name_count = std::tuple_size_v<std::remove_const_t<decltype(ns_uri_tbl)>>;
+
+	protected:
+		/*! @brief 項目ごとに保持する、PUSH 前の索引の値
+
+		位置は 1 から始まり、 0 は該当する項目が無いことを表す。
+		*/
+		struct index_entry
+		{
+			std::uint32_t m_key;
+			std::uint32_t m_previous;
+			std::array<std::uint32_t, scope_count> m_boundary;
+		};
+
+	public:
+		open_element_stack()
+			: m_top()
+			, m_boundary({ 0, 0, 0, 0, 0 })
+		{
+		}
+
+		// 要素アクセス -------------------------------------------------------
+
+		reference operator[](size_type i) { return m_c[i]; }
+		const_reference operator[](size_type i) const { return m_c[i]; }
+
+		reference front() { return m_c.front(); }
+		const_reference front() const { return m_c.front(); }
+
+		reference back() { return m_c.back(); }
+		const_reference back() const { return m_c.back(); }
+
+		// イテレータ ---------------------------------------------------------
+
+		iterator begin() noexcept { return m_c.begin(); }
+		const_iterator begin() const noexcept { return m_c.begin(); }
+
+		iterator end() noexcept { return m_c.end(); }
+		const_iterator end() const noexcept { return m_c.end(); }
+
+		reverse_iterator rbegin() noexcept { return m_c.rbegin(); }
+		const_reverse_iterator rbegin() const noexcept { return m_c.rbegin(); }
+
+		reverse_iterator rend() noexcept { return m_c.rend(); }
+		const_reverse_iterator rend() const noexcept { return m_c.rend(); }
+
+		// 容量 ---------------------------------------------------------------
+
+		bool empty() const noexcept { return m_c.empty(); }
+
+		size_type size() const noexcept { return m_c.size(); }
+
+		// 変更 ---------------------------------------------------------------
+
+		void clear()
+		{
+			m_c.clear();
+			m_index.clear();
+			std::fill(m_top.begin(), m_top.end(), 0);
+			m_boundary.fill(0);
+		}
+
+		void push_back(value_type const& entry)
+		{
+			m_c.push_back(entry);
+			index(m_c.back(), m_c.size());
+		}
+
+		void pop_back()
+		{
+			unindex();
+			m_c.pop_back();
+		}
+
+		iterator insert(const_iterator pos, value_type const& entry)
+		{
+			if (pos == m_c.end())
+			{
+				push_back(entry);
+				return std::prev(m_c.end());
+			}
+
+			iterator it = m_c.insert(pos, entry);
+			reindex();
+			return it;
+		}
+
+		iterator erase(const_iterator pos)
+		{
+			if (std::next(pos) == m_c.end())
+			{
+				pop_back();
+				return m_c.end();
+			}
+
+			iterator it = m_c.erase(pos);
+			reindex();
+			return it;
+		}
+
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			iterator it = m_c.erase(first, last);
+			reindex();
+			return it;
+		}
+
+		// 索引 ---------------------------------------------------------------
+
+		/*! @brief 指定の要素がスタック内にあれば、最も上にある項目の位置を返す
+
+		@return 1 から始まる位置、見つからない場合 0
+		*/
+		std::uint32_t top(ns_name ns, tag_name tag) const
+		{
+			if (m_top.empty()) return 0;
+			return m_top[key(ns, tag)];
+		}
+
+		/*! @brief 指定の要素を持つ項目を検索する
+
+		@param [in] it 要素を指すポインタあるいはイテレータ
+
+		@return 項目を指すイテレータ、見つからない場合 end()
+
+		同じ名前空間とタグ名を持つ項目のみを、上から順にたどる。
+		*/
+		iterator find(node_pointer it)
+		{
+			std::uint32_t pos = find_position(it);
+			return pos == 0 ? m_c.end() : std::next(m_c.begin(), pos - 1);
+		}
+
+		const_iterator find(node_pointer it) const
+		{
+			std::uint32_t pos = find_position(it);
+			return pos == 0 ? m_c.end() : std::next(m_c.begin(), pos - 1);
+		}
+
+		/*! @brief 最も上にある境界要素の位置を返す
+
+		@return 1 から始まる位置、境界要素が無い場合 0
+		*/
+		std::uint32_t boundary(scope_name s) const
+		{
+			return m_boundary[static_cast<std::uint32_t>(s)];
+		}
+
+		/*! @brief 要素が特定のスコープ内にあるか調べる
+
+		要素自身が境界要素である場合も含め、最も上の境界要素と同じかそれより上にあれば、スコープ内にある。
+		*/
+		bool in_scope(scope_name s, ns_name ns, tag_name tag) const
+		{
+			std::uint32_t i = top(ns, tag);
+			return i != 0 && boundary(s) <= i;
+		}
+
+		/*! @brief 要素が特定のスコープ内にあるか調べる
+
+		@param [in] s    スコープ
+		@param [in] pred 項目の要素を引数に取り、ターゲットであれば true を返す関数
+
+		最も上の境界要素までの項目のみを走査する。
+		*/
+		template <typename Predicate>
+		bool in_scope_if(scope_name s, Predicate pred) const
+		{
+			std::uint32_t i = m_c.size();
+			std::uint32_t last = boundary(s);
+			if (last != 0) --last;
+
+			while (last < i)
+			{
+				if (pred(m_c[--i].m_it)) return true;
+			}
+
+			return false;
+		}
+
+		/*! @brief 要素が境界要素となるスコープをビット集合で返す
+
+		ビット位置は scope_name の値に対応する。
+
+		@sa https://html.spec.whatwg.org/multipage/parsing.html#has-an-element-in-scope
+		@sa https://triple-underscore.github.io/HTML-parsing-ja.html#has-an-element-in-scope
+		*/
+		static std::uint32_t scope_mask(ns_name ns, tag_name tag)
+		{
+			std::uint32_t constexpr general = (1u << static_cast<std::uint32_t>(scope_name::default_scope))
+				| (1u << static_cast<std::uint32_t>(scope_name::list_item_scope))
+				| (1u << static_cast<std::uint32_t>(scope_name::button_scope));
+			std::uint32_t constexpr list_item = 1u << static_cast<std::uint32_t>(scope_name::list_item_scope);
+			std::uint32_t constexpr button    = 1u << static_cast<std::uint32_t>(scope_name::button_scope);
+			std::uint32_t constexpr table     = 1u << static_cast<std::uint32_t>(scope_name::table_scope);
+			std::uint32_t constexpr select    = 1u << static_cast<std::uint32_t>(scope_name::select_scope);
+
+			if (ns == ns_name::HTML)
+			{
+				switch (tag)
+				{
+				case tag_name::Html: case tag_name::Table: case tag_name::Template:
+					return general | table | select;
+				case tag_name::Applet: case tag_name::Caption: case tag_name::Td: case tag_name::Th: case tag_name::Marquee:
+				case tag_name::Object:
+					return general | select;
+				case tag_name::Ol: case tag_name::Ul:
+					return list_item | select;
+				case tag_name::Button:
+					return button | select;
+				case tag_name::Optgroup: case tag_name::Option:
+					return 0;
+				default:
+					return select;
+				}
+			}
+			else if (ns == ns_name::MathML)
+			{
+				switch (tag)
+				{
+				case tag_name::Mi: case tag_name::Mo: case tag_name::Mn: case tag_name::Ms: case tag_name::Mtext: case tag_name::Annotation_xml:
+					return general | select;
+				default:
+					return select;
+				}
+			}
+			else if (ns == ns_name::SVG)
+			{
+				switch (tag)
+				{
+				case tag_name::Factorial: case tag_name::ForeignObject: case tag_name::Desc: case tag_name::Title:
+					return general | select;
+				default:
+					return select;
+				}
+			}
+
+			return select;
+		}
+
+	protected:
+		static std::uint32_t key(ns_name ns, tag_name tag)
+		{
+			return static_cast<std::uint32_t>(ns) * tag_name_count + static_cast<std::uint32_t>(tag);
+		}
+
+		std::uint32_t find_position(node_pointer it) const
+		{
+			std::uint32_t pos = top(traits::get_namespace_name(it), traits::get_local_name_name(it));
+			while (pos != 0 && m_c[pos - 1].m_it != it) pos = m_index[pos - 1].m_previous;
+
+			return pos;
+		}
+
+		/*! @brief 末尾に追加された項目を索引に加える
+
+		@param [in] entry 項目
+		@param [in] pos   1 から始まる項目の位置
+		*/
+		void index(value_type const& entry, std::uint32_t pos)
+		{
+			if (m_top.empty()) m_top.resize(ns_name_count * tag_name_count, 0);
+
+			ns_name  ns  = traits::get_namespace_name(entry.m_it);
+			tag_name tag = traits::get_local_name_name(entry.m_it);
+
+			std::uint32_t k = key(ns, tag);
+
+			m_index.push_back({ k, m_top[k], m_boundary });
+
+			m_top[k] = pos;
+
+			std::uint32_t mask = scope_mask(ns, tag);
+			for (std::uint32_t i = 0; i < scope_count; ++i)
+			{
+				if (mask & (1u << i)) m_boundary[i] = pos;
+			}
+		}
+
+		/*! @brief 末尾の項目を索引から除く
+		*/
+		void unindex()
+		{
+			index_entry const& idx = m_index.back();
+			m_top[idx.m_key] = idx.m_previous;
+			m_boundary = idx.m_boundary;
+			m_index.pop_back();
+		}
+
+		/*! @brief 索引を作り直す
+		*/
+		void reindex()
+		{
+			m_index.clear();
+			std::fill(m_top.begin(), m_top.end(), 0);
+			m_boundary.fill(0);
+
+			std::uint32_t pos = 0;
+			for (value_type const& entry : m_c) index(entry, ++pos);
+		}
+
+	protected:
+		container m_c;
+
+		std::vector<index_entry> m_index;
+
+		/*! @brief 名前空間とタグ名ごとの、最も上にある項目の位置 */
+		std::vector<std::uint32_t> m_top;
+
+		/*! @brief スコープの種類ごとの、最も上にある境界要素の位置 */
+		std::array<std::uint32_t, scope_count> m_boundary;
+	};
+}
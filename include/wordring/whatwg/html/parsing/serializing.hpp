@@ -6,7 +6,6 @@
 
 #include <wordring/encoding/encoding.hpp>
 
-#include <deque>
 #include <iterator>
 
 namespace wordring::whatwg::html
@@ -164,47 +163,26 @@ namespace wordring::whatwg::html
 		// 1.
 		if (serializes_as_void(it)) return;
 		// 4.
-		std::deque<node_pointer> x; // 親スタック
-		std::deque<node_pointer> y; // 探索スタック
+		// 子、次の兄弟、親へのリンクを辿って文書順に進むため、スタックを持たない
+		node_pointer current_node = traits::begin(it);
+		if (current_node == traits::end(it)) return;
 
-		x.push_back(it);
-		auto it1 = traits::begin(it);
-		auto it2 = traits::end(it);
-		auto pos = y.end();
-		while(it1 != it2) pos = y.insert(pos, it1++);
-
-		while (!y.empty())
+		auto end_tag = [&](node_pointer p)
 		{
-			// 探索スタックから開始タグをポップ
-			node_pointer current_node = y.back();
-			y.pop_back();
-
-			// 親スタックからポップして閉じタグ処理
-			while (x.back() != traits::parent(current_node))
+			if (!serializes_as_void(p))
 			{
-				if (!serializes_as_void(x.back()))
-				{
-					encoding_cast(std::u32string_view(U"</"), out);
-					detail::get_tag_name(x.back(), out);
-					wordring::to_string(U'>', out);
-				}
-				x.pop_back();
-			}
-
-			// スタックへプッシュ
-			if (traits::is_element(current_node))
-			{
-				x.push_back(current_node);
-				it1 = traits::begin(current_node);
-				it2 = traits::end(current_node);
-				pos = y.end();
-				while (it1 != it2) pos = y.insert(pos, it1++);
+				encoding_cast(std::u32string_view(U"</"), out);
+				detail::get_tag_name(p, out);
+				wordring::to_string(U'>', out);
 			}
+		};
 
+		while (true)
+		{
 			if (traits::is_element(current_node))
 			{
 				wordring::to_string(U'<', out);
-				detail::get_tag_name(x.back(), out);
+				detail::get_tag_name(current_node, out);
 
 				auto it3 = traits::abegin(current_node);
 				auto it4 = traits::aend(current_node);
@@ -220,25 +198,36 @@ namespace wordring::whatwg::html
 				}
 
 				wordring::to_string(U'>', out);
+
+				// 子が有れば降りる
+				if (traits::begin(current_node) != traits::end(current_node))
+				{
+					current_node = traits::begin(current_node);
+					continue;
+				}
+
+				end_tag(current_node);
 			}
 			else if (traits::is_text(current_node))
 			{
 				node_pointer parent = traits::parent(current_node);
 				ns_name  ns  = traits::get_namespace_name(parent);
 				tag_name tag = traits::get_local_name_name(parent);
+				bool raw = false;
 				if (ns == ns_name::HTML)
 				{
 					switch (tag)
 					{
 					case tag_name::Style:   case tag_name::Script:   case tag_name::Xmp:       case tag_name::Iframe:
 					case tag_name::Noembed: case tag_name::Noframes: case tag_name::Plaintext:
-						encoding_cast(traits::data(current_node), out);
-						continue;
+						raw = true;
+						break;
 					default:
 						break;
 					}
 				}
-				detail::escape_string(traits::data(current_node), out);
+				if (raw) encoding_cast(traits::data(current_node), out);
+				else detail::escape_string(traits::data(current_node), out);
 			}
 			else if (traits::is_comment(current_node))
 			{
@@ -260,18 +249,22 @@ namespace wordring::whatwg::html
 				encoding_cast(traits::name(current_node), out);
 				encoding_cast(std::u32string_view(U">"), out);
 			}
-		}
 
-		// 親スタックからポップして閉じタグ処理（探索スタックが空で親スタックが残っている場合）
-		while (1 < x.size())
-		{
-			if (!serializes_as_void(x.back()))
+			// 次の兄弟が無ければ親へ上がり、閉じタグを出力する
+			while (true)
 			{
-				encoding_cast(std::u32string_view(U"</"), out);
-				detail::get_tag_name(x.back(), out);
-				wordring::to_string(U'>', out);
+				node_pointer parent = traits::parent(current_node);
+				node_pointer next   = traits::next(current_node);
+				if (next != traits::end(parent))
+				{
+					current_node = next;
+					break;
+				}
+				if (parent == it) return;
+
+				end_tag(parent);
+				current_node = parent;
 			}
-			x.pop_back();
 		}
 	}
 }
@@ -0,0 +1,352 @@
+﻿#pragma once
+
+// https://html.spec.whatwg.org/multipage/parsing.html#tokenization
+// https://triple-underscore.github.io/HTML-parsing-ja.html#tokenization
+
+#include <wordring/whatwg/html/parsing/parser_defs.hpp>
+#include <wordring/whatwg/html/parsing/token.hpp>
+#include <wordring/whatwg/html/parsing/tokenization.hpp>
+
+#include <wordring/whatwg/html/html_defs.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace wordring::whatwg::html::parsing
+{
+	/*! @brief 投機的トークン化で一つの区間に割り当てるコード・ポイント数の目安
+	*/
+	std::uint32_t constexpr speculative_chunk_length = 64 * 1024;
+
+	namespace detail
+	{
+		/*! @brief 投機的トークン化器用のノード・トレイツ
+
+		木を持たないため、ノード・ポインタの代わりに名前空間を扱う。
+		*/
+		struct speculative_node_traits
+		{
+			using node_pointer = ns_name;
+
+			static ns_name get_namespace_name(node_pointer ns) { return ns; }
+		};
+
+		/*! @class speculative_tokenizer speculative_tokenizer.hpp wordring/whatwg/html/parsing/speculative_tokenizer.hpp
+
+		@brief 入力の一区間を、データ状態から始まると仮定してトークン化し、トークンとエラーを記録する
+
+		木構築段階を持たないため、 RCDATA 等への切り替えは行わず、調整済みカレント・ノードは常に HTML 名前空間とみなす。
+		記録したトークンは、 speculative_tokenize() が仮定の成り立つ範囲で本来のパーサーへ再生する。
+		*/
+		class speculative_tokenizer : public tokenizer<speculative_tokenizer, speculative_node_traits>
+		{
+			friend tokenizer<speculative_tokenizer, speculative_node_traits>;
+			friend input_stream<speculative_tokenizer>;
+
+		public:
+			using base_type = tokenizer<speculative_tokenizer, speculative_node_traits>;
+
+			/*! @brief 記録したイベントの種類 */
+			enum class event_kind : std::uint32_t
+			{
+				character = 1,
+				DOCTYPE,
+				start_tag,
+				end_tag,
+				comment,
+				error,
+			};
+
+			/*! @brief 記録したイベント
+
+			m_index は種類ごとの記録の添え字、 m_offset はイベントを発生させたコード・ポイントの直後の入力位置。
+			*/
+			struct event
+			{
+				event_kind    m_kind;
+				std::uint32_t m_index;
+				std::uint32_t m_offset;
+			};
+
+			struct stack_entry
+			{
+				ns_name m_it;
+			};
+
+		public:
+			speculative_tokenizer()
+				: m_clean_offset(0)
+				, m_clean_event_count(0)
+				, m_offset(0)
+			{
+			}
+
+			/*! @brief 区間をトークン化する
+
+			@param [in] first  区間の先頭
+			@param [in] last   区間の終端
+			@param [in] offset 入力全体における区間の先頭位置
+
+			区間の終端では EOF を送らない。
+			*/
+			void run(char32_t const* first, char32_t const* last, std::uint32_t offset)
+			{
+				m_clean_offset      = offset;
+				m_clean_event_count = 0;
+				m_offset            = offset;
+
+				while (first != last)
+				{
+					m_offset++;
+					base_type::push_code_point(*first++);
+					if (base_type::at_data_boundary())
+					{
+						m_clean_offset      = m_offset;
+						m_clean_event_count = m_events.size();
+					}
+				}
+			}
+
+			/*! @brief 記録を破棄し、記憶域を解放する
+			*/
+			void release()
+			{
+				std::vector<event>().swap(m_events);
+				std::u32string().swap(m_characters);
+				std::vector<DOCTYPE_token>().swap(m_DOCTYPE_tokens);
+				std::vector<start_tag_token>().swap(m_start_tag_tokens);
+				std::vector<end_tag_token>().swap(m_end_tag_tokens);
+				std::vector<comment_token>().swap(m_comment_tokens);
+				std::vector<error_name>().swap(m_errors);
+			}
+
+			// ------------------------------------------------------------------------------------
+			// トークン化器から呼び出されるメンバ
+			// ------------------------------------------------------------------------------------
+
+			stack_entry adjusted_current_node() const { return { ns_name::HTML }; }
+
+			void on_emit_token(character_token const& token)
+			{
+				record(event_kind::character, m_characters.size());
+				m_characters.push_back(token.m_data);
+			}
+
+			void on_emit_token(DOCTYPE_token const& token)
+			{
+				record(event_kind::DOCTYPE, m_DOCTYPE_tokens.size());
+				m_DOCTYPE_tokens.push_back(token);
+			}
+
+			void on_emit_token(start_tag_token const& token)
+			{
+				record(event_kind::start_tag, m_start_tag_tokens.size());
+				m_start_tag_tokens.push_back(token);
+			}
+
+			void on_emit_token(end_tag_token const& token)
+			{
+				record(event_kind::end_tag, m_end_tag_tokens.size());
+				m_end_tag_tokens.push_back(token);
+			}
+
+			void on_emit_token(comment_token const& token)
+			{
+				record(event_kind::comment, m_comment_tokens.size());
+				m_comment_tokens.push_back(token);
+			}
+
+			void on_emit_token(end_of_file_token const&) { assert(false); }
+
+			void on_report_error(error_name e)
+			{
+				record(event_kind::error, m_errors.size());
+				m_errors.push_back(e);
+			}
+
+		protected:
+			void record(event_kind kind, std::size_t index)
+			{
+				m_events.push_back({ kind, static_cast<std::uint32_t>(index), m_offset });
+			}
+
+		public:
+			std::vector<event> m_events;
+
+			std::u32string               m_characters;
+			std::vector<DOCTYPE_token>   m_DOCTYPE_tokens;
+			std::vector<start_tag_token> m_start_tag_tokens;
+			std::vector<end_tag_token>   m_end_tag_tokens;
+			std::vector<comment_token>   m_comment_tokens;
+			std::vector<error_name>      m_errors;
+
+			/*! @brief 最後にデータ状態の境界に達した入力位置 */
+			std::uint32_t m_clean_offset;
+
+			/*! @brief m_clean_offset までに記録したイベントの数 */
+			std::size_t m_clean_event_count;
+
+			/*! @brief トークン化器は空であることのみを調べる */
+			std::deque<stack_entry> m_stack;
+
+		protected:
+			std::uint32_t m_offset;
+		};
+
+		/*! @brief 区間の記録をパーサーへ再生する
+
+		@return 再生を終えた入力位置
+
+		開始タグの処理によって木構築段階がトークン化器の状態を変更した場合、あるいは外来コンテンツに入った場合、
+		以降の記録は仮定が崩れているため、その開始タグの直後で再生を打ち切る。
+		開始タグは「>」の消費で発送されるため、その直後はデータ状態の境界となっている。
+		*/
+		template <typename Parser>
+		inline std::uint32_t replay_speculation(Parser& p, speculative_tokenizer& s)
+		{
+			character_token ch;
+
+			for (std::size_t i = 0; i < s.m_clean_event_count; ++i)
+			{
+				speculative_tokenizer::event const& e = s.m_events[i];
+				switch (e.m_kind)
+				{
+				case speculative_tokenizer::event_kind::character:
+					ch.m_data = s.m_characters[e.m_index];
+					p.on_emit_token(ch);
+					break;
+				case speculative_tokenizer::event_kind::DOCTYPE:
+					p.on_emit_token(s.m_DOCTYPE_tokens[e.m_index]);
+					break;
+				case speculative_tokenizer::event_kind::start_tag:
+				{
+					start_tag_token& token = s.m_start_tag_tokens[e.m_index];
+					p.m_last_start_tag_name = token.m_tag_name;
+					p.on_emit_token(token);
+					if (!p.at_data_boundary() || (!p.m_stack.empty() && !p.in_html_namespace())) return e.m_offset;
+					break;
+				}
+				case speculative_tokenizer::event_kind::end_tag:
+					p.on_emit_token(s.m_end_tag_tokens[e.m_index]);
+					break;
+				case speculative_tokenizer::event_kind::comment:
+					p.on_emit_token(s.m_comment_tokens[e.m_index]);
+					break;
+				case speculative_tokenizer::event_kind::error:
+					p.on_report_error(s.m_errors[e.m_index]);
+					break;
+				}
+			}
+
+			return s.m_clean_offset;
+		}
+	}
+
+	/*! @brief 入力を区間に分けて並列に投機的トークン化し、結果を順にパーサーへ供給する
+
+	@tparam Parser tree_construction_dispatcher から派生したパーサー
+
+	@param [in,out] p            パーサー。データ状態で、入力を何も受け取っていないこと
+	@param [in]     in           入力全体
+	@param [in]     threads      スレッド数。 0 の場合、 std::thread::hardware_concurrency() を用いる
+	@param [in]     chunk_length 一区間のコード・ポイント数の目安
+
+	入力を chunk_length ごとに、次の「<」の直前で区切る。
+	先頭の区間は呼び出し元のスレッドが直接パーサーへ供給し、その間に残りの区間を作業者スレッドがデータ状態から始まると仮定してトークン化する。
+
+	各区間の開始時にパーサーのトークン化器がデータ状態の境界にあり、外来コンテンツ内でなければ仮定は成り立つので、記録したトークンを再生する。
+	仮定が崩れた場合、あるいは区間の終わりがトークンの途中であった場合、残りを通常どおり一文字ずつ供給する。
+	結果は常に逐次的な解析と等しい。
+
+	EOF は送らない。
+	*/
+	template <typename Parser>
+	inline void speculative_tokenize(
+		Parser&             p,
+		std::u32string_view in,
+		std::uint32_t       threads      = 0,
+		std::uint32_t       chunk_length = speculative_chunk_length)
+	{
+		// 区切り位置
+		std::vector<std::uint32_t> bounds(1, 0);
+		for (std::size_t pos = chunk_length; pos < in.size(); )
+		{
+			pos = in.find(U'<', pos);
+			if (pos == std::u32string_view::npos) break;
+			bounds.push_back(static_cast<std::uint32_t>(pos));
+			pos += std::max<std::uint32_t>(chunk_length, 1);
+		}
+		bounds.push_back(static_cast<std::uint32_t>(in.size()));
+
+		std::size_t n = bounds.size() - 1;
+		if (threads == 0) threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+		if (n <= 1 || threads <= 1)
+		{
+			for (char32_t cp : in) p.push_code_point(cp);
+			return;
+		}
+
+		// 投機的トークン化
+		std::vector<detail::speculative_tokenizer> spec(n);
+		std::vector<std::promise<void>> promises(n);
+		std::atomic<std::size_t> next(1);
+
+		auto work = [&]()
+		{
+			for (std::size_t i = next++; i < n; i = next++)
+			{
+				try
+				{
+					spec[i].run(in.data() + bounds[i], in.data() + bounds[i + 1], bounds[i]);
+					promises[i].set_value();
+				}
+				catch (...)
+				{
+					promises[i].set_exception(std::current_exception());
+				}
+			}
+		};
+
+		std::vector<std::thread> workers;
+		for (std::uint32_t i = 1; i < threads && i < n; ++i) workers.emplace_back(work);
+
+		// 順に供給する
+		std::exception_ptr ep;
+		try
+		{
+			std::size_t pos = 0;
+			for (std::size_t i = 0; i < n; ++i)
+			{
+				if (i != 0)
+				{
+					promises[i].get_future().get();
+					if (p.at_data_boundary() && (p.m_stack.empty() || p.in_html_namespace()))
+					{
+						pos = detail::replay_speculation(p, spec[i]);
+					}
+					spec[i].release();
+				}
+
+				for (; pos < bounds[i + 1]; ++pos) p.push_code_point(in[pos]);
+			}
+		}
+		catch (...)
+		{
+			ep = std::current_exception();
+			next = n;
+		}
+
+		for (std::thread& t : workers) t.join();
+		if (ep) std::rethrow_exception(ep);
+	}
+}
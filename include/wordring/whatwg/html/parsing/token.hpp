@@ -4,9 +4,14 @@
 // https://triple-underscore.github.io/HTML-parsing-ja.html
 
 #include <wordring/whatwg/html/parsing/atom_defs.hpp>
+#include <wordring/whatwg/html/parsing/atom_tbl.hpp>
 
 #include <cstdint>
+#include <functional>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace wordring::whatwg::html::parsing
@@ -53,6 +58,7 @@ namespace wordring::whatwg::html::parsing
 	{
 		token_attribute()
 			: m_namespace(static_cast<ns_name>(0))
+			, m_name_id(static_cast<attribute_name>(0))
 			, m_omitted(false)
 		{
 		}
@@ -61,6 +67,7 @@ namespace wordring::whatwg::html::parsing
 		{
 			m_namespace = static_cast<ns_name>(0);
 			m_name.clear();
+			m_name_id = static_cast<attribute_name>(0);
 			m_value.clear();
 			m_omitted = false;
 		}
@@ -68,6 +75,8 @@ namespace wordring::whatwg::html::parsing
 		ns_name        m_namespace;
 		std::u32string m_prefix;
 		std::u32string m_name;
+		/*! @brief 属性名のアトム、既知の属性名でない場合 0 */
+		attribute_name m_name_id;
 
 		std::u32string m_value;
 
@@ -80,12 +89,47 @@ namespace wordring::whatwg::html::parsing
 		using iterator = typename container::iterator;
 		using const_iterator = typename container::const_iterator;
 
+		/*! @brief 属性名アトムの個数（0 を含む） */
+		static std::uint32_t constexpr attribute_name_count = std::tuple_size_v<std::remove_const_t<decltype(attribute_name_tbl)>>;
+
 		token_attribute_list()
 			: m_last(0)
 		{
 		}
 
-		void clear() { m_last = 0; }
+		/*! @brief 属性を複製する
+
+		索引はトークナイザが組み立て中のトークンにのみ必要なため、複製しない。
+		複製した属性リストの find() は線形に検索する。
+		*/
+		token_attribute_list(token_attribute_list const& rhs)
+			: m_c(rhs.begin(), rhs.end())
+			, m_last(rhs.m_last)
+		{
+		}
+
+		token_attribute_list(token_attribute_list&&) noexcept = default;
+
+		token_attribute_list& operator=(token_attribute_list const& rhs)
+		{
+			if (this != &rhs)
+			{
+				clear();
+				m_c.assign(rhs.begin(), rhs.end());
+				m_last = rhs.m_last;
+			}
+			return *this;
+		}
+
+		token_attribute_list& operator=(token_attribute_list&&) noexcept = default;
+
+		void clear()
+		{
+			for (attribute_name name : m_known) m_index[static_cast<std::uint32_t>(name)] = 0;
+			m_known.clear();
+			m_unknown.clear();
+			m_last = 0;
+		}
 
 		/*! @brief 新しい属性を開始する
 		*/
@@ -102,6 +146,71 @@ namespace wordring::whatwg::html::parsing
 			return m_c[m_last - 1];
 		}
 
+		/*! @brief 現在の属性名をアトムに解決し、先行する属性との重複を調べる
+
+		@return 名前が重複する場合 true を返す
+
+		重複する属性には m_omitted が設定される。
+		既知の属性名はアトムで索引し、それ以外の属性名はハッシュ値で比較対象を絞る。
+		*/
+		bool unify()
+		{
+			token_attribute& attr = current();
+
+			auto it = attribute_atom_tbl.find(attr.m_name);
+			if (it != attribute_atom_tbl.end())
+			{
+				attr.m_name_id = it->second;
+				if (m_index.empty()) m_index.resize(attribute_name_count);
+				std::uint32_t& idx = m_index[static_cast<std::uint32_t>(it->second)];
+				if (idx != 0) attr.m_omitted = true;
+				else
+				{
+					idx = m_last;
+					m_known.push_back(it->second);
+				}
+			}
+			else
+			{
+				std::size_t h = std::hash<std::u32string>()(attr.m_name);
+				for (auto const& [hash, idx] : m_unknown)
+				{
+					if (hash == h && m_c[idx].m_name == attr.m_name)
+					{
+						attr.m_omitted = true;
+						break;
+					}
+				}
+				if (!attr.m_omitted) m_unknown.emplace_back(h, m_last - 1);
+			}
+
+			return attr.m_omitted;
+		}
+
+		/*! @brief 属性名アトムから属性を検索する
+
+		unify() で解決した名前を索引するため、木構築段階で名前を書き換えた属性は線形に検索する。
+		m_omitted が設定された属性は返さない。
+		*/
+		const_iterator find(attribute_name name) const
+		{
+			std::uint32_t i = static_cast<std::uint32_t>(name);
+			if (i < m_index.size() && m_index[i] != 0)
+			{
+				const_iterator it = std::next(begin(), m_index[i] - 1);
+				if (it->m_name_id == name && !it->m_omitted) return it;
+			}
+
+			const_iterator it1 = begin();
+			const_iterator it2 = end();
+			while (it1 != it2)
+			{
+				if (!it1->m_omitted && it1->m_name_id == name) return it1;
+				++it1;
+			}
+			return it2;
+		}
+
 		bool empty() const { return m_last == 0; }
 
 		iterator begin() { return m_c.begin(); }
@@ -116,6 +225,13 @@ namespace wordring::whatwg::html::parsing
 		/*! @brief 最後の要素の次 */
 		std::uint32_t m_last;
 
+		/*! @brief 属性名アトムから m_c の添字 + 1 を引く索引 */
+		std::vector<std::uint32_t> m_index;
+		/*! @brief m_index に登録した属性名アトム */
+		std::vector<attribute_name> m_known;
+		/*! @brief 既知でない属性名のハッシュ値と m_c の添字 */
+		std::vector<std::pair<std::size_t, std::uint32_t>> m_unknown;
+
 	};
 
 	struct tag_token
@@ -161,6 +277,8 @@ namespace wordring::whatwg::html::parsing
 			return it2;
 		}
 
+		const_iterator find(attribute_name name) const { return m_attributes.find(name); }
+
 		std::u32string m_tag_name;
 		tag_name       m_tag_name_id;
 		bool           m_self_closing_flag;
@@ -76,6 +76,9 @@ namespace wordring::whatwg::html::parsing
 
 		char32_t m_character_reference_code;
 
+		/*! @brief 現在のトークンが始まった入力位置 */
+		std::uint32_t m_token_begin;
+
 		//
 
 	public:
@@ -84,6 +87,7 @@ namespace wordring::whatwg::html::parsing
 			, m_return_state(nullptr)
 			, m_current_tag_token_id(0)
 			, m_character_reference_code(0)
+			, m_token_begin(0)
 		{
 		}
 
@@ -97,10 +101,11 @@ namespace wordring::whatwg::html::parsing
 			m_return_state = nullptr;
 			m_temporary_buffer.clear();
 
-			m_DOCTYPE_token     = DOCTYPE_token();
-			m_start_tag_token   = start_tag_token();
-			m_end_tag_token     = end_tag_token();
-			m_comment_token     = comment_token();
+			// トークンが確保した記憶域は、次の解析のために残す
+			m_DOCTYPE_token.clear();
+			m_start_tag_token.clear();
+			m_end_tag_token.clear();
+			m_comment_token.m_data.clear();
 			m_character_token   = character_token();
 			m_end_of_file_token = end_of_file_token();
 
@@ -109,6 +114,8 @@ namespace wordring::whatwg::html::parsing
 			m_last_start_tag_name.clear();
 
 			m_character_reference_code = 0;
+
+			m_token_begin = 0;
 		}
 
 		// トークン -----------------------------------------------------------
@@ -203,10 +210,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		void unify_attribute()
 		{
-			token_attribute_list& al = current_tag_token().m_attributes;
-			auto it1 = al.begin();
-			auto it2 = std::prev(al.end(), 1);
-			while (it1 != it2) if (it1++->m_name == al.current().m_name) al.current().m_omitted = true;
+			current_tag_token().m_attributes.unify();
 		}
 		
 		// トークンの発送-------------------------------------------------------
@@ -261,6 +265,12 @@ namespace wordring::whatwg::html::parsing
 
 		void change_state(state_type st) { m_state = st; }
 
+		/*! @brief データ状態にあり、追加された入力をすべて消費しているか調べる
+
+		この位置では、以降の入力を新しいトークン化器で処理しても同じトークン列が得られる（木構築段階が状態を変更しない限り）。
+		*/
+		bool at_data_boundary() const { return m_state == data_state && base_type::idle(); }
+
 		void return_state(state_type st) { m_return_state = st; }
 
 		state_type return_state() const { return m_return_state; }
@@ -294,9 +304,31 @@ namespace wordring::whatwg::html::parsing
 
 		void on_emit_code_point()
 		{
+			if constexpr (detail::input_position_tracking<this_type>::value)
+			{
+				if (is_text_state(m_state)) m_token_begin = base_type::m_next_position.m_offset;
+			}
+
 			(this->*m_state)();
 		}
 
+		/*! @brief 文字トークン以外を含まない状態か調べる
+
+		これらの状態で消費される文字から、次のトークンが始まる。
+		*/
+		static bool is_text_state(state_type st)
+		{
+			return st == data_state || st == RCDATA_state || st == RAWTEXT_state || st == script_data_state
+				|| st == script_data_escaped_state || st == script_data_double_escaped_state || st == PLAINTEXT_state;
+		}
+
+		/*! @brief 現在のトークンが始まった入力位置を返す
+
+		派生クラスが入力位置を追跡する場合のみ有効。
+		トークンの発送中に呼び出すと、そのトークンの最初の文字の位置を返す。
+		*/
+		std::uint32_t token_begin() const { return m_token_begin; }
+
 		// 状態関数 -----------------------------------------------------------
 
 		/*! 12.2.5.1 Data state */
@@ -2571,11 +2603,11 @@ namespace wordring::whatwg::html::parsing
 		/*! 12.2.5.73 Named character reference state */
 		void on_named_character_reference_state()
 		{
-			if (!fill(named_character_reference_max_length + 1)) return;
-
 			std::uint32_t len = 0;
-			std::array<char32_t, 2> a = match_named_character_reference(len);
-			
+			bool complete = false;
+			std::array<char32_t, 2> a = match_named_character_reference(len, complete);
+			if (!complete) return;
+
 			if (len != 0) // matched
 			{
 				char32_t tail = *(begin() + len - 1);
@@ -3,6 +3,7 @@
 // https://html.spec.whatwg.org/multipage/parsing.html
 // https://triple-underscore.github.io/HTML-parsing-ja.html
 
+#include <wordring/whatwg/html/parsing/open_element_stack.hpp>
 #include <wordring/whatwg/html/parsing/parser_defs.hpp>
 #include <wordring/whatwg/html/parsing/tokenization.hpp>
 
@@ -15,10 +16,12 @@
 #include <wordring/whatwg/encoding/encoding.hpp>
 
 #include <algorithm>
+#include <array>
 #include <deque>
-#include <list>
+#include <functional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace wordring::whatwg::html::parsing
 {
@@ -113,13 +116,22 @@ namespace wordring::whatwg::html::parsing
 		// https://html.spec.whatwg.org/multipage/parsing.html#the-stack-of-open-elements
 		// ----------------------------------------------------------------------------------------
 
+		/*! @brief オープン要素のスタックの項目
+
+		開始タグ・トークンの複製は持たず、要素を指すポインタのみを保持する。
+		トークンの属性が必要となるのは HTML 統合点の判定だけなので、その結果をフラグとして持つ。
+		*/
 		struct stack_entry
 		{
-			start_tag_token m_token;
-			node_pointer    m_it;
+			node_pointer m_it;
+			/*! @brief encoding 属性の値が text/html あるいは application/xhtml+xml である開始タグから作成された */
+			bool         m_html_encoding;
 		};
 
-		std::deque<stack_entry> m_stack;
+		using stack_type = open_element_stack<traits, stack_entry>;
+		using scope_name = typename stack_type::scope_name;
+
+		stack_type m_stack;
 
 		// ----------------------------------------------------------------------------------------
 		// アクティブ整形要素のリスト
@@ -133,11 +145,36 @@ namespace wordring::whatwg::html::parsing
 			start_tag_token m_token;
 			node_pointer    m_it;
 			bool            m_marker;
+			/*! @brief タグ名と属性から計算した署名、 Noah's Ark 条項の比較を絞り込むために使う */
+			std::size_t     m_signature;
 		};
 
 		/*! @brief アクティブ整形要素のリスト
+
+		項目は少数で末尾付近の操作が多いため、連続したメモリに置く。
+		項目の追加と削除は insert_list() と erase_list() を通し、 m_list_count を更新する。
+		*/
+		std::vector<active_formatting_element> m_list;
+
+		/*! @brief タグ名アトムごとの、リスト内の項目数（マーカーを除く）
+
+		要素の索引として使い、リストに無い要素の検索を定数時間で終える。
+		同意機関アルゴリズムの内側のループは、整形要素でない要素も含めてスタック上の要素を一つずつ検索する。
 		*/
-		std::list<active_formatting_element> m_list;
+		std::array<std::uint32_t, stack_type::tag_name_count> m_list_count;
+
+		/*! @brief アクティブ整形要素のリストに対する操作
+
+		パーサーの on_formatting_operation() へ通知され、計測に使われる。
+		*/
+		enum class formatting_operation_name : std::uint32_t
+		{
+			push,
+			push_marker,
+			reconstruct,
+			clear,
+			adoption_agency,
+		};
 
 		// ----------------------------------------------------------------------------------------
 		// 要素ポインタ
@@ -180,6 +217,12 @@ namespace wordring::whatwg::html::parsing
 
 		bool m_fragments_parser;
 
+		/*! @brief 構築時に指定された断片の解析モード
+
+		clear() は断片の解析モードをこの値へ戻す。
+		*/
+		bool m_default_fragments_parser;
+
 		stack_entry m_context_entry;
 
 		// ----------------------------------------------------------------------------------------
@@ -204,17 +247,22 @@ namespace wordring::whatwg::html::parsing
 			, m_encoding_name(enc)
 			, m_insertion_mode(mode_name::initial_insertion_mode)
 			, m_original_insertion_mode(static_cast<mode_name>(0))
+			, m_list_count()
 			, m_head_element_pointer(traits::pointer())
 			, m_form_element_pointer(traits::pointer())
 			, m_scripting_flag(false)
 			, m_frameset_ok_flag(true)
 			, m_foster_parenting(false)
 			, m_fragments_parser(fragments_parser)
+			, m_default_fragments_parser(fragments_parser)
 			, m_omit_lf(false)
 		{
 		}
 
 		/*! @brief 初期状態に戻し、パーサーを再利用可能とする
+
+		断片の解析モードは構築時に指定した値へ戻し、 start_fragment() で設定した文脈要素は解除する。
+		文脈要素を指定して断片を続けて解析する場合、再び start_fragment() を呼び出す。
 		*/
 		void clear(encoding_confidence_name confidence, encoding_name enc)
 		{
@@ -230,6 +278,7 @@ namespace wordring::whatwg::html::parsing
 			m_stack.clear();
 
 			m_list.clear();
+			m_list_count.fill(0);
 
 			m_head_element_pointer = traits::pointer();
 			m_form_element_pointer = traits::pointer();
@@ -239,13 +288,73 @@ namespace wordring::whatwg::html::parsing
 
 			m_foster_parenting = false;
 
-			m_context_entry = stack_entry();
+			m_fragments_parser = m_default_fragments_parser;
+			m_context_entry    = stack_entry();
 
 			m_omit_lf = false;
 
 			m_pending_table_character_tokens.clear();
 		}
 
+		/*! @brief HTML 断片の解析を開始する
+
+		@param [in] context 文脈要素を指すポインタあるいはイテレータ
+
+		文書ノードへ根となる html 要素を挿入し、スタックと挿入モード、トークン化器の状態を文脈要素に合わせて設定する。
+		解析後、根の子孫が断片となる。
+		文脈要素の祖先は調べないため、 form 要素ポインタは文脈要素自身が form 要素の場合のみ設定する。
+
+		- https://html.spec.whatwg.org/multipage/parsing.html#parsing-html-fragments
+		- https://triple-underscore.github.io/HTML-parsing-ja.html#parsing-html-fragments
+		*/
+		node_pointer start_fragment(node_pointer context)
+		{
+			this_type* P = static_cast<this_type*>(this);
+
+			m_fragments_parser = true;
+			m_context_entry    = { context, false };
+
+			// 4.
+			if (traits::get_namespace_name(context) == ns_name::HTML)
+			{
+				switch (traits::get_local_name_name(context))
+				{
+				case tag_name::Title: case tag_name::Textarea:
+					base_type::change_state(base_type::RCDATA_state);
+					break;
+				case tag_name::Style: case tag_name::Xmp: case tag_name::Iframe: case tag_name::Noembed: case tag_name::Noframes:
+					base_type::change_state(base_type::RAWTEXT_state);
+					break;
+				case tag_name::Script:
+					base_type::change_state(base_type::script_data_state);
+					break;
+				case tag_name::Noscript:
+					if (m_scripting_flag) base_type::change_state(base_type::RAWTEXT_state);
+					break;
+				case tag_name::Plaintext:
+					base_type::change_state(base_type::PLAINTEXT_state);
+					break;
+				default:
+					break;
+				}
+			}
+			// 5. - 7.
+			node_pointer root = P->create_element(P->get_document(), tag_name::Html, ns_name::HTML);
+			root = P->insert_element(traits::end(P->get_document()), root);
+			m_stack.push_back({ root, false });
+			// 8.
+			if (is_html_element_of(context, tag_name::Template))
+			{
+				m_template_insertion_mode_stack.push_back(mode_name::in_template_insertion_mode);
+			}
+			// 10.
+			reset_insertion_mode_appropriately();
+			// 11.
+			if (is_html_element_of(context, tag_name::Form)) m_form_element_pointer = context;
+
+			return root;
+		}
+
 		/*! 要素が指定のHTML要素であることを調べる
 
 		@param [in] it  要素を指すポインタあるいはイテレータ
@@ -449,12 +558,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		bool contains(ns_name ns, tag_name tag) const
 		{
-			for (stack_entry const& se : m_stack)
-			{
-				if (is_element_of(se.m_it, ns, tag)) return true;
-			}
-
-			return false;
+			return m_stack.top(ns, tag) != 0;
 		}
 
 		/*! @brief スタックに指定されたタグが有るか調べる
@@ -467,12 +571,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		bool contains(tag_name name) const
 		{
-			for (stack_entry const& se : m_stack)
-			{
-				if (is_html_element_of(se.m_it, name)) return true;
-			}
-
-			return false;
+			return m_stack.top(ns_name::HTML, name) != 0;
 		}
 
 		/*! @brief スタックに指定されたポインタが有るか調べる
@@ -485,8 +584,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		bool contains(node_pointer it) const
 		{
-			for (stack_entry const& se : m_stack) { if (se.m_it == it) return true; }
-			return false;
+			return m_stack.find(it) != m_stack.end();
 		}
 
 		/*! @brief 現在のノードを返す
@@ -626,48 +724,59 @@ namespace wordring::whatwg::html::parsing
 			+ 要素へのポインタあるいはイテレータ
 		.
 
+		タグ名による問い合わせは、スタックが保持する索引により定数時間で答える。
+		要素へのポインタと文字列による問い合わせは、最も上の境界要素までを走査する。
+
 		- https://html.spec.whatwg.org/multipage/parsing.html#has-an-element-in-the-specific-scope
 		- https://triple-underscore.github.io/HTML-parsing-ja.html#has-an-element-in-the-specific-scope
 		*/
 		template <typename Scope, typename Target>
 		bool in_specific_scope(Scope s, Target const& target) const
 		{
-			auto it1 = m_stack.rbegin();
-			auto it2 = m_stack.rend();
+			scope_name scope = to_scope_name(s);
 
-			while (it1 != it2)
+			if constexpr (std::is_same_v<Target, std::pair<ns_name, tag_name>>)
+			{
+				return m_stack.in_scope(scope, target.first, target.second);
+			}
+			else if constexpr (std::is_same_v<Target, node_pointer>)
+			{
+				return m_stack.in_scope_if(scope, [&target](node_pointer it) { return it == target; });
+			}
+			else if constexpr (std::is_same_v<Target, tag_name>)
+			{
+				return m_stack.in_scope(scope, ns_name::HTML, target);
+			}
+			else if constexpr (std::is_same_v<Target, std::u32string>)
+			{
+				return m_stack.in_scope_if(scope, [this, &target](node_pointer it) { return is_html_element_of(it, target); });
+			}
+			else // [h1-h6], [tbody, thead, tfoot] に対応するstd::array
 			{
-				auto it = it1->m_it;
+				for (tag_name tag : target) if (m_stack.in_scope(scope, ns_name::HTML, tag)) return true;
+				return false;
+			}
+		}
 
-				// ターゲット確認
-				if constexpr (std::is_same_v<Target, std::pair<ns_name, tag_name>>)
-				{
-					if (is_element_of(it, target.first, target.second)) return true;
-				}
-				else if constexpr (std::is_same_v<Target, node_pointer>)
-				{
-					if (it == target) return true;
-				}
-				else if constexpr (std::is_same_v<Target, tag_name>)
-				{
-					if (is_html_element_of(it, target)) return true;
-				}
-				else if constexpr (std::is_same_v<Target, std::u32string>)
-				{
-					if (is_html_element_of(it, target)) return true;
-				}
-				else // [h1-h6], [tbody, thead, tfoot] に対応するstd::array
-				{
-					for (tag_name tag : target) if (is_html_element_of(it, tag)) return true;
-				}
+		/*! @brief スコープを指すメンバ・ポインタをスタックのスコープ名に変換する
+		*/
+		static scope_name to_scope_name(scope_type s)
+		{
+			if (s == default_scope)   return scope_name::default_scope;
+			if (s == list_item_scope) return scope_name::list_item_scope;
+			if (s == button_scope)    return scope_name::button_scope;
+			if (s == table_scope)     return scope_name::table_scope;
 
-				// スコープ確認
-				if ((this->*s)(it)) return false;
-				++it1;
-			}
+			assert(s == select_scope);
+			return scope_name::select_scope;
+		}
 
-			assert(false);
-			return false;
+		/*! @brief 要素が指定のスコープの境界となるか調べる
+		*/
+		bool is_scope_boundary(node_pointer it, scope_name s) const
+		{
+			std::uint32_t mask = stack_type::scope_mask(traits::get_namespace_name(it), traits::get_local_name_name(it));
+			return (mask & (1u << static_cast<std::uint32_t>(s))) != 0;
 		}
 
 		/*! @brief デフォルトのスコープ内の特定な要素か調べる
@@ -681,42 +790,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		bool is_default_scope(node_pointer it) const
 		{
-			ns_name  ns  = traits::get_namespace_name(it);
-			tag_name tag = traits::get_local_name_name(it);
-
-			if (ns == ns_name::HTML)
-			{
-				switch (tag)
-				{
-				case tag_name::Applet: case tag_name::Caption: case tag_name::Html:   case tag_name::Table:    case tag_name::Td:
-				case tag_name::Th:     case tag_name::Marquee: case tag_name::Object: case tag_name::Template:
-					return true;
-				default:
-					return false;
-				}
-			}
-			else if (ns == ns_name::MathML)
-			{
-				switch (tag)
-				{
-				case tag_name::Mi: case tag_name::Mo: case tag_name::Mn: case tag_name::Ms: case tag_name::Mtext: case tag_name::Annotation_xml:
-					return true;
-				default:
-					return false;
-				}
-			}
-			else if (ns == ns_name::SVG)
-			{
-				switch (tag)
-				{
-				case tag_name::Factorial: case tag_name::ForeignObject: case tag_name::Desc: case tag_name::Title:
-					return true;
-				default:
-					return false;
-				}
-			}
-
-			return false;
+			return is_scope_boundary(it, scope_name::default_scope);
 		}
 
 		/*! @brief リスト・アイテムのスコープ内の特定な要素か調べる
@@ -730,10 +804,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		bool is_list_item_scope(node_pointer it) const
 		{
-			if (is_default_scope(it)) return true;
-			if (is_html_element_of(it, tag_name::Ol) || is_html_element_of(it, tag_name::Ul)) return true;
-
-			return false;
+			return is_scope_boundary(it, scope_name::list_item_scope);
 		}
 
 		/*! @brief ボタンのスコープ内の特定な要素か調べる
@@ -747,10 +818,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		bool is_button_scope(node_pointer it) const
 		{
-			if (is_default_scope(it)) return true;
-			if (is_html_element_of(it, tag_name::Button)) return true;
-
-			return false;
+			return is_scope_boundary(it, scope_name::button_scope);
 		}
 
 		/*! @brief テーブルのスコープ内の特定な要素か調べる
@@ -764,11 +832,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		bool is_table_scope(node_pointer it) const
 		{
-			if (is_html_element_of(it, tag_name::Html)
-			 || is_html_element_of(it, tag_name::Table)
-			 || is_html_element_of(it, tag_name::Template)) return true;
-
-			return false;
+			return is_scope_boundary(it, scope_name::table_scope);
 		}
 
 		/*! @brief セレクトのスコープ内の特定な要素か調べる
@@ -782,9 +846,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		bool is_select_scope(node_pointer it) const
 		{
-			if (is_html_element_of(it, tag_name::Optgroup) || is_html_element_of(it, tag_name::Option)) return false;
-
-			return true;
+			return is_scope_boundary(it, scope_name::select_scope);
 		}
 
 		static scope_type constexpr default_scope   = &tree_construction_dispatcher::is_default_scope;
@@ -793,6 +855,20 @@ namespace wordring::whatwg::html::parsing
 		static scope_type constexpr table_scope     = &tree_construction_dispatcher::is_table_scope;
 		static scope_type constexpr select_scope    = &tree_construction_dispatcher::is_select_scope;
 
+		/*! @brief スタックの末尾の項目をPOPする
+
+		派生クラスへ on_pop_element() で要素の終了を通知する。
+		スタックからの除去は、解析器の再利用のための clear() を除き、すべてこのメンバか remove() を通す。
+		このメンバは規格に無い。
+		*/
+		void pop_open_element()
+		{
+			this_type* P = static_cast<this_type*>(this);
+
+			P->on_pop_element(m_stack.back().m_it);
+			m_stack.pop_back();
+		}
+
 		/*! @brief スタックから指定のタグが現れるまでPOPする
 
 		@param [in] ns  名前空間
@@ -808,7 +884,7 @@ namespace wordring::whatwg::html::parsing
 			while (!m_stack.empty())
 			{
 				bool f = is_element_of(m_stack.back().m_it, ns, tag);
-				m_stack.pop_back();
+				pop_open_element();
 				if (f) break;
 			}
 		}
@@ -835,7 +911,7 @@ namespace wordring::whatwg::html::parsing
 			{
 				node_pointer it = m_stack.back().m_it;
 				bool f = std::find_if(it1, it2, [this, ns, it](tag_name tag) { return is_element_of(it, ns, tag); }) != it2;
-				m_stack.pop_back();
+				pop_open_element();
 				if (f) break;
 			}
 		}
@@ -854,7 +930,7 @@ namespace wordring::whatwg::html::parsing
 			while (!m_stack.empty())
 			{
 				node_pointer p = m_stack.back().m_it;
-				m_stack.pop_back();
+				pop_open_element();
 				if (p == it) break;
 			}
 		}
@@ -869,15 +945,7 @@ namespace wordring::whatwg::html::parsing
 		*/
 		auto find(node_pointer it)
 		{
-			auto it1 = m_stack.begin();
-			auto it2 = m_stack.end();
-			while (it1 != it2)
-			{
-				if (it1->m_it == it) break;
-				++it1;
-			}
-
-			return it1;
+			return m_stack.find(it);
 		}
 
 		/*! @brief スタックから指定の要素を持つ項目を除去する
@@ -888,9 +956,11 @@ namespace wordring::whatwg::html::parsing
 		*/
 		void remove(node_pointer it)
 		{
-			auto it1 = std::find_if(m_stack.begin(), m_stack.end(), [it](stack_entry const& se) {
-				return se.m_it == it; });
+			this_type* P = static_cast<this_type*>(this);
+
+			auto it1 = m_stack.find(it);
 			assert(it1 != m_stack.end());
+			P->on_pop_element(it);
 			m_stack.erase(it1);
 		}
 
@@ -909,14 +979,15 @@ namespace wordring::whatwg::html::parsing
 		- https://html.spec.whatwg.org/multipage/parsing.html#push-onto-the-list-of-active-formatting-elements
 		- https://triple-underscore.github.io/HTML-parsing-ja.html#push-onto-the-list-of-active-formatting-elements
 
-		@todo
-			要素が作成されたときと同じ比較とは、ケース・インセンシティブ、名前空間接頭辞の分離前の比較を意味するかもしれない。
-			あるいは、実際にトークンと比較するのかもしれない。
-			この実装は、スクリプトをサポートしないため、トークンと要素の属性は違いが無い。
-			したがって、要素同士を比較している。
+		要素が作成されたときの属性で比較するため、要素ではなく、リストに保持する開始タグ・トークン同士を比較する。
+		署名が一致する項目のみ属性を比較する。
 		*/
 		void push_formatting_element_list(node_pointer it, start_tag_token const& token)
 		{
+			static_cast<this_type*>(this)->on_formatting_operation(formatting_operation_name::push);
+
+			std::size_t signature = formatting_signature(token);
+
 			std::uint32_t n = 0;
 			auto pos = m_list.end();
 
@@ -926,16 +997,56 @@ namespace wordring::whatwg::html::parsing
 			{
 				--it1;
 				if (it1->m_marker) break;
-				if (traits::equals(it, it1->m_it))
+				if (it1->m_signature == signature && equals_formatting_token(token, it1->m_token))
 				{
 					pos = it1;
 					++n;
 				}
 			}
 
-			if (3 <= n) m_list.erase(pos);
+			if (3 <= n) erase_list(pos);
+
+			insert_list(m_list.end(), { token, it, false, signature });
+		}
+
+		/*! @brief 開始タグ・トークンのタグ名と属性から署名を計算する
+
+		属性の順序に依らない値を返す。
+		このメンバは規格に無い。
+		*/
+		static std::size_t formatting_signature(start_tag_token const& token)
+		{
+			std::hash<std::u32string> hash;
+
+			std::size_t h = 0;
+			for (token_attribute const& a : token)
+			{
+				if (a.m_omitted) continue;
+				h += hash(a.m_name) * 31 + hash(a.m_value);
+			}
 
-			m_list.push_back({ token, it, false });
+			return hash(token.m_tag_name) ^ (h * 0x9E3779B9u);
+		}
+
+		/*! @brief 二つの開始タグ・トークンのタグ名と属性が一致するか調べる
+
+		このメンバは規格に無い。
+		*/
+		static bool equals_formatting_token(start_tag_token const& lhs, start_tag_token const& rhs)
+		{
+			if (lhs.m_tag_name != rhs.m_tag_name) return false;
+
+			std::uint32_t n = 0;
+			for (token_attribute const& a : lhs)
+			{
+				if (a.m_omitted) continue;
+				auto it = a.m_name_id != static_cast<attribute_name>(0) ? rhs.find(a.m_name_id) : rhs.find(a.m_name);
+				if (it == rhs.end() || it->m_value != a.m_value) return false;
+				++n;
+			}
+			for (token_attribute const& a : rhs) if (!a.m_omitted) --n;
+
+			return n == 0;
 		}
 
 		/*! @brief アクティブ整形要素リストへマーカーを挿入する
@@ -945,7 +1056,8 @@ namespace wordring::whatwg::html::parsing
 		*/
 		void push_formatting_element_list()
 		{
-			m_list.push_back({ start_tag_token(), node_pointer(), true });
+			static_cast<this_type*>(this)->on_formatting_operation(formatting_operation_name::push_marker);
+			insert_list(m_list.end(), { start_tag_token(), node_pointer(), true, 0 });
 		}
 
 		/*! @brief アクティブ整形要素リストを再構築する
@@ -961,6 +1073,7 @@ namespace wordring::whatwg::html::parsing
 			if (m_list.empty()) return;
 			// 2.
 			if (m_list.back().m_marker || contains(m_list.back().m_it)) return;
+			static_cast<this_type*>(this)->on_formatting_operation(formatting_operation_name::reconstruct);
 			// 3.
 			auto entry = --m_list.end();
 			// 4.
@@ -989,33 +1102,61 @@ namespace wordring::whatwg::html::parsing
 		*/
 		void clear_formatting_element_list()
 		{
+			static_cast<this_type*>(this)->on_formatting_operation(formatting_operation_name::clear);
+
 			while (!m_list.empty())
 			{
 				bool marker = m_list.back().m_marker;
-				m_list.pop_back();
+				erase_list(std::prev(m_list.end()));
 				if (marker) break;
 			}
 		}
 
+		/*! @brief リストへ項目を挿入し、索引を更新する
+
+		このメンバは規格に無い。
+		*/
+		void insert_list(typename std::vector<active_formatting_element>::iterator pos, active_formatting_element&& entry)
+		{
+			if (!entry.m_marker) ++m_list_count[static_cast<std::uint32_t>(traits::get_local_name_name(entry.m_it))];
+			m_list.insert(pos, std::move(entry));
+		}
+
+		/*! @brief リストから項目を削除し、索引を更新する
+
+		このメンバは規格に無い。
+		*/
+		void erase_list(typename std::vector<active_formatting_element>::iterator pos)
+		{
+			if (!pos->m_marker) --m_list_count[static_cast<std::uint32_t>(traits::get_local_name_name(pos->m_it))];
+			m_list.erase(pos);
+		}
+
 		/*! @brief リストから指定の要素を持つ項目を検索する
 
 		@param [in] it 要素を指すポインタあるいはイテレータ
 
 		@return リスト内で指定の要素を持つ項目を指すイテレータ
 
+		項目の要素は HTML 要素であり、再構築などで差し替えられてもタグ名は変わらない。
+		索引に同じタグ名の項目が無い場合、リストを走査しない。
+
 		このメンバは規格に無い。
 		*/
 		auto find_from_list(node_pointer it)
 		{
-			auto it1 = m_list.begin();
-			auto it2 = m_list.end();
+			if (traits::get_namespace_name(it) != ns_name::HTML
+				|| m_list_count[static_cast<std::uint32_t>(traits::get_local_name_name(it))] == 0) return m_list.end();
+
+			auto it1 = m_list.end();
+			auto it2 = m_list.begin();
 			while (it1 != it2)
 			{
-				if (it1->m_it == it) break;
-				++it1;
+				--it1;
+				if (!it1->m_marker && it1->m_it == it) return it1;
 			}
 
-			return it1;
+			return m_list.end();
 		}
 
 		/*! @brief 整形要素リストから指定の要素を持つ項目を削除する
@@ -1027,7 +1168,23 @@ namespace wordring::whatwg::html::parsing
 		void remove_from_list(node_pointer it)
 		{
 			auto it1 = find_from_list(it);
-			if (it1 != m_list.end()) m_list.erase(it1);
+			if (it1 != m_list.end()) erase_list(it1);
+		}
+
+		/*! @brief 整形要素リストから指定の要素を持つ項目を削除する
+
+		@param [in]     it       要素を指すポインタあるいはイテレータ
+		@param [in,out] bookmark リスト内の位置を表す添字、削除する項目より後ろを指す場合は一つ戻す
+
+		このメンバは規格に無い。
+		*/
+		void remove_from_list(node_pointer it, std::size_t& bookmark)
+		{
+			auto it1 = find_from_list(it);
+			if (it1 == m_list.end()) return;
+
+			if (static_cast<std::size_t>(std::distance(m_list.begin(), it1)) < bookmark) --bookmark;
+			erase_list(it1);
 		}
 
 		// ----------------------------------------------------------------------------------------
@@ -1205,13 +1362,7 @@ namespace wordring::whatwg::html::parsing
 
 			if (ns == ns_name::MathML && tag == tag_name::Annotation_xml)
 			{
-				auto it = entry.m_token.find(U"encoding");
-				if (it != entry.m_token.end())
-				{
-					std::u32string s;
-					to_ascii_lowercase(it->m_value.begin(), it->m_value.end(), std::back_inserter(s));
-					if (s == U"text/html" || s == U"application/xhtml+xml") return true;
-				}
+				if (entry.m_html_encoding) return true;
 			}
 			else if (ns == ns_name::SVG)
 			{
@@ -1337,7 +1488,12 @@ namespace wordring::whatwg::html::parsing
 		{
 			this_type* P = static_cast<this_type*>(this);
 
-			node_pointer adjusted_insertion_location = appropriate_place_for_inserting_node(current_node().m_it);
+			// 深さの上限を超える要素は、上限の深さにある要素の子とする
+			node_pointer target = current_node().m_it;
+			std::uint32_t limit = std::max(P->open_element_depth_limit(), 1u);
+			if (limit <= m_stack.size()) target = m_stack[limit - 1].m_it;
+
+			node_pointer adjusted_insertion_location = appropriate_place_for_inserting_node(target);
 			node_pointer el = create_element_for_token(token, ns, traits::parent(adjusted_insertion_location));
 			node_pointer it = traits::pointer();
 
@@ -1345,7 +1501,19 @@ namespace wordring::whatwg::html::parsing
 
 			it = P->insert_element(adjusted_insertion_location, el);
 
-			m_stack.push_back({ token, it });
+			bool html_encoding = false;
+			if (ns == ns_name::MathML && traits::get_local_name_name(it) == tag_name::Annotation_xml)
+			{
+				auto it1 = token.find(attribute_name::Encoding);
+				if (it1 != token.end())
+				{
+					std::u32string s;
+					to_ascii_lowercase(it1->m_value.begin(), it1->m_value.end(), std::back_inserter(s));
+					html_encoding = s == U"text/html" || s == U"application/xhtml+xml";
+				}
+			}
+
+			m_stack.push_back({ it, html_encoding });
 
 			return it;
 		}
@@ -1368,7 +1536,11 @@ namespace wordring::whatwg::html::parsing
 			{
 				for (auto& attr : token.m_attributes)
 				{
-					if (attr.m_name == U"definitionurl") attr.m_name = U"definitionURL";
+					if (attr.m_name == U"definitionurl")
+					{
+						attr.m_name    = U"definitionURL";
+						attr.m_name_id = attribute_name::DefinitionURL;
+					}
 				}
 			}
 		}
@@ -1384,7 +1556,12 @@ namespace wordring::whatwg::html::parsing
 				for (auto& attr : token.m_attributes)
 				{
 					auto it = svg_attributes_conversion_tbl.find(attr.m_name);
-					if(it != svg_attributes_conversion_tbl.end()) attr.m_name = it->second;
+					if (it != svg_attributes_conversion_tbl.end())
+					{
+						attr.m_name = it->second;
+						auto it1 = attribute_atom_tbl.find(attr.m_name);
+						attr.m_name_id = (it1 == attribute_atom_tbl.end()) ? static_cast<attribute_name>(0) : it1->second;
+					}
 				}
 			}
 		}
@@ -1405,6 +1582,9 @@ namespace wordring::whatwg::html::parsing
 						a.m_namespace = it->second.m_namespace;
 						a.m_prefix    = it->second.m_prefix;
 						a.m_name      = it->second.m_local_name;
+
+						auto it1 = attribute_atom_tbl.find(a.m_name);
+						a.m_name_id = (it1 == attribute_atom_tbl.end()) ? static_cast<attribute_name>(0) : it1->second;
 					}
 				}
 			}
@@ -1428,7 +1608,7 @@ namespace wordring::whatwg::html::parsing
 				node_pointer prev = traits::prev(it1);
 				if (traits::is_text(prev))
 				{
-					traits::append_text(prev, cp);
+					P->append_text(prev, cp);
 					return;
 				}
 			}
@@ -1526,7 +1706,7 @@ namespace wordring::whatwg::html::parsing
 					return;
 				}
 
-				m_stack.pop_back();
+				pop_open_element();
 			}
 		}
 
@@ -1557,7 +1737,7 @@ namespace wordring::whatwg::html::parsing
 					return;
 				}
 
-				m_stack.pop_back();
+				pop_open_element();
 			}
 		}
 
@@ -1707,7 +1887,7 @@ namespace wordring::whatwg::html::parsing
 				{
 					node_pointer el = create_element_for_token(token, ns_name::HTML, P->get_document());
 					node_pointer it = P->insert_element(P->get_document().end(), el);
-					m_stack.push_back({ token, it });
+					m_stack.push_back({ it, false });
 					insertion_mode(mode_name::before_head_insertion_mode);
 
 					return;
@@ -1731,7 +1911,7 @@ namespace wordring::whatwg::html::parsing
 			node_pointer el = P->create_element(P->get_document(), tag_name::Html, ns_name::HTML);
 			node_pointer it = P->insert_element(P->get_document().end(), std::move(el));
 			traits::set_document(it, P->get_document());
-			m_stack.push_back({ start_tag_token(), it });
+			m_stack.push_back({ it, false });
 			insertion_mode(mode_name::before_head_insertion_mode);
 			reprocess_token(token);
 		}
@@ -1842,13 +2022,13 @@ namespace wordring::whatwg::html::parsing
 					return;
 				case tag_name::Base: case tag_name::Basefont: case tag_name::Bgsound: case tag_name::Link:
 					insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					if (token.m_self_closing_flag == true) token.m_acknowledged_self_closing_flag = true;
 					return;
 				case tag_name::Meta:
 				{
 					insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					if (token.m_self_closing_flag == true) token.m_acknowledged_self_closing_flag = true;
 					if (m_encoding_confidence != encoding_confidence_name::tentative) return;
 
@@ -1906,7 +2086,7 @@ namespace wordring::whatwg::html::parsing
 
 					//TODO: スクリプトの実行を防ぐを無条件に設定している
 					traits::set_already_started_flag(it, true);
-					m_stack.push_back({ token, it });
+					m_stack.push_back({ it, false });
 					base_type::change_state(base_type::script_data_state);
 					m_original_insertion_mode = m_insertion_mode;
 					insertion_mode(mode_name::text_insertion_mode);
@@ -1923,7 +2103,7 @@ namespace wordring::whatwg::html::parsing
 				{
 				case tag_name::Head:
 					assert(is_html_element_of(current_node().m_it, tag_name::Head));
-					m_stack.pop_back();
+					pop_open_element();
 					insertion_mode(mode_name::after_head_insertion_mode);
 					return;
 				case tag_name::Body: case tag_name::Html: case tag_name::Br:
@@ -1981,7 +2161,7 @@ namespace wordring::whatwg::html::parsing
 			goto AnythingElse;
 		AnythingElse:
 			assert(is_html_element_of(current_node().m_it, tag_name::Head));
-			m_stack.pop_back();
+			pop_open_element();
 			insertion_mode(mode_name::after_head_insertion_mode);
 			reprocess_token(token);
 		}
@@ -2017,7 +2197,7 @@ namespace wordring::whatwg::html::parsing
 				if (token.m_tag_name_id == tag_name::Noscript)
 				{
 					assert(is_html_element_of(current_node().m_it, tag_name::Noscript));
-					m_stack.pop_back();
+					pop_open_element();
 					assert(is_html_element_of(current_node().m_it, tag_name::Head));
 					insertion_mode(mode_name::in_head_insertion_mode);
 					return;
@@ -2078,7 +2258,7 @@ namespace wordring::whatwg::html::parsing
 		AnythingElse:
 			base_type::report_error();
 			assert(is_html_element_of(current_node().m_it, tag_name::Noscript));
-			m_stack.pop_back();
+			pop_open_element();
 			assert(is_html_element_of(current_node().m_it, tag_name::Head));
 			insertion_mode(mode_name::in_head_insertion_mode);
 			reprocess_token(token);
@@ -2136,7 +2316,7 @@ namespace wordring::whatwg::html::parsing
 				case tag_name::Meta:     case tag_name::Noframes: case tag_name::Script:  case tag_name::Style:
 				case tag_name::Template: case tag_name::Title:
 					base_type::report_error();
-					m_stack.push_back({ start_tag_token(), m_head_element_pointer });
+					m_stack.push_back({ m_head_element_pointer, false });
 					on_in_head_insertion_mode(token);
 					m_stack.erase(std::remove_if(m_stack.begin(), m_stack.end(), [this](stack_entry const& entry) {
 						return entry.m_it == m_head_element_pointer; }), m_stack.end());
@@ -2304,7 +2484,7 @@ namespace wordring::whatwg::html::parsing
 
 					node_pointer it = traits::parent(m_stack[1].m_it);
 					if (traits::parent(it) != P->get_document()) P->erase_element(it);
-					while (!is_html_element_of(current_node().m_it, tag_name::Html)) m_stack.pop_back();
+					while (!is_html_element_of(current_node().m_it, tag_name::Html)) pop_open_element();
 					insert_html_element(token);
 					insertion_mode(mode_name::in_frameset_insertion_mode);
 					return;
@@ -2428,7 +2608,7 @@ namespace wordring::whatwg::html::parsing
 							if (traits::get_namespace_name(current_node().m_it) == ns_name::HTML)
 							{
 								base_type::report_error();
-								m_stack.pop_back();
+								pop_open_element();
 							}
 						default:
 							break;
@@ -2834,7 +3014,7 @@ namespace wordring::whatwg::html::parsing
 				case tag_name::Wbr:
 					reconstruct_formatting_element_list();
 					insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					if (token.m_self_closing_flag) token.m_acknowledged_self_closing_flag = true;
 					m_frameset_ok_flag = false;
 					return;
@@ -2849,9 +3029,9 @@ namespace wordring::whatwg::html::parsing
 				{
 					reconstruct_formatting_element_list();
 					insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					if (token.m_self_closing_flag) token.m_acknowledged_self_closing_flag = true;
-					auto it = token.find(U"type");
+					auto it = token.find(attribute_name::Type);
 					std::u32string_view sv(U"hidden");
 					if (it != token.end()
 						&& is_ascii_case_insensitive_match(it->m_value.begin(), it->m_value.end(), sv.begin(), sv.end())) return;
@@ -2866,7 +3046,7 @@ namespace wordring::whatwg::html::parsing
 				{
 				case tag_name::Param: case tag_name::Source: case tag_name::Track:
 					insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					if (token.m_self_closing_flag) token.m_acknowledged_self_closing_flag = true;
 					return;
 				default:
@@ -2880,7 +3060,7 @@ namespace wordring::whatwg::html::parsing
 				{
 					if (in_specific_scope(button_scope, tag_name::P)) close_p_element();
 					insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					if (token.m_self_closing_flag) token.m_acknowledged_self_closing_flag = true;
 					m_frameset_ok_flag = false;
 					return;
@@ -2982,7 +3162,7 @@ namespace wordring::whatwg::html::parsing
 				switch (token.m_tag_name_id)
 				{
 				case tag_name::Optgroup: case tag_name::Option:
-					if (is_html_element_of(current_node().m_it, tag_name::Option)) m_stack.pop_back();
+					if (is_html_element_of(current_node().m_it, tag_name::Option)) pop_open_element();
 					reconstruct_formatting_element_list();
 					insert_html_element(token);
 					return;
@@ -3036,7 +3216,7 @@ namespace wordring::whatwg::html::parsing
 					insert_foreign_element(token, ns_name::MathML);
 					if (token.m_self_closing_flag)
 					{
-						m_stack.pop_back();
+						pop_open_element();
 						token.m_acknowledged_self_closing_flag = true;
 					}
 					return;
@@ -3053,7 +3233,7 @@ namespace wordring::whatwg::html::parsing
 					insert_foreign_element(token, ns_name::SVG);
 					if (token.m_self_closing_flag)
 					{
-						m_stack.pop_back();
+						pop_open_element();
 						token.m_acknowledged_self_closing_flag = true;
 					}
 					return;
@@ -3136,12 +3316,14 @@ namespace wordring::whatwg::html::parsing
 				node_pointer  formatting_element; // 5.
 				node_pointer  furthest_block;     // 10.
 				node_pointer  common_ancestor;    // 12.
-				typename std::list<active_formatting_element>::iterator bookmark; // 13.
+				std::size_t   bookmark;  // 13. リスト内の添字
 				node_pointer  node;      // 14.
 				node_pointer  prev_node; // 14.
 				node_pointer  last_node; // 14.
 				std::uint32_t inner_loop_counter; // 14.1.
 
+				P->on_formatting_operation(formatting_operation_name::adoption_agency);
+
 				// 1.
 				std::u32string const& subject = token.m_tag_name;
 				// 2.
@@ -3150,7 +3332,7 @@ namespace wordring::whatwg::html::parsing
 					&& encoding_cast<std::u32string>(traits::get_local_name(it)) == subject
 					&& find_from_list(it) == m_list.end())
 				{
-					m_stack.pop_back();
+					pop_open_element();
 					return false;
 				}
 				// 3.
@@ -3169,7 +3351,7 @@ namespace wordring::whatwg::html::parsing
 					{
 						--it1;
 						if (it1->m_marker) break;
-						if (encoding_cast<std::u32string>(traits::get_local_name(it1->m_it)) == subject)
+						if (it1->m_token.m_tag_name == subject)
 						{
 							formatting_element = it1->m_it;
 							break;
@@ -3195,9 +3377,8 @@ namespace wordring::whatwg::html::parsing
 				// 10.
 				furthest_block = traits::pointer();
 				{
-					auto it1 = m_stack.begin();
+					auto it1 = std::next(find(formatting_element));
 					auto it2 = m_stack.end();
-					while (it1 != it2) { if (it1++->m_it == formatting_element) break; }
 					while (it1 != it2)
 					{
 						if (is_special(it1->m_it))
@@ -3218,7 +3399,7 @@ namespace wordring::whatwg::html::parsing
 				// 12.
 				common_ancestor = std::prev(find(formatting_element))->m_it;
 				// 13.
-				bookmark = std::next(find_from_list(formatting_element));
+				bookmark = std::distance(m_list.begin(), find_from_list(formatting_element)) + 1;
 				// 14
 				node = furthest_block;
 				last_node = furthest_block;
@@ -3236,10 +3417,7 @@ namespace wordring::whatwg::html::parsing
 				// 14.4.
 				if (node == formatting_element) goto NextStep;
 				// 14.5.
-				if (3 < inner_loop_counter && find_from_list(node) != m_list.end())
-				{
-					remove_from_list(node);
-				}
+				if (3 < inner_loop_counter) remove_from_list(node, bookmark);
 				// 14.6.
 				if (find_from_list(node) == m_list.end())
 				{
@@ -3253,12 +3431,12 @@ namespace wordring::whatwg::html::parsing
 				{
 					auto it1 = find(node);
 					auto it2 = find_from_list(node);
-					node = create_element_for_token(it1->m_token, ns_name::HTML, common_ancestor);
+					node = create_element_for_token(it2->m_token, ns_name::HTML, common_ancestor);
 					it1->m_it = node;
 					it2->m_it = node;
 				}
 				// 14.8.
-				if (last_node == furthest_block) bookmark = ++find_from_list(node);
+				if (last_node == furthest_block) bookmark = std::distance(m_list.begin(), find_from_list(node)) + 1;
 				// 14.9.
 				P->move_node(traits::end(node), last_node);
 				// 14.10.
@@ -3270,7 +3448,7 @@ namespace wordring::whatwg::html::parsing
 				P->insert_element(appropriate_place_for_inserting_node(common_ancestor), last_node);
 				// 16.
 				{
-					start_tag_token t = find(formatting_element)->m_token;
+					start_tag_token t = find_from_list(formatting_element)->m_token;
 					node_pointer el = create_element_for_token(t, ns_name::HTML, furthest_block);
 				// 17.
 					auto it1 = furthest_block.begin();
@@ -3283,11 +3461,12 @@ namespace wordring::whatwg::html::parsing
 				// 18.
 					P->insert_element(traits::end(furthest_block), el);
 				// 19.
-					remove_from_list(formatting_element);
-					m_list.insert(bookmark, { t, el, false });
+					std::size_t signature = find_from_list(formatting_element)->m_signature;
+					remove_from_list(formatting_element, bookmark);
+					insert_list(std::next(m_list.begin(), bookmark), { std::move(t), el, false, signature });
 				//20.
 					remove(formatting_element);
-					m_stack.insert(std::next(find(furthest_block)), { t, el });
+					m_stack.insert(std::next(find(furthest_block)), { el, false });
 				}
 				
 				// 21.
@@ -3316,7 +3495,7 @@ namespace wordring::whatwg::html::parsing
 				base_type::report_error();
 				node_pointer it = current_node().m_it;
 				if (is_html_element_of(it, tag_name::Script)) traits::set_already_started_flag(it, true);
-				m_stack.pop_back();
+				pop_open_element();
 				insertion_mode(m_original_insertion_mode);
 				reprocess_token(token);
 				return;
@@ -3326,7 +3505,7 @@ namespace wordring::whatwg::html::parsing
 			{
 				if (token.m_tag_name_id == tag_name::Script)
 				{
-					m_stack.pop_back();
+					pop_open_element();
 					insertion_mode(m_original_insertion_mode);
 					return;
 				}
@@ -3334,7 +3513,7 @@ namespace wordring::whatwg::html::parsing
 
 			if constexpr (std::is_same_v<end_tag_token, Token>)
 			{
-				m_stack.pop_back();
+				pop_open_element();
 				insertion_mode(m_original_insertion_mode);
 				return;
 			}
@@ -3503,13 +3682,13 @@ namespace wordring::whatwg::html::parsing
 			{
 				if (token.m_tag_name_id == tag_name::Input)
 				{
-					auto it = token.find(U"type");
+					auto it = token.find(attribute_name::Type);
 					std::u32string_view sv(U"hidden");
 					if (it == token.end()
 						|| !is_ascii_case_insensitive_match(it->m_value.begin(), it->m_value.end(), sv.begin(), sv.end())) goto AnythingElse;
 					base_type::report_error();
 					insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					if (token.m_self_closing_flag) token.m_acknowledged_self_closing_flag = true;
 					return;
 				}
@@ -3523,7 +3702,7 @@ namespace wordring::whatwg::html::parsing
 					if (contains(ns_name::HTML, tag_name::Template)
 						|| m_form_element_pointer != traits::pointer()) return;
 					m_form_element_pointer = insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					return;
 				}
 			}
@@ -3556,7 +3735,7 @@ namespace wordring::whatwg::html::parsing
 				case tag_name::Table: case tag_name::Template: case tag_name::Html:
 					return;
 				default:
-					m_stack.pop_back();
+					pop_open_element();
 				}
 			}
 		}
@@ -3734,7 +3913,7 @@ namespace wordring::whatwg::html::parsing
 				if (token.m_tag_name_id == tag_name::Col)
 				{
 					insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					if (token.m_self_closing_flag) token.m_acknowledged_self_closing_flag = true;
 					return;
 				}
@@ -3749,7 +3928,7 @@ namespace wordring::whatwg::html::parsing
 						base_type::report_error();
 						return;
 					}
-					m_stack.pop_back();
+					pop_open_element();
 					insertion_mode(mode_name::in_table_insertion_mode);
 					return;
 				}
@@ -3783,7 +3962,7 @@ namespace wordring::whatwg::html::parsing
 				base_type::report_error();
 				return;
 			}
-			m_stack.pop_back();
+			pop_open_element();
 			insertion_mode(mode_name::in_table_insertion_mode);
 			reprocess_token(token);
 		}
@@ -3835,7 +4014,7 @@ namespace wordring::whatwg::html::parsing
 						return;
 					}
 					clear_stack_back_to_table_body_context();
-					m_stack.pop_back();
+					pop_open_element();
 					insertion_mode(mode_name::in_table_insertion_mode);
 					return;
 				default:
@@ -3867,7 +4046,7 @@ namespace wordring::whatwg::html::parsing
 					return;
 				}
 				clear_stack_back_to_table_body_context();
-				m_stack.pop_back();
+				pop_open_element();
 				insertion_mode(mode_name::in_table_insertion_mode);
 				reprocess_token(token);
 				return;
@@ -3901,7 +4080,7 @@ namespace wordring::whatwg::html::parsing
 				default:
 					break;
 				}
-				m_stack.pop_back();
+				pop_open_element();
 			}
 		}
 
@@ -3939,7 +4118,7 @@ namespace wordring::whatwg::html::parsing
 					}
 					clear_stack_back_to_table_row_context();
 					assert(is_html_element_of(current_node().m_it, tag_name::Tr));
-					m_stack.pop_back();
+					pop_open_element();
 					insertion_mode(mode_name::in_table_body_insertion_mode);
 					return;
 				}
@@ -3970,7 +4149,7 @@ namespace wordring::whatwg::html::parsing
 				}
 				clear_stack_back_to_table_row_context();
 				assert(is_html_element_of(current_node().m_it, tag_name::Tr));
-				m_stack.pop_back();
+				pop_open_element();
 				insertion_mode(mode_name::in_table_body_insertion_mode);
 				reprocess_token(token);
 				return;
@@ -3990,7 +4169,7 @@ namespace wordring::whatwg::html::parsing
 					if (!in_specific_scope(table_scope, tag_name::Tr)) base_type::report_error();
 					clear_stack_back_to_table_row_context();
 					assert(is_html_element_of(current_node().m_it, tag_name::Tr));
-					m_stack.pop_back();
+					pop_open_element();
 					insertion_mode(mode_name::in_table_body_insertion_mode);
 					reprocess_token(token);
 					return;
@@ -4022,7 +4201,7 @@ namespace wordring::whatwg::html::parsing
 				 || is_html_element_of(it, tag_name::Table)
 				 || is_html_element_of(it, tag_name::Html)) return;
 
-				m_stack.pop_back();
+				pop_open_element();
 			}
 		}
 
@@ -4166,7 +4345,7 @@ namespace wordring::whatwg::html::parsing
 			{
 				if (token.m_tag_name_id == tag_name::Option)
 				{
-					if (is_html_element_of(current_node().m_it, tag_name::Option)) m_stack.pop_back();
+					if (is_html_element_of(current_node().m_it, tag_name::Option)) pop_open_element();
 					insert_html_element(token);
 					return;
 				}
@@ -4176,8 +4355,8 @@ namespace wordring::whatwg::html::parsing
 			{
 				if (token.m_tag_name_id == tag_name::Optgroup)
 				{
-					if (is_html_element_of(current_node().m_it, tag_name::Option)) m_stack.pop_back();
-					if (is_html_element_of(current_node().m_it, tag_name::Optgroup)) m_stack.pop_back();
+					if (is_html_element_of(current_node().m_it, tag_name::Option)) pop_open_element();
+					if (is_html_element_of(current_node().m_it, tag_name::Optgroup)) pop_open_element();
 					insert_html_element(token);
 					return;
 				}
@@ -4188,8 +4367,8 @@ namespace wordring::whatwg::html::parsing
 				if (token.m_tag_name_id == tag_name::Optgroup)
 				{
 					if (is_html_element_of(current_node().m_it, tag_name::Option)
-					 && is_html_element_of(std::prev(m_stack.end(), 2)->m_it, tag_name::Optgroup)) m_stack.pop_back();
-					if (is_html_element_of(current_node().m_it, tag_name::Optgroup)) m_stack.pop_back();
+					 && is_html_element_of(std::prev(m_stack.end(), 2)->m_it, tag_name::Optgroup)) pop_open_element();
+					if (is_html_element_of(current_node().m_it, tag_name::Optgroup)) pop_open_element();
 					else base_type::report_error();
 					return;
 				}
@@ -4199,7 +4378,7 @@ namespace wordring::whatwg::html::parsing
 			{
 				if (token.m_tag_name_id == tag_name::Option)
 				{
-					if (is_html_element_of(current_node().m_it, tag_name::Option)) m_stack.pop_back();
+					if (is_html_element_of(current_node().m_it, tag_name::Option)) pop_open_element();
 					else base_type::report_error();
 					return;
 				}
@@ -4569,7 +4748,7 @@ namespace wordring::whatwg::html::parsing
 						base_type::report_error();
 						return;
 					}
-					m_stack.pop_back();
+					pop_open_element();
 					if (!m_fragments_parser && !is_html_element_of(current_node().m_it, tag_name::Frameset))
 					{
 						insertion_mode(mode_name::after_frameset_insertion_mode);
@@ -4583,7 +4762,7 @@ namespace wordring::whatwg::html::parsing
 				if (token.m_tag_name_id == tag_name::Frame)
 				{
 					insert_html_element(token);
-					m_stack.pop_back();
+					pop_open_element();
 					if (token.m_self_closing_flag) token.m_acknowledged_self_closing_flag = true;
 					return;
 				}
@@ -4849,22 +5028,21 @@ namespace wordring::whatwg::html::parsing
 				}
 				if (!f && token.m_tag_name_id == tag_name::Font)
 				{
-					if (token.find(U"Color") != token.end()
-					 || token.find(U"Face") != token.end()
-					 || token.find(U"Size") != token.end()) f = true;
+					if (token.find(attribute_name::Color) != token.end()
+					 || token.find(U"face") != token.end()
+					 || token.find(attribute_name::Size) != token.end()) f = true;
 				}
 			}
 			if (f)
 			{
 				base_type::report_error();
 				if(m_fragments_parser) goto AnyOtherStartTag;
-				m_stack.pop_back();
 				while (true)
 				{
-					m_stack.pop_back();
 					if (is_mathml_text_integration_point(current_node())
 					 || is_html_integration_point(current_node())
 					 || traits::get_namespace_name(current_node().m_it) == ns_name::HTML) break;
+					pop_open_element();
 				}
 				reprocess_token(token);
 				return;
@@ -4892,12 +5070,12 @@ namespace wordring::whatwg::html::parsing
 					 && is_element_of(current_node().m_it, ns_name::SVG, tag_name::Script))
 					{
 						token.m_acknowledged_self_closing_flag = true;
-						m_stack.pop_back();
+						pop_open_element();
 						return;
 					}
 					else
 					{
-						m_stack.pop_back();
+						pop_open_element();
 						token.m_acknowledged_self_closing_flag = true;
 						return;
 					}
@@ -4910,7 +5088,7 @@ namespace wordring::whatwg::html::parsing
 				if (token.m_tag_name_id == tag_name::Script
 				 && is_element_of(current_node().m_it, ns_name::SVG, tag_name::Script))
 				{
-					m_stack.pop_back();
+					pop_open_element();
 					return;
 				}
 			}
@@ -5033,7 +5211,7 @@ namespace wordring::whatwg::html::parsing
 		void stop_parsing()
 		{
 			traits::set_document_ready_state(encoding_cast<string_type>(U"interactive"));
-			m_stack.clear();
+			while (!m_stack.empty()) pop_open_element();
 			traits::set_document_ready_state(encoding_cast<string_type>(U"complete"));
 		}
 
@@ -12,7 +12,7 @@
 #include <wordring/wwwc/css_defs.hpp>
 
 #include <wordring/html/html_defs.hpp>
-#include <wordring/tree/tree_iterator.hpp>
+#include <wordring/tree/tree_cursor.hpp>
 
 #include <algorithm>
 #include <string>
@@ -158,7 +158,7 @@ namespace wordring::wwwc::css
 
 		while (first != last)
 		{
-			wordring::tree_iterator<NodePointer> it1(first), it2;
+			wordring::pre_order_cursor<NodePointer> it1(first), it2;
 			while (it1 != it2)
 			{
 				bool is_descendants = true;
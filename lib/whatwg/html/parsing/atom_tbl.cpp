@@ -4756,6 +4756,1494 @@ std::array<std::array<char32_t, 2>, 2231> const wordring::whatwg::html::parsing:
 	{ 0x0200C, 0 }, 
 }};
 
+std::array<std::uint16_t, 9855> const wordring::whatwg::html::parsing::named_character_reference_dfa_base_tbl = {{
+	0, 52, 68, 76, 90, 101, 117, 122, 134, 142, 156, 161, 168, 179, 187, 196, 210, 219, 223, 235, 
+	248, 259, 273, 282, 287, 291, 300, 308, 324, 340, 355, 374, 392, 404, 421, 431, 446, 452, 460, 483, 
+	497, 521, 539, 551, 557, 578, 597, 610, 628, 643, 650, 664, 672, 682, 683, 684, 685, 686, 688, 689, 
+	690, 691, 692, 693, 695, 696, 697, 699, 700, 701, 703, 704, 707, 708, 709, 710, 711, 712, 713, 714, 
+	717, 721, 722, 724, 725, 726, 727, 728, 732, 733, 734, 735, 737, 738, 739, 740, 743, 745, 746, 747, 
+	749, 753, 755, 756, 757, 758, 761, 762, 763, 764, 765, 767, 769, 770, 771, 773, 774, 775, 777, 778, 
+	779, 780, 783, 784, 785, 786, 787, 788, 791, 792, 793, 794, 795, 796, 797, 798, 799, 801, 802, 803, 
+	804, 806, 808, 809, 810, 811, 812, 813, 815, 816, 817, 818, 821, 823, 826, 827, 828, 830, 832, 833, 
+	834, 836, 837, 838, 839, 840, 842, 843, 844, 845, 846, 847, 852, 855, 857, 858, 860, 861, 864, 867, 
+	868, 869, 870, 872, 873, 874, 875, 876, 877, 878, 879, 882, 885, 886, 890, 891, 892, 893, 894, 895, 
+	897, 898, 899, 900, 903, 904, 905, 906, 908, 909, 910, 911, 912, 913, 914, 915, 916, 917, 919, 923, 
+	925, 926, 927, 928, 929, 930, 931, 934, 937, 939, 940, 941, 942, 944, 945, 947, 948, 950, 951, 952, 
+	957, 958, 959, 960, 961, 962, 964, 965, 966, 970, 971, 972, 974, 976, 979, 980, 982, 983, 984, 985, 
+	987, 989, 990, 992, 993, 994, 995, 996, 998, 1000, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1018, 
+	1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1037, 1038, 1039, 
+	1040, 1041, 1042, 1043, 1045, 1046, 1048, 1049, 1050, 1051, 1052, 1053, 1059, 1060, 1062, 1063, 1065, 1067, 1069, 1071, 
+	1078, 1079, 1082, 1083, 1084, 1086, 1087, 1089, 1090, 1092, 1093, 1098, 1099, 1100, 1101, 1104, 1106, 1110, 1111, 1113, 
+	1117, 1119, 1122, 1126, 1127, 1130, 1131, 1134, 1135, 1136, 1140, 1142, 1144, 1145, 1152, 1154, 1155, 1156, 1157, 1161, 
+	1163, 1165, 1168, 1171, 1173, 1174, 1179, 1180, 1181, 1186, 1188, 1191, 1193, 1195, 1196, 1198, 1200, 1202, 1206, 1207, 
+	1208, 1210, 1213, 1217, 1220, 1222, 1224, 1227, 1231, 1233, 1236, 1238, 1240, 1243, 1244, 1245, 1246, 1249, 1250, 1251, 
+	1254, 1255, 1257, 1258, 1260, 1261, 1263, 1266, 1267, 1269, 1270, 1274, 1275, 1277, 1278, 1279, 1283, 1287, 1288, 1289, 
+	1291, 1297, 1299, 1300, 1304, 1305, 1306, 1309, 1310, 1311, 1316, 1319, 1321, 1322, 1325, 1327, 1329, 1330, 1334, 1335, 
+	1338, 1343, 1347, 1348, 1349, 1351, 1353, 1355, 1357, 1358, 1359, 1360, 1362, 1363, 1364, 1366, 1367, 1368, 1369, 1370, 
+	1371, 1372, 1375, 1376, 1378, 1379, 1388, 1391, 1395, 1399, 1404, 1407, 1409, 1411, 1412, 1417, 1419, 1423, 1431, 1432, 
+	1437, 1443, 1451, 1452, 1454, 1455, 1459, 1461, 1462, 1463, 1464, 1465, 1468, 1470, 1471, 1473, 1474, 1476, 1479, 1481, 
+	1484, 1485, 1487, 1492, 1494, 1499, 1500, 1507, 1508, 1512, 1515, 1518, 1519, 1526, 1527, 1529, 1532, 1536, 1543, 1547, 
+	1549, 1558, 1561, 1562, 1564, 1566, 1571, 1572, 1574, 1577, 1579, 1580, 1584, 1587, 1588, 1591, 1598, 1601, 1602, 1603, 
+	1604, 1605, 1606, 1607, 1608, 1611, 1614, 1616, 1617, 1620, 1630, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1641, 1644, 
+	1645, 1646, 1653, 1656, 1660, 1664, 1667, 1670, 1672, 1675, 1678, 1679, 1680, 1684, 1686, 1687, 1691, 1694, 1695, 1696, 
+	1697, 1698, 1708, 1709, 1716, 1717, 1721, 1723, 1724, 1728, 1731, 1732, 1735, 1736, 1740, 1742, 1747, 1750, 1751, 1753, 
+	1754, 1757, 1758, 1759, 1760, 1764, 1767, 1770, 1771, 1774, 1777, 1779, 1780, 1781, 1783, 1784, 1786, 1789, 1791, 1792, 
+	1794, 1796, 1798, 1800, 1806, 1809, 1810, 1813, 1815, 1816, 1817, 1818, 1819, 1821, 1822, 1823, 1826, 1827, 1828, 1829, 
+	1830, 1831, 1832, 1834, 1835, 1836, 1838, 1839, 1840, 1841, 1843, 1844, 1847, 1848, 1849, 1851, 1852, 1854, 1855, 1856, 
+	1859, 1861, 1863, 1865, 1866, 1867, 1868, 1870, 1871, 1872, 1873, 1874, 1875, 1877, 1878, 1880, 1881, 1883, 1884, 1885, 
+	1886, 1887, 1888, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 
+	1907, 1908, 1909, 1910, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1926, 1927, 1928, 
+	1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1939, 1940, 1943, 1945, 1946, 1947, 1948, 1950, 1950, 1951, 1952, 
+	1953, 1954, 1955, 1956, 1957, 1958, 1959, 1961, 1962, 1964, 1965, 1966, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 
+	1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 
+	1998, 1999, 2000, 2001, 2002, 2003, 2004, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2011, 2012, 2013, 2014, 2014, 
+	2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 
+	2034, 2036, 2037, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 
+	2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 
+	2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2090, 2091, 
+	2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2115, 2116, 2117, 2117, 2118, 2119, 2120, 2121, 2122, 
+	2123, 2124, 2125, 2126, 2127, 2128, 2129, 2129, 2130, 2131, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2139, 2140, 2141, 
+	2142, 2142, 2143, 2144, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2160, 
+	2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173, 2174, 2174, 2175, 2176, 2177, 2178, 2179, 
+	2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2189, 2191, 2192, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 
+	2204, 2205, 2207, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 
+	2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2248, 
+	2249, 2250, 2251, 2252, 2253, 2254, 2255, 2256, 2257, 2258, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 
+	2268, 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2282, 2283, 2284, 2285, 2286, 
+	2287, 2288, 2288, 2289, 2290, 2292, 2293, 2295, 2296, 2301, 2308, 2309, 2310, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 
+	2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2339, 
+	2340, 2347, 2348, 2350, 2352, 2353, 2355, 2356, 2357, 2359, 2360, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 
+	2381, 2382, 2388, 2390, 2392, 2393, 2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403, 2410, 2411, 2412, 2414, 
+	2416, 2419, 2420, 2421, 2422, 2424, 2425, 2426, 2428, 2429, 2435, 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 
+	2448, 2449, 2450, 2451, 2452, 2453, 2454, 2454, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 
+	2470, 2471, 2473, 2474, 2475, 2480, 2481, 2482, 2483, 2485, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 
+	2497, 2498, 2499, 2500, 2501, 2502, 2503, 2504, 2505, 2505, 2506, 2507, 2507, 2508, 2510, 2510, 2511, 2512, 2514, 2515, 
+	2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2526, 2528, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 
+	2540, 2541, 2542, 2543, 2545, 2546, 2547, 2548, 2549, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2561, 2562, 
+	2564, 2565, 2566, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2574, 2575, 2578, 2582, 2583, 2583, 2584, 2585, 
+	2586, 2586, 2587, 2588, 2589, 2590, 2591, 2593, 2594, 2595, 2596, 2597, 2598, 2598, 2600, 2601, 2602, 2603, 2608, 2609, 
+	2610, 2611, 2612, 2613, 2614, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 
+	2632, 2633, 2634, 2635, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2642, 2644, 2645, 2646, 2647, 2650, 2651, 2652, 
+	2652, 2653, 2654, 2655, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 
+	2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2692, 2693, 
+	2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2705, 2706, 2707, 2709, 2710, 2712, 2713, 2714, 2715, 2716, 2718, 
+	2719, 2719, 2720, 2721, 2724, 2729, 2730, 2731, 2732, 2732, 2733, 2734, 2735, 2736, 2736, 2737, 2738, 2739, 2740, 2741, 
+	2742, 2743, 2744, 2746, 2747, 2749, 2750, 2751, 2752, 2755, 2756, 2758, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 
+	2769, 2770, 2771, 2773, 2774, 2774, 2776, 2777, 2778, 2779, 2780, 2781, 2783, 2785, 2786, 2787, 2788, 2789, 2791, 2793, 
+	2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2805, 2806, 2807, 2808, 2809, 2810, 2811, 2811, 2812, 2813, 2813, 2814, 
+	2815, 2816, 2818, 2819, 2820, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2833, 2834, 2835, 2836, 2838, 2839, 2840, 2841, 
+	2842, 2843, 2843, 2844, 2845, 2846, 2847, 2849, 2850, 2851, 2852, 2855, 2856, 2858, 2859, 2860, 2861, 2861, 2863, 2864, 
+	2865, 2866, 2867, 2868, 2869, 2873, 2874, 2876, 2877, 2878, 2881, 2882, 2883, 2886, 2887, 2888, 2889, 2890, 2894, 2895, 
+	2896, 2897, 2898, 2899, 2902, 2903, 2904, 2905, 2906, 2906, 2909, 2910, 2911, 2912, 2913, 2915, 2916, 2919, 2921, 2922, 
+	2923, 2924, 2925, 2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 
+	2942, 2943, 2944, 2946, 2947, 2948, 2949, 2950, 2953, 2954, 2955, 2956, 2957, 2957, 2958, 2962, 2963, 2964, 2965, 2966, 
+	2967, 2968, 2969, 2971, 2972, 2973, 2977, 2978, 2983, 2984, 2986, 2987, 2988, 2988, 2989, 2990, 2991, 2992, 2992, 2993, 
+	2994, 2995, 2995, 2996, 2997, 2998, 3000, 3001, 3004, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017, 
+	3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3027, 3028, 3029, 3030, 3031, 3032, 3034, 3035, 3036, 3038, 3039, 3041, 
+	3042, 3043, 3044, 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 
+	3063, 3064, 3066, 3067, 3070, 3071, 3072, 3073, 3074, 3075, 3076, 3077, 3079, 3080, 3081, 3082, 3083, 3083, 3084, 3085, 
+	3085, 3086, 3088, 3089, 3091, 3092, 3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3108, 3109, 
+	3111, 3112, 3113, 3114, 3122, 3123, 3125, 3126, 3128, 3130, 3131, 3133, 3134, 3136, 3138, 3139, 3142, 3143, 3144, 3145, 
+	3146, 3147, 3148, 3150, 3159, 3160, 3161, 3162, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184, 3185, 3186, 
+	3187, 3188, 3190, 3192, 3194, 3195, 3196, 3197, 3198, 3199, 3203, 3204, 3205, 3206, 3213, 3214, 3216, 3217, 3218, 3219, 
+	3220, 3221, 3222, 3223, 3224, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 3238, 3239, 3240, 3241, 
+	3242, 3243, 3244, 3245, 3246, 3247, 3248, 3249, 3251, 3252, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 
+	3263, 3264, 3271, 3272, 3273, 3276, 3277, 3279, 3280, 3281, 3282, 3283, 3284, 3285, 3286, 3288, 3289, 3290, 3292, 3293, 
+	3294, 3295, 3295, 3295, 3296, 3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304, 3304, 3305, 3306, 3307, 3308, 3309, 3311, 
+	3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3322, 3323, 3324, 3325, 3326, 3327, 3328, 3329, 3330, 3331, 3332, 
+	3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345, 3345, 3346, 3347, 3348, 3348, 3348, 3349, 
+	3350, 3351, 3351, 3352, 3353, 3354, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3362, 3363, 3364, 3365, 3365, 3366, 
+	3367, 3368, 3369, 3370, 3371, 3372, 3372, 3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3381, 3381, 3382, 3383, 
+	3384, 3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3393, 3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 
+	3402, 3402, 3403, 3403, 3404, 3405, 3406, 3407, 3407, 3408, 3409, 3410, 3416, 3417, 3418, 3418, 3418, 3419, 3420, 3421, 
+	3421, 3422, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3433, 3434, 3435, 3436, 3436, 3436, 
+	3437, 3438, 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3446, 3447, 3447, 3448, 3449, 3450, 3451, 3452, 3452, 3453, 
+	3453, 3454, 3455, 3456, 3457, 3458, 3460, 3461, 3462, 3463, 3464, 3465, 3465, 3466, 3466, 3467, 3468, 3469, 3470, 3470, 
+	3472, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3480, 3481, 3481, 3481, 3482, 3483, 3484, 3485, 3486, 3487, 3488, 3489, 
+	3489, 3489, 3490, 3491, 3492, 3493, 3494, 3495, 3496, 3497, 3498, 3499, 3499, 3509, 3515, 3515, 3516, 3517, 3521, 3522, 
+	3523, 3524, 3524, 3525, 3525, 3525, 3526, 3527, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 3534, 3534, 3535, 3536, 3537, 
+	3537, 3538, 3539, 3540, 3540, 3542, 3543, 3546, 3547, 3548, 3549, 3550, 3551, 3553, 3555, 3556, 3557, 3558, 3559, 3560, 
+	3561, 3562, 3562, 3563, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3576, 3577, 3577, 3577, 
+	3577, 3578, 3579, 3580, 3581, 3582, 3583, 3584, 3585, 3585, 3586, 3586, 3587, 3588, 3589, 3589, 3590, 3591, 3593, 3594, 
+	3595, 3595, 3596, 3596, 3596, 3597, 3598, 3599, 3600, 3601, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3609, 
+	3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 3617, 3617, 3618, 3619, 3620, 3620, 3620, 3621, 3622, 3623, 3624, 3625, 
+	3626, 3626, 3626, 3627, 3628, 3628, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3640, 3641, 3642, 
+	3643, 3643, 3644, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3659, 3660, 3661, 
+	3662, 3663, 3664, 3665, 3665, 3666, 3666, 3667, 3669, 3670, 3670, 3671, 3672, 3673, 3674, 3675, 3675, 3676, 3677, 3677, 
+	3678, 3679, 3680, 3681, 3682, 3683, 3684, 3684, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3690, 3691, 3692, 3693, 3693, 
+	3694, 3695, 3696, 3697, 3697, 3697, 3698, 3699, 3699, 3700, 3700, 3701, 3702, 3703, 3704, 3705, 3706, 3706, 3706, 3707, 
+	3708, 3709, 3710, 3710, 3711, 3712, 3713, 3714, 3716, 3717, 3718, 3719, 3719, 3720, 3720, 3721, 3722, 3723, 3724, 3725, 
+	3725, 3726, 3727, 3728, 3729, 3730, 3731, 3735, 3736, 3737, 3739, 3740, 3740, 3741, 3742, 3743, 3744, 3745, 3746, 3747, 
+	3748, 3748, 3751, 3754, 3756, 3757, 3758, 3759, 3760, 3761, 3762, 3763, 3765, 3766, 3767, 3767, 3768, 3769, 3770, 3770, 
+	3771, 3772, 3776, 3781, 3785, 3792, 3793, 3797, 3802, 3803, 3804, 3805, 3809, 3816, 3817, 3818, 3819, 3820, 3821, 3823, 
+	3826, 3828, 3831, 3832, 3832, 3833, 3834, 3836, 3837, 3838, 3839, 3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847, 3848, 
+	3850, 3850, 3851, 3852, 3852, 3852, 3853, 3856, 3857, 3858, 3859, 3860, 3861, 3862, 3863, 3866, 3868, 3869, 3870, 3871, 
+	3873, 3874, 3875, 3876, 3878, 3880, 3881, 3882, 3883, 3884, 3885, 3885, 3886, 3888, 3889, 3890, 3891, 3892, 3893, 3894, 
+	3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 3907, 3908, 3909, 3910, 3910, 3911, 3912, 3913, 3913, 
+	3914, 3915, 3916, 3916, 3918, 3921, 3921, 3922, 3923, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3930, 3931, 3932, 
+	3933, 3934, 3935, 3938, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3948, 3949, 3950, 3951, 3952, 3953, 3954, 3955, 
+	3956, 3957, 3958, 3960, 3961, 3961, 3962, 3963, 3963, 3964, 3964, 3965, 3966, 3966, 3966, 3967, 3968, 3969, 3971, 3971, 
+	3972, 3973, 3974, 3976, 3977, 3980, 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 3991, 3992, 3993, 3993, 
+	3993, 3994, 3995, 3996, 3997, 3998, 3999, 4000, 4000, 4001, 4002, 4003, 4004, 4004, 4005, 4006, 4007, 4008, 4009, 4010, 
+	4011, 4012, 4014, 4015, 4021, 4022, 4023, 4024, 4024, 4025, 4026, 4026, 4027, 4028, 4028, 4029, 4029, 4029, 4030, 4031, 
+	4031, 4032, 4033, 4035, 4035, 4035, 4036, 4037, 4037, 4037, 4037, 4037, 4039, 4039, 4041, 4042, 4043, 4044, 4045, 4048, 
+	4049, 4050, 4051, 4052, 4053, 4055, 4056, 4057, 4058, 4059, 4060, 4061, 4062, 4063, 4064, 4065, 4066, 4069, 4070, 4071, 
+	4072, 4073, 4074, 4074, 4075, 4076, 4077, 4078, 4080, 4081, 4082, 4083, 4084, 4085, 4086, 4087, 4088, 4089, 4089, 4090, 
+	4091, 4091, 4091, 4092, 4093, 4094, 4095, 4096, 4097, 4098, 4101, 4102, 4103, 4104, 4105, 4106, 4107, 4107, 4108, 4110, 
+	4111, 4112, 4113, 4114, 4115, 4116, 4117, 4118, 4119, 4124, 4125, 4126, 4127, 4128, 4128, 4128, 4129, 4130, 4131, 4132, 
+	4133, 4134, 4135, 4135, 4135, 4136, 4137, 4138, 4139, 4140, 4141, 4142, 4143, 4144, 4144, 4145, 4146, 4147, 4148, 4149, 
+	4152, 4152, 4153, 4161, 4161, 4162, 4164, 4165, 4166, 4167, 4169, 4170, 4171, 4172, 4173, 4173, 4174, 4175, 4176, 4177, 
+	4178, 4183, 4183, 4183, 4184, 4185, 4185, 4186, 4187, 4189, 4194, 4195, 4196, 4196, 4196, 4198, 4199, 4200, 4201, 4202, 
+	4203, 4204, 4205, 4206, 4206, 4208, 4208, 4210, 4211, 4212, 4213, 4214, 4217, 4218, 4219, 4220, 4221, 4222, 4223, 4224, 
+	4224, 4225, 4226, 4228, 4229, 4230, 4231, 4231, 4232, 4233, 4234, 4234, 4237, 4238, 4239, 4240, 4241, 4242, 4243, 4244, 
+	4245, 4246, 4247, 4248, 4251, 4252, 4253, 4254, 4255, 4256, 4257, 4258, 4260, 4260, 4261, 4262, 4263, 4263, 4264, 4265, 
+	4265, 4265, 4266, 4266, 4267, 4268, 4269, 4270, 4271, 4272, 4273, 4274, 4275, 4276, 4277, 4278, 4279, 4279, 4279, 4280, 
+	4281, 4281, 4281, 4282, 4283, 4284, 4285, 4286, 4287, 4288, 4288, 4289, 4290, 4291, 4292, 4293, 4294, 4295, 4296, 4297, 
+	4298, 4299, 4300, 4300, 4301, 4302, 4304, 4305, 4306, 4307, 4308, 4309, 4309, 4309, 4309, 4312, 4313, 4314, 4314, 4315, 
+	4316, 4317, 4318, 4318, 4319, 4319, 4320, 4321, 4321, 4322, 4323, 4323, 4324, 4327, 4329, 4330, 4330, 4331, 4332, 4333, 
+	4333, 4334, 4335, 4339, 4340, 4340, 4341, 4343, 4344, 4345, 4346, 4347, 4347, 4348, 4349, 4350, 4351, 4353, 4354, 4355, 
+	4356, 4360, 4361, 4365, 4366, 4367, 4368, 4369, 4369, 4370, 4371, 4372, 4373, 4374, 4375, 4376, 4377, 4378, 4379, 4380, 
+	4382, 4383, 4384, 4385, 4386, 4388, 4389, 4390, 4391, 4393, 4393, 4394, 4395, 4396, 4397, 4398, 4399, 4400, 4400, 4401, 
+	4402, 4402, 4403, 4403, 4404, 4405, 4406, 4407, 4408, 4408, 4409, 4410, 4411, 4412, 4413, 4414, 4415, 4416, 4417, 4418, 
+	4418, 4419, 4420, 4421, 4422, 4423, 4424, 4424, 4425, 4426, 4427, 4428, 4429, 4430, 4431, 4431, 4433, 4435, 4436, 4436, 
+	4437, 4438, 4439, 4440, 4441, 4441, 4441, 4442, 4443, 4444, 4445, 4445, 4447, 4456, 4457, 4458, 4459, 4459, 4460, 4461, 
+	4461, 4467, 4468, 4469, 4470, 4471, 4472, 4475, 4477, 4478, 4479, 4480, 4480, 4481, 4481, 4482, 4483, 4484, 4485, 4487, 
+	4488, 4489, 4490, 4491, 4492, 4493, 4494, 4495, 4496, 4497, 4498, 4502, 4503, 4514, 4515, 4516, 4517, 4518, 4519, 4521, 
+	4522, 4523, 4524, 4525, 4525, 4526, 4527, 4528, 4529, 4533, 4534, 4534, 4535, 4536, 4536, 4538, 4538, 4539, 4540, 4541, 
+	4542, 4543, 4544, 4544, 4545, 4546, 4547, 4548, 4549, 4550, 4551, 4552, 4553, 4555, 4556, 4557, 4558, 4559, 4559, 4560, 
+	4561, 4562, 4563, 4567, 4568, 4569, 4570, 4570, 4571, 4572, 4573, 4573, 4574, 4575, 4576, 4577, 4578, 4579, 4580, 4580, 
+	4583, 4584, 4586, 4587, 4588, 4589, 4591, 4592, 4592, 4593, 4594, 4595, 4596, 4597, 4597, 4598, 4598, 4599, 4601, 4603, 
+	4605, 4606, 4607, 4608, 4609, 4610, 4611, 4612, 4613, 4614, 4614, 4616, 4617, 4617, 4619, 4620, 4621, 4622, 4623, 4624, 
+	4626, 4626, 4627, 4628, 4629, 4630, 4631, 4632, 4633, 4635, 4636, 4637, 4637, 4638, 4639, 4641, 4642, 4644, 4645, 4646, 
+	4649, 4655, 4655, 4656, 4657, 4658, 4659, 4659, 4660, 4662, 4664, 4665, 4666, 4667, 4669, 4670, 4673, 4674, 4676, 4677, 
+	4678, 4679, 4679, 4680, 4681, 4682, 4682, 4683, 4684, 4684, 4685, 4686, 4687, 4688, 4689, 4690, 4691, 4692, 4693, 4694, 
+	4695, 4695, 4696, 4697, 4699, 4700, 4701, 4702, 4703, 4704, 4705, 4706, 4707, 4708, 4709, 4710, 4711, 4712, 4713, 4714, 
+	4715, 4716, 4717, 4718, 4719, 4720, 4721, 4722, 4723, 4723, 4724, 4725, 4726, 4727, 4727, 4728, 4730, 4731, 4732, 4733, 
+	4734, 4735, 4735, 4736, 4737, 4738, 4739, 4740, 4741, 4744, 4745, 4746, 4747, 4748, 4749, 4750, 4751, 4752, 4754, 4755, 
+	4756, 4757, 4758, 4760, 4761, 4762, 4763, 4764, 4765, 4768, 4770, 4772, 4774, 4774, 4775, 4775, 4776, 4777, 4778, 4779, 
+	4780, 4780, 4781, 4783, 4784, 4785, 4786, 4787, 4788, 4789, 4790, 4791, 4792, 4793, 4794, 4794, 4795, 4796, 4797, 4798, 
+	4799, 4800, 4801, 4801, 4802, 4803, 4804, 4805, 4806, 4807, 4808, 4809, 4810, 4811, 4812, 4813, 4814, 4815, 4816, 4817, 
+	4818, 4819, 4820, 4821, 4822, 4822, 4822, 4822, 4823, 4824, 4825, 4826, 4827, 4828, 4829, 4829, 4830, 4831, 4832, 4832, 
+	4833, 4834, 4835, 4836, 4836, 4837, 4838, 4839, 4840, 4841, 4842, 4843, 4844, 4845, 4845, 4846, 4847, 4847, 4848, 4849, 
+	4849, 4850, 4850, 4851, 4852, 4853, 4853, 4853, 4854, 4854, 4855, 4855, 4855, 4856, 4857, 4858, 4859, 4860, 4861, 4862, 
+	4862, 4863, 4864, 4865, 4866, 4867, 4869, 4870, 4871, 4872, 4872, 4873, 4874, 4875, 4875, 4876, 4877, 4877, 4877, 4877, 
+	4878, 4878, 4879, 4880, 4881, 4882, 4883, 4884, 4884, 4885, 4886, 4887, 4888, 4889, 4890, 4891, 4892, 4893, 4893, 4894, 
+	4895, 4896, 4897, 4897, 4898, 4899, 4900, 4902, 4903, 4903, 4904, 4906, 4907, 4907, 4907, 4907, 4908, 4909, 4910, 4910, 
+	4911, 4912, 4912, 4912, 4914, 4915, 4916, 4917, 4917, 4917, 4918, 4918, 4919, 4920, 4921, 4922, 4922, 4923, 4923, 4924, 
+	4925, 4926, 4926, 4927, 4927, 4928, 4929, 4929, 4930, 4931, 4932, 4933, 4934, 4935, 4936, 4937, 4937, 4937, 4937, 4938, 
+	4939, 4939, 4940, 4940, 4940, 4941, 4942, 4942, 4942, 4943, 4944, 4944, 4944, 4944, 4945, 4946, 4946, 4947, 4947, 4948, 
+	4949, 4951, 4952, 4953, 4954, 4955, 4957, 4958, 4959, 4960, 4961, 4962, 4963, 4964, 4965, 4966, 4967, 4968, 4969, 4970, 
+	4971, 4972, 4973, 4973, 4975, 4975, 4976, 4977, 4978, 4979, 4979, 4979, 4979, 4980, 4981, 4982, 4983, 4984, 4985, 4986, 
+	4987, 4987, 4988, 4989, 4990, 4991, 4992, 4993, 4994, 4995, 4997, 4998, 4999, 5000, 5001, 5002, 5005, 5006, 5007, 5007, 
+	5008, 5009, 5010, 5011, 5012, 5013, 5014, 5015, 5016, 5016, 5017, 5017, 5018, 5019, 5020, 5020, 5022, 5023, 5024, 5025, 
+	5026, 5026, 5027, 5028, 5029, 5030, 5030, 5030, 5030, 5030, 5031, 5032, 5032, 5032, 5033, 5034, 5035, 5036, 5044, 5044, 
+	5045, 5046, 5046, 5047, 5048, 5048, 5049, 5050, 5051, 5052, 5053, 5057, 5058, 5059, 5059, 5059, 5060, 5060, 5060, 5061, 
+	5062, 5063, 5064, 5065, 5066, 5067, 5068, 5068, 5069, 5070, 5071, 5072, 5073, 5074, 5078, 5078, 5079, 5079, 5080, 5081, 
+	5081, 5082, 5083, 5084, 5085, 5086, 5087, 5088, 5090, 5092, 5093, 5093, 5094, 5095, 5096, 5098, 5099, 5100, 5102, 5102, 
+	5103, 5104, 5104, 5105, 5105, 5106, 5106, 5108, 5109, 5109, 5110, 5111, 5111, 5111, 5112, 5113, 5114, 5114, 5114, 5114, 
+	5114, 5114, 5114, 5114, 5115, 5116, 5116, 5116, 5116, 5116, 5117, 5118, 5118, 5119, 5119, 5119, 5119, 5120, 5121, 5122, 
+	5123, 5124, 5125, 5126, 5127, 5128, 5129, 5130, 5131, 5131, 5132, 5132, 5132, 5133, 5134, 5136, 5137, 5138, 5139, 5140, 
+	5140, 5141, 5141, 5141, 5142, 5143, 5143, 5145, 5146, 5146, 5147, 5148, 5148, 5149, 5150, 5151, 5152, 5153, 5154, 5154, 
+	5155, 5156, 5157, 5158, 5159, 5160, 5161, 5161, 5161, 5162, 5163, 5164, 5165, 5166, 5167, 5168, 5169, 5170, 5171, 5172, 
+	5173, 5174, 5175, 5178, 5179, 5180, 5181, 5182, 5183, 5184, 5184, 5184, 5185, 5186, 5187, 5188, 5189, 5190, 5190, 5191, 
+	5192, 5193, 5194, 5195, 5196, 5197, 5198, 5198, 5199, 5200, 5201, 5202, 5203, 5204, 5205, 5206, 5207, 5208, 5209, 5209, 
+	5210, 5211, 5212, 5213, 5214, 5215, 5216, 5217, 5218, 5219, 5220, 5220, 5221, 5222, 5223, 5224, 5225, 5226, 5227, 5228, 
+	5229, 5229, 5230, 5230, 5231, 5231, 5232, 5233, 5233, 5234, 5234, 5235, 5237, 5238, 5239, 5240, 5241, 5242, 5243, 5243, 
+	5244, 5245, 5246, 5247, 5248, 5249, 5251, 5251, 5252, 5253, 5253, 5254, 5254, 5256, 5256, 5256, 5257, 5258, 5258, 5259, 
+	5260, 5261, 5263, 5265, 5267, 5267, 5268, 5269, 5269, 5270, 5271, 5271, 5272, 5272, 5273, 5274, 5275, 5275, 5275, 5276, 
+	5276, 5277, 5278, 5279, 5280, 5281, 5282, 5283, 5284, 5285, 5286, 5287, 5287, 5288, 5291, 5292, 5293, 5294, 5295, 5296, 
+	5297, 5298, 5298, 5298, 5299, 5300, 5300, 5300, 5301, 5302, 5303, 5304, 5305, 5306, 5307, 5308, 5309, 5310, 5311, 5312, 
+	5312, 5313, 5314, 5315, 5316, 5317, 5318, 5318, 5319, 5320, 5321, 5321, 5323, 5324, 5325, 5326, 5327, 5328, 5329, 5330, 
+	5331, 5332, 5333, 5333, 5333, 5333, 5334, 5335, 5335, 5336, 5337, 5338, 5339, 5339, 5340, 5341, 5341, 5342, 5343, 5344, 
+	5344, 5345, 5346, 5346, 5347, 5348, 5349, 5350, 5351, 5352, 5355, 5357, 5357, 5357, 5358, 5358, 5358, 5359, 5360, 5360, 
+	5361, 5362, 5363, 5364, 5365, 5366, 5367, 5368, 5370, 5371, 5372, 5373, 5373, 5374, 5374, 5374, 5374, 5374, 5375, 5376, 
+	5377, 5378, 5379, 5380, 5381, 5382, 5383, 5384, 5384, 5385, 5386, 5386, 5386, 5387, 5387, 5388, 5389, 5395, 5397, 5400, 
+	5401, 5403, 5404, 5405, 5406, 5406, 5407, 5409, 5410, 5411, 5411, 5411, 5412, 5413, 5414, 5414, 5415, 5416, 5416, 5416, 
+	5417, 5417, 5418, 5419, 5419, 5420, 5420, 5420, 5421, 5422, 5422, 5423, 5424, 5425, 5426, 5427, 5428, 5429, 5431, 5432, 
+	5433, 5434, 5434, 5434, 5435, 5435, 5436, 5437, 5437, 5438, 5439, 5439, 5440, 5441, 5442, 5443, 5444, 5445, 5446, 5447, 
+	5448, 5449, 5449, 5450, 5450, 5451, 5452, 5453, 5454, 5455, 5456, 5456, 5457, 5458, 5459, 5460, 5461, 5462, 5463, 5464, 
+	5465, 5466, 5467, 5468, 5468, 5469, 5470, 5472, 5473, 5474, 5475, 5476, 5477, 5478, 5478, 5479, 5479, 5479, 5480, 5481, 
+	5481, 5481, 5482, 5483, 5485, 5486, 5487, 5488, 5488, 5489, 5490, 5490, 5490, 5491, 5492, 5494, 5495, 5496, 5496, 5496, 
+	5496, 5496, 5497, 5497, 5498, 5499, 5499, 5500, 5501, 5502, 5503, 5503, 5504, 5505, 5506, 5506, 5508, 5509, 5510, 5511, 
+	5512, 5513, 5514, 5515, 5515, 5516, 5517, 5518, 5520, 5521, 5522, 5523, 5524, 5525, 5525, 5525, 5527, 5528, 5529, 5529, 
+	5530, 5531, 5532, 5533, 5534, 5534, 5535, 5536, 5537, 5537, 5538, 5539, 5540, 5541, 5542, 5543, 5544, 5545, 5546, 5548, 
+	5549, 5549, 5550, 5551, 5552, 5553, 5554, 5555, 5555, 5556, 5556, 5557, 5558, 5559, 5560, 5561, 5562, 5563, 5564, 5565, 
+	5566, 5566, 5567, 5568, 5569, 5570, 5571, 5571, 5571, 5572, 5573, 5574, 5576, 5577, 5578, 5578, 5578, 5579, 5580, 5580, 
+	5582, 5583, 5583, 5584, 5585, 5586, 5587, 5588, 5589, 5590, 5590, 5591, 5592, 5593, 5594, 5595, 5595, 5596, 5596, 5596, 
+	5596, 5597, 5598, 5599, 5600, 5601, 5602, 5603, 5604, 5605, 5606, 5609, 5609, 5609, 5610, 5611, 5611, 5611, 5612, 5613, 
+	5614, 5614, 5616, 5616, 5617, 5618, 5619, 5620, 5621, 5621, 5621, 5622, 5623, 5624, 5626, 5626, 5628, 5628, 5629, 5630, 
+	5632, 5632, 5633, 5634, 5635, 5637, 5638, 5639, 5640, 5641, 5642, 5642, 5643, 5644, 5644, 5645, 5645, 5646, 5647, 5648, 
+	5648, 5648, 5649, 5650, 5650, 5652, 5652, 5653, 5654, 5654, 5655, 5656, 5658, 5658, 5658, 5662, 5664, 5664, 5665, 5666, 
+	5667, 5668, 5669, 5669, 5671, 5672, 5675, 5676, 5678, 5679, 5679, 5679, 5680, 5680, 5682, 5683, 5684, 5686, 5686, 5687, 
+	5688, 5689, 5691, 5691, 5692, 5693, 5694, 5694, 5695, 5695, 5696, 5697, 5698, 5699, 5700, 5700, 5701, 5701, 5701, 5702, 
+	5703, 5703, 5703, 5704, 5705, 5706, 5707, 5708, 5709, 5711, 5712, 5713, 5713, 5713, 5714, 5715, 5716, 5716, 5716, 5717, 
+	5718, 5719, 5719, 5720, 5721, 5721, 5722, 5723, 5724, 5725, 5726, 5727, 5728, 5728, 5729, 5729, 5729, 5730, 5731, 5732, 
+	5734, 5734, 5734, 5735, 5735, 5736, 5736, 5737, 5737, 5738, 5739, 5739, 5740, 5740, 5741, 5742, 5743, 5743, 5744, 5745, 
+	5746, 5746, 5747, 5747, 5748, 5749, 5750, 5751, 5752, 5752, 5753, 5754, 5755, 5757, 5758, 5759, 5760, 5761, 5762, 5762, 
+	5763, 5763, 5764, 5764, 5765, 5766, 5767, 5770, 5771, 5773, 5773, 5774, 5775, 5775, 5776, 5777, 5778, 5778, 5779, 5780, 
+	5781, 5781, 5782, 5782, 5782, 5783, 5783, 5784, 5785, 5787, 5787, 5788, 5788, 5789, 5790, 5790, 5790, 5791, 5792, 5793, 
+	5793, 5794, 5795, 5796, 5797, 5797, 5798, 5800, 5801, 5802, 5803, 5804, 5805, 5806, 5807, 5808, 5809, 5811, 5812, 5813, 
+	5815, 5816, 5817, 5818, 5819, 5820, 5820, 5820, 5821, 5823, 5823, 5823, 5824, 5825, 5826, 5826, 5827, 5828, 5829, 5831, 
+	5831, 5837, 5837, 5838, 5839, 5840, 5841, 5842, 5843, 5844, 5845, 5846, 5846, 5847, 5848, 5848, 5849, 5850, 5851, 5852, 
+	5852, 5852, 5854, 5855, 5856, 5856, 5857, 5858, 5859, 5860, 5861, 5862, 5862, 5863, 5864, 5865, 5866, 5866, 5867, 5868, 
+	5869, 5870, 5870, 5871, 5872, 5873, 5874, 5876, 5876, 5876, 5877, 5878, 5879, 5879, 5880, 5881, 5882, 5882, 5884, 5887, 
+	5888, 5888, 5889, 5889, 5890, 5890, 5891, 5892, 5893, 5894, 5895, 5896, 5897, 5898, 5898, 5899, 5899, 5900, 5901, 5901, 
+	5902, 5902, 5903, 5903, 5905, 5907, 5910, 5913, 5915, 5915, 5916, 5916, 5917, 5918, 5919, 5919, 5920, 5921, 5922, 5922, 
+	5923, 5923, 5924, 5925, 5926, 5927, 5928, 5929, 5930, 5931, 5933, 5933, 5934, 5935, 5936, 5939, 5940, 5940, 5940, 5940, 
+	5940, 5940, 5941, 5942, 5942, 5943, 5945, 5946, 5947, 5948, 5949, 5950, 5951, 5952, 5954, 5955, 5956, 5958, 5959, 5960, 
+	5961, 5961, 5962, 5963, 5963, 5964, 5966, 5969, 5971, 5972, 5973, 5974, 5975, 5976, 5979, 5979, 5979, 5980, 5981, 5981, 
+	5982, 5982, 5983, 5984, 5985, 5986, 5986, 5987, 5988, 5989, 5990, 5991, 5991, 5991, 5992, 5993, 5994, 5995, 5995, 5995, 
+	5996, 5996, 5997, 5998, 5999, 6000, 6001, 6002, 6003, 6004, 6005, 6006, 6007, 6008, 6009, 6010, 6011, 6012, 6012, 6013, 
+	6014, 6015, 6016, 6016, 6017, 6018, 6019, 6020, 6021, 6022, 6023, 6023, 6024, 6025, 6025, 6026, 6027, 6027, 6028, 6028, 
+	6028, 6029, 6030, 6031, 6032, 6033, 6034, 6035, 6036, 6037, 6037, 6038, 6039, 6041, 6042, 6043, 6044, 6045, 6046, 6047, 
+	6048, 6048, 6049, 6050, 6051, 6051, 6052, 6053, 6053, 6055, 6057, 6058, 6059, 6060, 6062, 6063, 6063, 6064, 6064, 6064, 
+	6065, 6065, 6066, 6067, 6068, 6069, 6070, 6070, 6070, 6071, 6071, 6072, 6073, 6074, 6075, 6075, 6076, 6077, 6078, 6078, 
+	6079, 6080, 6080, 6081, 6081, 6081, 6081, 6081, 6081, 6082, 6083, 6083, 6084, 6084, 6084, 6085, 6085, 6085, 6085, 6085, 
+	6086, 6087, 6087, 6088, 6088, 6088, 6088, 6089, 6089, 6090, 6091, 6092, 6093, 6094, 6095, 6095, 6096, 6097, 6098, 6099, 
+	6100, 6101, 6101, 6102, 6103, 6104, 6108, 6109, 6110, 6110, 6111, 6112, 6113, 6114, 6115, 6116, 6116, 6117, 6118, 6119, 
+	6119, 6120, 6120, 6121, 6122, 6123, 6124, 6125, 6131, 6132, 6133, 6134, 6135, 6136, 6137, 6138, 6139, 6140, 6140, 6141, 
+	6142, 6142, 6143, 6144, 6144, 6145, 6145, 6146, 6147, 6148, 6149, 6151, 6152, 6153, 6153, 6154, 6155, 6156, 6156, 6157, 
+	6158, 6158, 6158, 6159, 6160, 6161, 6162, 6163, 6163, 6164, 6164, 6165, 6165, 6166, 6167, 6168, 6169, 6170, 6170, 6171, 
+	6171, 6171, 6172, 6172, 6172, 6173, 6174, 6175, 6176, 6177, 6178, 6179, 6180, 6181, 6183, 6184, 6185, 6186, 6187, 6190, 
+	6191, 6192, 6193, 6194, 6195, 6196, 6197, 6198, 6199, 6200, 6201, 6202, 6203, 6204, 6205, 6206, 6207, 6208, 6209, 6210, 
+	6211, 6212, 6213, 6214, 6215, 6217, 6218, 6219, 6220, 6221, 6222, 6223, 6224, 6225, 6226, 6227, 6228, 6229, 6230, 6231, 
+	6232, 6233, 6234, 6235, 6236, 6237, 6238, 6239, 6240, 6241, 6241, 6242, 6242, 6243, 6244, 6244, 6244, 6245, 6246, 6247, 
+	6248, 6249, 6250, 6251, 6252, 6253, 6254, 6255, 6256, 6256, 6257, 6258, 6258, 6259, 6260, 6261, 6262, 6263, 6265, 6266, 
+	6267, 6268, 6270, 6271, 6272, 6273, 6274, 6275, 6276, 6277, 6278, 6279, 6280, 6281, 6281, 6282, 6283, 6284, 6285, 6285, 
+	6286, 6290, 6292, 6293, 6294, 6295, 6296, 6296, 6296, 6296, 6297, 6298, 6299, 6299, 6300, 6301, 6301, 6302, 6303, 6304, 
+	6305, 6306, 6307, 6308, 6308, 6309, 6309, 6310, 6311, 6311, 6313, 6314, 6314, 6315, 6315, 6316, 6317, 6318, 6318, 6319, 
+	6320, 6321, 6322, 6323, 6324, 6324, 6325, 6325, 6325, 6326, 6327, 6328, 6329, 6330, 6330, 6330, 6331, 6331, 6332, 6333, 
+	6334, 6335, 6336, 6336, 6336, 6336, 6337, 6338, 6338, 6338, 6338, 6338, 6339, 6340, 6340, 6342, 6342, 6343, 6344, 6344, 
+	6345, 6345, 6346, 6348, 6348, 6348, 6349, 6350, 6351, 6351, 6352, 6353, 6354, 6355, 6356, 6358, 6359, 6359, 6359, 6361, 
+	6362, 6362, 6363, 6364, 6365, 6366, 6367, 6368, 6369, 6370, 6371, 6372, 6373, 6374, 6375, 6376, 6377, 6378, 6379, 6380, 
+	6380, 6380, 6380, 6380, 6380, 6381, 6382, 6383, 6383, 6383, 6383, 6383, 6383, 6383, 6383, 6383, 6383, 6383, 6383, 6383, 
+	6383, 6383, 6383, 6383, 6383, 6383, 6384, 6384, 6384, 6384, 6384, 6384, 6384, 6384, 6384, 6385, 6386, 6387, 6387, 6387, 
+	6387, 6387, 6387, 6387, 6387, 6387, 6387, 6387, 6388, 6388, 6389, 6389, 6389, 6389, 6390, 6391, 6391, 6391, 6392, 6393, 
+	6394, 6395, 6396, 6397, 6398, 6398, 6398, 6398, 6399, 6400, 6400, 6400, 6401, 6401, 6402, 6403, 6403, 6404, 6405, 6407, 
+	6408, 6409, 6410, 6410, 6411, 6411, 6413, 6413, 6414, 6415, 6417, 6418, 6419, 6420, 6421, 6421, 6421, 6421, 6421, 6421, 
+	6423, 6423, 6423, 6425, 6426, 6427, 6428, 6429, 6429, 6431, 6432, 6433, 6434, 6435, 6436, 6436, 6436, 6437, 6437, 6438, 
+	6439, 6440, 6440, 6441, 6441, 6442, 6443, 6443, 6444, 6444, 6445, 6446, 6446, 6446, 6447, 6447, 6448, 6448, 6450, 6451, 
+	6452, 6453, 6454, 6454, 6455, 6456, 6457, 6458, 6459, 6460, 6461, 6462, 6463, 6464, 6465, 6466, 6466, 6466, 6466, 6466, 
+	6467, 6468, 6468, 6469, 6470, 6471, 6471, 6472, 6472, 6473, 6474, 6475, 6476, 6476, 6476, 6477, 6478, 6479, 6480, 6480, 
+	6481, 6481, 6482, 6482, 6483, 6484, 6484, 6485, 6486, 6487, 6487, 6488, 6489, 6489, 6489, 6489, 6489, 6490, 6491, 6492, 
+	6493, 6494, 6494, 6495, 6495, 6495, 6495, 6495, 6496, 6496, 6497, 6498, 6499, 6500, 6501, 6502, 6503, 6504, 6505, 6506, 
+	6507, 6508, 6509, 6510, 6511, 6512, 6512, 6512, 6513, 6513, 6514, 6515, 6515, 6516, 6516, 6518, 6519, 6519, 6520, 6520, 
+	6520, 6520, 6520, 6520, 6520, 6520, 6521, 6522, 6523, 6524, 6525, 6526, 6527, 6528, 6529, 6530, 6531, 6532, 6533, 6534, 
+	6534, 6534, 6536, 6537, 6538, 6539, 6540, 6540, 6541, 6542, 6543, 6544, 6545, 6546, 6547, 6548, 6549, 6549, 6549, 6550, 
+	6551, 6551, 6552, 6552, 6552, 6552, 6552, 6553, 6554, 6554, 6554, 6555, 6555, 6556, 6557, 6558, 6559, 6560, 6561, 6562, 
+	6562, 6562, 6563, 6563, 6564, 6564, 6565, 6565, 6566, 6566, 6566, 6566, 6567, 6567, 6567, 6568, 6569, 6570, 6570, 6571, 
+	6571, 6572, 6573, 6574, 6575, 6575, 6576, 6576, 6576, 6577, 6578, 6579, 6580, 6581, 6582, 6583, 6584, 6584, 6584, 6584, 
+	6585, 6586, 6586, 6588, 6589, 6590, 6590, 6590, 6591, 6592, 6593, 6594, 6595, 6596, 6597, 6598, 6599, 6599, 6601, 6602, 
+	6603, 6604, 6606, 6607, 6608, 6609, 6610, 6610, 6610, 6611, 6611, 6611, 6612, 6613, 6613, 6614, 6616, 6617, 6617, 6617, 
+	6617, 6617, 6617, 6618, 6619, 6620, 6621, 6621, 6622, 6623, 6624, 6625, 6626, 6627, 6627, 6628, 6628, 6629, 6629, 6630, 
+	6630, 6630, 6630, 6631, 6632, 6632, 6632, 6633, 6634, 6635, 6636, 6637, 6637, 6637, 6638, 6639, 6640, 6640, 6641, 6645, 
+	6646, 6647, 6647, 6648, 6648, 6649, 6650, 6651, 6651, 6652, 6654, 6655, 6656, 6657, 6658, 6658, 6659, 6660, 6661, 6662, 
+	6663, 6663, 6664, 6664, 6664, 6665, 6665, 6666, 6666, 6667, 6668, 6669, 6669, 6670, 6670, 6670, 6671, 6671, 6672, 6672, 
+	6673, 6674, 6674, 6676, 6676, 6677, 6677, 6677, 6677, 6677, 6677, 6677, 6678, 6679, 6679, 6680, 6680, 6680, 6680, 6681, 
+	6681, 6682, 6683, 6686, 6686, 6689, 6690, 6691, 6691, 6692, 6693, 6693, 6694, 6694, 6694, 6695, 6696, 6697, 6697, 6698, 
+	6699, 6701, 6701, 6702, 6702, 6702, 6703, 6704, 6704, 6704, 6705, 6705, 6706, 6706, 6706, 6707, 6708, 6709, 6710, 6710, 
+	6711, 6712, 6713, 6714, 6715, 6716, 6717, 6718, 6718, 6718, 6719, 6719, 6720, 6721, 6722, 6722, 6722, 6723, 6724, 6724, 
+	6724, 6725, 6725, 6725, 6725, 6726, 6726, 6726, 6726, 6727, 6728, 6728, 6728, 6728, 6728, 6729, 6730, 6731, 6732, 6733, 
+	6735, 6735, 6736, 6737, 6737, 6738, 6739, 6740, 6741, 6742, 6742, 6743, 6745, 6746, 6747, 6747, 6748, 6749, 6750, 6750, 
+	6751, 6752, 6753, 6754, 6754, 6754, 6755, 6756, 6757, 6758, 6759, 6760, 6761, 6761, 6762, 6762, 6763, 6764, 6765, 6766, 
+	6767, 6767, 6768, 6769, 6770, 6771, 6772, 6772, 6773, 6773, 6774, 6774, 6775, 6775, 6776, 6776, 6776, 6777, 6777, 6778, 
+	6778, 6779, 6779, 6780, 6781, 6782, 6783, 6784, 6785, 6785, 6786, 6786, 6787, 6787, 6787, 6788, 6789, 6789, 6791, 6792, 
+	6793, 6793, 6794, 6794, 6795, 6796, 6797, 6797, 6798, 6799, 6799, 6799, 6800, 6801, 6802, 6803, 6804, 6805, 6806, 6807, 
+	6807, 6807, 6809, 6809, 6809, 6809, 6809, 6809, 6810, 6811, 6812, 6813, 6813, 6814, 6814, 6815, 6816, 6817, 6817, 6817, 
+	6818, 6819, 6820, 6820, 6821, 6821, 6822, 6822, 6822, 6823, 6824, 6824, 6824, 6824, 6824, 6825, 6825, 6826, 6827, 6828, 
+	6828, 6829, 6829, 6830, 6831, 6832, 6832, 6833, 6834, 6835, 6835, 6835, 6835, 6835, 6836, 6837, 6837, 6838, 6839, 6840, 
+	6840, 6840, 6841, 6842, 6844, 6844, 6845, 6845, 6846, 6846, 6847, 6848, 6848, 6849, 6850, 6851, 6852, 6852, 6853, 6854, 
+	6855, 6855, 6856, 6856, 6857, 6858, 6859, 6859, 6859, 6860, 6861, 6864, 6865, 6866, 6867, 6868, 6869, 6870, 6871, 6872, 
+	6873, 6874, 6875, 6876, 6877, 6878, 6879, 6880, 6881, 6881, 6881, 6882, 6885, 6886, 6887, 6888, 6888, 6889, 6889, 6890, 
+	6891, 6891, 6892, 6893, 6894, 6895, 6896, 6897, 6897, 6898, 6899, 6900, 6901, 6902, 6902, 6903, 6903, 6903, 6903, 6905, 
+	6906, 6907, 6908, 6909, 6910, 6910, 6911, 6912, 6913, 6914, 6914, 6915, 6916, 6916, 6917, 6917, 6918, 6919, 6919, 6920, 
+	6920, 6920, 6921, 6921, 6922, 6923, 6923, 6923, 6923, 6925, 6926, 6926, 6926, 6926, 6927, 6928, 6929, 6929, 6929, 6930, 
+	6931, 6933, 6934, 6934, 6934, 6934, 6935, 6935, 6935, 6936, 6936, 6936, 6937, 6938, 6939, 6940, 6941, 6941, 6942, 6943, 
+	6944, 6945, 6946, 6947, 6948, 6948, 6949, 6949, 6950, 6951, 6951, 6951, 6951, 6951, 6951, 6952, 6953, 6954, 6955, 6956, 
+	6956, 6957, 6957, 6958, 6959, 6960, 6960, 6960, 6960, 6960, 6960, 6960, 6960, 6961, 6962, 6962, 6962, 6963, 6964, 6964, 
+	6965, 6966, 6966, 6967, 6968, 6969, 6970, 6970, 6970, 6970, 6971, 6971, 6971, 6972, 6972, 6973, 6974, 6974, 6974, 6975, 
+	6976, 6976, 6976, 6977, 6978, 6979, 6980, 6981, 6982, 6983, 6984, 6985, 6985, 6986, 6986, 6987, 6988, 6989, 6989, 6990, 
+	6990, 6990, 6991, 6992, 6993, 6993, 6994, 6995, 6996, 6998, 6999, 7000, 7001, 7002, 7003, 7004, 7005, 7007, 7008, 7008, 
+	7008, 7008, 7008, 7009, 7010, 7011, 7012, 7013, 7014, 7014, 7015, 7016, 7017, 7017, 7018, 7018, 7018, 7018, 7024, 7024, 
+	7025, 7026, 7026, 7027, 7028, 7028, 7028, 7029, 7030, 7031, 7032, 7033, 7033, 7033, 7033, 7033, 7033, 7034, 7034, 7034, 
+	7035, 7036, 7037, 7038, 7039, 7040, 7041, 7044, 7045, 7046, 7047, 7048, 7049, 7050, 7051, 7052, 7053, 7054, 7055, 7056, 
+	7057, 7058, 7058, 7059, 7060, 7061, 7062, 7063, 7064, 7064, 7065, 7066, 7067, 7067, 7067, 7067, 7068, 7069, 7070, 7071, 
+	7072, 7073, 7074, 7075, 7076, 7077, 7078, 7079, 7080, 7082, 7083, 7089, 7090, 7091, 7092, 7093, 7094, 7095, 7096, 7097, 
+	7098, 7099, 7099, 7099, 7099, 7099, 7100, 7101, 7101, 7101, 7101, 7102, 7103, 7104, 7105, 7106, 7107, 7108, 7109, 7110, 
+	7110, 7110, 7110, 7110, 7112, 7113, 7114, 7115, 7117, 7118, 7119, 7120, 7123, 7124, 7125, 7126, 7127, 7128, 7128, 7128, 
+	7128, 7128, 7128, 7129, 7130, 7131, 7132, 7133, 7133, 7134, 7135, 7136, 7136, 7137, 7138, 7139, 7140, 7140, 7140, 7140, 
+	7141, 7142, 7143, 7144, 7145, 7146, 7147, 7147, 7147, 7148, 7148, 7148, 7148, 7149, 7150, 7151, 7152, 7155, 7156, 7157, 
+	7158, 7159, 7160, 7161, 7162, 7163, 7163, 7163, 7163, 7164, 7165, 7165, 7165, 7165, 7165, 7166, 7166, 7166, 7166, 7167, 
+	7167, 7168, 7168, 7176, 7178, 7178, 7179, 7179, 7179, 7180, 7181, 7181, 7182, 7183, 7184, 7185, 7187, 7187, 7187, 7188, 
+	7189, 7189, 7190, 7191, 7191, 7192, 7192, 7193, 7193, 7194, 7195, 7196, 7197, 7198, 7199, 7200, 7200, 7201, 7201, 7202, 
+	7203, 7204, 7205, 7205, 7205, 7205, 7206, 7207, 7208, 7208, 7208, 7209, 7209, 7209, 7209, 7209, 7210, 7210, 7210, 7210, 
+	7210, 7210, 7211, 7212, 7213, 7214, 7214, 7215, 7220, 7221, 7221, 7222, 7223, 7223, 7224, 7224, 7224, 7225, 7226, 7227, 
+	7227, 7227, 7227, 7228, 7229, 7229, 7230, 7231, 7231, 7231, 7231, 7231, 7232, 7234, 7235, 7236, 7236, 7237, 7238, 7238, 
+	7238, 7238, 7239, 7239, 7240, 7241, 7242, 7242, 7244, 7245, 7245, 7246, 7246, 7246, 7246, 7246, 7247, 7248, 7249, 7250, 
+	7251, 7252, 7253, 7254, 7255, 7255, 7255, 7255, 7256, 7257, 7257, 7257, 7257, 7257, 7257, 7257, 7258, 7258, 7259, 7259, 
+	7259, 7259, 7259, 7260, 7260, 7261, 7263, 7263, 7263, 7264, 7265, 7266, 7267, 7268, 7268, 7268, 7268, 7268, 7269, 7269, 
+	7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7269, 7270, 7270, 7272, 
+	7272, 7273, 7273, 7274, 7275, 7275, 7275, 7276, 7277, 7278, 7278, 7279, 7279, 7279, 7279, 7280, 7280, 7281, 7281, 7281, 
+	7282, 7283, 7283, 7284, 7285, 7285, 7285, 7285, 7285, 7285, 7285, 7285, 7285, 7285, 7286, 7287, 7287, 7288, 7288, 7288, 
+	7289, 7290, 7291, 7292, 7292, 7293, 7293, 7293, 7293, 7293, 7293, 7293, 7293, 7293, 7294, 7294, 7294, 7294, 7295, 7295, 
+	7295, 7295, 7295, 7296, 7296, 7296, 7296, 7296, 7297, 7298, 7298, 7298, 7298, 7299, 7300, 7301, 7302, 7303, 7304, 7305, 
+	7306, 7306, 7308, 7308, 7309, 7310, 7311, 7312, 7313, 7314, 7314, 7314, 7314, 7315, 7315, 7315, 7315, 7316, 7317, 7318, 
+	7319, 7320, 7321, 7321, 7322, 7322, 7322, 7323, 7323, 7324, 7324, 7324, 7324, 7324, 7324, 7324, 7324, 7325, 7325, 7326, 
+	7327, 7328, 7329, 7329, 7330, 7331, 7332, 7332, 7332, 7333, 7333, 7333, 7333, 7333, 7333, 7334, 7334, 7334, 7334, 7335, 
+	7336, 7337, 7338, 7338, 7338, 7338, 7339, 7341, 7341, 7341, 7341, 7342, 7342, 7343, 7343, 7343, 7343, 7344, 7345, 7346, 
+	7347, 7348, 7348, 7348, 7349, 7350, 7351, 7352, 7353, 7354, 7355, 7356, 7356, 7357, 7357, 7358, 7358, 7358, 7359, 7359, 
+	7359, 7360, 7361, 7361, 7362, 7363, 7365, 7366, 7368, 7368, 7369, 7369, 7369, 7369, 7369, 7370, 7370, 7371, 7371, 7372, 
+	7372, 7373, 7373, 7373, 7373, 7373, 7373, 7374, 7375, 7375, 7376, 7376, 7377, 7377, 7377, 7377, 7378, 7379, 7379, 7379, 
+	7379, 7379, 7380, 7380, 7381, 7381, 7382, 7382, 7383, 7384, 7384, 7384, 7384, 7385, 7386, 7387, 7388, 7389, 7389, 7390, 
+	7391, 7392, 7393, 7393, 7393, 7394, 7395, 7396, 7396, 7396, 7396, 7396, 7397, 7398, 7399, 7399, 7399, 7400, 7400, 7400, 
+	7401, 7401, 7401, 7401, 7401, 7402, 7402, 7402, 7403, 7403, 7403, 7404, 7405, 7405, 7405, 7406, 7406, 7407, 7408, 7408, 
+	7408, 7408, 7409, 7410, 7411, 7412, 7413, 7414, 7415, 7415, 7416, 7416, 7417, 7417, 7418, 7418, 7418, 7418, 7418, 7419, 
+	7420, 7420, 7420, 7420, 7420, 7421, 7421, 7422, 7422, 7423, 7423, 7423, 7424, 7425, 7425, 7425, 7425, 7426, 7427, 7428, 
+	7428, 7429, 7429, 7429, 7429, 7430, 7430, 7430, 7430, 7431, 7431, 7432, 7432, 7432, 7432, 7432, 7432, 7433, 7433, 7434, 
+	7435, 7436, 7437, 7437, 7438, 7439, 7439, 7439, 7439, 7440, 7441, 7441, 7442, 7443, 7444, 7445, 7445, 7446, 7447, 7448, 
+	7449, 7450, 7451, 7452, 7452, 7453, 7454, 7454, 7454, 7454, 7454, 7455, 7455, 7455, 7455, 7455, 7455, 7455, 7456, 7457, 
+	7457, 7458, 7459, 7459, 7459, 7459, 7460, 7460, 7460, 7460, 7461, 7461, 7462, 7462, 7463, 7464, 7465, 7466, 7466, 7468, 
+	7468, 7468, 7468, 7468, 7468, 7468, 7469, 7469, 7470, 7471, 7472, 7473, 7474, 7474, 7475, 7475, 7475, 7476, 7476, 7477, 
+	7478, 7479, 7479, 7480, 7480, 7481, 7482, 7483, 7484, 7485, 7485, 7485, 7485, 7485, 7485, 7485, 7485, 7486, 7486, 7486, 
+	7486, 7486, 7486, 7486, 7486, 7486, 7486, 7486, 7486, 7486, 7486, 7487, 7488, 7489, 7489, 7490, 7491, 7491, 7491, 7491, 
+	7492, 7493, 7494, 7495, 7496, 7497, 7498, 7499, 7500, 7501, 7502, 7503, 7504, 7504, 7505, 7506, 7507, 7509, 7510, 7511, 
+	7512, 7514, 7515, 7516, 7517, 7520, 7521, 7521, 7522, 7523, 7523, 7524, 7525, 7525, 7526, 7527, 7528, 7529, 7530, 7531, 
+	7532, 7533, 7534, 7535, 7536, 7537, 7538, 7539, 7540, 7541, 7542, 7542, 7543, 7544, 7545, 7546, 7547, 7548, 7549, 7550, 
+	7552, 7553, 7554, 7554, 7555, 7556, 7557, 7558, 7559, 7560, 7561, 7562, 7563, 7564, 7565, 7566, 7567, 7568, 7569, 7570, 
+	7572, 7573, 7575, 7576, 7577, 7578, 7579, 7580, 7581, 7584, 7585, 7586, 7586, 7586, 7587, 7588, 7589, 7590, 7591, 7593, 
+	7594, 7595, 7596, 7597, 7598, 7598, 7599, 7600, 7601, 7602, 7603, 7604, 7605, 7606, 7607, 7608, 7609, 7610, 7611, 7615, 
+	7616, 7616, 7617, 7617, 7619, 7620, 7621, 7622, 7623, 7627, 7627, 7628, 7630, 7631, 7632, 7633, 7634, 7635, 7636, 7637, 
+	7640, 7641, 7642, 7643, 7644, 7645, 7646, 7647, 7648, 7649, 7650, 7651, 7652, 7653, 7654, 7655, 7657, 7658, 7659, 7663, 
+	7664, 7666, 7667, 7668, 7669, 7670, 7671, 7672, 7673, 7674, 7675, 7676, 7677, 7678, 7678, 7679, 7680, 7681, 7682, 7683, 
+	7683, 7684, 7685, 7686, 7686, 7690, 7691, 7692, 7692, 7693, 7694, 7695, 7696, 7697, 7698, 7699, 7700, 7701, 7701, 7702, 
+	7702, 7703, 7703, 7704, 7705, 7706, 7707, 7707, 7708, 7709, 7710, 7710, 7710, 7710, 7710, 7710, 7711, 7712, 7713, 7713, 
+	7714, 7715, 7716, 7717, 7718, 7719, 7719, 7720, 7720, 7721, 7722, 7723, 7723, 7723, 7724, 7725, 7726, 7727, 7728, 7729, 
+	7730, 7731, 7732, 7732, 7733, 7733, 7734, 7735, 7735, 7735, 7735, 7735, 7736, 7736, 7737, 7738, 7739, 7740, 7741, 7742, 
+	7742, 7742, 7742, 7742, 7742, 7743, 7743, 7744, 7745, 7746, 7746, 7747, 7748, 7749, 7750, 7751, 7752, 7752, 7753, 7754, 
+	7755, 7755, 7755, 7756, 7757, 7757, 7758, 7759, 7760, 7761, 7762, 7763, 7763, 7764, 7765, 7765, 7766, 7767, 7768, 7768, 
+	7769, 7769, 7770, 7771, 7772, 7773, 7774, 7775, 7776, 7777, 7778, 7779, 7780, 7780, 7780, 7781, 7781, 7781, 7781, 7781, 
+	7781, 7782, 7783, 7784, 7785, 7786, 7787, 7788, 7788, 7789, 7790, 7790, 7791, 7792, 7792, 7792, 7793, 7794, 7795, 7797, 
+	7798, 7799, 7800, 7800, 7800, 7801, 7801, 7802, 7802, 7803, 7803, 7804, 7805, 7806, 7807, 7807, 7808, 7809, 7810, 7811, 
+	7811, 7811, 7812, 7813, 7813, 7813, 7814, 7815, 7816, 7817, 7818, 7818, 7818, 7818, 7818, 7818, 7818, 7819, 7819, 7819, 
+	7820, 7821, 7822, 7822, 7822, 7822, 7823, 7823, 7823, 7824, 7825, 7825, 7825, 7825, 7825, 7825, 7825, 7825, 7825, 7826, 
+	7827, 7827, 7828, 7828, 7829, 7829, 7829, 7829, 7830, 7831, 7832, 7833, 7834, 7835, 7835, 7836, 7837, 7838, 7839, 7839, 
+	7839, 7840, 7840, 7840, 7841, 7841, 7841, 7841, 7841, 7842, 7843, 7844, 7845, 7846, 7847, 7848, 7849, 7850, 7850, 7851, 
+	7852, 7852, 7853, 7853, 7854, 7855, 7856, 7856, 7856, 7857, 7858, 7859, 7861, 7863, 7865, 7865, 7865, 7865, 7865, 7867, 
+	7868, 7869, 7870, 7871, 7872, 7873, 7873, 7873, 7873, 7873, 7873, 7873, 7873, 7873, 7875, 7876, 7876, 7877, 7878, 7879, 
+	7880, 7881, 7881, 7886, 7887, 7887, 7887, 7888, 7889, 7890, 7891, 7891, 7892, 7893, 7893, 7894, 7895, 7895, 7896, 7897, 
+	7898, 7899, 7900, 7901, 7902, 7903, 7904, 7904, 7904, 7905, 7906, 7907, 7908, 7909, 7910, 7911, 7912, 7913, 7914, 7915, 
+	7916, 7917, 7918, 7919, 7919, 7920, 7921, 7921, 7922, 7923, 7924, 7925, 7926, 7927, 7928, 7929, 7930, 7933, 7934, 7935, 
+	7936, 7937, 7939, 7940, 7941, 7942, 7943, 7944, 7945, 7946, 7947, 7948, 7949, 7950, 7951, 7952, 7953, 7954, 7955, 7956, 
+	7957, 7958, 7959, 7960, 7960, 7961, 7963, 7964, 7965, 7968, 7969, 7970, 7971, 7972, 7973, 7975, 7976, 7977, 7978, 7979, 
+	7980, 7981, 7982, 7983, 7984, 7985, 7986, 7987, 7987, 7988, 7989, 7990, 7991, 7992, 7993, 7994, 7995, 7996, 7997, 7998, 
+	7999, 8000, 8001, 8002, 8003, 8004, 8005, 8006, 8007, 8008, 8009, 8010, 8011, 8011, 8012, 8013, 8014, 8015, 8016, 8017, 
+	8018, 8019, 8020, 8021, 8022, 8024, 8025, 8026, 8027, 8028, 8030, 8031, 8032, 8032, 8033, 8034, 8035, 8036, 8038, 8039, 
+	8040, 8041, 8041, 8042, 8043, 8043, 8044, 8045, 8046, 8047, 8048, 8049, 8050, 8051, 8052, 8053, 8054, 8056, 8057, 8057, 
+	8058, 8059, 8060, 8061, 8062, 8063, 8064, 8065, 8066, 8067, 8068, 8069, 8070, 8071, 8072, 8073, 8074, 8075, 8076, 8077, 
+	8078, 8078, 8079, 8080, 8081, 8081, 8081, 8082, 8083, 8084, 8085, 8086, 8087, 8088, 8089, 8089, 8089, 8091, 8092, 8093, 
+	8094, 8095, 8096, 8097, 8098, 8099, 8100, 8101, 8102, 8103, 8104, 8105, 8106, 8107, 8107, 8107, 8107, 8107, 8107, 8107, 
+	8107, 8107, 8107, 8107, 8107, 8107, 8107, 8108, 8109, 8110, 8110, 8110, 8110, 8111, 8111, 8112, 8112, 8112, 8113, 8114, 
+	8115, 8115, 8115, 8115, 8115, 8116, 8117, 8118, 8118, 8118, 8119, 8120, 8121, 8121, 8121, 8122, 8123, 8123, 8124, 8125, 
+	8125, 8126, 8127, 8127, 8128, 8129, 8129, 8129, 8130, 8131, 8132, 8133, 8134, 8134, 8134, 8134, 8134, 8135, 8136, 8136, 
+	8137, 8138, 8139, 8139, 8139, 8139, 8139, 8140, 8141, 8142, 8143, 8144, 8144, 8144, 8145, 8146, 8146, 8146, 8146, 8146, 
+	8146, 8146, 8146, 8146, 8148, 8149, 8150, 8153, 8154, 8154, 8154, 8155, 8156, 8157, 8157, 8158, 8158, 8159, 8160, 8161, 
+	8162, 8164, 8164, 8164, 8165, 8166, 8167, 8167, 8168, 8168, 8169, 8170, 8171, 8171, 8171, 8172, 8173, 8174, 8175, 8175, 
+	8176, 8177, 8178, 8179, 8181, 8183, 8185, 8185, 8185, 8186, 8186, 8186, 8187, 8188, 8189, 8189, 8189, 8189, 8189, 8189, 
+	8190, 8190, 8191, 8191, 8192, 8193, 8195, 8196, 8197, 8198, 8199, 8200, 8200, 8200, 8200, 8200, 8200, 8201, 8202, 8202, 
+	8203, 8203, 8204, 8204, 8205, 8206, 8207, 8207, 8208, 8210, 8211, 8212, 8213, 8213, 8213, 8213, 8214, 8216, 8217, 8217, 
+	8218, 8218, 8218, 8218, 8219, 8220, 8221, 8222, 8222, 8222, 8223, 8224, 8224, 8225, 8227, 8228, 8228, 8229, 8229, 8230, 
+	8231, 8231, 8232, 8233, 8233, 8234, 8235, 8235, 8236, 8237, 8237, 8237, 8238, 8239, 8240, 8241, 8243, 8243, 8244, 8244, 
+	8245, 8246, 8247, 8248, 8248, 8249, 8252, 8254, 8255, 8256, 8257, 8258, 8258, 8259, 8260, 8260, 8261, 8262, 8263, 8264, 
+	8265, 8266, 8266, 8267, 8268, 8269, 8270, 8271, 8272, 8273, 8274, 8275, 8276, 8277, 8278, 8279, 8280, 8281, 8282, 8283, 
+	8283, 8284, 8285, 8286, 8287, 8288, 8289, 8289, 8290, 8291, 8292, 8293, 8294, 8295, 8295, 8296, 8297, 8298, 8299, 8300, 
+	8301, 8302, 8303, 8305, 8305, 8306, 8307, 8308, 8309, 8310, 8310, 8311, 8312, 8313, 8314, 8315, 8316, 8317, 8318, 8319, 
+	8320, 8320, 8320, 8321, 8322, 8323, 8324, 8325, 8326, 8327, 8327, 8328, 8329, 8330, 8330, 8337, 8338, 8339, 8340, 8341, 
+	8342, 8343, 8344, 8345, 8346, 8347, 8348, 8349, 8350, 8351, 8351, 8352, 8353, 8354, 8355, 8356, 8357, 8358, 8359, 8360, 
+	8360, 8361, 8362, 8362, 8363, 8364, 8365, 8366, 8368, 8369, 8370, 8371, 8372, 8375, 8376, 8377, 8378, 8379, 8380, 8381, 
+	8382, 8383, 8384, 8385, 8386, 8387, 8388, 8389, 8390, 8391, 8392, 8393, 8394, 8395, 8396, 8397, 8398, 8399, 8400, 8401, 
+	8402, 8403, 8404, 8405, 8405, 8406, 8406, 8407, 8408, 8409, 8409, 8410, 8411, 8412, 8412, 8413, 8414, 8415, 8416, 8417, 
+	8418, 8419, 8420, 8421, 8422, 8423, 8424, 8425, 8426, 8427, 8427, 8427, 8427, 8428, 8429, 8430, 8431, 8431, 8431, 8432, 
+	8433, 8434, 8435, 8436, 8436, 8437, 8438, 8439, 8441, 8442, 8443, 8443, 8444, 8444, 8445, 8446, 8447, 8448, 8449, 8450, 
+	8451, 8451, 8451, 8452, 8452, 8452, 8453, 8454, 8454, 8455, 8456, 8457, 8458, 8459, 8460, 8461, 8462, 8462, 8463, 8464, 
+	8465, 8466, 8467, 8468, 8469, 8470, 8470, 8471, 8472, 8473, 8474, 8475, 8476, 8476, 8477, 8478, 8478, 8478, 8479, 8479, 
+	8480, 8480, 8481, 8481, 8482, 8483, 8484, 8484, 8485, 8486, 8487, 8488, 8488, 8490, 8491, 8492, 8493, 8494, 8495, 8496, 
+	8497, 8498, 8499, 8500, 8500, 8501, 8502, 8503, 8504, 8504, 8504, 8505, 8506, 8507, 8508, 8508, 8508, 8509, 8509, 8510, 
+	8511, 8512, 8512, 8513, 8514, 8515, 8516, 8517, 8518, 8519, 8520, 8521, 8521, 8522, 8523, 8524, 8525, 8525, 8526, 8527, 
+	8527, 8528, 8529, 8530, 8531, 8532, 8533, 8537, 8538, 8539, 8540, 8541, 8542, 8543, 8544, 8545, 8547, 8548, 8549, 8550, 
+	8551, 8552, 8553, 8554, 8555, 8556, 8557, 8558, 8559, 8560, 8560, 8561, 8562, 8563, 8564, 8564, 8565, 8566, 8567, 8568, 
+	8569, 8570, 8571, 8572, 8573, 8573, 8574, 8575, 8576, 8576, 8577, 8578, 8579, 8580, 8581, 8582, 8583, 8584, 8585, 8586, 
+	8587, 8588, 8589, 8590, 8591, 8591, 8592, 8593, 8594, 8595, 8596, 8597, 8597, 8598, 8599, 8600, 8601, 8602, 8603, 8604, 
+	8605, 8606, 8607, 8609, 8610, 8611, 8612, 8613, 8614, 8615, 8615, 8616, 8616, 8617, 8618, 8619, 8620, 8621, 8622, 8623, 
+	8624, 8625, 8626, 8627, 8628, 8629, 8630, 8631, 8632, 8635, 8636, 8637, 8639, 8640, 8644, 8646, 8647, 8648, 8649, 8650, 
+	8651, 8652, 8653, 8654, 8655, 8656, 8657, 8658, 8658, 8659, 8660, 8661, 8662, 8663, 8663, 8664, 8665, 8666, 8667, 8668, 
+	8669, 8669, 8670, 8671, 8672, 8673, 8674, 8675, 8677, 8677, 8678, 8679, 8680, 8681, 8682, 8683, 8684, 8685, 8686, 8687, 
+	8688, 8689, 8690, 8691, 8692, 8693, 8694, 8694, 8694, 8695, 8695, 8695, 8696, 8697, 8697, 8698, 8699, 8700, 8700, 8701, 
+	8702, 8703, 8704, 8705, 8706, 8707, 8708, 8709, 8710, 8712, 8713, 8714, 8715, 8717, 8717, 8718, 8719, 8719, 8720, 8721, 
+	8721, 8722, 8723, 8724, 8725, 8726, 8727, 8729, 8729, 8730, 8731, 8732, 8733, 8733, 8734, 8735, 8736, 8738, 8739, 8740, 
+	8741, 8742, 8743, 8743, 8743, 8743, 8744, 8745, 8745, 8746, 8747, 8748, 8748, 8748, 8749, 8749, 8750, 8751, 8751, 8752, 
+	8753, 8754, 8754, 8754, 8755, 8756, 8756, 8757, 8758, 8759, 8759, 8760, 8761, 8762, 8763, 8764, 8765, 8766, 8767, 8767, 
+	8768, 8769, 8769, 8769, 8770, 8771, 8771, 8771, 8772, 8773, 8773, 8774, 8775, 8776, 8777, 8778, 8779, 8780, 8781, 8782, 
+	8782, 8782, 8782, 8783, 8784, 8786, 8787, 8788, 8788, 8788, 8789, 8790, 8791, 8792, 8793, 8794, 8795, 8796, 8797, 8798, 
+	8799, 8800, 8801, 8802, 8803, 8804, 8805, 8806, 8807, 8808, 8809, 8810, 8811, 8812, 8813, 8814, 8815, 8816, 8817, 8818, 
+	8819, 8820, 8820, 8821, 8822, 8823, 8825, 8826, 8827, 8827, 8828, 8829, 8830, 8831, 8832, 8833, 8834, 8835, 8836, 8837, 
+	8838, 8838, 8839, 8840, 8841, 8842, 8843, 8844, 8845, 8848, 8849, 8850, 8852, 8853, 8854, 8855, 8856, 8856, 8857, 8858, 
+	8859, 8860, 8861, 8862, 8863, 8864, 8865, 8865, 8866, 8867, 8868, 8869, 8870, 8871, 8872, 8873, 8874, 8875, 8876, 8877, 
+	8878, 8879, 8880, 8881, 8882, 8883, 8884, 8885, 8886, 8886, 8887, 8888, 8889, 8890, 8890, 8891, 8892, 8893, 8894, 8895, 
+	8896, 8897, 8897, 8898, 8899, 8900, 8900, 8901, 8902, 8903, 8904, 8905, 8906, 8907, 8907, 8908, 8909, 8910, 8911, 8912, 
+	8913, 8914, 8915, 8916, 8917, 8918, 8919, 8920, 8921, 8922, 8923, 8924, 8925, 8926, 8927, 8928, 8929, 8929, 8930, 8931, 
+	8931, 8931, 8932, 8933, 8934, 8935, 8935, 8936, 8938, 8939, 8939, 8939, 8940, 8941, 8942, 8943, 8944, 8945, 8946, 8947, 
+	8947, 8948, 8948, 8949, 8950, 8950, 8951, 8952, 8953, 8954, 8955, 8955, 8956, 8957, 8958, 8958, 8959, 8960, 8961, 8961, 
+	8961, 8961, 8961, 8962, 8963, 8963, 8964, 8965, 8966, 8967, 8968, 8968, 8968, 8969, 8970, 8971, 8972, 8973, 8974, 8975, 
+	8976, 8977, 8978, 8979, 8980, 8981, 8982, 8983, 8984, 8985, 8986, 8987, 8987, 8988, 8988, 8989, 8990, 8991, 8991, 8991, 
+	8991, 8992, 8994, 8995, 8996, 8997, 8998, 8999, 9000, 9001, 9002, 9003, 9003, 9003, 9003, 9003, 9004, 9006, 9007, 9008, 
+	9009, 9009, 9010, 9011, 9013, 9015, 9016, 9017, 9018, 9019, 9020, 9021, 9022, 9023, 9024, 9025, 9027, 9028, 9029, 9030, 
+	9031, 9032, 9033, 9034, 9035, 9036, 9037, 9038, 9039, 9040, 9041, 9042, 9042, 9043, 9044, 9045, 9046, 9047, 9048, 9048, 
+	9049, 9050, 9050, 9051, 9052, 9052, 9053, 9054, 9055, 9056, 9056, 9056, 9057, 9057, 9057, 9058, 9059, 9060, 9060, 9061, 
+	9062, 9063, 9064, 9065, 9066, 9066, 9067, 9067, 9068, 9069, 9070, 9071, 9071, 9072, 9073, 9074, 9075, 9076, 9077, 9078, 
+	9079, 9080, 9081, 9082, 9083, 9084, 9085, 9086, 9087, 9088, 9089, 9090, 9091, 9092, 9092, 9093, 9094, 9095, 9096, 9097, 
+	9098, 9099, 9100, 9101, 9101, 9102, 9102, 9103, 9104, 9104, 9105, 9106, 9107, 9108, 9109, 9110, 9111, 9112, 9113, 9114, 
+	9115, 9116, 9117, 9118, 9119, 9120, 9121, 9122, 9123, 9124, 9125, 9126, 9127, 9128, 9128, 9129, 9130, 9131, 9132, 9133, 
+	9134, 9134, 9135, 9136, 9137, 9138, 9139, 9142, 9143, 9144, 9146, 9147, 9147, 9148, 9149, 9150, 9150, 9151, 9151, 9152, 
+	9153, 9154, 9155, 9156, 9157, 9158, 9158, 9159, 9160, 9161, 9162, 9163, 9163, 9164, 9165, 9166, 9167, 9168, 9169, 9169, 
+	9173, 9174, 9175, 9176, 9177, 9178, 9179, 9180, 9181, 9182, 9182, 9183, 9184, 9185, 9186, 9187, 9188, 9189, 9190, 9191, 
+	9192, 9193, 9194, 9195, 9196, 9197, 9198, 9199, 9200, 9201, 9202, 9204, 9205, 9206, 9207, 9208, 9209, 9210, 9211, 9212, 
+	9213, 9213, 9214, 9215, 9216, 9216, 9216, 9217, 9219, 9220, 9221, 9222, 9223, 9223, 9224, 9224, 9225, 9226, 9227, 9227, 
+	9228, 9229, 9230, 9231, 9232, 9233, 9234, 9235, 9236, 9237, 9238, 9238, 9239, 9240, 9241, 9242, 9242, 9244, 9245, 9246, 
+	9247, 9247, 9248, 9249, 9250, 9251, 9252, 9254, 9255, 9256, 9257, 9258, 9259, 9260, 9261, 9262, 9263, 9264, 9265, 9266, 
+	9267, 9268, 9269, 9270, 9271, 9273, 9274, 9275, 9275, 9276, 9277, 9278, 9279, 9280, 9280, 9281, 9282, 9282, 9283, 9283, 
+	9284, 9285, 9285, 9286, 9287, 9288, 9289, 9290, 9291, 9292, 9293, 9294, 9295, 9296, 9297, 9297, 9298, 9299, 9300, 9301, 
+	9302, 9303, 9304, 9305, 9306, 9307, 9308, 9309, 9310, 9311, 9312, 9313, 9314, 9315, 9316, 9317, 9318, 9319, 9320, 9320, 
+	9321, 9321, 9322, 9323, 9324, 9325, 9325, 9325, 9326, 9326, 9327, 9328, 9329, 9330, 9330, 9331, 9332, 9333, 9334, 9334, 
+	9335, 9335, 9336, 9337, 9338, 9339, 9339, 9340, 9341, 9342, 9343, 9344, 9345, 9346, 9348, 9348, 9349, 9349, 9349, 9350, 
+	9351, 9352, 9352, 9353, 9354, 9355, 9355, 9355, 9356, 9357, 9357, 9357, 9358, 9359, 9360, 9361, 9362, 9363, 9364, 9364, 
+	9365, 9366, 9367, 9368, 9368, 9368, 9369, 9369, 9370, 9370, 9371, 9373, 9374, 9375, 9376, 9376, 9377, 9378, 9378, 9379, 
+	9379, 9380, 9381, 9382, 9382, 9383, 9385, 9386, 9387, 9388, 9389, 9390, 9391, 9392, 9393, 9393, 9393, 9394, 9395, 9395, 
+	9396, 9397, 9398, 9398, 9399, 9399, 9399, 9400, 9401, 9402, 9403, 9404, 9405, 9406, 9407, 9408, 9408, 9409, 9410, 9411, 
+	9412, 9413, 9414, 9415, 9416, 9417, 9418, 9419, 9419, 9420, 9421, 9422, 9423, 9424, 9424, 9425, 9426, 9428, 9429, 9430, 
+	9431, 9432, 9433, 9434, 9434, 9435, 9435, 9435, 9435, 9436, 9437, 9438, 9439, 9439, 9440, 9440, 9441, 9442, 9443, 9444, 
+	9445, 9446, 9446, 9447, 9447, 9448, 9448, 9449, 9449, 9449, 9450, 9451, 9452, 9453, 9454, 9455, 9455, 9456, 9457, 9458, 
+	9459, 9460, 9460, 9461, 9462, 9463, 9466, 9466, 9467, 9468, 9469, 9470, 9471, 9472, 9473, 9475, 9476, 9476, 9477, 9478, 
+	9479, 9480, 9481, 9481, 9482, 9482, 9483, 9484, 9484, 9485, 9486, 9487, 9488, 9489, 9490, 9492, 9492, 9493, 9494, 9495, 
+	9496, 9497, 9497, 9497, 9497, 9498, 9499, 9500, 9500, 9501, 9502, 9502, 9503, 9504, 9504, 9505, 9506, 9506, 9507, 9508, 
+	9509, 9510, 9511, 9512, 9512, 9513, 9513, 9513, 9514, 9515, 9515, 9516, 9516, 9516, 9517, 9518, 9519, 9519, 9520, 9520, 
+	9520, 9521, 9522, 9522, 9523, 9523, 9524, 9524, 9525, 9525, 9526, 9527, 9528, 9529, 9530, 9531, 9531, 9532, 9533, 9534, 
+	9534, 9535, 9536, 9537, 9538, 9539, 9539, 9539, 9540, 9541, 9542, 9543, 9544, 9545, 9545, 9545, 9546, 9547, 9548, 9549, 
+	9550, 9551, 9552, 9553, 9554, 9555, 9556, 9557, 9557, 9558, 9559, 9560, 9561, 9562, 9563, 9564, 9565, 9566, 9567, 9568, 
+	9569, 9570, 9570, 9570, 9571, 9572, 9572, 9572, 9573, 9574, 9575, 9575, 9576, 9577, 9578, 9579, 9580, 9581, 9582, 9582, 
+	9583, 9584, 9585, 9585, 9585, 9585, 9586, 9587, 9588, 9589, 9590, 9591, 9592, 9593, 9596, 9596, 9597, 9598, 9599, 9600, 
+	9601, 9602, 9603, 9604, 9604, 9605, 9606, 9607, 9608, 9609, 9610, 9611, 9611, 9612, 9613, 9614, 9615, 9616, 9617, 9617, 
+	9618, 9619, 9620, 9621, 9622, 9623, 9623, 9624, 9624, 9625, 9626, 9627, 9627, 9628, 9628, 9628, 9629, 9629, 9629, 9630, 
+	9631, 9632, 9632, 9632, 9632, 9633, 9634, 9634, 9635, 9636, 9636, 9636, 9636, 9636, 9637, 9638, 9638, 9639, 9640, 9641, 
+	9642, 9643, 9643, 9644, 9644, 9644, 9645, 9646, 9647, 9648, 9649, 9649, 9650, 9651, 9651, 9652, 9653, 9654, 9655, 9656, 
+	9656, 9657, 9658, 9659, 9659, 9659, 9660, 9660, 9661, 9662, 9663, 9664, 9665, 9665, 9665, 9666, 9667, 9668, 9669, 9670, 
+	9671, 9672, 9672, 9673, 9674, 9675, 9676, 9677, 9678, 9679, 9680, 9681, 9681, 9682, 9683, 9683, 9684, 9685, 9686, 9688, 
+	9688, 9689, 9689, 9689, 9690, 9691, 9692, 9693, 9694, 9695, 9696, 9697, 9698, 9699, 9699, 9700, 9701, 9701, 9701, 9702, 
+	9703, 9704, 9705, 9705, 9705, 9706, 9707, 9708, 9709, 9709, 9709, 9710, 9711, 9712, 9712, 9712, 9713, 9713, 9713, 9714, 
+	9714, 9715, 9716, 9717, 9718, 9719, 9720, 9721, 9722, 9723, 9724, 9724, 9724, 9725, 9725, 9725, 9726, 9727, 9728, 9728, 
+	9729, 9729, 9730, 9730, 9730, 9730, 9730, 9731, 9732, 9733, 9734, 9734, 9735, 9736, 9737, 9738, 9738, 9739, 9740, 9741, 
+	9741, 9742, 9742, 9743, 9743, 9744, 9745, 9746, 9746, 9747, 9748, 9748, 9749, 9750, 9751, 9752, 9752, 9753, 9754, 9755, 
+	9756, 9757, 9757, 9758, 9758, 9759, 9760, 9760, 9760, 9760, 9761, 9761, 9762, 9763, 9763, 9763, 9764, 9765, 9766, 9767, 
+	9768, 9769, 9770, 9771, 9772, 9773, 9774, 9774, 9774, 9775, 9776, 9777, 9777, 9777, 9778, 9778, 9779, 9780, 9781, 9782, 
+	9783, 9783, 9784, 9785, 9786, 9787, 9788, 9789, 9790, 9791, 9792, 9792, 9792, 9793, 9794, 9794, 9794, 9794, 9794, 9794, 
+	9795, 9795, 9795, 9796, 9796, 9797, 9798, 9799, 9800, 9801, 9802, 9803, 9803, 9804, 9805, 9805, 9806, 9807, 9807, 9807, 
+	9808, 9809, 9810, 9810, 9811, 9812, 9813, 9814, 9814, 9815, 9816, 9817, 9818, 9819, 9820, 9820, 9820, 9820, 9820, 9821, 
+	9822, 9823, 9824, 9825, 9825, 9826, 9826, 9826, 9827, 9828, 9828, 9828, 9828, 9828, 9829, 9830, 9831, 9831, 9832, 9833, 
+	9833, 9833, 9834, 9834, 9835, 9836, 9836, 9837, 9837, 9837, 9838, 9838, 9838, 9839, 9839, 9840, 9841, 9841, 9842, 9843, 
+	9843, 9844, 9845, 9846, 9846, 9846, 9847, 9847, 9848, 9849, 9850, 9851, 9852, 9853, 9853, 
+}};
+
+std::array<std::array<std::uint16_t, 2>, 9853> const wordring::whatwg::html::parsing::named_character_reference_dfa_edge_tbl = {{
+	{ 65, 1 }, { 66, 2 }, { 67, 3 }, { 68, 4 }, { 69, 5 }, { 70, 6 }, { 71, 7 }, { 72, 8 }, { 73, 9 }, { 74, 10 }, { 75, 11 }, { 76, 12 }, { 77, 13 }, { 78, 14 }, { 79, 15 }, { 80, 16 }, { 81, 17 }, { 82, 18 }, { 83, 19 }, { 84, 20 }, 
+	{ 85, 21 }, { 86, 22 }, { 87, 23 }, { 88, 24 }, { 89, 25 }, { 90, 26 }, { 97, 27 }, { 98, 28 }, { 99, 29 }, { 100, 30 }, { 101, 31 }, { 102, 32 }, { 103, 33 }, { 104, 34 }, { 105, 35 }, { 106, 36 }, { 107, 37 }, { 108, 38 }, { 109, 39 }, { 110, 40 }, 
+	{ 111, 41 }, { 112, 42 }, { 113, 43 }, { 114, 44 }, { 115, 45 }, { 116, 46 }, { 117, 47 }, { 118, 48 }, { 119, 49 }, { 120, 50 }, { 121, 51 }, { 122, 52 }, { 69, 53 }, { 77, 54 }, { 97, 55 }, { 98, 56 }, { 99, 57 }, { 102, 58 }, { 103, 59 }, { 108, 60 }, 
+	{ 109, 61 }, { 110, 62 }, { 111, 63 }, { 112, 64 }, { 114, 65 }, { 115, 66 }, { 116, 67 }, { 117, 68 }, { 97, 69 }, { 99, 70 }, { 101, 71 }, { 102, 72 }, { 111, 73 }, { 114, 74 }, { 115, 75 }, { 117, 76 }, { 72, 77 }, { 79, 78 }, { 97, 79 }, { 99, 80 }, 
+	{ 100, 81 }, { 101, 82 }, { 102, 83 }, { 104, 84 }, { 105, 85 }, { 108, 86 }, { 111, 87 }, { 114, 88 }, { 115, 89 }, { 117, 90 }, { 68, 91 }, { 74, 92 }, { 83, 93 }, { 90, 94 }, { 97, 95 }, { 99, 96 }, { 101, 97 }, { 102, 98 }, { 105, 99 }, { 111, 100 }, 
+	{ 115, 101 }, { 78, 102 }, { 84, 103 }, { 97, 104 }, { 99, 105 }, { 100, 106 }, { 102, 107 }, { 103, 108 }, { 108, 109 }, { 109, 110 }, { 111, 111 }, { 112, 112 }, { 113, 113 }, { 115, 114 }, { 116, 115 }, { 117, 116 }, { 120, 117 }, { 99, 118 }, { 102, 119 }, { 105, 120 }, 
+	{ 111, 121 }, { 115, 122 }, { 74, 123 }, { 84, 124 }, { 97, 125 }, { 98, 126 }, { 99, 127 }, { 100, 128 }, { 102, 129 }, { 103, 130 }, { 111, 131 }, { 114, 132 }, { 115, 133 }, { 116, 134 }, { 65, 135 }, { 97, 136 }, { 99, 137 }, { 102, 138 }, { 105, 139 }, { 111, 140 }, 
+	{ 115, 141 }, { 117, 142 }, { 69, 143 }, { 74, 144 }, { 79, 145 }, { 97, 146 }, { 99, 147 }, { 100, 148 }, { 102, 149 }, { 103, 150 }, { 109, 151 }, { 110, 152 }, { 111, 153 }, { 115, 154 }, { 116, 155 }, { 117, 156 }, { 99, 157 }, { 102, 158 }, { 111, 159 }, { 115, 160 }, 
+	{ 117, 161 }, { 72, 162 }, { 74, 163 }, { 97, 164 }, { 99, 165 }, { 102, 166 }, { 111, 167 }, { 115, 168 }, { 74, 169 }, { 84, 170 }, { 97, 171 }, { 99, 172 }, { 101, 173 }, { 102, 174 }, { 108, 175 }, { 109, 176 }, { 111, 177 }, { 115, 178 }, { 116, 179 }, { 97, 180 }, 
+	{ 99, 181 }, { 101, 182 }, { 102, 183 }, { 105, 184 }, { 111, 185 }, { 115, 186 }, { 117, 187 }, { 74, 188 }, { 97, 189 }, { 99, 190 }, { 101, 191 }, { 102, 192 }, { 111, 193 }, { 115, 194 }, { 116, 195 }, { 117, 196 }, { 69, 197 }, { 97, 198 }, { 99, 199 }, { 100, 200 }, 
+	{ 102, 201 }, { 103, 202 }, { 109, 203 }, { 111, 204 }, { 112, 205 }, { 114, 206 }, { 115, 207 }, { 116, 208 }, { 117, 209 }, { 118, 210 }, { 97, 211 }, { 99, 212 }, { 102, 213 }, { 104, 214 }, { 105, 215 }, { 108, 216 }, { 111, 217 }, { 114, 218 }, { 115, 219 }, { 85, 220 }, 
+	{ 102, 221 }, { 111, 222 }, { 115, 223 }, { 66, 224 }, { 69, 225 }, { 97, 226 }, { 99, 227 }, { 101, 228 }, { 102, 229 }, { 104, 230 }, { 105, 231 }, { 111, 232 }, { 114, 233 }, { 115, 234 }, { 117, 235 }, { 72, 236 }, { 79, 237 }, { 97, 238 }, { 99, 239 }, { 102, 240 }, 
+	{ 104, 241 }, { 105, 242 }, { 109, 243 }, { 111, 244 }, { 113, 245 }, { 115, 246 }, { 116, 247 }, { 117, 248 }, { 72, 249 }, { 82, 250 }, { 83, 251 }, { 97, 252 }, { 99, 253 }, { 102, 254 }, { 104, 255 }, { 105, 256 }, { 111, 257 }, { 114, 258 }, { 115, 259 }, { 97, 260 }, 
+	{ 98, 261 }, { 99, 262 }, { 100, 263 }, { 102, 264 }, { 103, 265 }, { 109, 266 }, { 110, 267 }, { 111, 268 }, { 112, 269 }, { 114, 270 }, { 115, 271 }, { 116, 272 }, { 117, 273 }, { 68, 274 }, { 98, 275 }, { 99, 276 }, { 100, 277 }, { 101, 278 }, { 102, 279 }, { 111, 280 }, 
+	{ 115, 281 }, { 118, 282 }, { 99, 283 }, { 101, 284 }, { 102, 285 }, { 111, 286 }, { 115, 287 }, { 102, 288 }, { 105, 289 }, { 111, 290 }, { 115, 291 }, { 65, 292 }, { 73, 293 }, { 85, 294 }, { 97, 295 }, { 99, 296 }, { 102, 297 }, { 111, 298 }, { 115, 299 }, { 117, 300 }, 
+	{ 72, 301 }, { 97, 302 }, { 99, 303 }, { 100, 304 }, { 101, 305 }, { 102, 306 }, { 111, 307 }, { 115, 308 }, { 97, 309 }, { 98, 310 }, { 99, 311 }, { 101, 312 }, { 102, 313 }, { 103, 314 }, { 108, 315 }, { 109, 316 }, { 110, 317 }, { 111, 318 }, { 112, 319 }, { 114, 320 }, 
+	{ 115, 321 }, { 116, 322 }, { 117, 323 }, { 119, 324 }, { 78, 325 }, { 97, 326 }, { 98, 327 }, { 99, 328 }, { 100, 329 }, { 101, 330 }, { 102, 331 }, { 105, 332 }, { 107, 333 }, { 108, 334 }, { 110, 335 }, { 111, 336 }, { 112, 337 }, { 114, 338 }, { 115, 339 }, { 117, 340 }, 
+	{ 97, 341 }, { 99, 342 }, { 100, 343 }, { 101, 344 }, { 102, 345 }, { 104, 346 }, { 105, 347 }, { 108, 348 }, { 111, 349 }, { 114, 350 }, { 115, 351 }, { 116, 352 }, { 117, 353 }, { 119, 354 }, { 121, 355 }, { 65, 356 }, { 72, 357 }, { 97, 358 }, { 98, 359 }, { 99, 360 }, 
+	{ 100, 361 }, { 101, 362 }, { 102, 363 }, { 104, 364 }, { 105, 365 }, { 106, 366 }, { 108, 367 }, { 111, 368 }, { 114, 369 }, { 115, 370 }, { 116, 371 }, { 117, 372 }, { 119, 373 }, { 122, 374 }, { 68, 375 }, { 97, 376 }, { 99, 377 }, { 100, 378 }, { 101, 379 }, { 102, 380 }, 
+	{ 103, 381 }, { 108, 382 }, { 109, 383 }, { 110, 384 }, { 111, 385 }, { 112, 386 }, { 113, 387 }, { 114, 388 }, { 115, 389 }, { 116, 390 }, { 117, 391 }, { 120, 392 }, { 97, 393 }, { 99, 394 }, { 101, 395 }, { 102, 396 }, { 105, 397 }, { 106, 398 }, { 108, 399 }, { 110, 400 }, 
+	{ 111, 401 }, { 112, 402 }, { 114, 403 }, { 115, 404 }, { 69, 405 }, { 97, 406 }, { 98, 407 }, { 99, 408 }, { 100, 409 }, { 101, 410 }, { 102, 411 }, { 103, 412 }, { 105, 413 }, { 106, 414 }, { 108, 415 }, { 110, 416 }, { 111, 417 }, { 114, 418 }, { 115, 419 }, { 116, 420 }, 
+	{ 118, 421 }, { 65, 422 }, { 97, 423 }, { 98, 424 }, { 99, 425 }, { 101, 426 }, { 102, 427 }, { 107, 428 }, { 111, 429 }, { 115, 430 }, { 121, 431 }, { 97, 432 }, { 99, 433 }, { 101, 434 }, { 102, 435 }, { 103, 436 }, { 105, 437 }, { 106, 438 }, { 109, 439 }, { 110, 440 }, 
+	{ 111, 441 }, { 112, 442 }, { 113, 443 }, { 115, 444 }, { 116, 445 }, { 117, 446 }, { 99, 447 }, { 102, 448 }, { 109, 449 }, { 111, 450 }, { 115, 451 }, { 117, 452 }, { 97, 453 }, { 99, 454 }, { 102, 455 }, { 103, 456 }, { 104, 457 }, { 106, 458 }, { 111, 459 }, { 115, 460 }, 
+	{ 65, 461 }, { 66, 462 }, { 69, 463 }, { 72, 464 }, { 97, 465 }, { 98, 466 }, { 99, 467 }, { 100, 468 }, { 101, 469 }, { 102, 470 }, { 103, 471 }, { 104, 472 }, { 106, 473 }, { 108, 474 }, { 109, 475 }, { 110, 476 }, { 111, 477 }, { 112, 478 }, { 114, 479 }, { 115, 480 }, 
+	{ 116, 481 }, { 117, 482 }, { 118, 483 }, { 68, 484 }, { 97, 485 }, { 99, 486 }, { 100, 487 }, { 101, 488 }, { 102, 489 }, { 104, 490 }, { 105, 491 }, { 108, 492 }, { 110, 493 }, { 111, 494 }, { 112, 495 }, { 115, 496 }, { 117, 497 }, { 71, 498 }, { 76, 499 }, { 82, 500 }, 
+	{ 86, 501 }, { 97, 502 }, { 98, 503 }, { 99, 504 }, { 100, 505 }, { 101, 506 }, { 102, 507 }, { 103, 508 }, { 104, 509 }, { 105, 510 }, { 106, 511 }, { 108, 512 }, { 109, 513 }, { 111, 514 }, { 112, 515 }, { 114, 516 }, { 115, 517 }, { 116, 518 }, { 117, 519 }, { 118, 520 }, 
+	{ 119, 521 }, { 83, 522 }, { 97, 523 }, { 99, 524 }, { 100, 525 }, { 101, 526 }, { 102, 527 }, { 103, 528 }, { 104, 529 }, { 105, 530 }, { 108, 531 }, { 109, 532 }, { 111, 533 }, { 112, 534 }, { 114, 535 }, { 115, 536 }, { 116, 537 }, { 117, 538 }, { 118, 539 }, { 97, 540 }, 
+	{ 99, 541 }, { 101, 542 }, { 102, 543 }, { 104, 544 }, { 105, 545 }, { 108, 546 }, { 109, 547 }, { 111, 548 }, { 114, 549 }, { 115, 550 }, { 117, 551 }, { 102, 552 }, { 105, 553 }, { 111, 554 }, { 112, 555 }, { 115, 556 }, { 117, 557 }, { 65, 558 }, { 66, 559 }, { 72, 560 }, 
+	{ 97, 561 }, { 98, 562 }, { 99, 563 }, { 100, 564 }, { 101, 565 }, { 102, 566 }, { 104, 567 }, { 105, 568 }, { 108, 569 }, { 109, 570 }, { 110, 571 }, { 111, 572 }, { 112, 573 }, { 114, 574 }, { 115, 575 }, { 116, 576 }, { 117, 577 }, { 120, 578 }, { 97, 579 }, { 98, 580 }, 
+	{ 99, 581 }, { 100, 582 }, { 101, 583 }, { 102, 584 }, { 104, 585 }, { 105, 586 }, { 108, 587 }, { 109, 588 }, { 111, 589 }, { 112, 590 }, { 113, 591 }, { 114, 592 }, { 115, 593 }, { 116, 594 }, { 117, 595 }, { 119, 596 }, { 122, 597 }, { 97, 598 }, { 98, 599 }, { 99, 600 }, 
+	{ 100, 601 }, { 101, 602 }, { 102, 603 }, { 104, 604 }, { 105, 605 }, { 111, 606 }, { 112, 607 }, { 114, 608 }, { 115, 609 }, { 119, 610 }, { 65, 611 }, { 72, 612 }, { 97, 613 }, { 98, 614 }, { 99, 615 }, { 100, 616 }, { 102, 617 }, { 103, 618 }, { 104, 619 }, { 108, 620 }, 
+	{ 109, 621 }, { 111, 622 }, { 112, 623 }, { 114, 624 }, { 115, 625 }, { 116, 626 }, { 117, 627 }, { 119, 628 }, { 65, 629 }, { 66, 630 }, { 68, 631 }, { 97, 632 }, { 99, 633 }, { 100, 634 }, { 101, 635 }, { 102, 636 }, { 108, 637 }, { 110, 638 }, { 111, 639 }, { 112, 640 }, 
+	{ 114, 641 }, { 115, 642 }, { 122, 643 }, { 99, 644 }, { 101, 645 }, { 102, 646 }, { 111, 647 }, { 112, 648 }, { 114, 649 }, { 115, 650 }, { 99, 651 }, { 100, 652 }, { 102, 653 }, { 104, 654 }, { 105, 655 }, { 108, 656 }, { 109, 657 }, { 110, 658 }, { 111, 659 }, { 114, 660 }, 
+	{ 115, 661 }, { 117, 662 }, { 118, 663 }, { 119, 664 }, { 97, 665 }, { 99, 666 }, { 101, 667 }, { 102, 668 }, { 105, 669 }, { 111, 670 }, { 115, 671 }, { 117, 672 }, { 97, 673 }, { 99, 674 }, { 100, 675 }, { 101, 676 }, { 102, 677 }, { 104, 678 }, { 105, 679 }, { 111, 680 }, 
+	{ 115, 681 }, { 119, 682 }, { 108, 683 }, { 80, 684 }, { 99, 685 }, { 114, 686 }, { 105, 687 }, { 121, 688 }, { 114, 689 }, { 114, 690 }, { 112, 691 }, { 97, 692 }, { 100, 693 }, { 103, 694 }, { 112, 695 }, { 112, 696 }, { 105, 697 }, { 99, 698 }, { 115, 699 }, { 105, 700 }, 
+	{ 109, 701 }, { 99, 702 }, { 114, 703 }, { 121, 704 }, { 99, 705 }, { 114, 706 }, { 116, 707 }, { 114, 708 }, { 112, 709 }, { 101, 710 }, { 99, 711 }, { 109, 712 }, { 99, 713 }, { 80, 714 }, { 99, 715 }, { 112, 716 }, { 121, 717 }, { 97, 718 }, { 101, 719 }, { 105, 720 }, 
+	{ 111, 721 }, { 111, 722 }, { 100, 723 }, { 110, 724 }, { 114, 725 }, { 105, 726 }, { 114, 727 }, { 111, 728 }, { 108, 729 }, { 110, 730 }, { 112, 731 }, { 117, 732 }, { 111, 733 }, { 99, 734 }, { 112, 735 }, { 59, 736 }, { 111, 737 }, { 99, 738 }, { 99, 739 }, { 99, 740 }, 
+	{ 103, 741 }, { 114, 742 }, { 115, 743 }, { 97, 744 }, { 121, 745 }, { 108, 746 }, { 114, 747 }, { 97, 748 }, { 102, 749 }, { 112, 750 }, { 116, 751 }, { 117, 752 }, { 119, 753 }, { 99, 754 }, { 116, 755 }, { 71, 756 }, { 72, 757 }, { 99, 758 }, { 97, 759 }, { 105, 760 }, 
+	{ 121, 761 }, { 111, 762 }, { 114, 763 }, { 114, 764 }, { 101, 765 }, { 97, 766 }, { 112, 767 }, { 103, 768 }, { 112, 769 }, { 115, 770 }, { 117, 771 }, { 99, 772 }, { 105, 773 }, { 97, 774 }, { 109, 775 }, { 105, 776 }, { 112, 777 }, { 121, 778 }, { 114, 779 }, { 108, 780 }, 
+	{ 112, 781 }, { 114, 782 }, { 117, 783 }, { 99, 784 }, { 99, 785 }, { 59, 786 }, { 109, 787 }, { 114, 788 }, { 101, 789 }, { 105, 790 }, { 121, 791 }, { 111, 792 }, { 114, 793 }, { 59, 794 }, { 112, 795 }, { 101, 796 }, { 99, 797 }, { 59, 798 }, { 82, 799 }, { 99, 800 }, 
+	{ 116, 801 }, { 105, 802 }, { 114, 803 }, { 108, 804 }, { 112, 805 }, { 114, 806 }, { 99, 807 }, { 116, 808 }, { 109, 809 }, { 99, 810 }, { 108, 811 }, { 99, 812 }, { 99, 813 }, { 105, 814 }, { 121, 815 }, { 111, 816 }, { 114, 817 }, { 114, 818 }, { 59, 819 }, { 97, 820 }, 
+	{ 112, 821 }, { 116, 822 }, { 118, 823 }, { 103, 824 }, { 112, 825 }, { 116, 826 }, { 99, 827 }, { 105, 828 }, { 107, 829 }, { 109, 830 }, { 105, 831 }, { 121, 832 }, { 114, 833 }, { 112, 834 }, { 99, 835 }, { 101, 836 }, { 107, 837 }, { 99, 838 }, { 99, 839 }, { 112, 840 }, 
+	{ 101, 841 }, { 121, 842 }, { 114, 843 }, { 112, 844 }, { 99, 845 }, { 99, 846 }, { 59, 847 }, { 99, 848 }, { 109, 849 }, { 110, 850 }, { 112, 851 }, { 114, 852 }, { 97, 853 }, { 101, 854 }, { 121, 855 }, { 102, 856 }, { 115, 857 }, { 114, 858 }, { 59, 859 }, { 101, 860 }, 
+	{ 105, 861 }, { 110, 862 }, { 112, 863 }, { 119, 864 }, { 99, 865 }, { 104, 866 }, { 116, 867 }, { 59, 868 }, { 112, 869 }, { 121, 870 }, { 100, 871 }, { 108, 872 }, { 114, 873 }, { 110, 874 }, { 112, 875 }, { 99, 876 }, { 59, 877 }, { 99, 878 }, { 99, 879 }, { 97, 880 }, 
+	{ 101, 881 }, { 121, 882 }, { 103, 883 }, { 115, 884 }, { 119, 885 }, { 114, 886 }, { 66, 887 }, { 110, 888 }, { 112, 889 }, { 116, 890 }, { 99, 891 }, { 105, 892 }, { 59, 893 }, { 108, 894 }, { 99, 895 }, { 105, 896 }, { 121, 897 }, { 98, 898 }, { 114, 899 }, { 114, 900 }, 
+	{ 97, 901 }, { 101, 902 }, { 105, 903 }, { 112, 904 }, { 101, 905 }, { 59, 906 }, { 99, 907 }, { 108, 908 }, { 105, 909 }, { 109, 910 }, { 101, 911 }, { 114, 912 }, { 121, 913 }, { 114, 914 }, { 105, 915 }, { 59, 916 }, { 117, 917 }, { 105, 918 }, { 112, 919 }, { 59, 920 }, 
+	{ 101, 921 }, { 105, 922 }, { 111, 923 }, { 99, 924 }, { 105, 925 }, { 79, 926 }, { 114, 927 }, { 112, 928 }, { 99, 929 }, { 97, 930 }, { 71, 931 }, { 99, 932 }, { 110, 933 }, { 114, 934 }, { 97, 935 }, { 101, 936 }, { 121, 937 }, { 59, 938 }, { 118, 939 }, { 114, 940 }, 
+	{ 111, 941 }, { 103, 942 }, { 112, 943 }, { 117, 944 }, { 105, 945 }, { 99, 946 }, { 104, 947 }, { 108, 948 }, { 67, 949 }, { 99, 950 }, { 70, 951 }, { 99, 952 }, { 59, 953 }, { 97, 954 }, { 101, 955 }, { 105, 956 }, { 121, 957 }, { 114, 958 }, { 111, 959 }, { 103, 960 }, 
+	{ 97, 961 }, { 112, 962 }, { 114, 963 }, { 117, 964 }, { 99, 965 }, { 97, 966 }, { 98, 967 }, { 99, 968 }, { 109, 969 }, { 112, 970 }, { 79, 971 }, { 65, 972 }, { 72, 973 }, { 99, 974 }, { 98, 975 }, { 117, 976 }, { 97, 977 }, { 101, 978 }, { 121, 979 }, { 114, 980 }, 
+	{ 101, 981 }, { 105, 982 }, { 108, 983 }, { 112, 984 }, { 105, 985 }, { 99, 986 }, { 116, 987 }, { 99, 988 }, { 114, 989 }, { 114, 990 }, { 105, 991 }, { 121, 992 }, { 98, 993 }, { 114, 994 }, { 114, 995 }, { 97, 996 }, { 100, 997 }, { 105, 998 }, { 103, 999 }, { 112, 1000 }, 
+	{ 65, 1001 }, { 68, 1002 }, { 69, 1003 }, { 84, 1004 }, { 97, 1005 }, { 100, 1006 }, { 112, 1007 }, { 115, 1008 }, { 105, 1009 }, { 99, 1010 }, { 105, 1011 }, { 109, 1012 }, { 97, 1013 }, { 97, 1014 }, { 121, 1015 }, { 97, 1016 }, { 101, 1017 }, { 114, 1018 }, { 114, 1019 }, { 112, 1020 }, 
+	{ 99, 1021 }, { 100, 1022 }, { 105, 1023 }, { 100, 1024 }, { 114, 1025 }, { 112, 1026 }, { 99, 1027 }, { 114, 1028 }, { 59, 1029 }, { 112, 1030 }, { 99, 1031 }, { 99, 1032 }, { 99, 1033 }, { 99, 1034 }, { 99, 1035 }, { 105, 1036 }, { 121, 1037 }, { 114, 1038 }, { 112, 1039 }, { 99, 1040 }, 
+	{ 109, 1041 }, { 99, 1042 }, { 99, 1043 }, { 97, 1044 }, { 121, 1045 }, { 111, 1046 }, { 114, 1047 }, { 116, 1048 }, { 114, 1049 }, { 112, 1050 }, { 99, 1051 }, { 99, 1052 }, { 114, 1053 }, { 59, 1054 }, { 69, 1055 }, { 100, 1056 }, { 105, 1057 }, { 117, 1058 }, { 121, 1059 }, { 108, 1060 }, 
+	{ 59, 1061 }, { 114, 1062 }, { 114, 1063 }, { 101, 1064 }, { 112, 1065 }, { 97, 1066 }, { 112, 1067 }, { 100, 1068 }, { 103, 1069 }, { 103, 1070 }, { 112, 1071 }, { 59, 1072 }, { 69, 1073 }, { 97, 1074 }, { 101, 1075 }, { 105, 1076 }, { 111, 1077 }, { 112, 1078 }, { 105, 1079 }, { 99, 1080 }, 
+	{ 116, 1081 }, { 121, 1082 }, { 105, 1083 }, { 109, 1084 }, { 99, 1085 }, { 105, 1086 }, { 111, 1087 }, { 99, 1088 }, { 114, 1089 }, { 114, 1090 }, { 111, 1091 }, { 121, 1092 }, { 113, 1093 }, { 99, 1094 }, { 109, 1095 }, { 112, 1096 }, { 114, 1097 }, { 116, 1098 }, { 114, 1099 }, { 103, 1100 }, 
+	{ 97, 1101 }, { 97, 1102 }, { 107, 1103 }, { 111, 1104 }, { 101, 1105 }, { 111, 1106 }, { 112, 1107 }, { 116, 1108 }, { 119, 1109 }, { 120, 1110 }, { 114, 1111 }, { 101, 1112 }, { 118, 1113 }, { 99, 1114 }, { 101, 1115 }, { 105, 1116 }, { 111, 1117 }, { 108, 1118 }, { 109, 1119 }, { 99, 1120 }, 
+	{ 112, 1121 }, { 114, 1122 }, { 97, 1123 }, { 101, 1124 }, { 105, 1125 }, { 117, 1126 }, { 111, 1127 }, { 100, 1128 }, { 109, 1129 }, { 110, 1130 }, { 114, 1131 }, { 99, 1132 }, { 101, 1133 }, { 105, 1134 }, { 114, 1135 }, { 117, 1136 }, { 108, 1137 }, { 109, 1138 }, { 110, 1139 }, { 112, 1140 }, 
+	{ 97, 1141 }, { 111, 1142 }, { 99, 1143 }, { 117, 1144 }, { 100, 1145 }, { 100, 1146 }, { 101, 1147 }, { 108, 1148 }, { 112, 1149 }, { 114, 1150 }, { 118, 1151 }, { 119, 1152 }, { 99, 1153 }, { 105, 1154 }, { 108, 1155 }, { 114, 1156 }, { 97, 1157 }, { 103, 1158 }, { 108, 1159 }, { 114, 1160 }, 
+	{ 115, 1161 }, { 107, 1162 }, { 108, 1163 }, { 97, 1164 }, { 121, 1165 }, { 59, 1166 }, { 97, 1167 }, { 111, 1168 }, { 103, 1169 }, { 108, 1170 }, { 109, 1171 }, { 105, 1172 }, { 114, 1173 }, { 97, 1174 }, { 97, 1175 }, { 101, 1176 }, { 103, 1177 }, { 115, 1178 }, { 118, 1179 }, { 99, 1180 }, 
+	{ 99, 1181 }, { 108, 1182 }, { 112, 1183 }, { 116, 1184 }, { 117, 1185 }, { 119, 1186 }, { 98, 1187 }, { 99, 1188 }, { 99, 1189 }, { 111, 1190 }, { 116, 1191 }, { 100, 1192 }, { 114, 1193 }, { 97, 1194 }, { 104, 1195 }, { 97, 1196 }, { 99, 1197 }, { 105, 1198 }, { 68, 1199 }, { 111, 1200 }, 
+	{ 99, 1201 }, { 115, 1202 }, { 97, 1203 }, { 105, 1204 }, { 111, 1205 }, { 121, 1206 }, { 111, 1207 }, { 59, 1208 }, { 68, 1209 }, { 114, 1210 }, { 59, 1211 }, { 114, 1212 }, { 115, 1213 }, { 59, 1214 }, { 105, 1215 }, { 108, 1216 }, { 115, 1217 }, { 97, 1218 }, { 112, 1219 }, { 115, 1220 }, 
+	{ 103, 1221 }, { 115, 1222 }, { 103, 1223 }, { 112, 1224 }, { 97, 1225 }, { 108, 1226 }, { 115, 1227 }, { 99, 1228 }, { 115, 1229 }, { 117, 1230 }, { 118, 1231 }, { 68, 1232 }, { 97, 1233 }, { 99, 1234 }, { 100, 1235 }, { 105, 1236 }, { 97, 1237 }, { 104, 1238 }, { 109, 1239 }, { 114, 1240 }, 
+	{ 99, 1241 }, { 105, 1242 }, { 112, 1243 }, { 108, 1244 }, { 121, 1245 }, { 109, 1246 }, { 105, 1247 }, { 108, 1248 }, { 114, 1249 }, { 108, 1250 }, { 108, 1251 }, { 97, 1252 }, { 108, 1253 }, { 116, 1254 }, { 111, 1255 }, { 112, 1256 }, { 114, 1257 }, { 97, 1258 }, { 97, 1259 }, { 111, 1260 }, 
+	{ 99, 1261 }, { 59, 1262 }, { 108, 1263 }, { 99, 1264 }, { 109, 1265 }, { 112, 1266 }, { 114, 1267 }, { 105, 1268 }, { 121, 1269 }, { 111, 1270 }, { 59, 1271 }, { 108, 1272 }, { 113, 1273 }, { 115, 1274 }, { 114, 1275 }, { 59, 1276 }, { 103, 1277 }, { 109, 1278 }, { 99, 1279 }, { 59, 1280 }, 
+	{ 69, 1281 }, { 97, 1282 }, { 106, 1283 }, { 69, 1284 }, { 97, 1285 }, { 101, 1286 }, { 115, 1287 }, { 112, 1288 }, { 97, 1289 }, { 99, 1290 }, { 105, 1291 }, { 59, 1292 }, { 99, 1293 }, { 100, 1294 }, { 108, 1295 }, { 113, 1296 }, { 114, 1297 }, { 101, 1298 }, { 110, 1299 }, { 114, 1300 }, 
+	{ 105, 1301 }, { 108, 1302 }, { 109, 1303 }, { 114, 1304 }, { 97, 1305 }, { 105, 1306 }, { 97, 1307 }, { 108, 1308 }, { 114, 1309 }, { 114, 1310 }, { 115, 1311 }, { 97, 1312 }, { 109, 1313 }, { 111, 1314 }, { 112, 1315 }, { 114, 1316 }, { 99, 1317 }, { 108, 1318 }, { 116, 1319 }, { 98, 1320 }, 
+	{ 112, 1321 }, { 99, 1322 }, { 59, 1323 }, { 105, 1324 }, { 121, 1325 }, { 99, 1326 }, { 120, 1327 }, { 102, 1328 }, { 114, 1329 }, { 114, 1330 }, { 59, 1331 }, { 105, 1332 }, { 110, 1333 }, { 111, 1334 }, { 108, 1335 }, { 97, 1336 }, { 111, 1337 }, { 112, 1338 }, { 59, 1339 }, { 99, 1340 }, 
+	{ 102, 1341 }, { 111, 1342 }, { 116, 1343 }, { 99, 1344 }, { 103, 1345 }, { 112, 1346 }, { 116, 1347 }, { 114, 1348 }, { 117, 1349 }, { 99, 1350 }, { 105, 1351 }, { 59, 1352 }, { 105, 1353 }, { 107, 1354 }, { 109, 1355 }, { 105, 1356 }, { 121, 1357 }, { 114, 1358 }, { 97, 1359 }, { 112, 1360 }, 
+	{ 99, 1361 }, { 101, 1362 }, { 107, 1363 }, { 112, 1364 }, { 101, 1365 }, { 121, 1366 }, { 114, 1367 }, { 114, 1368 }, { 99, 1369 }, { 99, 1370 }, { 112, 1371 }, { 99, 1372 }, { 97, 1373 }, { 114, 1374 }, { 116, 1375 }, { 97, 1376 }, { 59, 1377 }, { 103, 1378 }, { 97, 1379 }, { 99, 1380 }, 
+	{ 101, 1381 }, { 103, 1382 }, { 109, 1383 }, { 110, 1384 }, { 112, 1385 }, { 113, 1386 }, { 114, 1387 }, { 116, 1388 }, { 97, 1389 }, { 98, 1390 }, { 114, 1391 }, { 97, 1392 }, { 101, 1393 }, { 117, 1394 }, { 121, 1395 }, { 99, 1396 }, { 113, 1397 }, { 114, 1398 }, { 115, 1399 }, { 59, 1400 }, 
+	{ 102, 1401 }, { 103, 1402 }, { 113, 1403 }, { 115, 1404 }, { 105, 1405 }, { 108, 1406 }, { 114, 1407 }, { 59, 1408 }, { 69, 1409 }, { 97, 1410 }, { 98, 1411 }, { 99, 1412 }, { 59, 1413 }, { 97, 1414 }, { 99, 1415 }, { 104, 1416 }, { 116, 1417 }, { 105, 1418 }, { 111, 1419 }, { 69, 1420 }, 
+	{ 97, 1421 }, { 101, 1422 }, { 115, 1423 }, { 97, 1424 }, { 98, 1425 }, { 110, 1426 }, { 111, 1427 }, { 112, 1428 }, { 116, 1429 }, { 119, 1430 }, { 122, 1431 }, { 97, 1432 }, { 97, 1433 }, { 99, 1434 }, { 104, 1435 }, { 109, 1436 }, { 116, 1437 }, { 97, 1438 }, { 99, 1439 }, { 104, 1440 }, 
+	{ 105, 1441 }, { 113, 1442 }, { 116, 1443 }, { 59, 1444 }, { 99, 1445 }, { 100, 1446 }, { 104, 1447 }, { 105, 1448 }, { 108, 1449 }, { 113, 1450 }, { 114, 1451 }, { 114, 1452 }, { 101, 1453 }, { 110, 1454 }, { 68, 1455 }, { 99, 1456 }, { 108, 1457 }, { 112, 1458 }, { 114, 1459 }, { 111, 1460 }, 
+	{ 121, 1461 }, { 97, 1462 }, { 97, 1463 }, { 114, 1464 }, { 111, 1465 }, { 99, 1466 }, { 100, 1467 }, { 110, 1468 }, { 99, 1469 }, { 100, 1470 }, { 112, 1471 }, { 100, 1472 }, { 112, 1473 }, { 59, 1474 }, { 99, 1475 }, { 116, 1476 }, { 59, 1477 }, { 108, 1478 }, { 109, 1479 }, { 103, 1480 }, 
+	{ 116, 1481 }, { 101, 1482 }, { 108, 1483 }, { 116, 1484 }, { 105, 1485 }, { 68, 1486 }, { 100, 1487 }, { 98, 1488 }, { 99, 1489 }, { 110, 1490 }, { 112, 1491 }, { 116, 1492 }, { 115, 1493 }, { 117, 1494 }, { 97, 1495 }, { 101, 1496 }, { 111, 1497 }, { 117, 1498 }, { 121, 1499 }, { 97, 1500 }, 
+	{ 59, 1501 }, { 65, 1502 }, { 97, 1503 }, { 100, 1504 }, { 113, 1505 }, { 115, 1506 }, { 120, 1507 }, { 114, 1508 }, { 69, 1509 }, { 101, 1510 }, { 115, 1511 }, { 116, 1512 }, { 65, 1513 }, { 97, 1514 }, { 112, 1515 }, { 59, 1516 }, { 115, 1517 }, { 118, 1518 }, { 99, 1519 }, { 65, 1520 }, 
+	{ 69, 1521 }, { 97, 1522 }, { 100, 1523 }, { 101, 1524 }, { 115, 1525 }, { 116, 1526 }, { 105, 1527 }, { 112, 1528 }, { 116, 1529 }, { 97, 1530 }, { 111, 1531 }, { 114, 1532 }, { 65, 1533 }, { 97, 1534 }, { 105, 1535 }, { 116, 1536 }, { 99, 1537 }, { 104, 1538 }, { 105, 1539 }, { 109, 1540 }, 
+	{ 112, 1541 }, { 113, 1542 }, { 117, 1543 }, { 103, 1544 }, { 105, 1545 }, { 108, 1546 }, { 114, 1547 }, { 59, 1548 }, { 109, 1549 }, { 68, 1550 }, { 72, 1551 }, { 97, 1552 }, { 100, 1553 }, { 103, 1554 }, { 105, 1555 }, { 108, 1556 }, { 114, 1557 }, { 115, 1558 }, { 65, 1559 }, { 97, 1560 }, 
+	{ 110, 1561 }, { 59, 1562 }, { 99, 1563 }, { 115, 1564 }, { 105, 1565 }, { 121, 1566 }, { 97, 1567 }, { 98, 1568 }, { 105, 1569 }, { 111, 1570 }, { 115, 1571 }, { 108, 1572 }, { 99, 1573 }, { 114, 1574 }, { 111, 1575 }, { 114, 1576 }, { 116, 1577 }, { 98, 1578 }, { 109, 1579 }, { 110, 1580 }, 
+	{ 97, 1581 }, { 99, 1582 }, { 105, 1583 }, { 116, 1584 }, { 97, 1585 }, { 101, 1586 }, { 105, 1587 }, { 112, 1588 }, { 97, 1589 }, { 101, 1590 }, { 108, 1591 }, { 59, 1592 }, { 97, 1593 }, { 100, 1594 }, { 105, 1595 }, { 111, 1596 }, { 115, 1597 }, { 118, 1598 }, { 99, 1599 }, { 108, 1600 }, 
+	{ 111, 1601 }, { 105, 1602 }, { 109, 1603 }, { 98, 1604 }, { 114, 1605 }, { 121, 1606 }, { 114, 1607 }, { 114, 1608 }, { 105, 1609 }, { 109, 1610 }, { 111, 1611 }, { 59, 1612 }, { 116, 1613 }, { 118, 1614 }, { 97, 1615 }, { 117, 1616 }, { 59, 1617 }, { 105, 1618 }, { 112, 1619 }, { 117, 1620 }, 
+	{ 59, 1621 }, { 69, 1622 }, { 97, 1623 }, { 99, 1624 }, { 101, 1625 }, { 105, 1626 }, { 110, 1627 }, { 111, 1628 }, { 115, 1629 }, { 117, 1630 }, { 99, 1631 }, { 105, 1632 }, { 110, 1633 }, { 114, 1634 }, { 110, 1635 }, { 112, 1636 }, { 114, 1637 }, { 99, 1638 }, { 97, 1639 }, { 101, 1640 }, 
+	{ 111, 1641 }, { 97, 1642 }, { 114, 1643 }, { 116, 1644 }, { 97, 1645 }, { 97, 1646 }, { 99, 1647 }, { 100, 1648 }, { 101, 1649 }, { 110, 1650 }, { 113, 1651 }, { 114, 1652 }, { 116, 1653 }, { 97, 1654 }, { 98, 1655 }, { 114, 1656 }, { 97, 1657 }, { 101, 1658 }, { 117, 1659 }, { 121, 1660 }, 
+	{ 99, 1661 }, { 108, 1662 }, { 113, 1663 }, { 115, 1664 }, { 97, 1665 }, { 99, 1666 }, { 103, 1667 }, { 105, 1668 }, { 108, 1669 }, { 114, 1670 }, { 97, 1671 }, { 111, 1672 }, { 103, 1673 }, { 110, 1674 }, { 115, 1675 }, { 97, 1676 }, { 104, 1677 }, { 109, 1678 }, { 111, 1679 }, { 109, 1680 }, 
+	{ 97, 1681 }, { 98, 1682 }, { 112, 1683 }, { 116, 1684 }, { 97, 1685 }, { 112, 1686 }, { 97, 1687 }, { 97, 1688 }, { 99, 1689 }, { 104, 1690 }, { 113, 1691 }, { 104, 1692 }, { 105, 1693 }, { 114, 1694 }, { 108, 1695 }, { 59, 1696 }, { 99, 1697 }, { 113, 1698 }, { 59, 1699 }, { 69, 1700 }, 
+	{ 97, 1701 }, { 99, 1702 }, { 101, 1703 }, { 105, 1704 }, { 110, 1705 }, { 112, 1706 }, { 115, 1707 }, { 121, 1708 }, { 111, 1709 }, { 65, 1710 }, { 97, 1711 }, { 99, 1712 }, { 109, 1713 }, { 115, 1714 }, { 116, 1715 }, { 120, 1716 }, { 114, 1717 }, { 97, 1718 }, { 99, 1719 }, { 111, 1720 }, 
+	{ 121, 1721 }, { 103, 1722 }, { 109, 1723 }, { 97, 1724 }, { 97, 1725 }, { 101, 1726 }, { 105, 1727 }, { 116, 1728 }, { 102, 1729 }, { 108, 1730 }, { 112, 1731 }, { 97, 1732 }, { 99, 1733 }, { 115, 1734 }, { 117, 1735 }, { 97, 1736 }, { 99, 1737 }, { 101, 1738 }, { 109, 1739 }, { 116, 1740 }, 
+	{ 97, 1741 }, { 114, 1742 }, { 98, 1743 }, { 99, 1744 }, { 109, 1745 }, { 110, 1746 }, { 112, 1747 }, { 65, 1748 }, { 97, 1749 }, { 110, 1750 }, { 108, 1751 }, { 114, 1752 }, { 117, 1753 }, { 114, 1754 }, { 97, 1755 }, { 101, 1756 }, { 121, 1757 }, { 111, 1758 }, { 108, 1759 }, { 114, 1760 }, 
+	{ 101, 1761 }, { 105, 1762 }, { 107, 1763 }, { 111, 1764 }, { 108, 1765 }, { 109, 1766 }, { 110, 1767 }, { 101, 1768 }, { 112, 1769 }, { 115, 1770 }, { 114, 1771 }, { 97, 1772 }, { 105, 1773 }, { 112, 1774 }, { 99, 1775 }, { 104, 1776 }, { 116, 1777 }, { 105, 1778 }, { 111, 1779 }, { 114, 1780 }, 
+	{ 97, 1781 }, { 99, 1782 }, { 114, 1783 }, { 114, 1784 }, { 105, 1785 }, { 121, 1786 }, { 97, 1787 }, { 98, 1788 }, { 104, 1789 }, { 105, 1790 }, { 114, 1791 }, { 114, 1792 }, { 97, 1793 }, { 98, 1794 }, { 99, 1795 }, { 116, 1796 }, { 97, 1797 }, { 108, 1798 }, { 103, 1799 }, { 112, 1800 }, 
+	{ 97, 1801 }, { 100, 1802 }, { 104, 1803 }, { 108, 1804 }, { 115, 1805 }, { 117, 1806 }, { 99, 1807 }, { 105, 1808 }, { 116, 1809 }, { 99, 1810 }, { 100, 1811 }, { 105, 1812 }, { 114, 1813 }, { 97, 1814 }, { 109, 1815 }, { 97, 1816 }, { 114, 1817 }, { 97, 1818 }, { 97, 1819 }, { 110, 1820 }, 
+	{ 114, 1821 }, { 121, 1822 }, { 97, 1823 }, { 101, 1824 }, { 108, 1825 }, { 114, 1826 }, { 114, 1827 }, { 116, 1828 }, { 115, 1829 }, { 112, 1830 }, { 114, 1831 }, { 116, 1832 }, { 99, 1833 }, { 117, 1834 }, { 105, 1835 }, { 105, 1836 }, { 100, 1837 }, { 105, 1838 }, { 114, 1839 }, { 112, 1840 }, 
+	{ 59, 1841 }, { 59, 1842 }, { 101, 1843 }, { 99, 1844 }, { 97, 1845 }, { 105, 1846 }, { 117, 1847 }, { 116, 1848 }, { 114, 1849 }, { 65, 1850 }, { 97, 1851 }, { 59, 1852 }, { 65, 1853 }, { 97, 1854 }, { 97, 1855 }, { 105, 1856 }, { 100, 1857 }, { 112, 1858 }, { 116, 1859 }, { 65, 1860 }, 
+	{ 97, 1861 }, { 99, 1862 }, { 113, 1863 }, { 112, 1864 }, { 116, 1865 }, { 101, 1866 }, { 101, 1867 }, { 99, 1868 }, { 105, 1869 }, { 121, 1870 }, { 110, 1871 }, { 114, 1872 }, { 99, 1873 }, { 112, 1874 }, { 99, 1875 }, { 99, 1876 }, { 109, 1877 }, { 99, 1878 }, { 97, 1879 }, { 121, 1880 }, 
+	{ 111, 1881 }, { 101, 1882 }, { 116, 1883 }, { 114, 1884 }, { 99, 1885 }, { 103, 1886 }, { 112, 1887 }, { 99, 1888 }, { 106, 1889 }, { 110, 1890 }, { 105, 1891 }, { 59, 1892 }, { 117, 1893 }, { 101, 1894 }, { 114, 1895 }, { 59, 1896 }, { 59, 1897 }, { 97, 1898 }, { 104, 1899 }, { 99, 1900 }, 
+	{ 59, 1901 }, { 111, 1902 }, { 102, 1903 }, { 108, 1904 }, { 110, 1905 }, { 114, 1906 }, { 105, 1907 }, { 108, 1908 }, { 108, 1909 }, { 107, 1910 }, { 118, 1911 }, { 119, 1912 }, { 59, 1913 }, { 97, 1914 }, { 110, 1915 }, { 97, 1916 }, { 59, 1917 }, { 102, 1918 }, { 118, 1919 }, { 114, 1920 }, 
+	{ 112, 1921 }, { 121, 1922 }, { 89, 1923 }, { 117, 1924 }, { 59, 1925 }, { 105, 1926 }, { 108, 1927 }, { 114, 1928 }, { 100, 1929 }, { 114, 1930 }, { 110, 1931 }, { 116, 1932 }, { 105, 1933 }, { 116, 1934 }, { 59, 1935 }, { 59, 1936 }, { 99, 1937 }, { 99, 1938 }, { 115, 1939 }, { 111, 1940 }, 
+	{ 103, 1941 }, { 105, 1942 }, { 116, 1943 }, { 102, 1944 }, { 114, 1945 }, { 110, 1946 }, { 115, 1947 }, { 114, 1948 }, { 59, 1949 }, { 67, 1950 }, { 116, 1951 }, { 121, 1952 }, { 121, 1953 }, { 121, 1954 }, { 103, 1955 }, { 114, 1956 }, { 104, 1957 }, { 114, 1958 }, { 59, 1959 }, { 59, 1960 }, 
+	{ 116, 1961 }, { 59, 1962 }, { 99, 1963 }, { 109, 1964 }, { 102, 1965 }, { 102, 1966 }, { 59, 1967 }, { 68, 1968 }, { 69, 1969 }, { 98, 1970 }, { 110, 1971 }, { 114, 1972 }, { 114, 1973 }, { 59, 1974 }, { 59, 1975 }, { 117, 1976 }, { 114, 1977 }, { 114, 1978 }, { 59, 1979 }, { 116, 1980 }, 
+	{ 59, 1981 }, { 97, 1982 }, { 109, 1983 }, { 99, 1984 }, { 116, 1985 }, { 111, 1986 }, { 102, 1987 }, { 105, 1988 }, { 97, 1989 }, { 105, 1990 }, { 114, 1991 }, { 109, 1992 }, { 59, 1993 }, { 108, 1994 }, { 115, 1995 }, { 111, 1996 }, { 59, 1997 }, { 59, 1998 }, { 108, 1999 }, { 102, 2000 }, 
+	{ 65, 2001 }, { 114, 2002 }, { 114, 2003 }, { 121, 2004 }, { 109, 2005 }, { 101, 2006 }, { 100, 2007 }, { 114, 2008 }, { 59, 2009 }, { 116, 2010 }, { 59, 2011 }, { 102, 2012 }, { 97, 2013 }, { 114, 2014 }, { 68, 2015 }, { 101, 2016 }, { 59, 2017 }, { 114, 2018 }, { 59, 2019 }, { 98, 2020 }, 
+	{ 102, 2021 }, { 105, 2022 }, { 114, 2023 }, { 114, 2024 }, { 112, 2025 }, { 121, 2026 }, { 105, 2027 }, { 121, 2028 }, { 117, 2029 }, { 114, 2030 }, { 59, 2031 }, { 116, 2032 }, { 59, 2033 }, { 97, 2034 }, { 99, 2035 }, { 103, 2036 }, { 108, 2037 }, { 59, 2038 }, { 101, 2039 }, { 105, 2040 }, 
+	{ 111, 2041 }, { 102, 2042 }, { 97, 2043 }, { 114, 2044 }, { 108, 2045 }, { 99, 2046 }, { 108, 2047 }, { 114, 2048 }, { 59, 2049 }, { 59, 2050 }, { 102, 2051 }, { 114, 2052 }, { 114, 2053 }, { 99, 2054 }, { 121, 2055 }, { 121, 2056 }, { 112, 2057 }, { 100, 2058 }, { 59, 2059 }, { 59, 2060 }, 
+	{ 102, 2061 }, { 114, 2062 }, { 121, 2063 }, { 117, 2064 }, { 98, 2065 }, { 103, 2066 }, { 108, 2067 }, { 114, 2068 }, { 114, 2069 }, { 100, 2070 }, { 59, 2071 }, { 116, 2072 }, { 115, 2073 }, { 59, 2074 }, { 102, 2075 }, { 100, 2076 }, { 103, 2077 }, { 102, 2078 }, { 101, 2079 }, { 114, 2080 }, 
+	{ 59, 2081 }, { 114, 2082 }, { 59, 2083 }, { 59, 2084 }, { 105, 2085 }, { 108, 2086 }, { 59, 2087 }, { 117, 2088 }, { 102, 2089 }, { 114, 2090 }, { 121, 2091 }, { 117, 2092 }, { 114, 2093 }, { 100, 2094 }, { 59, 2095 }, { 97, 2096 }, { 116, 2097 }, { 76, 2098 }, { 59, 2099 }, { 114, 2100 }, 
+	{ 66, 2101 }, { 102, 2102 }, { 59, 2103 }, { 67, 2104 }, { 68, 2105 }, { 69, 2106 }, { 71, 2107 }, { 72, 2108 }, { 76, 2109 }, { 78, 2110 }, { 80, 2111 }, { 82, 2112 }, { 83, 2113 }, { 84, 2114 }, { 86, 2115 }, { 114, 2116 }, { 108, 2117 }, { 105, 2118 }, { 117, 2119 }, { 114, 2120 }, 
+	{ 59, 2121 }, { 108, 2122 }, { 59, 2123 }, { 97, 2124 }, { 99, 2125 }, { 103, 2126 }, { 99, 2127 }, { 102, 2128 }, { 110, 2129 }, { 114, 2130 }, { 97, 2131 }, { 108, 2132 }, { 109, 2133 }, { 108, 2134 }, { 114, 2135 }, { 116, 2136 }, { 59, 2137 }, { 59, 2138 }, { 59, 2139 }, { 115, 2140 }, 
+	{ 110, 2141 }, { 102, 2142 }, { 99, 2143 }, { 109, 2144 }, { 100, 2145 }, { 112, 2146 }, { 114, 2147 }, { 59, 2148 }, { 84, 2149 }, { 59, 2150 }, { 102, 2151 }, { 114, 2152 }, { 114, 2153 }, { 59, 2154 }, { 117, 2155 }, { 103, 2156 }, { 114, 2157 }, { 114, 2158 }, { 100, 2159 }, { 59, 2160 }, 
+	{ 101, 2161 }, { 59, 2162 }, { 59, 2163 }, { 104, 2164 }, { 102, 2165 }, { 110, 2166 }, { 103, 2167 }, { 114, 2168 }, { 59, 2169 }, { 101, 2170 }, { 72, 2171 }, { 121, 2172 }, { 84, 2173 }, { 117, 2174 }, { 114, 2175 }, { 100, 2176 }, { 114, 2177 }, { 59, 2178 }, { 59, 2179 }, { 114, 2180 }, 
+	{ 109, 2181 }, { 108, 2182 }, { 102, 2183 }, { 116, 2184 }, { 97, 2185 }, { 114, 2186 }, { 114, 2187 }, { 59, 2188 }, { 115, 2189 }, { 99, 2190 }, { 104, 2191 }, { 59, 2192 }, { 59, 2193 }, { 101, 2194 }, { 115, 2195 }, { 82, 2196 }, { 68, 2197 }, { 99, 2198 }, { 121, 2199 }, { 59, 2200 }, 
+	{ 59, 2201 }, { 114, 2202 }, { 100, 2203 }, { 59, 2204 }, { 59, 2205 }, { 114, 2206 }, { 116, 2207 }, { 99, 2208 }, { 110, 2209 }, { 100, 2210 }, { 102, 2211 }, { 112, 2212 }, { 114, 2213 }, { 114, 2214 }, { 117, 2215 }, { 114, 2216 }, { 99, 2217 }, { 101, 2218 }, { 114, 2219 }, { 59, 2220 }, 
+	{ 108, 2221 }, { 59, 2222 }, { 97, 2223 }, { 99, 2224 }, { 101, 2225 }, { 111, 2226 }, { 111, 2227 }, { 102, 2228 }, { 114, 2229 }, { 111, 2230 }, { 113, 2231 }, { 101, 2232 }, { 114, 2233 }, { 111, 2234 }, { 101, 2235 }, { 105, 2236 }, { 110, 2237 }, { 114, 2238 }, { 108, 2239 }, { 108, 2240 }, 
+	{ 115, 2241 }, { 114, 2242 }, { 59, 2243 }, { 115, 2244 }, { 59, 2245 }, { 98, 2246 }, { 116, 2247 }, { 121, 2248 }, { 59, 2249 }, { 102, 2250 }, { 114, 2251 }, { 97, 2252 }, { 114, 2253 }, { 103, 2254 }, { 59, 2255 }, { 102, 2256 }, { 114, 2257 }, { 59, 2258 }, { 102, 2259 }, { 114, 2260 }, 
+	{ 121, 2261 }, { 121, 2262 }, { 121, 2263 }, { 117, 2264 }, { 114, 2265 }, { 59, 2266 }, { 59, 2267 }, { 102, 2268 }, { 114, 2269 }, { 108, 2270 }, { 121, 2271 }, { 117, 2272 }, { 114, 2273 }, { 59, 2274 }, { 116, 2275 }, { 111, 2276 }, { 97, 2277 }, { 59, 2278 }, { 102, 2279 }, { 114, 2280 }, 
+	{ 117, 2281 }, { 101, 2282 }, { 59, 2283 }, { 59, 2284 }, { 114, 2285 }, { 116, 2286 }, { 59, 2287 }, { 105, 2288 }, { 59, 2289 }, { 97, 2290 }, { 102, 2291 }, { 112, 2292 }, { 104, 2293 }, { 99, 2294 }, { 108, 2295 }, { 59, 2296 }, { 59, 2297 }, { 97, 2298 }, { 100, 2299 }, { 115, 2300 }, 
+	{ 118, 2301 }, { 59, 2302 }, { 101, 2303 }, { 108, 2304 }, { 109, 2305 }, { 114, 2306 }, { 115, 2307 }, { 122, 2308 }, { 111, 2309 }, { 102, 2310 }, { 59, 2311 }, { 99, 2312 }, { 59, 2313 }, { 100, 2314 }, { 115, 2315 }, { 114, 2316 }, { 110, 2317 }, { 114, 2318 }, { 59, 2319 }, { 109, 2320 }, 
+	{ 108, 2321 }, { 108, 2322 }, { 111, 2323 }, { 110, 2324 }, { 116, 2325 }, { 107, 2326 }, { 118, 2327 }, { 119, 2328 }, { 107, 2329 }, { 110, 2330 }, { 59, 2331 }, { 117, 2332 }, { 97, 2333 }, { 112, 2334 }, { 115, 2335 }, { 110, 2336 }, { 97, 2337 }, { 104, 2338 }, { 119, 2339 }, { 59, 2340 }, 
+	{ 99, 2341 }, { 111, 2342 }, { 115, 2343 }, { 116, 2344 }, { 117, 2345 }, { 118, 2346 }, { 119, 2347 }, { 114, 2348 }, { 99, 2349 }, { 110, 2350 }, { 49, 2351 }, { 51, 2352 }, { 99, 2353 }, { 59, 2354 }, { 113, 2355 }, { 116, 2356 }, { 102, 2357 }, { 59, 2358 }, { 116, 2359 }, { 116, 2360 }, 
+	{ 68, 2361 }, { 72, 2362 }, { 85, 2363 }, { 86, 2364 }, { 98, 2365 }, { 100, 2366 }, { 104, 2367 }, { 109, 2368 }, { 112, 2369 }, { 116, 2370 }, { 117, 2371 }, { 118, 2372 }, { 105, 2373 }, { 118, 2374 }, { 98, 2375 }, { 114, 2376 }, { 109, 2377 }, { 109, 2378 }, { 108, 2379 }, { 108, 2380 }, 
+	{ 112, 2381 }, { 117, 2382 }, { 59, 2383 }, { 97, 2384 }, { 98, 2385 }, { 99, 2386 }, { 100, 2387 }, { 115, 2388 }, { 101, 2389 }, { 111, 2390 }, { 112, 2391 }, { 114, 2392 }, { 100, 2393 }, { 114, 2394 }, { 112, 2395 }, { 116, 2396 }, { 105, 2397 }, { 112, 2398 }, { 116, 2399 }, { 59, 2400 }, 
+	{ 121, 2401 }, { 99, 2402 }, { 59, 2403 }, { 59, 2404 }, { 69, 2405 }, { 99, 2406 }, { 101, 2407 }, { 102, 2408 }, { 109, 2409 }, { 115, 2410 }, { 98, 2411 }, { 111, 2412 }, { 109, 2413 }, { 112, 2414 }, { 103, 2415 }, { 105, 2416 }, { 102, 2417 }, { 114, 2418 }, { 121, 2419 }, { 114, 2420 }, 
+	{ 115, 2421 }, { 114, 2422 }, { 98, 2423 }, { 112, 2424 }, { 111, 2425 }, { 97, 2426 }, { 112, 2427 }, { 115, 2428 }, { 97, 2429 }, { 59, 2430 }, { 98, 2431 }, { 99, 2432 }, { 100, 2433 }, { 111, 2434 }, { 115, 2435 }, { 97, 2436 }, { 108, 2437 }, { 114, 2438 }, { 118, 2439 }, { 101, 2440 }, 
+	{ 101, 2441 }, { 111, 2442 }, { 110, 2443 }, { 99, 2444 }, { 114, 2445 }, { 114, 2446 }, { 103, 2447 }, { 101, 2448 }, { 114, 2449 }, { 104, 2450 }, { 97, 2451 }, { 97, 2452 }, { 114, 2453 }, { 59, 2454 }, { 103, 2455 }, { 114, 2456 }, { 116, 2457 }, { 59, 2458 }, { 116, 2459 }, { 112, 2460 }, 
+	{ 115, 2461 }, { 59, 2462 }, { 114, 2463 }, { 109, 2464 }, { 59, 2465 }, { 97, 2466 }, { 105, 2467 }, { 59, 2468 }, { 105, 2469 }, { 111, 2470 }, { 121, 2471 }, { 111, 2472 }, { 114, 2473 }, { 108, 2474 }, { 102, 2475 }, { 59, 2476 }, { 101, 2477 }, { 109, 2478 }, { 112, 2479 }, { 115, 2480 }, 
+	{ 98, 2481 }, { 110, 2482 }, { 107, 2483 }, { 111, 2484 }, { 114, 2485 }, { 114, 2486 }, { 121, 2487 }, { 108, 2488 }, { 114, 2489 }, { 111, 2490 }, { 105, 2491 }, { 114, 2492 }, { 97, 2493 }, { 110, 2494 }, { 121, 2495 }, { 103, 2496 }, { 111, 2497 }, { 116, 2498 }, { 117, 2499 }, { 116, 2500 }, 
+	{ 114, 2501 }, { 114, 2502 }, { 108, 2503 }, { 59, 2504 }, { 116, 2505 }, { 111, 2506 }, { 59, 2507 }, { 97, 2508 }, { 59, 2509 }, { 100, 2510 }, { 110, 2511 }, { 59, 2512 }, { 59, 2513 }, { 100, 2514 }, { 99, 2515 }, { 116, 2516 }, { 112, 2517 }, { 59, 2518 }, { 112, 2519 }, { 111, 2520 }, 
+	{ 102, 2521 }, { 114, 2522 }, { 117, 2523 }, { 105, 2524 }, { 105, 2525 }, { 111, 2526 }, { 105, 2527 }, { 108, 2528 }, { 97, 2529 }, { 101, 2530 }, { 105, 2531 }, { 112, 2532 }, { 111, 2533 }, { 114, 2534 }, { 114, 2535 }, { 111, 2536 }, { 109, 2537 }, { 59, 2538 }, { 59, 2539 }, { 108, 2540 }, 
+	{ 111, 2541 }, { 108, 2542 }, { 115, 2543 }, { 101, 2544 }, { 111, 2545 }, { 108, 2546 }, { 59, 2547 }, { 97, 2548 }, { 108, 2549 }, { 105, 2550 }, { 108, 2551 }, { 59, 2552 }, { 105, 2553 }, { 105, 2554 }, { 116, 2555 }, { 105, 2556 }, { 110, 2557 }, { 102, 2558 }, { 102, 2559 }, { 97, 2560 }, 
+	{ 107, 2561 }, { 114, 2562 }, { 99, 2563 }, { 115, 2564 }, { 119, 2565 }, { 114, 2566 }, { 59, 2567 }, { 117, 2568 }, { 109, 2569 }, { 59, 2570 }, { 101, 2571 }, { 114, 2572 }, { 59, 2573 }, { 116, 2574 }, { 59, 2575 }, { 59, 2576 }, { 113, 2577 }, { 115, 2578 }, { 59, 2579 }, { 99, 2580 }, 
+	{ 100, 2581 }, { 108, 2582 }, { 59, 2583 }, { 59, 2584 }, { 101, 2585 }, { 121, 2586 }, { 59, 2587 }, { 59, 2588 }, { 59, 2589 }, { 59, 2590 }, { 112, 2591 }, { 59, 2592 }, { 113, 2593 }, { 105, 2594 }, { 102, 2595 }, { 118, 2596 }, { 114, 2597 }, { 109, 2598 }, { 99, 2599 }, { 105, 2600 }, 
+	{ 111, 2601 }, { 80, 2602 }, { 117, 2603 }, { 97, 2604 }, { 100, 2605 }, { 101, 2606 }, { 108, 2607 }, { 115, 2608 }, { 114, 2609 }, { 69, 2610 }, { 114, 2611 }, { 114, 2612 }, { 102, 2613 }, { 105, 2614 }, { 100, 2615 }, { 114, 2616 }, { 114, 2617 }, { 114, 2618 }, { 114, 2619 }, { 108, 2620 }, 
+	{ 99, 2621 }, { 59, 2622 }, { 101, 2623 }, { 119, 2624 }, { 114, 2625 }, { 116, 2626 }, { 107, 2627 }, { 102, 2628 }, { 98, 2629 }, { 114, 2630 }, { 97, 2631 }, { 114, 2632 }, { 117, 2633 }, { 104, 2634 }, { 117, 2635 }, { 114, 2636 }, { 59, 2637 }, { 121, 2638 }, { 99, 2639 }, { 59, 2640 }, 
+	{ 59, 2641 }, { 97, 2642 }, { 105, 2643 }, { 110, 2644 }, { 102, 2645 }, { 116, 2646 }, { 105, 2647 }, { 99, 2648 }, { 103, 2649 }, { 116, 2650 }, { 102, 2651 }, { 101, 2652 }, { 97, 2653 }, { 105, 2654 }, { 100, 2655 }, { 59, 2656 }, { 99, 2657 }, { 101, 2658 }, { 108, 2659 }, { 112, 2660 }, 
+	{ 121, 2661 }, { 111, 2662 }, { 102, 2663 }, { 97, 2664 }, { 111, 2665 }, { 101, 2666 }, { 114, 2667 }, { 110, 2668 }, { 108, 2669 }, { 99, 2670 }, { 108, 2671 }, { 114, 2672 }, { 59, 2673 }, { 59, 2674 }, { 116, 2675 }, { 102, 2676 }, { 114, 2677 }, { 114, 2678 }, { 99, 2679 }, { 112, 2680 }, 
+	{ 100, 2681 }, { 59, 2682 }, { 59, 2683 }, { 101, 2684 }, { 121, 2685 }, { 121, 2686 }, { 102, 2687 }, { 114, 2688 }, { 114, 2689 }, { 114, 2690 }, { 97, 2691 }, { 114, 2692 }, { 59, 2693 }, { 114, 2694 }, { 117, 2695 }, { 109, 2696 }, { 114, 2697 }, { 98, 2698 }, { 103, 2699 }, { 59, 2700 }, 
+	{ 117, 2701 }, { 114, 2702 }, { 59, 2703 }, { 97, 2704 }, { 101, 2705 }, { 114, 2706 }, { 114, 2707 }, { 97, 2708 }, { 107, 2709 }, { 114, 2710 }, { 100, 2711 }, { 105, 2712 }, { 98, 2713 }, { 59, 2714 }, { 97, 2715 }, { 117, 2716 }, { 100, 2717 }, { 117, 2718 }, { 104, 2719 }, { 116, 2720 }, 
+	{ 59, 2721 }, { 59, 2722 }, { 113, 2723 }, { 115, 2724 }, { 59, 2725 }, { 99, 2726 }, { 100, 2727 }, { 103, 2728 }, { 115, 2729 }, { 115, 2730 }, { 111, 2731 }, { 59, 2732 }, { 59, 2733 }, { 114, 2734 }, { 108, 2735 }, { 121, 2736 }, { 114, 2737 }, { 111, 2738 }, { 97, 2739 }, { 114, 2740 }, 
+	{ 100, 2741 }, { 117, 2742 }, { 59, 2743 }, { 112, 2744 }, { 59, 2745 }, { 113, 2746 }, { 105, 2747 }, { 110, 2748 }, { 114, 2749 }, { 114, 2750 }, { 103, 2751 }, { 112, 2752 }, { 97, 2753 }, { 102, 2754 }, { 108, 2755 }, { 105, 2756 }, { 97, 2757 }, { 98, 2758 }, { 59, 2759 }, { 101, 2760 }, 
+	{ 102, 2761 }, { 114, 2762 }, { 114, 2763 }, { 111, 2764 }, { 97, 2765 }, { 59, 2766 }, { 114, 2767 }, { 113, 2768 }, { 114, 2769 }, { 59, 2770 }, { 109, 2771 }, { 98, 2772 }, { 117, 2773 }, { 114, 2774 }, { 99, 2775 }, { 105, 2776 }, { 111, 2777 }, { 114, 2778 }, { 109, 2779 }, { 97, 2780 }, 
+	{ 117, 2781 }, { 80, 2782 }, { 105, 2783 }, { 100, 2784 }, { 117, 2785 }, { 114, 2786 }, { 69, 2787 }, { 111, 2788 }, { 114, 2789 }, { 101, 2790 }, { 116, 2791 }, { 59, 2792 }, { 115, 2793 }, { 107, 2794 }, { 109, 2795 }, { 59, 2796 }, { 115, 2797 }, { 115, 2798 }, { 59, 2799 }, { 59, 2800 }, 
+	{ 114, 2801 }, { 59, 2802 }, { 97, 2803 }, { 99, 2804 }, { 100, 2805 }, { 117, 2806 }, { 112, 2807 }, { 114, 2808 }, { 108, 2809 }, { 101, 2810 }, { 102, 2811 }, { 114, 2812 }, { 112, 2813 }, { 116, 2814 }, { 97, 2815 }, { 59, 2816 }, { 59, 2817 }, { 118, 2818 }, { 102, 2819 }, { 59, 2820 }, 
+	{ 59, 2821 }, { 118, 2822 }, { 103, 2823 }, { 97, 2824 }, { 97, 2825 }, { 108, 2826 }, { 117, 2827 }, { 103, 2828 }, { 59, 2829 }, { 69, 2830 }, { 105, 2831 }, { 111, 2832 }, { 112, 2833 }, { 117, 2834 }, { 112, 2835 }, { 109, 2836 }, { 112, 2837 }, { 114, 2838 }, { 100, 2839 }, { 110, 2840 }, 
+	{ 112, 2841 }, { 59, 2842 }, { 115, 2843 }, { 114, 2844 }, { 114, 2845 }, { 111, 2846 }, { 117, 2847 }, { 101, 2848 }, { 105, 2849 }, { 105, 2850 }, { 59, 2851 }, { 59, 2852 }, { 59, 2853 }, { 113, 2854 }, { 115, 2855 }, { 105, 2856 }, { 59, 2857 }, { 114, 2858 }, { 114, 2859 }, { 114, 2860 }, 
+	{ 97, 2861 }, { 59, 2862 }, { 100, 2863 }, { 59, 2864 }, { 121, 2865 }, { 114, 2866 }, { 59, 2867 }, { 114, 2868 }, { 114, 2869 }, { 59, 2870 }, { 102, 2871 }, { 113, 2872 }, { 115, 2873 }, { 105, 2874 }, { 59, 2875 }, { 114, 2876 }, { 100, 2877 }, { 102, 2878 }, { 59, 2879 }, { 105, 2880 }, 
+	{ 110, 2881 }, { 114, 2882 }, { 108, 2883 }, { 59, 2884 }, { 99, 2885 }, { 101, 2886 }, { 114, 2887 }, { 114, 2888 }, { 103, 2889 }, { 114, 2890 }, { 59, 2891 }, { 99, 2892 }, { 101, 2893 }, { 114, 2894 }, { 111, 2895 }, { 109, 2896 }, { 105, 2897 }, { 97, 2898 }, { 115, 2899 }, { 98, 2900 }, 
+	{ 99, 2901 }, { 112, 2902 }, { 108, 2903 }, { 108, 2904 }, { 103, 2905 }, { 105, 2906 }, { 59, 2907 }, { 101, 2908 }, { 115, 2909 }, { 97, 2910 }, { 97, 2911 }, { 112, 2912 }, { 97, 2913 }, { 101, 2914 }, { 116, 2915 }, { 110, 2916 }, { 65, 2917 }, { 101, 2918 }, { 116, 2919 }, { 65, 2920 }, 
+	{ 116, 2921 }, { 105, 2922 }, { 114, 2923 }, { 114, 2924 }, { 101, 2925 }, { 117, 2926 }, { 116, 2927 }, { 114, 2928 }, { 59, 2929 }, { 115, 2930 }, { 108, 2931 }, { 118, 2932 }, { 116, 2933 }, { 111, 2934 }, { 105, 2935 }, { 105, 2936 }, { 59, 2937 }, { 110, 2938 }, { 97, 2939 }, { 59, 2940 }, 
+	{ 97, 2941 }, { 59, 2942 }, { 116, 2943 }, { 114, 2944 }, { 105, 2945 }, { 114, 2946 }, { 110, 2947 }, { 59, 2948 }, { 99, 2949 }, { 103, 2950 }, { 99, 2951 }, { 100, 2952 }, { 110, 2953 }, { 102, 2954 }, { 114, 2955 }, { 114, 2956 }, { 117, 2957 }, { 114, 2958 }, { 59, 2959 }, { 101, 2960 }, 
+	{ 102, 2961 }, { 109, 2962 }, { 103, 2963 }, { 114, 2964 }, { 108, 2965 }, { 59, 2966 }, { 114, 2967 }, { 97, 2968 }, { 108, 2969 }, { 108, 2970 }, { 109, 2971 }, { 108, 2972 }, { 97, 2973 }, { 59, 2974 }, { 97, 2975 }, { 115, 2976 }, { 116, 2977 }, { 59, 2978 }, { 99, 2979 }, { 105, 2980 }, 
+	{ 109, 2981 }, { 112, 2982 }, { 116, 2983 }, { 59, 2984 }, { 59, 2985 }, { 118, 2986 }, { 109, 2987 }, { 110, 2988 }, { 99, 2989 }, { 59, 2990 }, { 110, 2991 }, { 115, 2992 }, { 110, 2993 }, { 102, 2994 }, { 110, 2995 }, { 59, 2996 }, { 112, 2997 }, { 117, 2998 }, { 59, 2999 }, { 99, 3000 }, 
+	{ 109, 3001 }, { 69, 3002 }, { 97, 3003 }, { 115, 3004 }, { 100, 3005 }, { 102, 3006 }, { 112, 3007 }, { 105, 3008 }, { 114, 3009 }, { 114, 3010 }, { 59, 3011 }, { 99, 3012 }, { 59, 3013 }, { 116, 3014 }, { 102, 3015 }, { 105, 3016 }, { 114, 3017 }, { 116, 3018 }, { 115, 3019 }, { 116, 3020 }, 
+	{ 114, 3021 }, { 114, 3022 }, { 97, 3023 }, { 114, 3024 }, { 114, 3025 }, { 101, 3026 }, { 117, 3027 }, { 105, 3028 }, { 109, 3029 }, { 103, 3030 }, { 117, 3031 }, { 114, 3032 }, { 97, 3033 }, { 105, 3034 }, { 114, 3035 }, { 114, 3036 }, { 97, 3037 }, { 107, 3038 }, { 114, 3039 }, { 100, 3040 }, 
+	{ 105, 3041 }, { 98, 3042 }, { 59, 3043 }, { 97, 3044 }, { 100, 3045 }, { 117, 3046 }, { 104, 3047 }, { 108, 3048 }, { 116, 3049 }, { 59, 3050 }, { 115, 3051 }, { 111, 3052 }, { 59, 3053 }, { 114, 3054 }, { 59, 3055 }, { 118, 3056 }, { 104, 3057 }, { 103, 3058 }, { 105, 3059 }, { 114, 3060 }, 
+	{ 97, 3061 }, { 59, 3062 }, { 117, 3063 }, { 105, 3064 }, { 110, 3065 }, { 114, 3066 }, { 114, 3067 }, { 97, 3068 }, { 102, 3069 }, { 108, 3070 }, { 105, 3071 }, { 114, 3072 }, { 111, 3073 }, { 114, 3074 }, { 113, 3075 }, { 114, 3076 }, { 59, 3077 }, { 98, 3078 }, { 117, 3079 }, { 114, 3080 }, 
+	{ 109, 3081 }, { 105, 3082 }, { 117, 3083 }, { 117, 3084 }, { 117, 3085 }, { 59, 3086 }, { 112, 3087 }, { 114, 3088 }, { 117, 3089 }, { 59, 3090 }, { 100, 3091 }, { 114, 3092 }, { 69, 3093 }, { 97, 3094 }, { 115, 3095 }, { 111, 3096 }, { 105, 3097 }, { 59, 3098 }, { 116, 3099 }, { 114, 3100 }, 
+	{ 114, 3101 }, { 116, 3102 }, { 105, 3103 }, { 119, 3104 }, { 109, 3105 }, { 116, 3106 }, { 59, 3107 }, { 111, 3108 }, { 114, 3109 }, { 104, 3110 }, { 121, 3111 }, { 114, 3112 }, { 59, 3113 }, { 109, 3114 }, { 59, 3115 }, { 100, 3116 }, { 101, 3117 }, { 103, 3118 }, { 108, 3119 }, { 110, 3120 }, 
+	{ 112, 3121 }, { 114, 3122 }, { 114, 3123 }, { 108, 3124 }, { 115, 3125 }, { 112, 3126 }, { 100, 3127 }, { 108, 3128 }, { 59, 3129 }, { 101, 3130 }, { 116, 3131 }, { 59, 3132 }, { 98, 3133 }, { 102, 3134 }, { 100, 3135 }, { 114, 3136 }, { 97, 3137 }, { 117, 3138 }, { 117, 3139 }, { 59, 3140 }, 
+	{ 97, 3141 }, { 102, 3142 }, { 114, 3143 }, { 114, 3144 }, { 116, 3145 }, { 105, 3146 }, { 97, 3147 }, { 114, 3148 }, { 97, 3149 }, { 110, 3150 }, { 59, 3151 }, { 69, 3152 }, { 100, 3153 }, { 101, 3154 }, { 109, 3155 }, { 110, 3156 }, { 112, 3157 }, { 114, 3158 }, { 115, 3159 }, { 99, 3160 }, 
+	{ 59, 3161 }, { 103, 3162 }, { 49, 3163 }, { 50, 3164 }, { 51, 3165 }, { 59, 3166 }, { 69, 3167 }, { 100, 3168 }, { 101, 3169 }, { 104, 3170 }, { 108, 3171 }, { 109, 3172 }, { 110, 3173 }, { 112, 3174 }, { 115, 3175 }, { 114, 3176 }, { 114, 3177 }, { 119, 3178 }, { 105, 3179 }, { 103, 3180 }, 
+	{ 59, 3181 }, { 107, 3182 }, { 114, 3183 }, { 100, 3184 }, { 59, 3185 }, { 116, 3186 }, { 114, 3187 }, { 59, 3188 }, { 114, 3189 }, { 116, 3190 }, { 99, 3191 }, { 110, 3192 }, { 97, 3193 }, { 115, 3194 }, { 114, 3195 }, { 100, 3196 }, { 101, 3197 }, { 116, 3198 }, { 97, 3199 }, { 59, 3200 }, 
+	{ 98, 3201 }, { 99, 3202 }, { 102, 3203 }, { 97, 3204 }, { 105, 3205 }, { 100, 3206 }, { 97, 3207 }, { 100, 3208 }, { 101, 3209 }, { 109, 3210 }, { 112, 3211 }, { 115, 3212 }, { 116, 3213 }, { 101, 3214 }, { 114, 3215 }, { 121, 3216 }, { 99, 3217 }, { 114, 3218 }, { 120, 3219 }, { 104, 3220 }, 
+	{ 114, 3221 }, { 114, 3222 }, { 117, 3223 }, { 114, 3224 }, { 99, 3225 }, { 101, 3226 }, { 114, 3227 }, { 59, 3228 }, { 114, 3229 }, { 108, 3230 }, { 97, 3231 }, { 115, 3232 }, { 59, 3233 }, { 97, 3234 }, { 114, 3235 }, { 108, 3236 }, { 111, 3237 }, { 114, 3238 }, { 114, 3239 }, { 99, 3240 }, 
+	{ 59, 3241 }, { 111, 3242 }, { 102, 3243 }, { 114, 3244 }, { 111, 3245 }, { 97, 3246 }, { 117, 3247 }, { 105, 3248 }, { 112, 3249 }, { 111, 3250 }, { 114, 3251 }, { 110, 3252 }, { 114, 3253 }, { 114, 3254 }, { 111, 3255 }, { 108, 3256 }, { 105, 3257 }, { 114, 3258 }, { 108, 3259 }, { 110, 3260 }, 
+	{ 114, 3261 }, { 114, 3262 }, { 115, 3263 }, { 103, 3264 }, { 101, 3265 }, { 107, 3266 }, { 110, 3267 }, { 112, 3268 }, { 114, 3269 }, { 115, 3270 }, { 116, 3271 }, { 59, 3272 }, { 115, 3273 }, { 59, 3274 }, { 98, 3275 }, { 101, 3276 }, { 108, 3277 }, { 98, 3278 }, { 116, 3279 }, { 59, 3280 }, 
+	{ 114, 3281 }, { 117, 3282 }, { 102, 3283 }, { 111, 3284 }, { 114, 3285 }, { 114, 3286 }, { 98, 3287 }, { 112, 3288 }, { 103, 3289 }, { 114, 3290 }, { 98, 3291 }, { 103, 3292 }, { 101, 3293 }, { 59, 3294 }, { 102, 3295 }, { 97, 3296 }, { 114, 3297 }, { 112, 3298 }, { 114, 3299 }, { 112, 3300 }, 
+	{ 114, 3301 }, { 59, 3302 }, { 114, 3303 }, { 114, 3304 }, { 114, 3305 }, { 114, 3306 }, { 112, 3307 }, { 115, 3308 }, { 111, 3309 }, { 102, 3310 }, { 108, 3311 }, { 105, 3312 }, { 114, 3313 }, { 114, 3314 }, { 114, 3315 }, { 99, 3316 }, { 108, 3317 }, { 114, 3318 }, { 101, 3319 }, { 100, 3320 }, 
+	{ 117, 3321 }, { 121, 3322 }, { 114, 3323 }, { 59, 3324 }, { 59, 3325 }, { 59, 3326 }, { 121, 3327 }, { 102, 3328 }, { 114, 3329 }, { 121, 3330 }, { 108, 3331 }, { 117, 3332 }, { 114, 3333 }, { 59, 3334 }, { 116, 3335 }, { 116, 3336 }, { 97, 3337 }, { 59, 3338 }, { 121, 3339 }, { 114, 3340 }, 
+	{ 102, 3341 }, { 114, 3342 }, { 59, 3343 }, { 106, 3344 }, { 103, 3345 }, { 116, 3346 }, { 118, 3347 }, { 99, 3348 }, { 118, 3349 }, { 97, 3350 }, { 114, 3351 }, { 110, 3352 }, { 59, 3353 }, { 121, 3354 }, { 103, 3355 }, { 59, 3356 }, { 103, 3357 }, { 100, 3358 }, { 59, 3359 }, { 115, 3360 }, 
+	{ 59, 3361 }, { 101, 3362 }, { 117, 3363 }, { 111, 3364 }, { 59, 3365 }, { 59, 3366 }, { 101, 3367 }, { 59, 3368 }, { 101, 3369 }, { 59, 3370 }, { 59, 3371 }, { 116, 3372 }, { 116, 3373 }, { 101, 3374 }, { 111, 3375 }, { 105, 3376 }, { 99, 3377 }, { 105, 3378 }, { 59, 3379 }, { 108, 3380 }, 
+	{ 101, 3381 }, { 108, 3382 }, { 107, 3383 }, { 101, 3384 }, { 110, 3385 }, { 114, 3386 }, { 110, 3387 }, { 111, 3388 }, { 59, 3389 }, { 111, 3390 }, { 116, 3391 }, { 115, 3392 }, { 59, 3393 }, { 97, 3394 }, { 114, 3395 }, { 59, 3396 }, { 59, 3397 }, { 59, 3398 }, { 101, 3399 }, { 59, 3400 }, 
+	{ 118, 3401 }, { 111, 3402 }, { 97, 3403 }, { 114, 3404 }, { 111, 3405 }, { 101, 3406 }, { 59, 3407 }, { 111, 3408 }, { 113, 3409 }, { 108, 3410 }, { 65, 3411 }, { 66, 3412 }, { 76, 3413 }, { 82, 3414 }, { 84, 3415 }, { 97, 3416 }, { 59, 3417 }, { 111, 3418 }, { 116, 3419 }, { 111, 3420 }, 
+	{ 99, 3421 }, { 59, 3422 }, { 118, 3423 }, { 101, 3424 }, { 114, 3425 }, { 121, 3426 }, { 110, 3427 }, { 59, 3428 }, { 108, 3429 }, { 108, 3430 }, { 108, 3431 }, { 59, 3432 }, { 59, 3433 }, { 59, 3434 }, { 116, 3435 }, { 110, 3436 }, { 101, 3437 }, { 59, 3438 }, { 108, 3439 }, { 105, 3440 }, 
+	{ 59, 3441 }, { 59, 3442 }, { 97, 3443 }, { 118, 3444 }, { 105, 3445 }, { 99, 3446 }, { 59, 3447 }, { 59, 3448 }, { 116, 3449 }, { 59, 3450 }, { 99, 3451 }, { 107, 3452 }, { 99, 3453 }, { 101, 3454 }, { 59, 3455 }, { 122, 3456 }, { 59, 3457 }, { 111, 3458 }, { 68, 3459 }, { 69, 3460 }, 
+	{ 59, 3461 }, { 103, 3462 }, { 59, 3463 }, { 116, 3464 }, { 99, 3465 }, { 59, 3466 }, { 118, 3467 }, { 114, 3468 }, { 105, 3469 }, { 105, 3470 }, { 103, 3471 }, { 114, 3472 }, { 115, 3473 }, { 110, 3474 }, { 59, 3475 }, { 59, 3476 }, { 59, 3477 }, { 100, 3478 }, { 121, 3479 }, { 59, 3480 }, 
+	{ 99, 3481 }, { 59, 3482 }, { 59, 3483 }, { 99, 3484 }, { 121, 3485 }, { 59, 3486 }, { 59, 3487 }, { 97, 3488 }, { 105, 3489 }, { 59, 3490 }, { 59, 3491 }, { 59, 3492 }, { 116, 3493 }, { 100, 3494 }, { 59, 3495 }, { 97, 3496 }, { 59, 3497 }, { 111, 3498 }, { 105, 3499 }, { 65, 3500 }, 
+	{ 67, 3501 }, { 68, 3502 }, { 70, 3503 }, { 82, 3504 }, { 84, 3505 }, { 85, 3506 }, { 86, 3507 }, { 97, 3508 }, { 114, 3509 }, { 69, 3510 }, { 70, 3511 }, { 71, 3512 }, { 76, 3513 }, { 83, 3514 }, { 84, 3515 }, { 116, 3516 }, { 111, 3517 }, { 76, 3518 }, { 82, 3519 }, { 108, 3520 }, 
+	{ 114, 3521 }, { 59, 3522 }, { 114, 3523 }, { 59, 3524 }, { 111, 3525 }, { 117, 3526 }, { 105, 3527 }, { 115, 3528 }, { 59, 3529 }, { 59, 3530 }, { 59, 3531 }, { 116, 3532 }, { 111, 3533 }, { 105, 3534 }, { 116, 3535 }, { 101, 3536 }, { 105, 3537 }, { 101, 3538 }, { 114, 3539 }, { 59, 3540 }, 
+	{ 111, 3541 }, { 117, 3542 }, { 111, 3543 }, { 108, 3544 }, { 113, 3545 }, { 120, 3546 }, { 114, 3547 }, { 117, 3548 }, { 101, 3549 }, { 101, 3550 }, { 114, 3551 }, { 101, 3552 }, { 105, 3553 }, { 113, 3554 }, { 117, 3555 }, { 105, 3556 }, { 101, 3557 }, { 59, 3558 }, { 100, 3559 }, { 103, 3560 }, 
+	{ 116, 3561 }, { 99, 3562 }, { 97, 3563 }, { 118, 3564 }, { 114, 3565 }, { 97, 3566 }, { 114, 3567 }, { 59, 3568 }, { 67, 3569 }, { 59, 3570 }, { 115, 3571 }, { 100, 3572 }, { 101, 3573 }, { 59, 3574 }, { 66, 3575 }, { 80, 3576 }, { 105, 3577 }, { 77, 3578 }, { 99, 3579 }, { 59, 3580 }, 
+	{ 101, 3581 }, { 101, 3582 }, { 117, 3583 }, { 111, 3584 }, { 59, 3585 }, { 59, 3586 }, { 59, 3587 }, { 59, 3588 }, { 114, 3589 }, { 116, 3590 }, { 59, 3591 }, { 59, 3592 }, { 116, 3593 }, { 111, 3594 }, { 105, 3595 }, { 114, 3596 }, { 116, 3597 }, { 59, 3598 }, { 100, 3599 }, { 104, 3600 }, 
+	{ 59, 3601 }, { 68, 3602 }, { 99, 3603 }, { 59, 3604 }, { 99, 3605 }, { 116, 3606 }, { 111, 3607 }, { 105, 3608 }, { 99, 3609 }, { 116, 3610 }, { 97, 3611 }, { 108, 3612 }, { 59, 3613 }, { 59, 3614 }, { 114, 3615 }, { 59, 3616 }, { 59, 3617 }, { 101, 3618 }, { 101, 3619 }, { 84, 3620 }, 
+	{ 114, 3621 }, { 101, 3622 }, { 78, 3623 }, { 69, 3624 }, { 121, 3625 }, { 59, 3626 }, { 111, 3627 }, { 105, 3628 }, { 101, 3629 }, { 97, 3630 }, { 107, 3631 }, { 83, 3632 }, { 101, 3633 }, { 59, 3634 }, { 108, 3635 }, { 59, 3636 }, { 111, 3637 }, { 116, 3638 }, { 59, 3639 }, { 111, 3640 }, 
+	{ 121, 3641 }, { 118, 3642 }, { 99, 3643 }, { 97, 3644 }, { 118, 3645 }, { 114, 3646 }, { 114, 3647 }, { 110, 3648 }, { 110, 3649 }, { 59, 3650 }, { 114, 3651 }, { 119, 3652 }, { 117, 3653 }, { 101, 3654 }, { 114, 3655 }, { 119, 3656 }, { 114, 3657 }, { 59, 3658 }, { 108, 3659 }, { 103, 3660 }, 
+	{ 59, 3661 }, { 100, 3662 }, { 59, 3663 }, { 104, 3664 }, { 59, 3665 }, { 104, 3666 }, { 97, 3667 }, { 59, 3668 }, { 105, 3669 }, { 84, 3670 }, { 59, 3671 }, { 59, 3672 }, { 115, 3673 }, { 99, 3674 }, { 101, 3675 }, { 59, 3676 }, { 59, 3677 }, { 59, 3678 }, { 59, 3679 }, { 59, 3680 }, 
+	{ 59, 3681 }, { 59, 3682 }, { 116, 3683 }, { 99, 3684 }, { 59, 3685 }, { 59, 3686 }, { 59, 3687 }, { 59, 3688 }, { 116, 3689 }, { 111, 3690 }, { 59, 3691 }, { 87, 3692 }, { 59, 3693 }, { 59, 3694 }, { 59, 3695 }, { 116, 3696 }, { 118, 3697 }, { 99, 3698 }, { 101, 3699 }, { 103, 3700 }, 
+	{ 118, 3701 }, { 115, 3702 }, { 104, 3703 }, { 97, 3704 }, { 114, 3705 }, { 103, 3706 }, { 110, 3707 }, { 59, 3708 }, { 108, 3709 }, { 59, 3710 }, { 59, 3711 }, { 101, 3712 }, { 115, 3713 }, { 116, 3714 }, { 112, 3715 }, { 116, 3716 }, { 97, 3717 }, { 110, 3718 }, { 59, 3719 }, { 105, 3720 }, 
+	{ 59, 3721 }, { 59, 3722 }, { 111, 3723 }, { 103, 3724 }, { 59, 3725 }, { 112, 3726 }, { 100, 3727 }, { 59, 3728 }, { 110, 3729 }, { 116, 3730 }, { 59, 3731 }, { 99, 3732 }, { 101, 3733 }, { 112, 3734 }, { 115, 3735 }, { 101, 3736 }, { 101, 3737 }, { 59, 3738 }, { 116, 3739 }, { 103, 3740 }, 
+	{ 111, 3741 }, { 117, 3742 }, { 116, 3743 }, { 105, 3744 }, { 111, 3745 }, { 59, 3746 }, { 59, 3747 }, { 101, 3748 }, { 97, 3749 }, { 105, 3750 }, { 117, 3751 }, { 100, 3752 }, { 112, 3753 }, { 116, 3754 }, { 113, 3755 }, { 116, 3756 }, { 114, 3757 }, { 112, 3758 }, { 101, 3759 }, { 101, 3760 }, 
+	{ 111, 3761 }, { 107, 3762 }, { 107, 3763 }, { 50, 3764 }, { 52, 3765 }, { 52, 3766 }, { 107, 3767 }, { 117, 3768 }, { 59, 3769 }, { 59, 3770 }, { 111, 3771 }, { 105, 3772 }, { 76, 3773 }, { 82, 3774 }, { 108, 3775 }, { 114, 3776 }, { 59, 3777 }, { 68, 3778 }, { 85, 3779 }, { 100, 3780 }, 
+	{ 117, 3781 }, { 76, 3782 }, { 82, 3783 }, { 108, 3784 }, { 114, 3785 }, { 59, 3786 }, { 72, 3787 }, { 76, 3788 }, { 82, 3789 }, { 104, 3790 }, { 108, 3791 }, { 114, 3792 }, { 111, 3793 }, { 76, 3794 }, { 82, 3795 }, { 108, 3796 }, { 114, 3797 }, { 59, 3798 }, { 68, 3799 }, { 85, 3800 }, 
+	{ 100, 3801 }, { 117, 3802 }, { 105, 3803 }, { 108, 3804 }, { 105, 3805 }, { 76, 3806 }, { 82, 3807 }, { 108, 3808 }, { 114, 3809 }, { 59, 3810 }, { 72, 3811 }, { 76, 3812 }, { 82, 3813 }, { 104, 3814 }, { 108, 3815 }, { 114, 3816 }, { 109, 3817 }, { 101, 3818 }, { 97, 3819 }, { 59, 3820 }, 
+	{ 105, 3821 }, { 59, 3822 }, { 101, 3823 }, { 59, 3824 }, { 98, 3825 }, { 104, 3826 }, { 59, 3827 }, { 101, 3828 }, { 59, 3829 }, { 69, 3830 }, { 101, 3831 }, { 116, 3832 }, { 110, 3833 }, { 114, 3834 }, { 97, 3835 }, { 117, 3836 }, { 111, 3837 }, { 59, 3838 }, { 116, 3839 }, { 110, 3840 }, 
+	{ 115, 3841 }, { 111, 3842 }, { 105, 3843 }, { 99, 3844 }, { 115, 3845 }, { 59, 3846 }, { 108, 3847 }, { 116, 3848 }, { 59, 3849 }, { 101, 3850 }, { 59, 3851 }, { 107, 3852 }, { 59, 3853 }, { 59, 3854 }, { 101, 3855 }, { 108, 3856 }, { 59, 3857 }, { 110, 3858 }, { 105, 3859 }, { 99, 3860 }, 
+	{ 115, 3861 }, { 110, 3862 }, { 97, 3863 }, { 59, 3864 }, { 102, 3865 }, { 108, 3866 }, { 59, 3867 }, { 100, 3868 }, { 110, 3869 }, { 59, 3870 }, { 111, 3871 }, { 59, 3872 }, { 115, 3873 }, { 114, 3874 }, { 115, 3875 }, { 59, 3876 }, { 59, 3877 }, { 101, 3878 }, { 59, 3879 }, { 101, 3880 }, 
+	{ 116, 3881 }, { 114, 3882 }, { 114, 3883 }, { 99, 3884 }, { 114, 3885 }, { 114, 3886 }, { 97, 3887 }, { 117, 3888 }, { 111, 3889 }, { 114, 3890 }, { 59, 3891 }, { 114, 3892 }, { 121, 3893 }, { 101, 3894 }, { 101, 3895 }, { 101, 3896 }, { 100, 3897 }, { 110, 3898 }, { 116, 3899 }, { 116, 3900 }, 
+	{ 59, 3901 }, { 59, 3902 }, { 101, 3903 }, { 116, 3904 }, { 59, 3905 }, { 59, 3906 }, { 118, 3907 }, { 114, 3908 }, { 99, 3909 }, { 111, 3910 }, { 103, 3911 }, { 114, 3912 }, { 115, 3913 }, { 97, 3914 }, { 116, 3915 }, { 104, 3916 }, { 108, 3917 }, { 114, 3918 }, { 59, 3919 }, { 111, 3920 }, 
+	{ 115, 3921 }, { 109, 3922 }, { 110, 3923 }, { 100, 3924 }, { 110, 3925 }, { 59, 3926 }, { 114, 3927 }, { 111, 3928 }, { 97, 3929 }, { 59, 3930 }, { 113, 3931 }, { 105, 3932 }, { 108, 3933 }, { 113, 3934 }, { 108, 3935 }, { 97, 3936 }, { 100, 3937 }, { 104, 3938 }, { 97, 3939 }, { 114, 3940 }, 
+	{ 111, 3941 }, { 59, 3942 }, { 59, 3943 }, { 59, 3944 }, { 111, 3945 }, { 116, 3946 }, { 59, 3947 }, { 102, 3948 }, { 114, 3949 }, { 114, 3950 }, { 103, 3951 }, { 59, 3952 }, { 114, 3953 }, { 116, 3954 }, { 59, 3955 }, { 116, 3956 }, { 101, 3957 }, { 111, 3958 }, { 59, 3959 }, { 99, 3960 }, 
+	{ 111, 3961 }, { 59, 3962 }, { 116, 3963 }, { 118, 3964 }, { 111, 3965 }, { 116, 3966 }, { 111, 3967 }, { 114, 3968 }, { 121, 3969 }, { 49, 3970 }, { 59, 3971 }, { 59, 3972 }, { 110, 3973 }, { 59, 3974 }, { 59, 3975 }, { 115, 3976 }, { 115, 3977 }, { 59, 3978 }, { 108, 3979 }, { 118, 3980 }, 
+	{ 114, 3981 }, { 108, 3982 }, { 109, 3983 }, { 97, 3984 }, { 108, 3985 }, { 115, 3986 }, { 118, 3987 }, { 97, 3988 }, { 116, 3989 }, { 114, 3990 }, { 59, 3991 }, { 116, 3992 }, { 59, 3993 }, { 59, 3994 }, { 59, 3995 }, { 59, 3996 }, { 116, 3997 }, { 99, 3998 }, { 110, 3999 }, { 105, 4000 }, 
+	{ 108, 4001 }, { 105, 4002 }, { 103, 4003 }, { 105, 4004 }, { 103, 4005 }, { 103, 4006 }, { 59, 4007 }, { 103, 4008 }, { 115, 4009 }, { 59, 4010 }, { 59, 4011 }, { 108, 4012 }, { 59, 4013 }, { 118, 4014 }, { 116, 4015 }, { 49, 4016 }, { 50, 4017 }, { 51, 4018 }, { 52, 4019 }, { 53, 4020 }, 
+	{ 55, 4021 }, { 108, 4022 }, { 110, 4023 }, { 59, 4024 }, { 116, 4025 }, { 97, 4026 }, { 118, 4027 }, { 99, 4028 }, { 59, 4029 }, { 59, 4030 }, { 108, 4031 }, { 99, 4032 }, { 111, 4033 }, { 59, 4034 }, { 101, 4035 }, { 108, 4036 }, { 59, 4037 }, { 59, 4038 }, { 112, 4039 }, { 59, 4040 }, 
+	{ 113, 4041 }, { 109, 4042 }, { 59, 4043 }, { 101, 4044 }, { 59, 4045 }, { 59, 4046 }, { 101, 4047 }, { 108, 4048 }, { 59, 4049 }, { 114, 4050 }, { 116, 4051 }, { 97, 4052 }, { 101, 4053 }, { 112, 4054 }, { 114, 4055 }, { 111, 4056 }, { 113, 4057 }, { 101, 4058 }, { 105, 4059 }, { 116, 4060 }, 
+	{ 59, 4061 }, { 59, 4062 }, { 115, 4063 }, { 59, 4064 }, { 108, 4065 }, { 99, 4066 }, { 59, 4067 }, { 99, 4068 }, { 119, 4069 }, { 59, 4070 }, { 99, 4071 }, { 116, 4072 }, { 105, 4073 }, { 111, 4074 }, { 97, 4075 }, { 97, 4076 }, { 114, 4077 }, { 104, 4078 }, { 108, 4079 }, { 114, 4080 }, 
+	{ 59, 4081 }, { 97, 4082 }, { 59, 4083 }, { 115, 4084 }, { 111, 4085 }, { 108, 4086 }, { 101, 4087 }, { 116, 4088 }, { 99, 4089 }, { 59, 4090 }, { 108, 4091 }, { 118, 4092 }, { 110, 4093 }, { 116, 4094 }, { 105, 4095 }, { 97, 4096 }, { 103, 4097 }, { 114, 4098 }, { 101, 4099 }, { 108, 4100 }, 
+	{ 112, 4101 }, { 104, 4102 }, { 59, 4103 }, { 100, 4104 }, { 114, 4105 }, { 110, 4106 }, { 111, 4107 }, { 97, 4108 }, { 103, 4109 }, { 114, 4110 }, { 97, 4111 }, { 114, 4112 }, { 59, 4113 }, { 110, 4114 }, { 59, 4115 }, { 59, 4116 }, { 100, 4117 }, { 115, 4118 }, { 59, 4119 }, { 59, 4120 }, 
+	{ 69, 4121 }, { 100, 4122 }, { 115, 4123 }, { 118, 4124 }, { 100, 4125 }, { 121, 4126 }, { 59, 4127 }, { 99, 4128 }, { 104, 4129 }, { 59, 4130 }, { 59, 4131 }, { 99, 4132 }, { 121, 4133 }, { 97, 4134 }, { 105, 4135 }, { 101, 4136 }, { 59, 4137 }, { 59, 4138 }, { 59, 4139 }, { 59, 4140 }, 
+	{ 114, 4141 }, { 59, 4142 }, { 105, 4143 }, { 114, 4144 }, { 59, 4145 }, { 116, 4146 }, { 112, 4147 }, { 97, 4148 }, { 100, 4149 }, { 59, 4150 }, { 100, 4151 }, { 108, 4152 }, { 111, 4153 }, { 59, 4154 }, { 98, 4155 }, { 102, 4156 }, { 104, 4157 }, { 108, 4158 }, { 112, 4159 }, { 115, 4160 }, 
+	{ 116, 4161 }, { 105, 4162 }, { 59, 4163 }, { 115, 4164 }, { 114, 4165 }, { 107, 4166 }, { 99, 4167 }, { 101, 4168 }, { 115, 4169 }, { 111, 4170 }, { 105, 4171 }, { 108, 4172 }, { 59, 4173 }, { 59, 4174 }, { 111, 4175 }, { 104, 4176 }, { 115, 4177 }, { 59, 4178 }, { 97, 4179 }, { 104, 4180 }, 
+	{ 108, 4181 }, { 114, 4182 }, { 116, 4183 }, { 59, 4184 }, { 108, 4185 }, { 99, 4186 }, { 111, 4187 }, { 59, 4188 }, { 101, 4189 }, { 97, 4190 }, { 100, 4191 }, { 101, 4192 }, { 103, 4193 }, { 115, 4194 }, { 104, 4195 }, { 111, 4196 }, { 100, 4197 }, { 117, 4198 }, { 107, 4199 }, { 59, 4200 }, 
+	{ 114, 4201 }, { 114, 4202 }, { 114, 4203 }, { 105, 4204 }, { 111, 4205 }, { 115, 4206 }, { 59, 4207 }, { 112, 4208 }, { 59, 4209 }, { 113, 4210 }, { 109, 4211 }, { 103, 4212 }, { 114, 4213 }, { 107, 4214 }, { 108, 4215 }, { 109, 4216 }, { 114, 4217 }, { 97, 4218 }, { 114, 4219 }, { 59, 4220 }, 
+	{ 117, 4221 }, { 109, 4222 }, { 115, 4223 }, { 97, 4224 }, { 110, 4225 }, { 59, 4226 }, { 59, 4227 }, { 108, 4228 }, { 114, 4229 }, { 114, 4230 }, { 114, 4231 }, { 105, 4232 }, { 117, 4233 }, { 59, 4234 }, { 59, 4235 }, { 101, 4236 }, { 103, 4237 }, { 59, 4238 }, { 111, 4239 }, { 111, 4240 }, 
+	{ 59, 4241 }, { 114, 4242 }, { 116, 4243 }, { 101, 4244 }, { 101, 4245 }, { 114, 4246 }, { 101, 4247 }, { 97, 4248 }, { 59, 4249 }, { 101, 4250 }, { 102, 4251 }, { 115, 4252 }, { 104, 4253 }, { 116, 4254 }, { 59, 4255 }, { 116, 4256 }, { 59, 4257 }, { 59, 4258 }, { 59, 4259 }, { 101, 4260 }, 
+	{ 116, 4261 }, { 101, 4262 }, { 109, 4263 }, { 104, 4264 }, { 117, 4265 }, { 111, 4266 }, { 115, 4267 }, { 105, 4268 }, { 111, 4269 }, { 115, 4270 }, { 59, 4271 }, { 59, 4272 }, { 117, 4273 }, { 108, 4274 }, { 59, 4275 }, { 59, 4276 }, { 111, 4277 }, { 105, 4278 }, { 112, 4279 }, { 59, 4280 }, 
+	{ 116, 4281 }, { 59, 4282 }, { 104, 4283 }, { 115, 4284 }, { 115, 4285 }, { 97, 4286 }, { 116, 4287 }, { 59, 4288 }, { 59, 4289 }, { 100, 4290 }, { 115, 4291 }, { 114, 4292 }, { 114, 4293 }, { 59, 4294 }, { 112, 4295 }, { 59, 4296 }, { 111, 4297 }, { 105, 4298 }, { 103, 4299 }, { 59, 4300 }, 
+	{ 104, 4301 }, { 114, 4302 }, { 104, 4303 }, { 114, 4304 }, { 116, 4305 }, { 105, 4306 }, { 97, 4307 }, { 109, 4308 }, { 115, 4309 }, { 59, 4310 }, { 113, 4311 }, { 115, 4312 }, { 59, 4313 }, { 109, 4314 }, { 59, 4315 }, { 114, 4316 }, { 114, 4317 }, { 114, 4318 }, { 59, 4319 }, { 59, 4320 }, 
+	{ 114, 4321 }, { 114, 4322 }, { 59, 4323 }, { 116, 4324 }, { 59, 4325 }, { 113, 4326 }, { 115, 4327 }, { 59, 4328 }, { 115, 4329 }, { 109, 4330 }, { 105, 4331 }, { 59, 4332 }, { 59, 4333 }, { 110, 4334 }, { 105, 4335 }, { 59, 4336 }, { 97, 4337 }, { 115, 4338 }, { 116, 4339 }, { 105, 4340 }, 
+	{ 117, 4341 }, { 59, 4342 }, { 99, 4343 }, { 114, 4344 }, { 114, 4345 }, { 104, 4346 }, { 105, 4347 }, { 117, 4348 }, { 59, 4349 }, { 59, 4350 }, { 114, 4351 }, { 59, 4352 }, { 101, 4353 }, { 100, 4354 }, { 114, 4355 }, { 117, 4356 }, { 59, 4357 }, { 69, 4358 }, { 101, 4359 }, { 115, 4360 }, 
+	{ 99, 4361 }, { 59, 4362 }, { 69, 4363 }, { 101, 4364 }, { 115, 4365 }, { 59, 4366 }, { 100, 4367 }, { 59, 4368 }, { 97, 4369 }, { 114, 4370 }, { 112, 4371 }, { 115, 4372 }, { 114, 4373 }, { 59, 4374 }, { 115, 4375 }, { 59, 4376 }, { 59, 4377 }, { 102, 4378 }, { 114, 4379 }, { 59, 4380 }, 
+	{ 59, 4381 }, { 114, 4382 }, { 114, 4383 }, { 114, 4384 }, { 109, 4385 }, { 114, 4386 }, { 104, 4387 }, { 114, 4388 }, { 97, 4389 }, { 116, 4390 }, { 59, 4391 }, { 59, 4392 }, { 99, 4393 }, { 104, 4394 }, { 97, 4395 }, { 59, 4396 }, { 59, 4397 }, { 108, 4398 }, { 103, 4399 }, { 114, 4400 }, 
+	{ 59, 4401 }, { 118, 4402 }, { 114, 4403 }, { 59, 4404 }, { 114, 4405 }, { 114, 4406 }, { 111, 4407 }, { 101, 4408 }, { 114, 4409 }, { 97, 4410 }, { 114, 4411 }, { 59, 4412 }, { 117, 4413 }, { 59, 4414 }, { 59, 4415 }, { 112, 4416 }, { 115, 4417 }, { 114, 4418 }, { 114, 4419 }, { 59, 4420 }, 
+	{ 59, 4421 }, { 111, 4422 }, { 59, 4423 }, { 111, 4424 }, { 59, 4425 }, { 115, 4426 }, { 59, 4427 }, { 100, 4428 }, { 101, 4429 }, { 59, 4430 }, { 114, 4431 }, { 59, 4432 }, { 108, 4433 }, { 105, 4434 }, { 108, 4435 }, { 59, 4436 }, { 110, 4437 }, { 111, 4438 }, { 105, 4439 }, { 59, 4440 }, 
+	{ 101, 4441 }, { 59, 4442 }, { 97, 4443 }, { 101, 4444 }, { 104, 4445 }, { 99, 4446 }, { 107, 4447 }, { 59, 4448 }, { 97, 4449 }, { 98, 4450 }, { 99, 4451 }, { 100, 4452 }, { 101, 4453 }, { 109, 4454 }, { 115, 4455 }, { 116, 4456 }, { 116, 4457 }, { 59, 4458 }, { 100, 4459 }, { 59, 4460 }, 
+	{ 101, 4461 }, { 59, 4462 }, { 97, 4463 }, { 99, 4464 }, { 101, 4465 }, { 110, 4466 }, { 115, 4467 }, { 101, 4468 }, { 59, 4469 }, { 112, 4470 }, { 105, 4471 }, { 59, 4472 }, { 97, 4473 }, { 108, 4474 }, { 115, 4475 }, { 59, 4476 }, { 116, 4477 }, { 109, 4478 }, { 101, 4479 }, { 59, 4480 }, 
+	{ 115, 4481 }, { 59, 4482 }, { 59, 4483 }, { 109, 4484 }, { 59, 4485 }, { 101, 4486 }, { 105, 4487 }, { 116, 4488 }, { 59, 4489 }, { 114, 4490 }, { 59, 4491 }, { 105, 4492 }, { 114, 4493 }, { 59, 4494 }, { 59, 4495 }, { 116, 4496 }, { 99, 4497 }, { 112, 4498 }, { 59, 4499 }, { 100, 4500 }, 
+	{ 101, 4501 }, { 108, 4502 }, { 111, 4503 }, { 59, 4504 }, { 97, 4505 }, { 98, 4506 }, { 99, 4507 }, { 102, 4508 }, { 104, 4509 }, { 108, 4510 }, { 112, 4511 }, { 115, 4512 }, { 116, 4513 }, { 119, 4514 }, { 105, 4515 }, { 111, 4516 }, { 114, 4517 }, { 107, 4518 }, { 99, 4519 }, { 101, 4520 }, 
+	{ 115, 4521 }, { 111, 4522 }, { 105, 4523 }, { 108, 4524 }, { 59, 4525 }, { 59, 4526 }, { 104, 4527 }, { 111, 4528 }, { 59, 4529 }, { 59, 4530 }, { 105, 4531 }, { 112, 4532 }, { 115, 4533 }, { 59, 4534 }, { 104, 4535 }, { 111, 4536 }, { 100, 4537 }, { 117, 4538 }, { 59, 4539 }, { 116, 4540 }, 
+	{ 59, 4541 }, { 110, 4542 }, { 114, 4543 }, { 114, 4544 }, { 115, 4545 }, { 100, 4546 }, { 103, 4547 }, { 114, 4548 }, { 107, 4549 }, { 114, 4550 }, { 59, 4551 }, { 117, 4552 }, { 109, 4553 }, { 59, 4554 }, { 103, 4555 }, { 108, 4556 }, { 114, 4557 }, { 117, 4558 }, { 59, 4559 }, { 59, 4560 }, 
+	{ 111, 4561 }, { 101, 4562 }, { 101, 4563 }, { 59, 4564 }, { 101, 4565 }, { 102, 4566 }, { 108, 4567 }, { 104, 4568 }, { 116, 4569 }, { 111, 4570 }, { 59, 4571 }, { 111, 4572 }, { 101, 4573 }, { 105, 4574 }, { 99, 4575 }, { 59, 4576 }, { 112, 4577 }, { 105, 4578 }, { 108, 4579 }, { 109, 4580 }, 
+	{ 59, 4581 }, { 98, 4582 }, { 101, 4583 }, { 114, 4584 }, { 104, 4585 }, { 114, 4586 }, { 59, 4587 }, { 59, 4588 }, { 97, 4589 }, { 105, 4590 }, { 110, 4591 }, { 59, 4592 }, { 119, 4593 }, { 112, 4594 }, { 99, 4595 }, { 59, 4596 }, { 116, 4597 }, { 97, 4598 }, { 111, 4599 }, { 59, 4600 }, 
+	{ 113, 4601 }, { 59, 4602 }, { 69, 4603 }, { 59, 4604 }, { 69, 4605 }, { 101, 4606 }, { 108, 4607 }, { 97, 4608 }, { 114, 4609 }, { 108, 4610 }, { 104, 4611 }, { 97, 4612 }, { 59, 4613 }, { 101, 4614 }, { 59, 4615 }, { 115, 4616 }, { 99, 4617 }, { 59, 4618 }, { 97, 4619 }, { 59, 4620 }, 
+	{ 101, 4621 }, { 59, 4622 }, { 112, 4623 }, { 112, 4624 }, { 98, 4625 }, { 112, 4626 }, { 114, 4627 }, { 59, 4628 }, { 114, 4629 }, { 59, 4630 }, { 109, 4631 }, { 108, 4632 }, { 114, 4633 }, { 59, 4634 }, { 102, 4635 }, { 105, 4636 }, { 115, 4637 }, { 59, 4638 }, { 111, 4639 }, { 59, 4640 }, 
+	{ 100, 4641 }, { 117, 4642 }, { 69, 4643 }, { 101, 4644 }, { 108, 4645 }, { 97, 4646 }, { 101, 4647 }, { 105, 4648 }, { 117, 4649 }, { 59, 4650 }, { 97, 4651 }, { 99, 4652 }, { 101, 4653 }, { 110, 4654 }, { 115, 4655 }, { 59, 4656 }, { 59, 4657 }, { 59, 4658 }, { 59, 4659 }, { 59, 4660 }, 
+	{ 111, 4661 }, { 115, 4662 }, { 59, 4663 }, { 100, 4664 }, { 115, 4665 }, { 97, 4666 }, { 117, 4667 }, { 69, 4668 }, { 101, 4669 }, { 108, 4670 }, { 101, 4671 }, { 105, 4672 }, { 117, 4673 }, { 114, 4674 }, { 104, 4675 }, { 114, 4676 }, { 97, 4677 }, { 103, 4678 }, { 101, 4679 }, { 59, 4680 }, 
+	{ 111, 4681 }, { 105, 4682 }, { 59, 4683 }, { 101, 4684 }, { 101, 4685 }, { 97, 4686 }, { 107, 4687 }, { 115, 4688 }, { 112, 4689 }, { 105, 4690 }, { 110, 4691 }, { 101, 4692 }, { 115, 4693 }, { 59, 4694 }, { 59, 4695 }, { 111, 4696 }, { 105, 4697 }, { 59, 4698 }, { 111, 4699 }, { 59, 4700 }, 
+	{ 109, 4701 }, { 101, 4702 }, { 110, 4703 }, { 111, 4704 }, { 59, 4705 }, { 105, 4706 }, { 108, 4707 }, { 98, 4708 }, { 105, 4709 }, { 122, 4710 }, { 59, 4711 }, { 59, 4712 }, { 121, 4713 }, { 111, 4714 }, { 116, 4715 }, { 101, 4716 }, { 59, 4717 }, { 59, 4718 }, { 116, 4719 }, { 59, 4720 }, 
+	{ 121, 4721 }, { 118, 4722 }, { 99, 4723 }, { 114, 4724 }, { 97, 4725 }, { 114, 4726 }, { 104, 4727 }, { 118, 4728 }, { 108, 4729 }, { 114, 4730 }, { 107, 4731 }, { 114, 4732 }, { 111, 4733 }, { 105, 4734 }, { 114, 4735 }, { 110, 4736 }, { 59, 4737 }, { 114, 4738 }, { 119, 4739 }, { 114, 4740 }, 
+	{ 115, 4741 }, { 59, 4742 }, { 104, 4743 }, { 108, 4744 }, { 97, 4745 }, { 114, 4746 }, { 111, 4747 }, { 103, 4748 }, { 105, 4749 }, { 59, 4750 }, { 116, 4751 }, { 100, 4752 }, { 59, 4753 }, { 102, 4754 }, { 114, 4755 }, { 59, 4756 }, { 103, 4757 }, { 59, 4758 }, { 59, 4759 }, { 118, 4760 }, 
+	{ 104, 4761 }, { 114, 4762 }, { 112, 4763 }, { 97, 4764 }, { 111, 4765 }, { 104, 4766 }, { 105, 4767 }, { 114, 4768 }, { 59, 4769 }, { 104, 4770 }, { 105, 4771 }, { 117, 4772 }, { 104, 4773 }, { 114, 4774 }, { 104, 4775 }, { 97, 4776 }, { 113, 4777 }, { 105, 4778 }, { 97, 4779 }, { 59, 4780 }, 
+	{ 105, 4781 }, { 98, 4782 }, { 112, 4783 }, { 59, 4784 }, { 112, 4785 }, { 105, 4786 }, { 59, 4787 }, { 110, 4788 }, { 110, 4789 }, { 122, 4790 }, { 99, 4791 }, { 97, 4792 }, { 101, 4793 }, { 114, 4794 }, { 59, 4795 }, { 116, 4796 }, { 59, 4797 }, { 59, 4798 }, { 99, 4799 }, { 59, 4800 }, 
+	{ 105, 4801 }, { 114, 4802 }, { 114, 4803 }, { 114, 4804 }, { 114, 4805 }, { 59, 4806 }, { 59, 4807 }, { 116, 4808 }, { 59, 4809 }, { 117, 4810 }, { 109, 4811 }, { 114, 4812 }, { 114, 4813 }, { 59, 4814 }, { 117, 4815 }, { 117, 4816 }, { 105, 4817 }, { 59, 4818 }, { 103, 4819 }, { 116, 4820 }, 
+	{ 59, 4821 }, { 99, 4822 }, { 59, 4823 }, { 59, 4824 }, { 59, 4825 }, { 59, 4826 }, { 59, 4827 }, { 116, 4828 }, { 111, 4829 }, { 59, 4830 }, { 114, 4831 }, { 59, 4832 }, { 59, 4833 }, { 97, 4834 }, { 59, 4835 }, { 59, 4836 }, { 59, 4837 }, { 59, 4838 }, { 101, 4839 }, { 101, 4840 }, 
+	{ 59, 4841 }, { 101, 4842 }, { 59, 4843 }, { 59, 4844 }, { 59, 4845 }, { 70, 4846 }, { 59, 4847 }, { 110, 4848 }, { 101, 4849 }, { 108, 4850 }, { 100, 4851 }, { 115, 4852 }, { 117, 4853 }, { 59, 4854 }, { 113, 4855 }, { 101, 4856 }, { 97, 4857 }, { 121, 4858 }, { 110, 4859 }, { 108, 4860 }, 
+	{ 59, 4861 }, { 110, 4862 }, { 108, 4863 }, { 114, 4864 }, { 101, 4865 }, { 119, 4866 }, { 67, 4867 }, { 59, 4868 }, { 101, 4869 }, { 117, 4870 }, { 116, 4871 }, { 117, 4872 }, { 100, 4873 }, { 101, 4874 }, { 59, 4875 }, { 112, 4876 }, { 97, 4877 }, { 114, 4878 }, { 59, 4879 }, { 110, 4880 }, 
+	{ 59, 4881 }, { 105, 4882 }, { 110, 4883 }, { 114, 4884 }, { 116, 4885 }, { 117, 4886 }, { 101, 4887 }, { 114, 4888 }, { 114, 4889 }, { 101, 4890 }, { 105, 4891 }, { 101, 4892 }, { 114, 4893 }, { 107, 4894 }, { 101, 4895 }, { 110, 4896 }, { 59, 4897 }, { 101, 4898 }, { 110, 4899 }, { 59, 4900 }, 
+	{ 83, 4901 }, { 86, 4902 }, { 59, 4903 }, { 111, 4904 }, { 59, 4905 }, { 84, 4906 }, { 105, 4907 }, { 115, 4908 }, { 101, 4909 }, { 100, 4910 }, { 108, 4911 }, { 101, 4912 }, { 59, 4913 }, { 100, 4914 }, { 101, 4915 }, { 108, 4916 }, { 59, 4917 }, { 101, 4918 }, { 121, 4919 }, { 59, 4920 }, 
+	{ 59, 4921 }, { 114, 4922 }, { 111, 4923 }, { 107, 4924 }, { 111, 4925 }, { 113, 4926 }, { 59, 4927 }, { 101, 4928 }, { 59, 4929 }, { 101, 4930 }, { 59, 4931 }, { 110, 4932 }, { 101, 4933 }, { 114, 4934 }, { 115, 4935 }, { 105, 4936 }, { 59, 4937 }, { 101, 4938 }, { 59, 4939 }, { 59, 4940 }, 
+	{ 121, 4941 }, { 59, 4942 }, { 59, 4943 }, { 108, 4944 }, { 101, 4945 }, { 97, 4946 }, { 99, 4947 }, { 110, 4948 }, { 108, 4949 }, { 110, 4950 }, { 114, 4951 }, { 101, 4952 }, { 111, 4953 }, { 108, 4954 }, { 105, 4955 }, { 101, 4956 }, { 114, 4957 }, { 112, 4958 }, { 101, 4959 }, { 114, 4960 }, 
+	{ 105, 4961 }, { 113, 4962 }, { 117, 4963 }, { 114, 4964 }, { 101, 4965 }, { 108, 4966 }, { 105, 4967 }, { 97, 4968 }, { 116, 4969 }, { 101, 4970 }, { 105, 4971 }, { 101, 4972 }, { 105, 4973 }, { 76, 4974 }, { 82, 4975 }, { 107, 4976 }, { 109, 4977 }, { 110, 4978 }, { 80, 4979 }, { 101, 4980 }, 
+	{ 110, 4981 }, { 108, 4982 }, { 105, 4983 }, { 100, 4984 }, { 110, 4985 }, { 97, 4986 }, { 101, 4987 }, { 110, 4988 }, { 112, 4989 }, { 117, 4990 }, { 101, 4991 }, { 117, 4992 }, { 105, 4993 }, { 101, 4994 }, { 109, 4995 }, { 102, 4996 }, { 115, 4997 }, { 115, 4998 }, { 101, 4999 }, { 118, 5000 }, 
+	{ 103, 5001 }, { 117, 5002 }, { 98, 5003 }, { 99, 5004 }, { 112, 5005 }, { 108, 5006 }, { 114, 5007 }, { 101, 5008 }, { 59, 5009 }, { 101, 5010 }, { 59, 5011 }, { 99, 5012 }, { 101, 5013 }, { 59, 5014 }, { 59, 5015 }, { 111, 5016 }, { 117, 5017 }, { 104, 5018 }, { 101, 5019 }, { 115, 5020 }, 
+	{ 97, 5021 }, { 114, 5022 }, { 97, 5023 }, { 97, 5024 }, { 105, 5025 }, { 97, 5026 }, { 100, 5027 }, { 59, 5028 }, { 99, 5029 }, { 114, 5030 }, { 59, 5031 }, { 101, 5032 }, { 108, 5033 }, { 110, 5034 }, { 108, 5035 }, { 115, 5036 }, { 65, 5037 }, { 67, 5038 }, { 68, 5039 }, { 70, 5040 }, 
+	{ 84, 5041 }, { 85, 5042 }, { 86, 5043 }, { 97, 5044 }, { 73, 5045 }, { 116, 5046 }, { 101, 5047 }, { 121, 5048 }, { 121, 5049 }, { 101, 5050 }, { 110, 5051 }, { 108, 5052 }, { 59, 5053 }, { 68, 5054 }, { 76, 5055 }, { 82, 5056 }, { 85, 5057 }, { 59, 5058 }, { 67, 5059 }, { 101, 5060 }, 
+	{ 116, 5061 }, { 101, 5062 }, { 104, 5063 }, { 115, 5064 }, { 116, 5065 }, { 59, 5066 }, { 59, 5067 }, { 59, 5068 }, { 110, 5069 }, { 108, 5070 }, { 102, 5071 }, { 59, 5072 }, { 83, 5073 }, { 112, 5074 }, { 59, 5075 }, { 69, 5076 }, { 70, 5077 }, { 84, 5078 }, { 101, 5079 }, { 107, 5080 }, 
+	{ 101, 5081 }, { 99, 5082 }, { 59, 5083 }, { 101, 5084 }, { 59, 5085 }, { 99, 5086 }, { 101, 5087 }, { 59, 5088 }, { 66, 5089 }, { 80, 5090 }, { 59, 5091 }, { 80, 5092 }, { 59, 5093 }, { 111, 5094 }, { 110, 5095 }, { 105, 5096 }, { 59, 5097 }, { 65, 5098 }, { 111, 5099 }, { 110, 5100 }, 
+	{ 76, 5101 }, { 82, 5102 }, { 111, 5103 }, { 59, 5104 }, { 101, 5105 }, { 59, 5106 }, { 59, 5107 }, { 108, 5108 }, { 114, 5109 }, { 99, 5110 }, { 104, 5111 }, { 104, 5112 }, { 59, 5113 }, { 59, 5114 }, { 101, 5115 }, { 59, 5116 }, { 101, 5117 }, { 110, 5118 }, { 105, 5119 }, { 101, 5120 }, 
+	{ 101, 5121 }, { 59, 5122 }, { 59, 5123 }, { 59, 5124 }, { 101, 5125 }, { 121, 5126 }, { 59, 5127 }, { 59, 5128 }, { 59, 5129 }, { 59, 5130 }, { 100, 5131 }, { 111, 5132 }, { 59, 5133 }, { 100, 5134 }, { 59, 5135 }, { 118, 5136 }, { 104, 5137 }, { 59, 5138 }, { 114, 5139 }, { 59, 5140 }, 
+	{ 114, 5141 }, { 120, 5142 }, { 59, 5143 }, { 59, 5144 }, { 101, 5145 }, { 101, 5146 }, { 105, 5147 }, { 59, 5148 }, { 111, 5149 }, { 112, 5150 }, { 114, 5151 }, { 105, 5152 }, { 101, 5153 }, { 100, 5154 }, { 98, 5155 }, { 59, 5156 }, { 59, 5157 }, { 115, 5158 }, { 121, 5159 }, { 59, 5160 }, 
+	{ 117, 5161 }, { 101, 5162 }, { 112, 5163 }, { 114, 5164 }, { 112, 5165 }, { 111, 5166 }, { 108, 5167 }, { 105, 5168 }, { 99, 5169 }, { 97, 5170 }, { 105, 5171 }, { 108, 5172 }, { 101, 5173 }, { 100, 5174 }, { 119, 5175 }, { 108, 5176 }, { 115, 5177 }, { 116, 5178 }, { 59, 5179 }, { 59, 5180 }, 
+	{ 59, 5181 }, { 59, 5182 }, { 59, 5183 }, { 105, 5184 }, { 109, 5185 }, { 101, 5186 }, { 59, 5187 }, { 59, 5188 }, { 59, 5189 }, { 59, 5190 }, { 59, 5191 }, { 59, 5192 }, { 59, 5193 }, { 59, 5194 }, { 59, 5195 }, { 59, 5196 }, { 59, 5197 }, { 59, 5198 }, { 59, 5199 }, { 59, 5200 }, 
+	{ 59, 5201 }, { 59, 5202 }, { 59, 5203 }, { 59, 5204 }, { 120, 5205 }, { 59, 5206 }, { 59, 5207 }, { 59, 5208 }, { 59, 5209 }, { 59, 5210 }, { 59, 5211 }, { 59, 5212 }, { 59, 5213 }, { 110, 5214 }, { 117, 5215 }, { 109, 5216 }, { 59, 5217 }, { 59, 5218 }, { 59, 5219 }, { 59, 5220 }, 
+	{ 59, 5221 }, { 59, 5222 }, { 59, 5223 }, { 59, 5224 }, { 59, 5225 }, { 59, 5226 }, { 101, 5227 }, { 59, 5228 }, { 114, 5229 }, { 59, 5230 }, { 59, 5231 }, { 59, 5232 }, { 115, 5233 }, { 116, 5234 }, { 59, 5235 }, { 59, 5236 }, { 113, 5237 }, { 101, 5238 }, { 100, 5239 }, { 99, 5240 }, 
+	{ 112, 5241 }, { 112, 5242 }, { 116, 5243 }, { 59, 5244 }, { 59, 5245 }, { 59, 5246 }, { 110, 5247 }, { 108, 5248 }, { 59, 5249 }, { 59, 5250 }, { 115, 5251 }, { 59, 5252 }, { 121, 5253 }, { 114, 5254 }, { 59, 5255 }, { 109, 5256 }, { 113, 5257 }, { 101, 5258 }, { 105, 5259 }, { 100, 5260 }, 
+	{ 105, 5261 }, { 59, 5262 }, { 117, 5263 }, { 59, 5264 }, { 101, 5265 }, { 59, 5266 }, { 116, 5267 }, { 110, 5268 }, { 101, 5269 }, { 111, 5270 }, { 116, 5271 }, { 100, 5272 }, { 114, 5273 }, { 59, 5274 }, { 59, 5275 }, { 59, 5276 }, { 59, 5277 }, { 59, 5278 }, { 114, 5279 }, { 59, 5280 }, 
+	{ 59, 5281 }, { 114, 5282 }, { 99, 5283 }, { 112, 5284 }, { 112, 5285 }, { 116, 5286 }, { 59, 5287 }, { 114, 5288 }, { 101, 5289 }, { 118, 5290 }, { 119, 5291 }, { 110, 5292 }, { 97, 5293 }, { 59, 5294 }, { 59, 5295 }, { 105, 5296 }, { 59, 5297 }, { 121, 5298 }, { 114, 5299 }, { 104, 5300 }, 
+	{ 59, 5301 }, { 111, 5302 }, { 59, 5303 }, { 110, 5304 }, { 101, 5305 }, { 59, 5306 }, { 101, 5307 }, { 59, 5308 }, { 121, 5309 }, { 116, 5310 }, { 59, 5311 }, { 59, 5312 }, { 110, 5313 }, { 59, 5314 }, { 109, 5315 }, { 59, 5316 }, { 101, 5317 }, { 120, 5318 }, { 110, 5319 }, { 112, 5320 }, 
+	{ 114, 5321 }, { 59, 5322 }, { 100, 5323 }, { 110, 5324 }, { 117, 5325 }, { 117, 5326 }, { 101, 5327 }, { 114, 5328 }, { 111, 5329 }, { 97, 5330 }, { 114, 5331 }, { 110, 5332 }, { 112, 5333 }, { 107, 5334 }, { 59, 5335 }, { 59, 5336 }, { 59, 5337 }, { 59, 5338 }, { 108, 5339 }, { 97, 5340 }, 
+	{ 59, 5341 }, { 101, 5342 }, { 114, 5343 }, { 110, 5344 }, { 59, 5345 }, { 110, 5346 }, { 59, 5347 }, { 101, 5348 }, { 116, 5349 }, { 101, 5350 }, { 116, 5351 }, { 59, 5352 }, { 59, 5353 }, { 115, 5354 }, { 118, 5355 }, { 51, 5356 }, { 52, 5357 }, { 59, 5358 }, { 108, 5359 }, { 59, 5360 }, 
+	{ 111, 5361 }, { 59, 5362 }, { 99, 5363 }, { 111, 5364 }, { 59, 5365 }, { 110, 5366 }, { 115, 5367 }, { 116, 5368 }, { 59, 5369 }, { 68, 5370 }, { 114, 5371 }, { 59, 5372 }, { 59, 5373 }, { 59, 5374 }, { 59, 5375 }, { 116, 5376 }, { 101, 5377 }, { 110, 5378 }, { 101, 5379 }, { 103, 5380 }, 
+	{ 59, 5381 }, { 103, 5382 }, { 59, 5383 }, { 59, 5384 }, { 59, 5385 }, { 59, 5386 }, { 108, 5387 }, { 59, 5388 }, { 105, 5389 }, { 50, 5390 }, { 51, 5391 }, { 52, 5392 }, { 53, 5393 }, { 54, 5394 }, { 56, 5395 }, { 51, 5396 }, { 53, 5397 }, { 52, 5398 }, { 53, 5399 }, { 56, 5400 }, 
+	{ 53, 5401 }, { 54, 5402 }, { 56, 5403 }, { 56, 5404 }, { 59, 5405 }, { 59, 5406 }, { 101, 5407 }, { 59, 5408 }, { 100, 5409 }, { 101, 5410 }, { 59, 5411 }, { 97, 5412 }, { 59, 5413 }, { 116, 5414 }, { 115, 5415 }, { 59, 5416 }, { 114, 5417 }, { 59, 5418 }, { 59, 5419 }, { 59, 5420 }, 
+	{ 59, 5421 }, { 59, 5422 }, { 59, 5423 }, { 59, 5424 }, { 114, 5425 }, { 115, 5426 }, { 112, 5427 }, { 114, 5428 }, { 116, 5429 }, { 108, 5430 }, { 113, 5431 }, { 115, 5432 }, { 109, 5433 }, { 110, 5434 }, { 112, 5435 }, { 116, 5436 }, { 121, 5437 }, { 105, 5438 }, { 59, 5439 }, { 59, 5440 }, 
+	{ 115, 5441 }, { 112, 5442 }, { 110, 5443 }, { 114, 5444 }, { 114, 5445 }, { 59, 5446 }, { 116, 5447 }, { 101, 5448 }, { 105, 5449 }, { 114, 5450 }, { 104, 5451 }, { 107, 5452 }, { 108, 5453 }, { 110, 5454 }, { 101, 5455 }, { 59, 5456 }, { 59, 5457 }, { 101, 5458 }, { 116, 5459 }, { 59, 5460 }, 
+	{ 110, 5461 }, { 59, 5462 }, { 59, 5463 }, { 59, 5464 }, { 59, 5465 }, { 105, 5466 }, { 97, 5467 }, { 59, 5468 }, { 59, 5469 }, { 101, 5470 }, { 59, 5471 }, { 116, 5472 }, { 116, 5473 }, { 108, 5474 }, { 101, 5475 }, { 99, 5476 }, { 114, 5477 }, { 111, 5478 }, { 59, 5479 }, { 59, 5480 }, 
+	{ 116, 5481 }, { 59, 5482 }, { 111, 5483 }, { 59, 5484 }, { 118, 5485 }, { 59, 5486 }, { 101, 5487 }, { 59, 5488 }, { 59, 5489 }, { 59, 5490 }, { 121, 5491 }, { 59, 5492 }, { 59, 5493 }, { 118, 5494 }, { 108, 5495 }, { 110, 5496 }, { 59, 5497 }, { 108, 5498 }, { 59, 5499 }, { 101, 5500 }, 
+	{ 116, 5501 }, { 110, 5502 }, { 97, 5503 }, { 59, 5504 }, { 101, 5505 }, { 59, 5506 }, { 59, 5507 }, { 102, 5508 }, { 115, 5509 }, { 107, 5510 }, { 112, 5511 }, { 108, 5512 }, { 105, 5513 }, { 108, 5514 }, { 108, 5515 }, { 59, 5516 }, { 59, 5517 }, { 59, 5518 }, { 101, 5519 }, { 107, 5520 }, 
+	{ 59, 5521 }, { 108, 5522 }, { 110, 5523 }, { 108, 5524 }, { 59, 5525 }, { 59, 5526 }, { 114, 5527 }, { 97, 5528 }, { 104, 5529 }, { 114, 5530 }, { 97, 5531 }, { 101, 5532 }, { 105, 5533 }, { 104, 5534 }, { 97, 5535 }, { 59, 5536 }, { 116, 5537 }, { 115, 5538 }, { 112, 5539 }, { 111, 5540 }, 
+	{ 113, 5541 }, { 116, 5542 }, { 105, 5543 }, { 116, 5544 }, { 114, 5545 }, { 59, 5546 }, { 59, 5547 }, { 108, 5548 }, { 59, 5549 }, { 59, 5550 }, { 110, 5551 }, { 100, 5552 }, { 59, 5553 }, { 116, 5554 }, { 116, 5555 }, { 114, 5556 }, { 59, 5557 }, { 59, 5558 }, { 59, 5559 }, { 59, 5560 }, 
+	{ 59, 5561 }, { 101, 5562 }, { 97, 5563 }, { 105, 5564 }, { 114, 5565 }, { 59, 5566 }, { 115, 5567 }, { 101, 5568 }, { 116, 5569 }, { 114, 5570 }, { 103, 5571 }, { 116, 5572 }, { 59, 5573 }, { 110, 5574 }, { 59, 5575 }, { 100, 5576 }, { 59, 5577 }, { 111, 5578 }, { 59, 5579 }, { 59, 5580 }, 
+	{ 59, 5581 }, { 114, 5582 }, { 107, 5583 }, { 59, 5584 }, { 59, 5585 }, { 101, 5586 }, { 115, 5587 }, { 114, 5588 }, { 115, 5589 }, { 114, 5590 }, { 59, 5591 }, { 59, 5592 }, { 104, 5593 }, { 97, 5594 }, { 110, 5595 }, { 59, 5596 }, { 115, 5597 }, { 111, 5598 }, { 114, 5599 }, { 97, 5600 }, 
+	{ 59, 5601 }, { 114, 5602 }, { 59, 5603 }, { 116, 5604 }, { 114, 5605 }, { 116, 5606 }, { 59, 5607 }, { 98, 5608 }, { 100, 5609 }, { 115, 5610 }, { 115, 5611 }, { 115, 5612 }, { 109, 5613 }, { 59, 5614 }, { 97, 5615 }, { 114, 5616 }, { 116, 5617 }, { 104, 5618 }, { 104, 5619 }, { 59, 5620 }, 
+	{ 101, 5621 }, { 59, 5622 }, { 59, 5623 }, { 111, 5624 }, { 59, 5625 }, { 97, 5626 }, { 59, 5627 }, { 101, 5628 }, { 110, 5629 }, { 108, 5630 }, { 59, 5631 }, { 100, 5632 }, { 59, 5633 }, { 59, 5634 }, { 107, 5635 }, { 59, 5636 }, { 111, 5637 }, { 59, 5638 }, { 118, 5639 }, { 114, 5640 }, 
+	{ 59, 5641 }, { 116, 5642 }, { 59, 5643 }, { 108, 5644 }, { 59, 5645 }, { 59, 5646 }, { 59, 5647 }, { 59, 5648 }, { 59, 5649 }, { 59, 5650 }, { 97, 5651 }, { 114, 5652 }, { 59, 5653 }, { 108, 5654 }, { 59, 5655 }, { 59, 5656 }, { 59, 5657 }, { 101, 5658 }, { 59, 5659 }, { 69, 5660 }, 
+	{ 100, 5661 }, { 118, 5662 }, { 59, 5663 }, { 118, 5664 }, { 108, 5665 }, { 108, 5666 }, { 59, 5667 }, { 110, 5668 }, { 101, 5669 }, { 59, 5670 }, { 101, 5671 }, { 59, 5672 }, { 59, 5673 }, { 99, 5674 }, { 119, 5675 }, { 116, 5676 }, { 59, 5677 }, { 101, 5678 }, { 101, 5679 }, { 116, 5680 }, 
+	{ 59, 5681 }, { 113, 5682 }, { 59, 5683 }, { 59, 5684 }, { 98, 5685 }, { 112, 5686 }, { 59, 5687 }, { 59, 5688 }, { 101, 5689 }, { 59, 5690 }, { 101, 5691 }, { 59, 5692 }, { 59, 5693 }, { 101, 5694 }, { 101, 5695 }, { 110, 5696 }, { 111, 5697 }, { 59, 5698 }, { 104, 5699 }, { 114, 5700 }, 
+	{ 104, 5701 }, { 105, 5702 }, { 114, 5703 }, { 105, 5704 }, { 114, 5705 }, { 105, 5706 }, { 59, 5707 }, { 59, 5708 }, { 107, 5709 }, { 59, 5710 }, { 111, 5711 }, { 114, 5712 }, { 101, 5713 }, { 59, 5714 }, { 59, 5715 }, { 99, 5716 }, { 100, 5717 }, { 59, 5718 }, { 59, 5719 }, { 101, 5720 }, 
+	{ 59, 5721 }, { 59, 5722 }, { 59, 5723 }, { 115, 5724 }, { 59, 5725 }, { 59, 5726 }, { 59, 5727 }, { 111, 5728 }, { 115, 5729 }, { 59, 5730 }, { 59, 5731 }, { 59, 5732 }, { 59, 5733 }, { 111, 5734 }, { 102, 5735 }, { 112, 5736 }, { 104, 5737 }, { 101, 5738 }, { 115, 5739 }, { 59, 5740 }, 
+	{ 108, 5741 }, { 109, 5742 }, { 59, 5743 }, { 116, 5744 }, { 100, 5745 }, { 108, 5746 }, { 110, 5747 }, { 116, 5748 }, { 59, 5749 }, { 102, 5750 }, { 107, 5751 }, { 118, 5752 }, { 99, 5753 }, { 59, 5754 }, { 105, 5755 }, { 111, 5756 }, { 117, 5757 }, { 59, 5758 }, { 110, 5759 }, { 105, 5760 }, 
+	{ 119, 5761 }, { 105, 5762 }, { 59, 5763 }, { 59, 5764 }, { 112, 5765 }, { 117, 5766 }, { 113, 5767 }, { 97, 5768 }, { 101, 5769 }, { 115, 5770 }, { 105, 5771 }, { 59, 5772 }, { 115, 5773 }, { 59, 5774 }, { 109, 5775 }, { 108, 5776 }, { 105, 5777 }, { 117, 5778 }, { 111, 5779 }, { 59, 5780 }, 
+	{ 108, 5781 }, { 112, 5782 }, { 101, 5783 }, { 114, 5784 }, { 110, 5785 }, { 59, 5786 }, { 101, 5787 }, { 59, 5788 }, { 108, 5789 }, { 59, 5790 }, { 101, 5791 }, { 59, 5792 }, { 116, 5793 }, { 59, 5794 }, { 59, 5795 }, { 101, 5796 }, { 59, 5797 }, { 112, 5798 }, { 59, 5799 }, { 102, 5800 }, 
+	{ 59, 5801 }, { 115, 5802 }, { 107, 5803 }, { 112, 5804 }, { 108, 5805 }, { 105, 5806 }, { 108, 5807 }, { 59, 5808 }, { 108, 5809 }, { 59, 5810 }, { 110, 5811 }, { 59, 5812 }, { 59, 5813 }, { 101, 5814 }, { 107, 5815 }, { 59, 5816 }, { 108, 5817 }, { 110, 5818 }, { 108, 5819 }, { 59, 5820 }, 
+	{ 97, 5821 }, { 59, 5822 }, { 114, 5823 }, { 110, 5824 }, { 97, 5825 }, { 59, 5826 }, { 116, 5827 }, { 114, 5828 }, { 59, 5829 }, { 59, 5830 }, { 108, 5831 }, { 97, 5832 }, { 104, 5833 }, { 108, 5834 }, { 114, 5835 }, { 115, 5836 }, { 116, 5837 }, { 103, 5838 }, { 59, 5839 }, { 59, 5840 }, 
+	{ 116, 5841 }, { 59, 5842 }, { 59, 5843 }, { 59, 5844 }, { 59, 5845 }, { 59, 5846 }, { 115, 5847 }, { 101, 5848 }, { 116, 5849 }, { 105, 5850 }, { 59, 5851 }, { 111, 5852 }, { 59, 5853 }, { 114, 5854 }, { 101, 5855 }, { 115, 5856 }, { 59, 5857 }, { 59, 5858 }, { 116, 5859 }, { 97, 5860 }, 
+	{ 101, 5861 }, { 59, 5862 }, { 110, 5863 }, { 59, 5864 }, { 108, 5865 }, { 59, 5866 }, { 59, 5867 }, { 109, 5868 }, { 105, 5869 }, { 59, 5870 }, { 59, 5871 }, { 59, 5872 }, { 59, 5873 }, { 107, 5874 }, { 59, 5875 }, { 111, 5876 }, { 114, 5877 }, { 110, 5878 }, { 59, 5879 }, { 110, 5880 }, 
+	{ 59, 5881 }, { 121, 5882 }, { 109, 5883 }, { 112, 5884 }, { 59, 5885 }, { 102, 5886 }, { 118, 5887 }, { 116, 5888 }, { 59, 5889 }, { 59, 5890 }, { 59, 5891 }, { 59, 5892 }, { 117, 5893 }, { 114, 5894 }, { 59, 5895 }, { 115, 5896 }, { 112, 5897 }, { 114, 5898 }, { 59, 5899 }, { 59, 5900 }, 
+	{ 121, 5901 }, { 114, 5902 }, { 115, 5903 }, { 59, 5904 }, { 115, 5905 }, { 59, 5906 }, { 115, 5907 }, { 59, 5908 }, { 101, 5909 }, { 115, 5910 }, { 59, 5911 }, { 101, 5912 }, { 115, 5913 }, { 101, 5914 }, { 102, 5915 }, { 59, 5916 }, { 110, 5917 }, { 101, 5918 }, { 102, 5919 }, { 59, 5920 }, 
+	{ 103, 5921 }, { 59, 5922 }, { 116, 5923 }, { 111, 5924 }, { 108, 5925 }, { 59, 5926 }, { 59, 5927 }, { 117, 5928 }, { 114, 5929 }, { 116, 5930 }, { 109, 5931 }, { 98, 5932 }, { 112, 5933 }, { 112, 5934 }, { 117, 5935 }, { 113, 5936 }, { 97, 5937 }, { 101, 5938 }, { 115, 5939 }, { 105, 5940 }, 
+	{ 116, 5941 }, { 117, 5942 }, { 111, 5943 }, { 111, 5944 }, { 117, 5945 }, { 114, 5946 }, { 108, 5947 }, { 59, 5948 }, { 59, 5949 }, { 117, 5950 }, { 116, 5951 }, { 109, 5952 }, { 98, 5953 }, { 112, 5954 }, { 59, 5955 }, { 107, 5956 }, { 59, 5957 }, { 111, 5958 }, { 114, 5959 }, { 59, 5960 }, 
+	{ 116, 5961 }, { 110, 5962 }, { 108, 5963 }, { 99, 5964 }, { 52, 5965 }, { 102, 5966 }, { 59, 5967 }, { 115, 5968 }, { 118, 5969 }, { 97, 5970 }, { 115, 5971 }, { 112, 5972 }, { 59, 5973 }, { 109, 5974 }, { 59, 5975 }, { 59, 5976 }, { 59, 5977 }, { 98, 5978 }, { 100, 5979 }, { 116, 5980 }, 
+	{ 114, 5981 }, { 114, 5982 }, { 101, 5983 }, { 59, 5984 }, { 103, 5985 }, { 116, 5986 }, { 110, 5987 }, { 117, 5988 }, { 59, 5989 }, { 109, 5990 }, { 105, 5991 }, { 59, 5992 }, { 107, 5993 }, { 59, 5994 }, { 97, 5995 }, { 101, 5996 }, { 59, 5997 }, { 101, 5998 }, { 59, 5999 }, { 59, 6000 }, 
+	{ 99, 6001 }, { 59, 6002 }, { 116, 6003 }, { 101, 6004 }, { 59, 6005 }, { 59, 6006 }, { 59, 6007 }, { 110, 6008 }, { 112, 6009 }, { 59, 6010 }, { 59, 6011 }, { 59, 6012 }, { 111, 6013 }, { 110, 6014 }, { 112, 6015 }, { 59, 6016 }, { 59, 6017 }, { 111, 6018 }, { 114, 6019 }, { 110, 6020 }, 
+	{ 112, 6021 }, { 59, 6022 }, { 59, 6023 }, { 59, 6024 }, { 101, 6025 }, { 59, 6026 }, { 59, 6027 }, { 108, 6028 }, { 59, 6029 }, { 59, 6030 }, { 116, 6031 }, { 115, 6032 }, { 112, 6033 }, { 116, 6034 }, { 105, 6035 }, { 59, 6036 }, { 111, 6037 }, { 111, 6038 }, { 103, 6039 }, { 98, 6040 }, 
+	{ 112, 6041 }, { 101, 6042 }, { 105, 6043 }, { 59, 6044 }, { 114, 6045 }, { 59, 6046 }, { 112, 6047 }, { 114, 6048 }, { 59, 6049 }, { 59, 6050 }, { 59, 6051 }, { 59, 6052 }, { 59, 6053 }, { 69, 6054 }, { 101, 6055 }, { 69, 6056 }, { 101, 6057 }, { 97, 6058 }, { 59, 6059 }, { 114, 6060 }, 
+	{ 59, 6061 }, { 113, 6062 }, { 112, 6063 }, { 104, 6064 }, { 59, 6065 }, { 59, 6066 }, { 59, 6067 }, { 59, 6068 }, { 59, 6069 }, { 59, 6070 }, { 59, 6071 }, { 115, 6072 }, { 101, 6073 }, { 59, 6074 }, { 59, 6075 }, { 112, 6076 }, { 115, 6077 }, { 59, 6078 }, { 101, 6079 }, { 101, 6080 }, 
+	{ 59, 6081 }, { 101, 6082 }, { 110, 6083 }, { 102, 6084 }, { 114, 6085 }, { 59, 6086 }, { 59, 6087 }, { 59, 6088 }, { 117, 6089 }, { 59, 6090 }, { 59, 6091 }, { 97, 6092 }, { 59, 6093 }, { 101, 6094 }, { 108, 6095 }, { 59, 6096 }, { 59, 6097 }, { 108, 6098 }, { 115, 6099 }, { 59, 6100 }, 
+	{ 59, 6101 }, { 116, 6102 }, { 97, 6103 }, { 68, 6104 }, { 68, 6105 }, { 77, 6106 }, { 80, 6107 }, { 84, 6108 }, { 105, 6109 }, { 117, 6110 }, { 59, 6111 }, { 101, 6112 }, { 59, 6113 }, { 114, 6114 }, { 117, 6115 }, { 114, 6116 }, { 59, 6117 }, { 104, 6118 }, { 59, 6119 }, { 59, 6120 }, 
+	{ 116, 6121 }, { 100, 6122 }, { 101, 6123 }, { 59, 6124 }, { 97, 6125 }, { 67, 6126 }, { 68, 6127 }, { 76, 6128 }, { 82, 6129 }, { 85, 6130 }, { 86, 6131 }, { 114, 6132 }, { 101, 6133 }, { 102, 6134 }, { 103, 6135 }, { 101, 6136 }, { 114, 6137 }, { 59, 6138 }, { 59, 6139 }, { 59, 6140 }, 
+	{ 59, 6141 }, { 116, 6142 }, { 109, 6143 }, { 101, 6144 }, { 110, 6145 }, { 105, 6146 }, { 98, 6147 }, { 59, 6148 }, { 110, 6149 }, { 83, 6150 }, { 86, 6151 }, { 59, 6152 }, { 114, 6153 }, { 59, 6154 }, { 59, 6155 }, { 59, 6156 }, { 114, 6157 }, { 59, 6158 }, { 116, 6159 }, { 110, 6160 }, 
+	{ 59, 6161 }, { 119, 6162 }, { 117, 6163 }, { 59, 6164 }, { 59, 6165 }, { 97, 6166 }, { 115, 6167 }, { 97, 6168 }, { 101, 6169 }, { 98, 6170 }, { 59, 6171 }, { 59, 6172 }, { 59, 6173 }, { 59, 6174 }, { 59, 6175 }, { 101, 6176 }, { 59, 6177 }, { 59, 6178 }, { 103, 6179 }, { 114, 6180 }, 
+	{ 105, 6181 }, { 117, 6182 }, { 119, 6183 }, { 111, 6184 }, { 103, 6185 }, { 101, 6186 }, { 105, 6187 }, { 68, 6188 }, { 84, 6189 }, { 86, 6190 }, { 99, 6191 }, { 114, 6192 }, { 103, 6193 }, { 117, 6194 }, { 108, 6195 }, { 101, 6196 }, { 115, 6197 }, { 97, 6198 }, { 108, 6199 }, { 114, 6200 }, 
+	{ 59, 6201 }, { 102, 6202 }, { 103, 6203 }, { 102, 6204 }, { 103, 6205 }, { 101, 6206 }, { 105, 6207 }, { 59, 6208 }, { 83, 6209 }, { 116, 6210 }, { 108, 6211 }, { 59, 6212 }, { 59, 6213 }, { 59, 6214 }, { 118, 6215 }, { 71, 6216 }, { 76, 6217 }, { 101, 6218 }, { 107, 6219 }, { 97, 6220 }, 
+	{ 103, 6221 }, { 67, 6222 }, { 98, 6223 }, { 109, 6224 }, { 97, 6225 }, { 115, 6226 }, { 97, 6227 }, { 112, 6228 }, { 116, 6229 }, { 115, 6230 }, { 116, 6231 }, { 99, 6232 }, { 101, 6233 }, { 104, 6234 }, { 97, 6235 }, { 115, 6236 }, { 99, 6237 }, { 101, 6238 }, { 100, 6239 }, { 116, 6240 }, 
+	{ 59, 6241 }, { 59, 6242 }, { 59, 6243 }, { 59, 6244 }, { 110, 6245 }, { 114, 6246 }, { 59, 6247 }, { 59, 6248 }, { 59, 6249 }, { 114, 6250 }, { 97, 6251 }, { 114, 6252 }, { 108, 6253 }, { 110, 6254 }, { 114, 6255 }, { 101, 6256 }, { 116, 6257 }, { 116, 6258 }, { 59, 6259 }, { 59, 6260 }, 
+	{ 59, 6261 }, { 59, 6262 }, { 101, 6263 }, { 110, 6264 }, { 114, 6265 }, { 101, 6266 }, { 111, 6267 }, { 108, 6268 }, { 101, 6269 }, { 114, 6270 }, { 112, 6271 }, { 101, 6272 }, { 114, 6273 }, { 109, 6274 }, { 97, 6275 }, { 108, 6276 }, { 59, 6277 }, { 59, 6278 }, { 59, 6279 }, { 59, 6280 }, 
+	{ 59, 6281 }, { 111, 6282 }, { 101, 6283 }, { 105, 6284 }, { 112, 6285 }, { 105, 6286 }, { 59, 6287 }, { 73, 6288 }, { 83, 6289 }, { 85, 6290 }, { 59, 6291 }, { 69, 6292 }, { 100, 6293 }, { 97, 6294 }, { 101, 6295 }, { 59, 6296 }, { 59, 6297 }, { 59, 6298 }, { 111, 6299 }, { 112, 6300 }, 
+	{ 97, 6301 }, { 113, 6302 }, { 117, 6303 }, { 105, 6304 }, { 68, 6305 }, { 59, 6306 }, { 59, 6307 }, { 105, 6308 }, { 59, 6309 }, { 59, 6310 }, { 59, 6311 }, { 97, 6312 }, { 114, 6313 }, { 97, 6314 }, { 108, 6315 }, { 119, 6316 }, { 65, 6317 }, { 108, 6318 }, { 114, 6319 }, { 119, 6320 }, 
+	{ 97, 6321 }, { 101, 6322 }, { 105, 6323 }, { 110, 6324 }, { 59, 6325 }, { 59, 6326 }, { 59, 6327 }, { 97, 6328 }, { 105, 6329 }, { 59, 6330 }, { 59, 6331 }, { 59, 6332 }, { 59, 6333 }, { 100, 6334 }, { 59, 6335 }, { 59, 6336 }, { 59, 6337 }, { 109, 6338 }, { 59, 6339 }, { 112, 6340 }, 
+	{ 59, 6341 }, { 97, 6342 }, { 98, 6343 }, { 59, 6344 }, { 114, 6345 }, { 59, 6346 }, { 59, 6347 }, { 101, 6348 }, { 113, 6349 }, { 59, 6350 }, { 110, 6351 }, { 110, 6352 }, { 115, 6353 }, { 105, 6354 }, { 109, 6355 }, { 59, 6356 }, { 59, 6357 }, { 103, 6358 }, { 114, 6359 }, { 59, 6360 }, 
+	{ 101, 6361 }, { 118, 6362 }, { 59, 6363 }, { 110, 6364 }, { 59, 6365 }, { 99, 6366 }, { 59, 6367 }, { 116, 6368 }, { 117, 6369 }, { 109, 6370 }, { 117, 6371 }, { 114, 6372 }, { 97, 6373 }, { 117, 6374 }, { 59, 6375 }, { 103, 6376 }, { 59, 6377 }, { 111, 6378 }, { 113, 6379 }, { 114, 6380 }, 
+	{ 118, 6381 }, { 59, 6382 }, { 59, 6383 }, { 59, 6384 }, { 117, 6385 }, { 115, 6386 }, { 101, 6387 }, { 59, 6388 }, { 59, 6389 }, { 117, 6390 }, { 59, 6391 }, { 59, 6392 }, { 59, 6393 }, { 59, 6394 }, { 117, 6395 }, { 59, 6396 }, { 59, 6397 }, { 59, 6398 }, { 59, 6399 }, { 59, 6400 }, 
+	{ 109, 6401 }, { 118, 6402 }, { 100, 6403 }, { 97, 6404 }, { 59, 6405 }, { 97, 6406 }, { 100, 6407 }, { 110, 6408 }, { 59, 6409 }, { 114, 6410 }, { 105, 6411 }, { 59, 6412 }, { 113, 6413 }, { 59, 6414 }, { 59, 6415 }, { 109, 6416 }, { 120, 6417 }, { 116, 6418 }, { 59, 6419 }, { 59, 6420 }, 
+	{ 59, 6421 }, { 108, 6422 }, { 114, 6423 }, { 59, 6424 }, { 112, 6425 }, { 97, 6426 }, { 59, 6427 }, { 59, 6428 }, { 59, 6429 }, { 59, 6430 }, { 109, 6431 }, { 113, 6432 }, { 101, 6433 }, { 101, 6434 }, { 59, 6435 }, { 114, 6436 }, { 110, 6437 }, { 59, 6438 }, { 59, 6439 }, { 59, 6440 }, 
+	{ 119, 6441 }, { 59, 6442 }, { 114, 6443 }, { 113, 6444 }, { 118, 6445 }, { 59, 6446 }, { 100, 6447 }, { 97, 6448 }, { 59, 6449 }, { 111, 6450 }, { 59, 6451 }, { 59, 6452 }, { 59, 6453 }, { 59, 6454 }, { 111, 6455 }, { 117, 6456 }, { 115, 6457 }, { 97, 6458 }, { 98, 6459 }, { 114, 6460 }, 
+	{ 119, 6461 }, { 114, 6462 }, { 111, 6463 }, { 59, 6464 }, { 59, 6465 }, { 59, 6466 }, { 101, 6467 }, { 114, 6468 }, { 59, 6469 }, { 59, 6470 }, { 59, 6471 }, { 59, 6472 }, { 59, 6473 }, { 59, 6474 }, { 114, 6475 }, { 59, 6476 }, { 101, 6477 }, { 59, 6478 }, { 59, 6479 }, { 59, 6480 }, 
+	{ 59, 6481 }, { 110, 6482 }, { 59, 6483 }, { 110, 6484 }, { 116, 6485 }, { 59, 6486 }, { 59, 6487 }, { 68, 6488 }, { 115, 6489 }, { 97, 6490 }, { 110, 6491 }, { 103, 6492 }, { 59, 6493 }, { 59, 6494 }, { 59, 6495 }, { 59, 6496 }, { 110, 6497 }, { 59, 6498 }, { 59, 6499 }, { 59, 6500 }, 
+	{ 59, 6501 }, { 59, 6502 }, { 59, 6503 }, { 59, 6504 }, { 59, 6505 }, { 59, 6506 }, { 59, 6507 }, { 59, 6508 }, { 59, 6509 }, { 59, 6510 }, { 59, 6511 }, { 59, 6512 }, { 59, 6513 }, { 59, 6514 }, { 59, 6515 }, { 110, 6516 }, { 59, 6517 }, { 111, 6518 }, { 59, 6519 }, { 111, 6520 }, 
+	{ 59, 6521 }, { 116, 6522 }, { 114, 6523 }, { 59, 6524 }, { 59, 6525 }, { 101, 6526 }, { 108, 6527 }, { 115, 6528 }, { 59, 6529 }, { 101, 6530 }, { 59, 6531 }, { 59, 6532 }, { 59, 6533 }, { 114, 6534 }, { 59, 6535 }, { 117, 6536 }, { 59, 6537 }, { 59, 6538 }, { 111, 6539 }, { 111, 6540 }, 
+	{ 59, 6541 }, { 102, 6542 }, { 103, 6543 }, { 59, 6544 }, { 59, 6545 }, { 59, 6546 }, { 59, 6547 }, { 59, 6548 }, { 59, 6549 }, { 59, 6550 }, { 59, 6551 }, { 59, 6552 }, { 110, 6553 }, { 114, 6554 }, { 59, 6555 }, { 105, 6556 }, { 59, 6557 }, { 59, 6558 }, { 114, 6559 }, { 97, 6560 }, 
+	{ 104, 6561 }, { 100, 6562 }, { 59, 6563 }, { 116, 6564 }, { 59, 6565 }, { 59, 6566 }, { 59, 6567 }, { 59, 6568 }, { 59, 6569 }, { 59, 6570 }, { 59, 6571 }, { 59, 6572 }, { 121, 6573 }, { 59, 6574 }, { 59, 6575 }, { 59, 6576 }, { 115, 6577 }, { 59, 6578 }, { 59, 6579 }, { 59, 6580 }, 
+	{ 59, 6581 }, { 109, 6582 }, { 59, 6583 }, { 59, 6584 }, { 59, 6585 }, { 59, 6586 }, { 100, 6587 }, { 117, 6588 }, { 59, 6589 }, { 59, 6590 }, { 59, 6591 }, { 114, 6592 }, { 97, 6593 }, { 114, 6594 }, { 114, 6595 }, { 102, 6596 }, { 103, 6597 }, { 114, 6598 }, { 110, 6599 }, { 59, 6600 }, 
+	{ 111, 6601 }, { 59, 6602 }, { 112, 6603 }, { 116, 6604 }, { 103, 6605 }, { 113, 6606 }, { 114, 6607 }, { 109, 6608 }, { 59, 6609 }, { 59, 6610 }, { 59, 6611 }, { 101, 6612 }, { 59, 6613 }, { 59, 6614 }, { 59, 6615 }, { 97, 6616 }, { 111, 6617 }, { 102, 6618 }, { 112, 6619 }, { 103, 6620 }, 
+	{ 114, 6621 }, { 59, 6622 }, { 115, 6623 }, { 59, 6624 }, { 59, 6625 }, { 101, 6626 }, { 59, 6627 }, { 101, 6628 }, { 59, 6629 }, { 59, 6630 }, { 59, 6631 }, { 59, 6632 }, { 59, 6633 }, { 59, 6634 }, { 59, 6635 }, { 116, 6636 }, { 59, 6637 }, { 97, 6638 }, { 114, 6639 }, { 101, 6640 }, 
+	{ 101, 6641 }, { 59, 6642 }, { 100, 6643 }, { 108, 6644 }, { 117, 6645 }, { 59, 6646 }, { 59, 6647 }, { 101, 6648 }, { 59, 6649 }, { 59, 6650 }, { 59, 6651 }, { 59, 6652 }, { 59, 6653 }, { 117, 6654 }, { 59, 6655 }, { 59, 6656 }, { 59, 6657 }, { 97, 6658 }, { 114, 6659 }, { 105, 6660 }, 
+	{ 97, 6661 }, { 59, 6662 }, { 59, 6663 }, { 59, 6664 }, { 120, 6665 }, { 108, 6666 }, { 59, 6667 }, { 59, 6668 }, { 59, 6669 }, { 111, 6670 }, { 59, 6671 }, { 119, 6672 }, { 59, 6673 }, { 59, 6674 }, { 59, 6675 }, { 115, 6676 }, { 97, 6677 }, { 114, 6678 }, { 105, 6679 }, { 97, 6680 }, 
+	{ 59, 6681 }, { 59, 6682 }, { 111, 6683 }, { 97, 6684 }, { 98, 6685 }, { 99, 6686 }, { 97, 6687 }, { 98, 6688 }, { 99, 6689 }, { 108, 6690 }, { 59, 6691 }, { 116, 6692 }, { 59, 6693 }, { 113, 6694 }, { 59, 6695 }, { 59, 6696 }, { 97, 6697 }, { 59, 6698 }, { 59, 6699 }, { 109, 6700 }, 
+	{ 112, 6701 }, { 59, 6702 }, { 101, 6703 }, { 101, 6704 }, { 116, 6705 }, { 113, 6706 }, { 116, 6707 }, { 59, 6708 }, { 103, 6709 }, { 59, 6710 }, { 59, 6711 }, { 59, 6712 }, { 59, 6713 }, { 110, 6714 }, { 59, 6715 }, { 101, 6716 }, { 59, 6717 }, { 101, 6718 }, { 59, 6719 }, { 119, 6720 }, 
+	{ 59, 6721 }, { 59, 6722 }, { 59, 6723 }, { 59, 6724 }, { 59, 6725 }, { 115, 6726 }, { 110, 6727 }, { 59, 6728 }, { 102, 6729 }, { 59, 6730 }, { 101, 6731 }, { 59, 6732 }, { 59, 6733 }, { 59, 6734 }, { 97, 6735 }, { 101, 6736 }, { 59, 6737 }, { 59, 6738 }, { 59, 6739 }, { 59, 6740 }, 
+	{ 107, 6741 }, { 59, 6742 }, { 111, 6743 }, { 59, 6744 }, { 104, 6745 }, { 59, 6746 }, { 105, 6747 }, { 114, 6748 }, { 59, 6749 }, { 59, 6750 }, { 59, 6751 }, { 109, 6752 }, { 111, 6753 }, { 110, 6754 }, { 112, 6755 }, { 114, 6756 }, { 59, 6757 }, { 112, 6758 }, { 113, 6759 }, { 105, 6760 }, 
+	{ 109, 6761 }, { 59, 6762 }, { 59, 6763 }, { 97, 6764 }, { 110, 6765 }, { 114, 6766 }, { 59, 6767 }, { 59, 6768 }, { 59, 6769 }, { 59, 6770 }, { 110, 6771 }, { 116, 6772 }, { 113, 6773 }, { 59, 6774 }, { 59, 6775 }, { 121, 6776 }, { 59, 6777 }, { 59, 6778 }, { 115, 6779 }, { 59, 6780 }, 
+	{ 59, 6781 }, { 59, 6782 }, { 59, 6783 }, { 109, 6784 }, { 59, 6785 }, { 59, 6786 }, { 97, 6787 }, { 59, 6788 }, { 59, 6789 }, { 100, 6790 }, { 117, 6791 }, { 59, 6792 }, { 59, 6793 }, { 114, 6794 }, { 59, 6795 }, { 101, 6796 }, { 114, 6797 }, { 59, 6798 }, { 59, 6799 }, { 59, 6800 }, 
+	{ 114, 6801 }, { 97, 6802 }, { 101, 6803 }, { 105, 6804 }, { 113, 6805 }, { 104, 6806 }, { 100, 6807 }, { 59, 6808 }, { 97, 6809 }, { 59, 6810 }, { 115, 6811 }, { 59, 6812 }, { 110, 6813 }, { 59, 6814 }, { 59, 6815 }, { 59, 6816 }, { 59, 6817 }, { 114, 6818 }, { 114, 6819 }, { 59, 6820 }, 
+	{ 59, 6821 }, { 59, 6822 }, { 59, 6823 }, { 110, 6824 }, { 59, 6825 }, { 119, 6826 }, { 59, 6827 }, { 117, 6828 }, { 59, 6829 }, { 59, 6830 }, { 105, 6831 }, { 97, 6832 }, { 59, 6833 }, { 59, 6834 }, { 59, 6835 }, { 115, 6836 }, { 114, 6837 }, { 101, 6838 }, { 59, 6839 }, { 115, 6840 }, 
+	{ 59, 6841 }, { 59, 6842 }, { 59, 6843 }, { 117, 6844 }, { 59, 6845 }, { 59, 6846 }, { 59, 6847 }, { 101, 6848 }, { 59, 6849 }, { 101, 6850 }, { 59, 6851 }, { 59, 6852 }, { 59, 6853 }, { 59, 6854 }, { 59, 6855 }, { 104, 6856 }, { 59, 6857 }, { 116, 6858 }, { 116, 6859 }, { 115, 6860 }, 
+	{ 114, 6861 }, { 59, 6862 }, { 101, 6863 }, { 110, 6864 }, { 59, 6865 }, { 59, 6866 }, { 59, 6867 }, { 112, 6868 }, { 114, 6869 }, { 59, 6870 }, { 112, 6871 }, { 113, 6872 }, { 105, 6873 }, { 109, 6874 }, { 59, 6875 }, { 98, 6876 }, { 116, 6877 }, { 108, 6878 }, { 98, 6879 }, { 114, 6880 }, 
+	{ 116, 6881 }, { 115, 6882 }, { 59, 6883 }, { 101, 6884 }, { 110, 6885 }, { 59, 6886 }, { 59, 6887 }, { 59, 6888 }, { 59, 6889 }, { 119, 6890 }, { 59, 6891 }, { 59, 6892 }, { 59, 6893 }, { 59, 6894 }, { 59, 6895 }, { 59, 6896 }, { 111, 6897 }, { 121, 6898 }, { 59, 6899 }, { 112, 6900 }, 
+	{ 105, 6901 }, { 59, 6902 }, { 59, 6903 }, { 59, 6904 }, { 97, 6905 }, { 59, 6906 }, { 59, 6907 }, { 59, 6908 }, { 107, 6909 }, { 59, 6910 }, { 108, 6911 }, { 59, 6912 }, { 117, 6913 }, { 115, 6914 }, { 101, 6915 }, { 117, 6916 }, { 59, 6917 }, { 100, 6918 }, { 59, 6919 }, { 59, 6920 }, 
+	{ 59, 6921 }, { 59, 6922 }, { 59, 6923 }, { 59, 6924 }, { 101, 6925 }, { 59, 6926 }, { 119, 6927 }, { 97, 6928 }, { 111, 6929 }, { 110, 6930 }, { 114, 6931 }, { 59, 6932 }, { 101, 6933 }, { 59, 6934 }, { 59, 6935 }, { 101, 6936 }, { 59, 6937 }, { 105, 6938 }, { 112, 6939 }, { 104, 6940 }, 
+	{ 59, 6941 }, { 112, 6942 }, { 59, 6943 }, { 109, 6944 }, { 115, 6945 }, { 115, 6946 }, { 116, 6947 }, { 97, 6948 }, { 59, 6949 }, { 59, 6950 }, { 59, 6951 }, { 59, 6952 }, { 59, 6953 }, { 59, 6954 }, { 59, 6955 }, { 103, 6956 }, { 59, 6957 }, { 59, 6958 }, { 59, 6959 }, { 59, 6960 }, 
+	{ 59, 6961 }, { 59, 6962 }, { 59, 6963 }, { 59, 6964 }, { 59, 6965 }, { 59, 6966 }, { 59, 6967 }, { 59, 6968 }, { 59, 6969 }, { 114, 6970 }, { 110, 6971 }, { 115, 6972 }, { 59, 6973 }, { 108, 6974 }, { 68, 6975 }, { 59, 6976 }, { 59, 6977 }, { 59, 6978 }, { 111, 6979 }, { 111, 6980 }, 
+	{ 105, 6981 }, { 108, 6982 }, { 105, 6983 }, { 115, 6984 }, { 114, 6985 }, { 110, 6986 }, { 73, 6987 }, { 99, 6988 }, { 67, 6989 }, { 100, 6990 }, { 105, 6991 }, { 59, 6992 }, { 110, 6993 }, { 108, 6994 }, { 111, 6995 }, { 111, 6996 }, { 101, 6997 }, { 111, 6998 }, { 105, 6999 }, { 112, 7000 }, 
+	{ 101, 7001 }, { 111, 7002 }, { 118, 7003 }, { 116, 7004 }, { 104, 7005 }, { 59, 7006 }, { 65, 7007 }, { 111, 7008 }, { 59, 7009 }, { 97, 7010 }, { 114, 7011 }, { 59, 7012 }, { 108, 7013 }, { 114, 7014 }, { 116, 7015 }, { 109, 7016 }, { 101, 7017 }, { 116, 7018 }, { 69, 7019 }, { 70, 7020 }, 
+	{ 71, 7021 }, { 76, 7022 }, { 83, 7023 }, { 84, 7024 }, { 83, 7025 }, { 116, 7026 }, { 110, 7027 }, { 97, 7028 }, { 114, 7029 }, { 59, 7030 }, { 108, 7031 }, { 99, 7032 }, { 108, 7033 }, { 116, 7034 }, { 108, 7035 }, { 111, 7036 }, { 108, 7037 }, { 98, 7038 }, { 110, 7039 }, { 111, 7040 }, 
+	{ 104, 7041 }, { 59, 7042 }, { 65, 7043 }, { 86, 7044 }, { 97, 7045 }, { 111, 7046 }, { 101, 7047 }, { 101, 7048 }, { 116, 7049 }, { 111, 7050 }, { 104, 7051 }, { 97, 7052 }, { 108, 7053 }, { 97, 7054 }, { 115, 7055 }, { 110, 7056 }, { 100, 7057 }, { 114, 7058 }, { 116, 7059 }, { 104, 7060 }, 
+	{ 116, 7061 }, { 104, 7062 }, { 102, 7063 }, { 103, 7064 }, { 112, 7065 }, { 114, 7066 }, { 117, 7067 }, { 101, 7068 }, { 114, 7069 }, { 101, 7070 }, { 59, 7071 }, { 59, 7072 }, { 107, 7073 }, { 114, 7074 }, { 97, 7075 }, { 108, 7076 }, { 101, 7077 }, { 108, 7078 }, { 116, 7079 }, { 116, 7080 }, 
+	{ 68, 7081 }, { 69, 7082 }, { 84, 7083 }, { 59, 7084 }, { 69, 7085 }, { 71, 7086 }, { 76, 7087 }, { 83, 7088 }, { 84, 7089 }, { 101, 7090 }, { 101, 7091 }, { 114, 7092 }, { 116, 7093 }, { 114, 7094 }, { 101, 7095 }, { 101, 7096 }, { 114, 7097 }, { 101, 7098 }, { 105, 7099 }, { 59, 7100 }, 
+	{ 108, 7101 }, { 59, 7102 }, { 99, 7103 }, { 101, 7104 }, { 68, 7105 }, { 117, 7106 }, { 101, 7107 }, { 115, 7108 }, { 59, 7109 }, { 105, 7110 }, { 69, 7111 }, { 85, 7112 }, { 103, 7113 }, { 114, 7114 }, { 105, 7115 }, { 117, 7116 }, { 119, 7117 }, { 111, 7118 }, { 101, 7119 }, { 105, 7120 }, 
+	{ 68, 7121 }, { 84, 7122 }, { 86, 7123 }, { 99, 7124 }, { 114, 7125 }, { 112, 7126 }, { 114, 7127 }, { 97, 7128 }, { 119, 7129 }, { 102, 7130 }, { 103, 7131 }, { 65, 7132 }, { 114, 7133 }, { 110, 7134 }, { 117, 7135 }, { 110, 7136 }, { 113, 7137 }, { 115, 7138 }, { 116, 7139 }, { 116, 7140 }, 
+	{ 114, 7141 }, { 97, 7142 }, { 99, 7143 }, { 117, 7144 }, { 108, 7145 }, { 108, 7146 }, { 111, 7147 }, { 114, 7148 }, { 114, 7149 }, { 97, 7150 }, { 114, 7151 }, { 117, 7152 }, { 59, 7153 }, { 66, 7154 }, { 68, 7155 }, { 114, 7156 }, { 105, 7157 }, { 114, 7158 }, { 59, 7159 }, { 114, 7160 }, 
+	{ 102, 7161 }, { 103, 7162 }, { 59, 7163 }, { 108, 7164 }, { 110, 7165 }, { 116, 7166 }, { 59, 7167 }, { 101, 7168 }, { 97, 7169 }, { 98, 7170 }, { 99, 7171 }, { 100, 7172 }, { 101, 7173 }, { 102, 7174 }, { 103, 7175 }, { 104, 7176 }, { 59, 7177 }, { 100, 7178 }, { 59, 7179 }, { 113, 7180 }, 
+	{ 59, 7181 }, { 116, 7182 }, { 103, 7183 }, { 105, 7184 }, { 109, 7185 }, { 59, 7186 }, { 101, 7187 }, { 101, 7188 }, { 107, 7189 }, { 59, 7190 }, { 59, 7191 }, { 59, 7192 }, { 59, 7193 }, { 59, 7194 }, { 115, 7195 }, { 101, 7196 }, { 112, 7197 }, { 59, 7198 }, { 110, 7199 }, { 115, 7200 }, 
+	{ 101, 7201 }, { 122, 7202 }, { 117, 7203 }, { 105, 7204 }, { 59, 7205 }, { 115, 7206 }, { 59, 7207 }, { 115, 7208 }, { 98, 7209 }, { 112, 7210 }, { 59, 7211 }, { 59, 7212 }, { 111, 7213 }, { 114, 7214 }, { 114, 7215 }, { 82, 7216 }, { 83, 7217 }, { 97, 7218 }, { 99, 7219 }, { 100, 7220 }, 
+	{ 116, 7221 }, { 59, 7222 }, { 116, 7223 }, { 59, 7224 }, { 101, 7225 }, { 101, 7226 }, { 59, 7227 }, { 59, 7228 }, { 59, 7229 }, { 59, 7230 }, { 112, 7231 }, { 59, 7232 }, { 112, 7233 }, { 115, 7234 }, { 101, 7235 }, { 100, 7236 }, { 114, 7237 }, { 116, 7238 }, { 59, 7239 }, { 59, 7240 }, 
+	{ 59, 7241 }, { 59, 7242 }, { 59, 7243 }, { 115, 7244 }, { 59, 7245 }, { 110, 7246 }, { 116, 7247 }, { 115, 7248 }, { 59, 7249 }, { 114, 7250 }, { 97, 7251 }, { 111, 7252 }, { 110, 7253 }, { 112, 7254 }, { 119, 7255 }, { 59, 7256 }, { 114, 7257 }, { 115, 7258 }, { 116, 7259 }, { 59, 7260 }, 
+	{ 59, 7261 }, { 103, 7262 }, { 108, 7263 }, { 59, 7264 }, { 108, 7265 }, { 116, 7266 }, { 116, 7267 }, { 100, 7268 }, { 116, 7269 }, { 116, 7270 }, { 59, 7271 }, { 108, 7272 }, { 120, 7273 }, { 59, 7274 }, { 111, 7275 }, { 115, 7276 }, { 101, 7277 }, { 59, 7278 }, { 113, 7279 }, { 59, 7280 }, 
+	{ 105, 7281 }, { 119, 7282 }, { 119, 7283 }, { 116, 7284 }, { 104, 7285 }, { 101, 7286 }, { 116, 7287 }, { 101, 7288 }, { 115, 7289 }, { 108, 7290 }, { 107, 7291 }, { 59, 7292 }, { 59, 7293 }, { 118, 7294 }, { 59, 7295 }, { 59, 7296 }, { 59, 7297 }, { 59, 7298 }, { 59, 7299 }, { 114, 7300 }, 
+	{ 111, 7301 }, { 112, 7302 }, { 116, 7303 }, { 104, 7304 }, { 101, 7305 }, { 116, 7306 }, { 59, 7307 }, { 114, 7308 }, { 114, 7309 }, { 59, 7310 }, { 116, 7311 }, { 103, 7312 }, { 59, 7313 }, { 59, 7314 }, { 114, 7315 }, { 99, 7316 }, { 120, 7317 }, { 116, 7318 }, { 115, 7319 }, { 104, 7320 }, 
+	{ 111, 7321 }, { 59, 7322 }, { 59, 7323 }, { 114, 7324 }, { 59, 7325 }, { 114, 7326 }, { 59, 7327 }, { 113, 7328 }, { 59, 7329 }, { 111, 7330 }, { 101, 7331 }, { 112, 7332 }, { 100, 7333 }, { 59, 7334 }, { 112, 7335 }, { 114, 7336 }, { 103, 7337 }, { 114, 7338 }, { 59, 7339 }, { 59, 7340 }, 
+	{ 115, 7341 }, { 116, 7342 }, { 59, 7343 }, { 59, 7344 }, { 110, 7345 }, { 114, 7346 }, { 103, 7347 }, { 110, 7348 }, { 116, 7349 }, { 59, 7350 }, { 59, 7351 }, { 59, 7352 }, { 59, 7353 }, { 59, 7354 }, { 59, 7355 }, { 101, 7356 }, { 59, 7357 }, { 59, 7358 }, { 114, 7359 }, { 105, 7360 }, 
+	{ 97, 7361 }, { 59, 7362 }, { 59, 7363 }, { 59, 7364 }, { 101, 7365 }, { 59, 7366 }, { 59, 7367 }, { 101, 7368 }, { 108, 7369 }, { 59, 7370 }, { 59, 7371 }, { 59, 7372 }, { 59, 7373 }, { 59, 7374 }, { 59, 7375 }, { 59, 7376 }, { 59, 7377 }, { 115, 7378 }, { 108, 7379 }, { 59, 7380 }, 
+	{ 114, 7381 }, { 59, 7382 }, { 114, 7383 }, { 59, 7384 }, { 59, 7385 }, { 59, 7386 }, { 116, 7387 }, { 114, 7388 }, { 108, 7389 }, { 112, 7390 }, { 113, 7391 }, { 109, 7392 }, { 59, 7393 }, { 114, 7394 }, { 101, 7395 }, { 102, 7396 }, { 105, 7397 }, { 59, 7398 }, { 59, 7399 }, { 118, 7400 }, 
+	{ 59, 7401 }, { 59, 7402 }, { 108, 7403 }, { 59, 7404 }, { 59, 7405 }, { 59, 7406 }, { 59, 7407 }, { 116, 7408 }, { 114, 7409 }, { 114, 7410 }, { 102, 7411 }, { 103, 7412 }, { 117, 7413 }, { 114, 7414 }, { 111, 7415 }, { 99, 7416 }, { 59, 7417 }, { 116, 7418 }, { 105, 7419 }, { 59, 7420 }, 
+	{ 116, 7421 }, { 59, 7422 }, { 115, 7423 }, { 100, 7424 }, { 114, 7425 }, { 59, 7426 }, { 59, 7427 }, { 116, 7428 }, { 108, 7429 }, { 105, 7430 }, { 116, 7431 }, { 116, 7432 }, { 116, 7433 }, { 59, 7434 }, { 59, 7435 }, { 59, 7436 }, { 59, 7437 }, { 113, 7438 }, { 101, 7439 }, { 114, 7440 }, 
+	{ 108, 7441 }, { 112, 7442 }, { 113, 7443 }, { 109, 7444 }, { 59, 7445 }, { 59, 7446 }, { 59, 7447 }, { 59, 7448 }, { 59, 7449 }, { 59, 7450 }, { 59, 7451 }, { 59, 7452 }, { 113, 7453 }, { 101, 7454 }, { 59, 7455 }, { 114, 7456 }, { 109, 7457 }, { 112, 7458 }, { 109, 7459 }, { 114, 7460 }, 
+	{ 59, 7461 }, { 101, 7462 }, { 115, 7463 }, { 59, 7464 }, { 59, 7465 }, { 109, 7466 }, { 108, 7467 }, { 114, 7468 }, { 114, 7469 }, { 59, 7470 }, { 114, 7471 }, { 111, 7472 }, { 59, 7473 }, { 111, 7474 }, { 114, 7475 }, { 59, 7476 }, { 108, 7477 }, { 97, 7478 }, { 105, 7479 }, { 116, 7480 }, 
+	{ 97, 7481 }, { 101, 7482 }, { 101, 7483 }, { 97, 7484 }, { 110, 7485 }, { 59, 7486 }, { 59, 7487 }, { 99, 7488 }, { 104, 7489 }, { 105, 7490 }, { 105, 7491 }, { 116, 7492 }, { 116, 7493 }, { 110, 7494 }, { 117, 7495 }, { 109, 7496 }, { 101, 7497 }, { 108, 7498 }, { 116, 7499 }, { 110, 7500 }, 
+	{ 116, 7501 }, { 108, 7502 }, { 59, 7503 }, { 99, 7504 }, { 116, 7505 }, { 59, 7506 }, { 110, 7507 }, { 116, 7508 }, { 119, 7509 }, { 102, 7510 }, { 110, 7511 }, { 103, 7512 }, { 65, 7513 }, { 68, 7514 }, { 114, 7515 }, { 119, 7516 }, { 101, 7517 }, { 82, 7518 }, { 84, 7519 }, { 86, 7520 }, 
+	{ 116, 7521 }, { 114, 7522 }, { 119, 7523 }, { 108, 7524 }, { 121, 7525 }, { 100, 7526 }, { 105, 7527 }, { 105, 7528 }, { 97, 7529 }, { 114, 7530 }, { 114, 7531 }, { 113, 7532 }, { 117, 7533 }, { 114, 7534 }, { 101, 7535 }, { 108, 7536 }, { 105, 7537 }, { 112, 7538 }, { 97, 7539 }, { 72, 7540 }, 
+	{ 108, 7541 }, { 121, 7542 }, { 59, 7543 }, { 116, 7544 }, { 101, 7545 }, { 114, 7546 }, { 101, 7547 }, { 119, 7548 }, { 105, 7549 }, { 108, 7550 }, { 84, 7551 }, { 86, 7552 }, { 114, 7553 }, { 116, 7554 }, { 114, 7555 }, { 101, 7556 }, { 110, 7557 }, { 119, 7558 }, { 101, 7559 }, { 99, 7560 }, 
+	{ 111, 7561 }, { 119, 7562 }, { 116, 7563 }, { 108, 7564 }, { 69, 7565 }, { 116, 7566 }, { 59, 7567 }, { 116, 7568 }, { 101, 7569 }, { 111, 7570 }, { 65, 7571 }, { 82, 7572 }, { 116, 7573 }, { 97, 7574 }, { 114, 7575 }, { 116, 7576 }, { 116, 7577 }, { 104, 7578 }, { 97, 7579 }, { 102, 7580 }, 
+	{ 115, 7581 }, { 77, 7582 }, { 84, 7583 }, { 86, 7584 }, { 101, 7585 }, { 115, 7586 }, { 105, 7587 }, { 117, 7588 }, { 112, 7589 }, { 101, 7590 }, { 110, 7591 }, { 59, 7592 }, { 84, 7593 }, { 115, 7594 }, { 101, 7595 }, { 111, 7596 }, { 113, 7597 }, { 114, 7598 }, { 113, 7599 }, { 114, 7600 }, 
+	{ 101, 7601 }, { 108, 7602 }, { 105, 7603 }, { 100, 7604 }, { 100, 7605 }, { 115, 7606 }, { 84, 7607 }, { 101, 7608 }, { 116, 7609 }, { 101, 7610 }, { 115, 7611 }, { 59, 7612 }, { 69, 7613 }, { 70, 7614 }, { 84, 7615 }, { 99, 7616 }, { 121, 7617 }, { 101, 7618 }, { 107, 7619 }, { 110, 7620 }, 
+	{ 59, 7621 }, { 115, 7622 }, { 112, 7623 }, { 59, 7624 }, { 69, 7625 }, { 83, 7626 }, { 84, 7627 }, { 111, 7628 }, { 108, 7629 }, { 113, 7630 }, { 112, 7631 }, { 108, 7632 }, { 111, 7633 }, { 108, 7634 }, { 98, 7635 }, { 110, 7636 }, { 111, 7637 }, { 59, 7638 }, { 65, 7639 }, { 86, 7640 }, 
+	{ 97, 7641 }, { 111, 7642 }, { 101, 7643 }, { 101, 7644 }, { 116, 7645 }, { 111, 7646 }, { 108, 7647 }, { 114, 7648 }, { 121, 7649 }, { 110, 7650 }, { 116, 7651 }, { 104, 7652 }, { 114, 7653 }, { 99, 7654 }, { 116, 7655 }, { 98, 7656 }, { 112, 7657 }, { 105, 7658 }, { 117, 7659 }, { 59, 7660 }, 
+	{ 69, 7661 }, { 83, 7662 }, { 84, 7663 }, { 59, 7664 }, { 59, 7665 }, { 69, 7666 }, { 101, 7667 }, { 99, 7668 }, { 101, 7669 }, { 97, 7670 }, { 108, 7671 }, { 100, 7672 }, { 116, 7673 }, { 59, 7674 }, { 59, 7675 }, { 99, 7676 }, { 101, 7677 }, { 115, 7678 }, { 97, 7679 }, { 111, 7680 }, 
+	{ 114, 7681 }, { 98, 7682 }, { 111, 7683 }, { 114, 7684 }, { 116, 7685 }, { 104, 7686 }, { 66, 7687 }, { 76, 7688 }, { 83, 7689 }, { 84, 7690 }, { 83, 7691 }, { 104, 7692 }, { 59, 7693 }, { 59, 7694 }, { 59, 7695 }, { 59, 7696 }, { 59, 7697 }, { 59, 7698 }, { 59, 7699 }, { 59, 7700 }, 
+	{ 59, 7701 }, { 59, 7702 }, { 59, 7703 }, { 59, 7704 }, { 59, 7705 }, { 108, 7706 }, { 101, 7707 }, { 113, 7708 }, { 59, 7709 }, { 59, 7710 }, { 59, 7711 }, { 115, 7712 }, { 59, 7713 }, { 103, 7714 }, { 59, 7715 }, { 59, 7716 }, { 101, 7717 }, { 97, 7718 }, { 97, 7719 }, { 59, 7720 }, 
+	{ 59, 7721 }, { 59, 7722 }, { 59, 7723 }, { 116, 7724 }, { 107, 7725 }, { 114, 7726 }, { 59, 7727 }, { 59, 7728 }, { 115, 7729 }, { 105, 7730 }, { 97, 7731 }, { 59, 7732 }, { 59, 7733 }, { 110, 7734 }, { 115, 7735 }, { 59, 7736 }, { 114, 7737 }, { 117, 7738 }, { 59, 7739 }, { 103, 7740 }, 
+	{ 111, 7741 }, { 59, 7742 }, { 117, 7743 }, { 116, 7744 }, { 59, 7745 }, { 59, 7746 }, { 101, 7747 }, { 114, 7748 }, { 119, 7749 }, { 97, 7750 }, { 111, 7751 }, { 59, 7752 }, { 59, 7753 }, { 59, 7754 }, { 59, 7755 }, { 116, 7756 }, { 101, 7757 }, { 59, 7758 }, { 105, 7759 }, { 105, 7760 }, 
+	{ 111, 7761 }, { 59, 7762 }, { 59, 7763 }, { 59, 7764 }, { 59, 7765 }, { 120, 7766 }, { 115, 7767 }, { 115, 7768 }, { 113, 7769 }, { 116, 7770 }, { 59, 7771 }, { 59, 7772 }, { 97, 7773 }, { 116, 7774 }, { 59, 7775 }, { 59, 7776 }, { 59, 7777 }, { 59, 7778 }, { 59, 7779 }, { 59, 7780 }, 
+	{ 59, 7781 }, { 59, 7782 }, { 119, 7783 }, { 111, 7784 }, { 97, 7785 }, { 116, 7786 }, { 101, 7787 }, { 59, 7788 }, { 59, 7789 }, { 111, 7790 }, { 114, 7791 }, { 116, 7792 }, { 59, 7793 }, { 104, 7794 }, { 59, 7795 }, { 97, 7796 }, { 114, 7797 }, { 116, 7798 }, { 116, 7799 }, { 119, 7800 }, 
+	{ 59, 7801 }, { 59, 7802 }, { 113, 7803 }, { 119, 7804 }, { 102, 7805 }, { 59, 7806 }, { 97, 7807 }, { 59, 7808 }, { 111, 7809 }, { 104, 7810 }, { 114, 7811 }, { 59, 7812 }, { 59, 7813 }, { 116, 7814 }, { 111, 7815 }, { 104, 7816 }, { 116, 7817 }, { 59, 7818 }, { 108, 7819 }, { 114, 7820 }, 
+	{ 100, 7821 }, { 114, 7822 }, { 113, 7823 }, { 113, 7824 }, { 101, 7825 }, { 59, 7826 }, { 59, 7827 }, { 107, 7828 }, { 59, 7829 }, { 59, 7830 }, { 111, 7831 }, { 121, 7832 }, { 114, 7833 }, { 59, 7834 }, { 59, 7835 }, { 59, 7836 }, { 59, 7837 }, { 59, 7838 }, { 111, 7839 }, { 59, 7840 }, 
+	{ 115, 7841 }, { 59, 7842 }, { 111, 7843 }, { 112, 7844 }, { 116, 7845 }, { 104, 7846 }, { 105, 7847 }, { 101, 7848 }, { 116, 7849 }, { 104, 7850 }, { 59, 7851 }, { 59, 7852 }, { 59, 7853 }, { 59, 7854 }, { 59, 7855 }, { 97, 7856 }, { 109, 7857 }, { 59, 7858 }, { 116, 7859 }, { 59, 7860 }, 
+	{ 101, 7861 }, { 59, 7862 }, { 101, 7863 }, { 101, 7864 }, { 112, 7865 }, { 59, 7866 }, { 113, 7867 }, { 113, 7868 }, { 111, 7869 }, { 121, 7870 }, { 114, 7871 }, { 59, 7872 }, { 59, 7873 }, { 59, 7874 }, { 113, 7875 }, { 113, 7876 }, { 101, 7877 }, { 59, 7878 }, { 114, 7879 }, { 59, 7880 }, 
+	{ 59, 7881 }, { 59, 7882 }, { 100, 7883 }, { 108, 7884 }, { 113, 7885 }, { 114, 7886 }, { 59, 7887 }, { 59, 7888 }, { 101, 7889 }, { 105, 7890 }, { 59, 7891 }, { 114, 7892 }, { 110, 7893 }, { 119, 7894 }, { 59, 7895 }, { 111, 7896 }, { 59, 7897 }, { 110, 7898 }, { 111, 7899 }, { 59, 7900 }, 
+	{ 116, 7901 }, { 116, 7902 }, { 59, 7903 }, { 103, 7904 }, { 116, 7905 }, { 59, 7906 }, { 115, 7907 }, { 102, 7908 }, { 59, 7909 }, { 59, 7910 }, { 117, 7911 }, { 115, 7912 }, { 101, 7913 }, { 67, 7914 }, { 121, 7915 }, { 59, 7916 }, { 116, 7917 }, { 59, 7918 }, { 111, 7919 }, { 97, 7920 }, 
+	{ 105, 7921 }, { 116, 7922 }, { 59, 7923 }, { 110, 7924 }, { 116, 7925 }, { 103, 7926 }, { 104, 7927 }, { 114, 7928 }, { 111, 7929 }, { 116, 7930 }, { 59, 7931 }, { 66, 7932 }, { 85, 7933 }, { 59, 7934 }, { 105, 7935 }, { 101, 7936 }, { 101, 7937 }, { 84, 7938 }, { 86, 7939 }, { 114, 7940 }, 
+	{ 59, 7941 }, { 108, 7942 }, { 83, 7943 }, { 101, 7944 }, { 117, 7945 }, { 97, 7946 }, { 108, 7947 }, { 121, 7948 }, { 102, 7949 }, { 117, 7950 }, { 108, 7951 }, { 101, 7952 }, { 115, 7953 }, { 97, 7954 }, { 108, 7955 }, { 97, 7956 }, { 108, 7957 }, { 117, 7958 }, { 59, 7959 }, { 73, 7960 }, 
+	{ 105, 7961 }, { 67, 7962 }, { 84, 7963 }, { 102, 7964 }, { 66, 7965 }, { 59, 7966 }, { 66, 7967 }, { 82, 7968 }, { 110, 7969 }, { 101, 7970 }, { 101, 7971 }, { 101, 7972 }, { 59, 7973 }, { 65, 7974 }, { 86, 7975 }, { 114, 7976 }, { 99, 7977 }, { 103, 7978 }, { 110, 7979 }, { 86, 7980 }, 
+	{ 116, 7981 }, { 114, 7982 }, { 59, 7983 }, { 97, 7984 }, { 71, 7985 }, { 113, 7986 }, { 101, 7987 }, { 69, 7988 }, { 59, 7989 }, { 119, 7990 }, { 114, 7991 }, { 105, 7992 }, { 65, 7993 }, { 114, 7994 }, { 105, 7995 }, { 97, 7996 }, { 65, 7997 }, { 116, 7998 }, { 99, 7999 }, { 59, 8000 }, 
+	{ 59, 8001 }, { 101, 8002 }, { 104, 8003 }, { 101, 8004 }, { 97, 8005 }, { 115, 8006 }, { 110, 8007 }, { 101, 8008 }, { 59, 8009 }, { 86, 8010 }, { 116, 8011 }, { 105, 8012 }, { 59, 8013 }, { 114, 8014 }, { 119, 8015 }, { 117, 8016 }, { 105, 8017 }, { 117, 8018 }, { 101, 8019 }, { 115, 8020 }, 
+	{ 97, 8021 }, { 108, 8022 }, { 71, 8023 }, { 76, 8024 }, { 101, 8025 }, { 101, 8026 }, { 114, 8027 }, { 83, 8028 }, { 59, 8029 }, { 69, 8030 }, { 100, 8031 }, { 101, 8032 }, { 113, 8033 }, { 117, 8034 }, { 105, 8035 }, { 97, 8036 }, { 68, 8037 }, { 81, 8038 }, { 59, 8039 }, { 101, 8040 }, 
+	{ 116, 8041 }, { 59, 8042 }, { 108, 8043 }, { 113, 8044 }, { 108, 8045 }, { 105, 8046 }, { 110, 8047 }, { 101, 8048 }, { 117, 8049 }, { 69, 8050 }, { 101, 8051 }, { 119, 8052 }, { 105, 8053 }, { 108, 8054 }, { 84, 8055 }, { 86, 8056 }, { 114, 8057 }, { 114, 8058 }, { 101, 8059 }, { 110, 8060 }, 
+	{ 119, 8061 }, { 101, 8062 }, { 99, 8063 }, { 111, 8064 }, { 119, 8065 }, { 105, 8066 }, { 111, 8067 }, { 101, 8068 }, { 65, 8069 }, { 65, 8070 }, { 116, 8071 }, { 114, 8072 }, { 108, 8073 }, { 101, 8074 }, { 115, 8075 }, { 101, 8076 }, { 111, 8077 }, { 97, 8078 }, { 113, 8079 }, { 108, 8080 }, 
+	{ 105, 8081 }, { 113, 8082 }, { 59, 8083 }, { 101, 8084 }, { 59, 8085 }, { 108, 8086 }, { 69, 8087 }, { 101, 8088 }, { 59, 8089 }, { 101, 8090 }, { 107, 8091 }, { 110, 8092 }, { 59, 8093 }, { 114, 8094 }, { 119, 8095 }, { 111, 8096 }, { 114, 8097 }, { 119, 8098 }, { 111, 8099 }, { 65, 8100 }, 
+	{ 116, 8101 }, { 97, 8102 }, { 105, 8103 }, { 101, 8104 }, { 105, 8105 }, { 112, 8106 }, { 83, 8107 }, { 111, 8108 }, { 59, 8109 }, { 59, 8110 }, { 59, 8111 }, { 108, 8112 }, { 110, 8113 }, { 114, 8114 }, { 110, 8115 }, { 59, 8116 }, { 59, 8117 }, { 111, 8118 }, { 116, 8119 }, { 114, 8120 }, 
+	{ 115, 8121 }, { 116, 8122 }, { 59, 8123 }, { 101, 8124 }, { 99, 8125 }, { 101, 8126 }, { 119, 8127 }, { 105, 8128 }, { 105, 8129 }, { 59, 8130 }, { 119, 8131 }, { 59, 8132 }, { 114, 8133 }, { 111, 8134 }, { 114, 8135 }, { 115, 8136 }, { 111, 8137 }, { 97, 8138 }, { 116, 8139 }, { 59, 8140 }, 
+	{ 59, 8141 }, { 115, 8142 }, { 59, 8143 }, { 59, 8144 }, { 114, 8145 }, { 97, 8146 }, { 59, 8147 }, { 116, 8148 }, { 111, 8149 }, { 114, 8150 }, { 97, 8151 }, { 104, 8152 }, { 115, 8153 }, { 116, 8154 }, { 120, 8155 }, { 59, 8156 }, { 114, 8157 }, { 101, 8158 }, { 114, 8159 }, { 105, 8160 }, 
+	{ 111, 8161 }, { 97, 8162 }, { 108, 8163 }, { 114, 8164 }, { 59, 8165 }, { 110, 8166 }, { 116, 8167 }, { 110, 8168 }, { 119, 8169 }, { 116, 8170 }, { 111, 8171 }, { 59, 8172 }, { 119, 8173 }, { 116, 8174 }, { 59, 8175 }, { 59, 8176 }, { 111, 8177 }, { 59, 8178 }, { 97, 8179 }, { 59, 8180 }, 
+	{ 113, 8181 }, { 59, 8182 }, { 113, 8183 }, { 108, 8184 }, { 114, 8185 }, { 59, 8186 }, { 120, 8187 }, { 101, 8188 }, { 111, 8189 }, { 110, 8190 }, { 59, 8191 }, { 119, 8192 }, { 111, 8193 }, { 97, 8194 }, { 104, 8195 }, { 116, 8196 }, { 103, 8197 }, { 101, 8198 }, { 115, 8199 }, { 101, 8200 }, 
+	{ 108, 8201 }, { 105, 8202 }, { 59, 8203 }, { 113, 8204 }, { 113, 8205 }, { 112, 8206 }, { 104, 8207 }, { 59, 8208 }, { 59, 8209 }, { 113, 8210 }, { 120, 8211 }, { 101, 8212 }, { 111, 8213 }, { 59, 8214 }, { 59, 8215 }, { 113, 8216 }, { 59, 8217 }, { 111, 8218 }, { 111, 8219 }, { 101, 8220 }, 
+	{ 59, 8221 }, { 105, 8222 }, { 102, 8223 }, { 103, 8224 }, { 111, 8225 }, { 108, 8226 }, { 114, 8227 }, { 115, 8228 }, { 110, 8229 }, { 103, 8230 }, { 59, 8231 }, { 110, 8232 }, { 110, 8233 }, { 108, 8234 }, { 105, 8235 }, { 59, 8236 }, { 102, 8237 }, { 115, 8238 }, { 59, 8239 }, { 115, 8240 }, 
+	{ 111, 8241 }, { 68, 8242 }, { 81, 8243 }, { 101, 8244 }, { 99, 8245 }, { 108, 8246 }, { 97, 8247 }, { 111, 8248 }, { 65, 8249 }, { 65, 8250 }, { 82, 8251 }, { 84, 8252 }, { 76, 8253 }, { 82, 8254 }, { 116, 8255 }, { 114, 8256 }, { 119, 8257 }, { 105, 8258 }, { 97, 8259 }, { 112, 8260 }, 
+	{ 103, 8261 }, { 101, 8262 }, { 99, 8263 }, { 101, 8264 }, { 101, 8265 }, { 111, 8266 }, { 83, 8267 }, { 109, 8268 }, { 59, 8269 }, { 109, 8270 }, { 108, 8271 }, { 108, 8272 }, { 83, 8273 }, { 59, 8274 }, { 97, 8275 }, { 108, 8276 }, { 97, 8277 }, { 115, 8278 }, { 110, 8279 }, { 100, 8280 }, 
+	{ 99, 8281 }, { 76, 8282 }, { 109, 8283 }, { 59, 8284 }, { 111, 8285 }, { 111, 8286 }, { 105, 8287 }, { 59, 8288 }, { 114, 8289 }, { 97, 8290 }, { 105, 8291 }, { 103, 8292 }, { 66, 8293 }, { 101, 8294 }, { 99, 8295 }, { 114, 8296 }, { 101, 8297 }, { 111, 8298 }, { 116, 8299 }, { 108, 8300 }, 
+	{ 86, 8301 }, { 101, 8302 }, { 111, 8303 }, { 59, 8304 }, { 66, 8305 }, { 114, 8306 }, { 114, 8307 }, { 117, 8308 }, { 114, 8309 }, { 113, 8310 }, { 59, 8311 }, { 114, 8312 }, { 103, 8313 }, { 114, 8314 }, { 114, 8315 }, { 103, 8316 }, { 114, 8317 }, { 114, 8318 }, { 65, 8319 }, { 101, 8320 }, 
+	{ 100, 8321 }, { 105, 8322 }, { 114, 8323 }, { 116, 8324 }, { 76, 8325 }, { 103, 8326 }, { 110, 8327 }, { 101, 8328 }, { 59, 8329 }, { 108, 8330 }, { 59, 8331 }, { 69, 8332 }, { 70, 8333 }, { 71, 8334 }, { 76, 8335 }, { 83, 8336 }, { 84, 8337 }, { 110, 8338 }, { 97, 8339 }, { 97, 8340 }, 
+	{ 97, 8341 }, { 97, 8342 }, { 115, 8343 }, { 110, 8344 }, { 100, 8345 }, { 114, 8346 }, { 101, 8347 }, { 115, 8348 }, { 69, 8349 }, { 105, 8350 }, { 117, 8351 }, { 113, 8352 }, { 115, 8353 }, { 116, 8354 }, { 117, 8355 }, { 108, 8356 }, { 108, 8357 }, { 108, 8358 }, { 111, 8359 }, { 117, 8360 }, 
+	{ 116, 8361 }, { 104, 8362 }, { 97, 8363 }, { 117, 8364 }, { 97, 8365 }, { 108, 8366 }, { 59, 8367 }, { 97, 8368 }, { 109, 8369 }, { 105, 8370 }, { 113, 8371 }, { 66, 8372 }, { 59, 8373 }, { 66, 8374 }, { 76, 8375 }, { 110, 8376 }, { 101, 8377 }, { 101, 8378 }, { 101, 8379 }, { 59, 8380 }, 
+	{ 114, 8381 }, { 99, 8382 }, { 103, 8383 }, { 110, 8384 }, { 86, 8385 }, { 116, 8386 }, { 114, 8387 }, { 59, 8388 }, { 101, 8389 }, { 119, 8390 }, { 100, 8391 }, { 114, 8392 }, { 114, 8393 }, { 65, 8394 }, { 111, 8395 }, { 101, 8396 }, { 114, 8397 }, { 101, 8398 }, { 114, 8399 }, { 110, 8400 }, 
+	{ 108, 8401 }, { 117, 8402 }, { 97, 8403 }, { 108, 8404 }, { 117, 8405 }, { 59, 8406 }, { 59, 8407 }, { 113, 8408 }, { 59, 8409 }, { 59, 8410 }, { 101, 8411 }, { 116, 8412 }, { 59, 8413 }, { 110, 8414 }, { 119, 8415 }, { 105, 8416 }, { 59, 8417 }, { 119, 8418 }, { 114, 8419 }, { 65, 8420 }, 
+	{ 114, 8421 }, { 110, 8422 }, { 112, 8423 }, { 108, 8424 }, { 97, 8425 }, { 112, 8426 }, { 110, 8427 }, { 101, 8428 }, { 103, 8429 }, { 101, 8430 }, { 103, 8431 }, { 119, 8432 }, { 59, 8433 }, { 99, 8434 }, { 104, 8435 }, { 59, 8436 }, { 99, 8437 }, { 99, 8438 }, { 59, 8439 }, { 108, 8440 }, 
+	{ 114, 8441 }, { 116, 8442 }, { 109, 8443 }, { 101, 8444 }, { 114, 8445 }, { 110, 8446 }, { 59, 8447 }, { 115, 8448 }, { 110, 8449 }, { 108, 8450 }, { 115, 8451 }, { 59, 8452 }, { 114, 8453 }, { 114, 8454 }, { 97, 8455 }, { 110, 8456 }, { 114, 8457 }, { 114, 8458 }, { 97, 8459 }, { 113, 8460 }, 
+	{ 105, 8461 }, { 59, 8462 }, { 59, 8463 }, { 59, 8464 }, { 114, 8465 }, { 103, 8466 }, { 59, 8467 }, { 114, 8468 }, { 101, 8469 }, { 105, 8470 }, { 59, 8471 }, { 59, 8472 }, { 103, 8473 }, { 59, 8474 }, { 97, 8475 }, { 119, 8476 }, { 59, 8477 }, { 97, 8478 }, { 119, 8479 }, { 108, 8480 }, 
+	{ 59, 8481 }, { 59, 8482 }, { 101, 8483 }, { 105, 8484 }, { 59, 8485 }, { 113, 8486 }, { 120, 8487 }, { 115, 8488 }, { 59, 8489 }, { 116, 8490 }, { 111, 8491 }, { 114, 8492 }, { 97, 8493 }, { 97, 8494 }, { 97, 8495 }, { 116, 8496 }, { 101, 8497 }, { 59, 8498 }, { 108, 8499 }, { 110, 8500 }, 
+	{ 59, 8501 }, { 59, 8502 }, { 115, 8503 }, { 105, 8504 }, { 59, 8505 }, { 59, 8506 }, { 113, 8507 }, { 120, 8508 }, { 59, 8509 }, { 120, 8510 }, { 119, 8511 }, { 102, 8512 }, { 103, 8513 }, { 116, 8514 }, { 104, 8515 }, { 119, 8516 }, { 101, 8517 }, { 105, 8518 }, { 59, 8519 }, { 59, 8520 }, 
+	{ 59, 8521 }, { 101, 8522 }, { 101, 8523 }, { 101, 8524 }, { 111, 8525 }, { 101, 8526 }, { 59, 8527 }, { 59, 8528 }, { 110, 8529 }, { 111, 8530 }, { 117, 8531 }, { 103, 8532 }, { 107, 8533 }, { 65, 8534 }, { 68, 8535 }, { 71, 8536 }, { 84, 8537 }, { 108, 8538 }, { 117, 8539 }, { 114, 8540 }, 
+	{ 114, 8541 }, { 105, 8542 }, { 101, 8543 }, { 101, 8544 }, { 105, 8545 }, { 65, 8546 }, { 84, 8547 }, { 111, 8548 }, { 110, 8549 }, { 99, 8550 }, { 114, 8551 }, { 65, 8552 }, { 104, 8553 }, { 86, 8554 }, { 116, 8555 }, { 101, 8556 }, { 99, 8557 }, { 119, 8558 }, { 113, 8559 }, { 97, 8560 }, 
+	{ 59, 8561 }, { 69, 8562 }, { 83, 8563 }, { 109, 8564 }, { 108, 8565 }, { 69, 8566 }, { 116, 8567 }, { 59, 8568 }, { 116, 8569 }, { 101, 8570 }, { 101, 8571 }, { 105, 8572 }, { 112, 8573 }, { 110, 8574 }, { 109, 8575 }, { 109, 8576 }, { 97, 8577 }, { 114, 8578 }, { 103, 8579 }, { 59, 8580 }, 
+	{ 114, 8581 }, { 86, 8582 }, { 116, 8583 }, { 114, 8584 }, { 99, 8585 }, { 119, 8586 }, { 111, 8587 }, { 101, 8588 }, { 101, 8589 }, { 99, 8590 }, { 114, 8591 }, { 97, 8592 }, { 114, 8593 }, { 101, 8594 }, { 97, 8595 }, { 59, 8596 }, { 117, 8597 }, { 111, 8598 }, { 104, 8599 }, { 114, 8600 }, 
+	{ 111, 8601 }, { 104, 8602 }, { 114, 8603 }, { 114, 8604 }, { 114, 8605 }, { 59, 8606 }, { 105, 8607 }, { 99, 8608 }, { 110, 8609 }, { 121, 8610 }, { 101, 8611 }, { 101, 8612 }, { 83, 8613 }, { 116, 8614 }, { 114, 8615 }, { 100, 8616 }, { 113, 8617 }, { 117, 8618 }, { 114, 8619 }, { 101, 8620 }, 
+	{ 108, 8621 }, { 105, 8622 }, { 72, 8623 }, { 108, 8624 }, { 110, 8625 }, { 108, 8626 }, { 116, 8627 }, { 59, 8628 }, { 116, 8629 }, { 101, 8630 }, { 101, 8631 }, { 115, 8632 }, { 59, 8633 }, { 69, 8634 }, { 83, 8635 }, { 108, 8636 }, { 97, 8637 }, { 98, 8638 }, { 112, 8639 }, { 117, 8640 }, 
+	{ 59, 8641 }, { 69, 8642 }, { 83, 8643 }, { 84, 8644 }, { 59, 8645 }, { 69, 8646 }, { 97, 8647 }, { 108, 8648 }, { 100, 8649 }, { 66, 8650 }, { 117, 8651 }, { 111, 8652 }, { 59, 8653 }, { 101, 8654 }, { 110, 8655 }, { 97, 8656 }, { 110, 8657 }, { 100, 8658 }, { 108, 8659 }, { 101, 8660 }, 
+	{ 108, 8661 }, { 117, 8662 }, { 114, 8663 }, { 97, 8664 }, { 101, 8665 }, { 103, 8666 }, { 66, 8667 }, { 101, 8668 }, { 99, 8669 }, { 111, 8670 }, { 116, 8671 }, { 108, 8672 }, { 86, 8673 }, { 101, 8674 }, { 111, 8675 }, { 59, 8676 }, { 66, 8677 }, { 115, 8678 }, { 59, 8679 }, { 59, 8680 }, 
+	{ 114, 8681 }, { 114, 8682 }, { 114, 8683 }, { 119, 8684 }, { 59, 8685 }, { 115, 8686 }, { 116, 8687 }, { 115, 8688 }, { 59, 8689 }, { 59, 8690 }, { 97, 8691 }, { 110, 8692 }, { 100, 8693 }, { 97, 8694 }, { 117, 8695 }, { 116, 8696 }, { 104, 8697 }, { 65, 8698 }, { 59, 8699 }, { 117, 8700 }, 
+	{ 59, 8701 }, { 114, 8702 }, { 114, 8703 }, { 59, 8704 }, { 101, 8705 }, { 97, 8706 }, { 100, 8707 }, { 99, 8708 }, { 97, 8709 }, { 59, 8710 }, { 100, 8711 }, { 117, 8712 }, { 101, 8713 }, { 59, 8714 }, { 108, 8715 }, { 108, 8716 }, { 114, 8717 }, { 59, 8718 }, { 59, 8719 }, { 59, 8720 }, 
+	{ 59, 8721 }, { 101, 8722 }, { 105, 8723 }, { 59, 8724 }, { 101, 8725 }, { 100, 8726 }, { 111, 8727 }, { 108, 8728 }, { 114, 8729 }, { 59, 8730 }, { 59, 8731 }, { 101, 8732 }, { 101, 8733 }, { 111, 8734 }, { 114, 8735 }, { 105, 8736 }, { 100, 8737 }, { 117, 8738 }, { 111, 8739 }, { 114, 8740 }, 
+	{ 114, 8741 }, { 117, 8742 }, { 109, 8743 }, { 111, 8744 }, { 104, 8745 }, { 114, 8746 }, { 102, 8747 }, { 103, 8748 }, { 108, 8749 }, { 114, 8750 }, { 59, 8751 }, { 114, 8752 }, { 59, 8753 }, { 108, 8754 }, { 102, 8755 }, { 103, 8756 }, { 59, 8757 }, { 59, 8758 }, { 59, 8759 }, { 97, 8760 }, 
+	{ 110, 8761 }, { 114, 8762 }, { 114, 8763 }, { 114, 8764 }, { 114, 8765 }, { 105, 8766 }, { 113, 8767 }, { 101, 8768 }, { 117, 8769 }, { 105, 8770 }, { 59, 8771 }, { 59, 8772 }, { 59, 8773 }, { 59, 8774 }, { 110, 8775 }, { 116, 8776 }, { 104, 8777 }, { 97, 8778 }, { 116, 8779 }, { 59, 8780 }, 
+	{ 102, 8781 }, { 103, 8782 }, { 113, 8783 }, { 113, 8784 }, { 108, 8785 }, { 114, 8786 }, { 110, 8787 }, { 114, 8788 }, { 116, 8789 }, { 117, 8790 }, { 111, 8791 }, { 114, 8792 }, { 119, 8793 }, { 99, 8794 }, { 111, 8795 }, { 114, 8796 }, { 105, 8797 }, { 68, 8798 }, { 114, 8799 }, { 114, 8800 }, 
+	{ 114, 8801 }, { 103, 8802 }, { 101, 8803 }, { 102, 8804 }, { 103, 8805 }, { 114, 8806 }, { 101, 8807 }, { 119, 8808 }, { 65, 8809 }, { 97, 8810 }, { 59, 8811 }, { 114, 8812 }, { 116, 8813 }, { 101, 8814 }, { 111, 8815 }, { 86, 8816 }, { 116, 8817 }, { 59, 8818 }, { 117, 8819 }, { 108, 8820 }, 
+	{ 59, 8821 }, { 113, 8822 }, { 97, 8823 }, { 59, 8824 }, { 76, 8825 }, { 113, 8826 }, { 101, 8827 }, { 69, 8828 }, { 59, 8829 }, { 59, 8830 }, { 110, 8831 }, { 59, 8832 }, { 59, 8833 }, { 109, 8834 }, { 101, 8835 }, { 99, 8836 }, { 59, 8837 }, { 104, 8838 }, { 97, 8839 }, { 101, 8840 }, 
+	{ 111, 8841 }, { 111, 8842 }, { 116, 8843 }, { 59, 8844 }, { 114, 8845 }, { 59, 8846 }, { 66, 8847 }, { 69, 8848 }, { 99, 8849 }, { 116, 8850 }, { 59, 8851 }, { 66, 8852 }, { 114, 8853 }, { 111, 8854 }, { 97, 8855 }, { 108, 8856 }, { 97, 8857 }, { 119, 8858 }, { 116, 8859 }, { 111, 8860 }, 
+	{ 119, 8861 }, { 116, 8862 }, { 111, 8863 }, { 111, 8864 }, { 114, 8865 }, { 117, 8866 }, { 107, 8867 }, { 83, 8868 }, { 84, 8869 }, { 114, 8870 }, { 115, 8871 }, { 112, 8872 }, { 59, 8873 }, { 116, 8874 }, { 101, 8875 }, { 117, 8876 }, { 108, 8877 }, { 101, 8878 }, { 115, 8879 }, { 97, 8880 }, 
+	{ 108, 8881 }, { 117, 8882 }, { 59, 8883 }, { 103, 8884 }, { 59, 8885 }, { 101, 8886 }, { 69, 8887 }, { 59, 8888 }, { 97, 8889 }, { 115, 8890 }, { 113, 8891 }, { 108, 8892 }, { 101, 8893 }, { 110, 8894 }, { 115, 8895 }, { 101, 8896 }, { 97, 8897 }, { 113, 8898 }, { 108, 8899 }, { 105, 8900 }, 
+	{ 113, 8901 }, { 108, 8902 }, { 69, 8903 }, { 101, 8904 }, { 97, 8905 }, { 98, 8906 }, { 116, 8907 }, { 115, 8908 }, { 101, 8909 }, { 108, 8910 }, { 116, 8911 }, { 101, 8912 }, { 59, 8913 }, { 110, 8914 }, { 105, 8915 }, { 105, 8916 }, { 97, 8917 }, { 114, 8918 }, { 102, 8919 }, { 59, 8920 }, 
+	{ 114, 8921 }, { 86, 8922 }, { 116, 8923 }, { 119, 8924 }, { 111, 8925 }, { 101, 8926 }, { 101, 8927 }, { 99, 8928 }, { 114, 8929 }, { 97, 8930 }, { 59, 8931 }, { 111, 8932 }, { 111, 8933 }, { 114, 8934 }, { 59, 8935 }, { 101, 8936 }, { 59, 8937 }, { 69, 8938 }, { 101, 8939 }, { 108, 8940 }, 
+	{ 116, 8941 }, { 101, 8942 }, { 108, 8943 }, { 97, 8944 }, { 59, 8945 }, { 101, 8946 }, { 114, 8947 }, { 109, 8948 }, { 111, 8949 }, { 114, 8950 }, { 59, 8951 }, { 114, 8952 }, { 101, 8953 }, { 101, 8954 }, { 99, 8955 }, { 111, 8956 }, { 112, 8957 }, { 59, 8958 }, { 101, 8959 }, { 101, 8960 }, 
+	{ 105, 8961 }, { 102, 8962 }, { 103, 8963 }, { 115, 8964 }, { 103, 8965 }, { 119, 8966 }, { 101, 8967 }, { 105, 8968 }, { 59, 8969 }, { 113, 8970 }, { 119, 8971 }, { 111, 8972 }, { 108, 8973 }, { 111, 8974 }, { 112, 8975 }, { 119, 8976 }, { 111, 8977 }, { 112, 8978 }, { 105, 8979 }, { 101, 8980 }, 
+	{ 119, 8981 }, { 116, 8982 }, { 111, 8983 }, { 116, 8984 }, { 104, 8985 }, { 101, 8986 }, { 114, 8987 }, { 114, 8988 }, { 101, 8989 }, { 116, 8990 }, { 104, 8991 }, { 105, 8992 }, { 100, 8993 }, { 117, 8994 }, { 111, 8995 }, { 112, 8996 }, { 114, 8997 }, { 114, 8998 }, { 109, 8999 }, { 59, 9000 }, 
+	{ 108, 9001 }, { 115, 9002 }, { 108, 9003 }, { 59, 9004 }, { 59, 9005 }, { 101, 9006 }, { 116, 9007 }, { 114, 9008 }, { 97, 9009 }, { 116, 9010 }, { 104, 9011 }, { 59, 9012 }, { 113, 9013 }, { 59, 9014 }, { 113, 9015 }, { 101, 9016 }, { 105, 9017 }, { 59, 9018 }, { 101, 9019 }, { 111, 9020 }, 
+	{ 98, 9021 }, { 116, 9022 }, { 97, 9023 }, { 105, 9024 }, { 117, 9025 }, { 116, 9026 }, { 117, 9027 }, { 97, 9028 }, { 108, 9029 }, { 59, 9030 }, { 73, 9031 }, { 111, 9032 }, { 111, 9033 }, { 104, 9034 }, { 59, 9035 }, { 116, 9036 }, { 104, 9037 }, { 114, 9038 }, { 101, 9039 }, { 59, 9040 }, 
+	{ 114, 9041 }, { 108, 9042 }, { 114, 9043 }, { 86, 9044 }, { 99, 9045 }, { 114, 9046 }, { 101, 9047 }, { 111, 9048 }, { 97, 9049 }, { 108, 9050 }, { 117, 9051 }, { 108, 9052 }, { 101, 9053 }, { 117, 9054 }, { 114, 9055 }, { 113, 9056 }, { 101, 9057 }, { 97, 9058 }, { 115, 9059 }, { 107, 9060 }, 
+	{ 116, 9061 }, { 99, 9062 }, { 99, 9063 }, { 114, 9064 }, { 119, 9065 }, { 111, 9066 }, { 59, 9067 }, { 97, 9068 }, { 113, 9069 }, { 116, 9070 }, { 111, 9071 }, { 97, 9072 }, { 59, 9073 }, { 119, 9074 }, { 116, 9075 }, { 59, 9076 }, { 108, 9077 }, { 59, 9078 }, { 65, 9079 }, { 119, 9080 }, 
+	{ 59, 9081 }, { 97, 9082 }, { 119, 9083 }, { 119, 9084 }, { 111, 9085 }, { 109, 9086 }, { 83, 9087 }, { 112, 9088 }, { 104, 9089 }, { 71, 9090 }, { 115, 9091 }, { 97, 9092 }, { 105, 9093 }, { 59, 9094 }, { 97, 9095 }, { 108, 9096 }, { 97, 9097 }, { 115, 9098 }, { 110, 9099 }, { 100, 9100 }, 
+	{ 109, 9101 }, { 108, 9102 }, { 114, 9103 }, { 113, 9104 }, { 116, 9105 }, { 76, 9106 }, { 117, 9107 }, { 97, 9108 }, { 109, 9109 }, { 103, 9110 }, { 101, 9111 }, { 114, 9112 }, { 108, 9113 }, { 117, 9114 }, { 97, 9115 }, { 108, 9116 }, { 117, 9117 }, { 59, 9118 }, { 113, 9119 }, { 59, 9120 }, 
+	{ 114, 9121 }, { 108, 9122 }, { 101, 9123 }, { 105, 9124 }, { 59, 9125 }, { 59, 9126 }, { 69, 9127 }, { 59, 9128 }, { 116, 9129 }, { 98, 9130 }, { 108, 9131 }, { 99, 9132 }, { 59, 9133 }, { 116, 9134 }, { 97, 9135 }, { 101, 9136 }, { 111, 9137 }, { 59, 9138 }, { 114, 9139 }, { 59, 9140 }, 
+	{ 66, 9141 }, { 69, 9142 }, { 99, 9143 }, { 116, 9144 }, { 59, 9145 }, { 66, 9146 }, { 114, 9147 }, { 119, 9148 }, { 119, 9149 }, { 111, 9150 }, { 99, 9151 }, { 113, 9152 }, { 116, 9153 }, { 59, 9154 }, { 69, 9155 }, { 59, 9156 }, { 59, 9157 }, { 108, 9158 }, { 115, 9159 }, { 114, 9160 }, 
+	{ 59, 9161 }, { 119, 9162 }, { 111, 9163 }, { 97, 9164 }, { 59, 9165 }, { 59, 9166 }, { 101, 9167 }, { 119, 9168 }, { 59, 9169 }, { 59, 9170 }, { 100, 9171 }, { 108, 9172 }, { 114, 9173 }, { 102, 9174 }, { 103, 9175 }, { 116, 9176 }, { 104, 9177 }, { 59, 9178 }, { 101, 9179 }, { 115, 9180 }, 
+	{ 102, 9181 }, { 103, 9182 }, { 59, 9183 }, { 59, 9184 }, { 119, 9185 }, { 59, 9186 }, { 119, 9187 }, { 59, 9188 }, { 115, 9189 }, { 119, 9190 }, { 111, 9191 }, { 103, 9192 }, { 115, 9193 }, { 59, 9194 }, { 97, 9195 }, { 119, 9196 }, { 59, 9197 }, { 116, 9198 }, { 59, 9199 }, { 111, 9200 }, 
+	{ 111, 9201 }, { 108, 9202 }, { 59, 9203 }, { 101, 9204 }, { 116, 9205 }, { 108, 9206 }, { 111, 9207 }, { 112, 9208 }, { 119, 9209 }, { 111, 9210 }, { 111, 9211 }, { 111, 9212 }, { 101, 9213 }, { 59, 9214 }, { 59, 9215 }, { 111, 9216 }, { 113, 9217 }, { 59, 9218 }, { 101, 9219 }, { 114, 9220 }, 
+	{ 114, 9221 }, { 59, 9222 }, { 116, 9223 }, { 59, 9224 }, { 59, 9225 }, { 102, 9226 }, { 103, 9227 }, { 110, 9228 }, { 117, 9229 }, { 108, 9230 }, { 101, 9231 }, { 108, 9232 }, { 115, 9233 }, { 116, 9234 }, { 59, 9235 }, { 98, 9236 }, { 118, 9237 }, { 100, 9238 }, { 110, 9239 }, { 119, 9240 }, 
+	{ 119, 9241 }, { 116, 9242 }, { 65, 9243 }, { 82, 9244 }, { 116, 9245 }, { 111, 9246 }, { 59, 9247 }, { 114, 9248 }, { 66, 9249 }, { 111, 9250 }, { 101, 9251 }, { 116, 9252 }, { 59, 9253 }, { 66, 9254 }, { 99, 9255 }, { 114, 9256 }, { 114, 9257 }, { 83, 9258 }, { 97, 9259 }, { 108, 9260 }, 
+	{ 115, 9261 }, { 97, 9262 }, { 59, 9263 }, { 117, 9264 }, { 59, 9265 }, { 59, 9266 }, { 59, 9267 }, { 101, 9268 }, { 65, 9269 }, { 107, 9270 }, { 116, 9271 }, { 59, 9272 }, { 66, 9273 }, { 59, 9274 }, { 114, 9275 }, { 114, 9276 }, { 117, 9277 }, { 111, 9278 }, { 114, 9279 }, { 114, 9280 }, 
+	{ 59, 9281 }, { 101, 9282 }, { 59, 9283 }, { 114, 9284 }, { 59, 9285 }, { 114, 9286 }, { 59, 9287 }, { 59, 9288 }, { 119, 9289 }, { 83, 9290 }, { 112, 9291 }, { 97, 9292 }, { 105, 9293 }, { 114, 9294 }, { 59, 9295 }, { 99, 9296 }, { 99, 9297 }, { 108, 9298 }, { 69, 9299 }, { 116, 9300 }, 
+	{ 59, 9301 }, { 116, 9302 }, { 101, 9303 }, { 112, 9304 }, { 101, 9305 }, { 59, 9306 }, { 117, 9307 }, { 101, 9308 }, { 101, 9309 }, { 97, 9310 }, { 110, 9311 }, { 101, 9312 }, { 108, 9313 }, { 116, 9314 }, { 115, 9315 }, { 59, 9316 }, { 97, 9317 }, { 110, 9318 }, { 100, 9319 }, { 97, 9320 }, 
+	{ 117, 9321 }, { 59, 9322 }, { 101, 9323 }, { 59, 9324 }, { 115, 9325 }, { 113, 9326 }, { 59, 9327 }, { 114, 9328 }, { 105, 9329 }, { 107, 9330 }, { 65, 9331 }, { 99, 9332 }, { 99, 9333 }, { 114, 9334 }, { 59, 9335 }, { 97, 9336 }, { 113, 9337 }, { 116, 9338 }, { 111, 9339 }, { 97, 9340 }, 
+	{ 59, 9341 }, { 59, 9342 }, { 59, 9343 }, { 119, 9344 }, { 116, 9345 }, { 117, 9346 }, { 59, 9347 }, { 69, 9348 }, { 113, 9349 }, { 59, 9350 }, { 105, 9351 }, { 111, 9352 }, { 59, 9353 }, { 119, 9354 }, { 116, 9355 }, { 59, 9356 }, { 110, 9357 }, { 111, 9358 }, { 101, 9359 }, { 105, 9360 }, 
+	{ 116, 9361 }, { 104, 9362 }, { 59, 9363 }, { 116, 9364 }, { 59, 9365 }, { 59, 9366 }, { 116, 9367 }, { 104, 9368 }, { 59, 9369 }, { 110, 9370 }, { 59, 9371 }, { 59, 9372 }, { 115, 9373 }, { 111, 9374 }, { 97, 9375 }, { 59, 9376 }, { 114, 9377 }, { 59, 9378 }, { 59, 9379 }, { 119, 9380 }, 
+	{ 119, 9381 }, { 59, 9382 }, { 113, 9383 }, { 59, 9384 }, { 101, 9385 }, { 59, 9386 }, { 119, 9387 }, { 59, 9388 }, { 115, 9389 }, { 111, 9390 }, { 119, 9391 }, { 119, 9392 }, { 115, 9393 }, { 110, 9394 }, { 59, 9395 }, { 113, 9396 }, { 111, 9397 }, { 114, 9398 }, { 59, 9399 }, { 116, 9400 }, 
+	{ 104, 9401 }, { 116, 9402 }, { 114, 9403 }, { 101, 9404 }, { 59, 9405 }, { 59, 9406 }, { 101, 9407 }, { 101, 9408 }, { 108, 9409 }, { 101, 9410 }, { 101, 9411 }, { 116, 9412 }, { 59, 9413 }, { 59, 9414 }, { 65, 9415 }, { 114, 9416 }, { 105, 9417 }, { 65, 9418 }, { 119, 9419 }, { 111, 9420 }, 
+	{ 97, 9421 }, { 119, 9422 }, { 99, 9423 }, { 111, 9424 }, { 97, 9425 }, { 116, 9426 }, { 59, 9427 }, { 66, 9428 }, { 101, 9429 }, { 113, 9430 }, { 114, 9431 }, { 83, 9432 }, { 115, 9433 }, { 108, 9434 }, { 97, 9435 }, { 116, 9436 }, { 114, 9437 }, { 101, 9438 }, { 111, 9439 }, { 97, 9440 }, 
+	{ 59, 9441 }, { 59, 9442 }, { 97, 9443 }, { 114, 9444 }, { 59, 9445 }, { 59, 9446 }, { 114, 9447 }, { 114, 9448 }, { 114, 9449 }, { 59, 9450 }, { 112, 9451 }, { 97, 9452 }, { 99, 9453 }, { 110, 9454 }, { 101, 9455 }, { 101, 9456 }, { 97, 9457 }, { 59, 9458 }, { 113, 9459 }, { 101, 9460 }, 
+	{ 69, 9461 }, { 59, 9462 }, { 59, 9463 }, { 59, 9464 }, { 66, 9465 }, { 69, 9466 }, { 97, 9467 }, { 114, 9468 }, { 115, 9469 }, { 108, 9470 }, { 116, 9471 }, { 110, 9472 }, { 101, 9473 }, { 59, 9474 }, { 69, 9475 }, { 101, 9476 }, { 108, 9477 }, { 116, 9478 }, { 101, 9479 }, { 108, 9480 }, 
+	{ 97, 9481 }, { 81, 9482 }, { 59, 9483 }, { 117, 9484 }, { 105, 9485 }, { 98, 9486 }, { 101, 9487 }, { 114, 9488 }, { 107, 9489 }, { 116, 9490 }, { 59, 9491 }, { 66, 9492 }, { 114, 9493 }, { 117, 9494 }, { 111, 9495 }, { 114, 9496 }, { 114, 9497 }, { 59, 9498 }, { 105, 9499 }, { 97, 9500 }, 
+	{ 113, 9501 }, { 117, 9502 }, { 115, 9503 }, { 119, 9504 }, { 59, 9505 }, { 111, 9506 }, { 59, 9507 }, { 119, 9508 }, { 102, 9509 }, { 103, 9510 }, { 59, 9511 }, { 116, 9512 }, { 59, 9513 }, { 59, 9514 }, { 116, 9515 }, { 59, 9516 }, { 59, 9517 }, { 110, 9518 }, { 114, 9519 }, { 114, 9520 }, 
+	{ 59, 9521 }, { 59, 9522 }, { 59, 9523 }, { 113, 9524 }, { 110, 9525 }, { 59, 9526 }, { 110, 9527 }, { 115, 9528 }, { 59, 9529 }, { 59, 9530 }, { 59, 9531 }, { 59, 9532 }, { 119, 9533 }, { 111, 9534 }, { 59, 9535 }, { 116, 9536 }, { 105, 9537 }, { 73, 9538 }, { 81, 9539 }, { 67, 9540 }, 
+	{ 59, 9541 }, { 101, 9542 }, { 59, 9543 }, { 59, 9544 }, { 101, 9545 }, { 114, 9546 }, { 114, 9547 }, { 103, 9548 }, { 114, 9549 }, { 59, 9550 }, { 119, 9551 }, { 114, 9552 }, { 59, 9553 }, { 116, 9554 }, { 114, 9555 }, { 114, 9556 }, { 111, 9557 }, { 97, 9558 }, { 59, 9559 }, { 117, 9560 }, 
+	{ 101, 9561 }, { 113, 9562 }, { 59, 9563 }, { 59, 9564 }, { 108, 9565 }, { 59, 9566 }, { 114, 9567 }, { 116, 9568 }, { 114, 9569 }, { 114, 9570 }, { 108, 9571 }, { 59, 9572 }, { 59, 9573 }, { 111, 9574 }, { 111, 9575 }, { 97, 9576 }, { 99, 9577 }, { 101, 9578 }, { 83, 9579 }, { 97, 9580 }, 
+	{ 59, 9581 }, { 108, 9582 }, { 117, 9583 }, { 114, 9584 }, { 113, 9585 }, { 97, 9586 }, { 113, 9587 }, { 108, 9588 }, { 71, 9589 }, { 115, 9590 }, { 59, 9591 }, { 69, 9592 }, { 116, 9593 }, { 59, 9594 }, { 66, 9595 }, { 69, 9596 }, { 113, 9597 }, { 116, 9598 }, { 59, 9599 }, { 69, 9600 }, 
+	{ 59, 9601 }, { 59, 9602 }, { 108, 9603 }, { 117, 9604 }, { 97, 9605 }, { 117, 9606 }, { 114, 9607 }, { 116, 9608 }, { 114, 9609 }, { 101, 9610 }, { 111, 9611 }, { 97, 9612 }, { 59, 9613 }, { 97, 9614 }, { 114, 9615 }, { 59, 9616 }, { 59, 9617 }, { 111, 9618 }, { 108, 9619 }, { 117, 9620 }, 
+	{ 97, 9621 }, { 59, 9622 }, { 59, 9623 }, { 114, 9624 }, { 110, 9625 }, { 116, 9626 }, { 104, 9627 }, { 59, 9628 }, { 59, 9629 }, { 115, 9630 }, { 114, 9631 }, { 111, 9632 }, { 59, 9633 }, { 59, 9634 }, { 115, 9635 }, { 59, 9636 }, { 59, 9637 }, { 119, 9638 }, { 59, 9639 }, { 97, 9640 }, 
+	{ 110, 9641 }, { 117, 9642 }, { 111, 9643 }, { 65, 9644 }, { 103, 9645 }, { 114, 9646 }, { 111, 9647 }, { 104, 9648 }, { 114, 9649 }, { 59, 9650 }, { 59, 9651 }, { 111, 9652 }, { 59, 9653 }, { 59, 9654 }, { 114, 9655 }, { 114, 9656 }, { 97, 9657 }, { 59, 9658 }, { 117, 9659 }, { 59, 9660 }, 
+	{ 111, 9661 }, { 59, 9662 }, { 59, 9663 }, { 59, 9664 }, { 59, 9665 }, { 119, 9666 }, { 119, 9667 }, { 99, 9668 }, { 101, 9669 }, { 59, 9670 }, { 112, 9671 }, { 116, 9672 }, { 66, 9673 }, { 97, 9674 }, { 59, 9675 }, { 117, 9676 }, { 114, 9677 }, { 117, 9678 }, { 59, 9679 }, { 114, 9680 }, 
+	{ 59, 9681 }, { 113, 9682 }, { 59, 9683 }, { 97, 9684 }, { 113, 9685 }, { 117, 9686 }, { 59, 9687 }, { 69, 9688 }, { 113, 9689 }, { 59, 9690 }, { 111, 9691 }, { 108, 9692 }, { 109, 9693 }, { 105, 9694 }, { 59, 9695 }, { 111, 9696 }, { 116, 9697 }, { 114, 9698 }, { 114, 9699 }, { 108, 9700 }, 
+	{ 59, 9701 }, { 110, 9702 }, { 59, 9703 }, { 97, 9704 }, { 108, 9705 }, { 59, 9706 }, { 59, 9707 }, { 59, 9708 }, { 116, 9709 }, { 59, 9710 }, { 111, 9711 }, { 119, 9712 }, { 59, 9713 }, { 59, 9714 }, { 108, 9715 }, { 116, 9716 }, { 111, 9717 }, { 110, 9718 }, { 99, 9719 }, { 114, 9720 }, 
+	{ 111, 9721 }, { 119, 9722 }, { 116, 9723 }, { 111, 9724 }, { 114, 9725 }, { 59, 9726 }, { 59, 9727 }, { 114, 9728 }, { 97, 9729 }, { 119, 9730 }, { 59, 9731 }, { 59, 9732 }, { 101, 9733 }, { 59, 9734 }, { 97, 9735 }, { 101, 9736 }, { 97, 9737 }, { 108, 9738 }, { 97, 9739 }, { 59, 9740 }, 
+	{ 97, 9741 }, { 101, 9742 }, { 117, 9743 }, { 114, 9744 }, { 117, 9745 }, { 97, 9746 }, { 113, 9747 }, { 117, 9748 }, { 116, 9749 }, { 59, 9750 }, { 59, 9751 }, { 117, 9752 }, { 119, 9753 }, { 59, 9754 }, { 59, 9755 }, { 59, 9756 }, { 59, 9757 }, { 59, 9758 }, { 108, 9759 }, { 59, 9760 }, 
+	{ 59, 9761 }, { 119, 9762 }, { 59, 9763 }, { 68, 9764 }, { 101, 9765 }, { 116, 9766 }, { 116, 9767 }, { 117, 9768 }, { 97, 9769 }, { 119, 9770 }, { 59, 9771 }, { 65, 9772 }, { 119, 9773 }, { 59, 9774 }, { 101, 9775 }, { 114, 9776 }, { 59, 9777 }, { 59, 9778 }, { 99, 9779 }, { 114, 9780 }, 
+	{ 114, 9781 }, { 59, 9782 }, { 108, 9783 }, { 108, 9784 }, { 97, 9785 }, { 97, 9786 }, { 59, 9787 }, { 97, 9788 }, { 108, 9789 }, { 117, 9790 }, { 97, 9791 }, { 101, 9792 }, { 109, 9793 }, { 59, 9794 }, { 59, 9795 }, { 59, 9796 }, { 59, 9797 }, { 103, 9798 }, { 101, 9799 }, { 111, 9800 }, 
+	{ 116, 9801 }, { 108, 9802 }, { 59, 9803 }, { 114, 9804 }, { 59, 9805 }, { 59, 9806 }, { 101, 9807 }, { 101, 9808 }, { 59, 9809 }, { 59, 9810 }, { 59, 9811 }, { 59, 9812 }, { 116, 9813 }, { 108, 9814 }, { 108, 9815 }, { 59, 9816 }, { 97, 9817 }, { 108, 9818 }, { 59, 9819 }, { 59, 9820 }, 
+	{ 114, 9821 }, { 59, 9822 }, { 117, 9823 }, { 101, 9824 }, { 59, 9825 }, { 114, 9826 }, { 59, 9827 }, { 59, 9828 }, { 101, 9829 }, { 59, 9830 }, { 59, 9831 }, { 108, 9832 }, { 59, 9833 }, { 97, 9834 }, { 114, 9835 }, { 59, 9836 }, { 111, 9837 }, { 114, 9838 }, { 59, 9839 }, { 108, 9840 }, 
+	{ 73, 9841 }, { 119, 9842 }, { 59, 9843 }, { 59, 9844 }, { 110, 9845 }, { 59, 9846 }, { 116, 9847 }, { 101, 9848 }, { 103, 9849 }, { 114, 9850 }, { 97, 9851 }, { 108, 9852 }, { 59, 9853 }, 
+}};
+
+std::array<std::uint16_t, 9854> const wordring::whatwg::html::parsing::named_character_reference_dfa_accept_tbl = {{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1059, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	691, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 1062, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 375, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 563, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 687, 0, 0, 0, 0, 0, 0, 0, 655, 0, 0, 0, 689, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 776, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 1058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 992, 
+	0, 0, 0, 0, 0, 0, 0, 0, 1060, 0, 0, 0, 0, 0, 0, 0, 0, 1123, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1341, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 1419, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1479, 0, 0, 0, 
+	1505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1622, 0, 0, 0, 0, 0, 0, 1615, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1713, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 
+	0, 22, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 68, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 376, 0, 0, 382, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 499, 0, 0, 503, 0, 0, 510, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 565, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 639, 0, 0, 0, 0, 0, 0, 0, 0, 640, 0, 0, 0, 0, 656, 0, 0, 0, 
+	661, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 750, 0, 0, 0, 0, 0, 0, 0, 769, 0, 0, 0, 0, 0, 0, 0, 787, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 822, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 917, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	918, 0, 0, 0, 0, 0, 0, 0, 983, 0, 0, 0, 0, 993, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 1061, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1119, 0, 0, 1124, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 1154, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1189, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 1342, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 1433, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1420, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1480, 0, 0, 0, 0, 1498, 0, 0, 
+	0, 1506, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 1624, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1709, 0, 0, 1714, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 1761, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2029, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 2151, 2152, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2165, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2195, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 0, 0, 0, 16, 23, 0, 0, 
+	0, 40, 0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0, 111, 0, 0, 0, 125, 0, 0, 
+	0, 0, 0, 315, 0, 227, 0, 0, 0, 0, 0, 0, 0, 0, 0, 261, 267, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 373, 
+	383, 0, 388, 0, 0, 0, 0, 419, 0, 0, 0, 0, 0, 0, 526, 562, 0, 0, 0, 493, 
+	0, 501, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 560, 567, 0, 0, 578, 584, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 635, 0, 653, 0, 0, 0, 0, 0, 716, 0, 724, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 755, 0, 763, 0, 0, 0, 0, 792, 0, 
+	0, 0, 0, 0, 0, 0, 0, 828, 0, 833, 835, 0, 0, 0, 0, 0, 0, 0, 0, 851, 
+	853, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 909, 0, 0, 981, 0, 0, 0, 0, 0, 
+	0, 1048, 0, 1083, 1091, 0, 0, 1098, 0, 0, 0, 0, 0, 0, 0, 1151, 0, 0, 0, 1172, 
+	0, 0, 0, 1221, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 1377, 0, 1388, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1449, 0, 0, 1465, 1472, 1474, 
+	0, 0, 0, 0, 0, 0, 0, 0, 1542, 1558, 1545, 0, 0, 0, 1621, 0, 0, 0, 0, 0, 
+	1608, 0, 1630, 1636, 0, 0, 0, 0, 0, 1696, 0, 0, 0, 0, 0, 0, 0, 0, 1730, 1746, 
+	0, 0, 0, 0, 0, 0, 0, 0, 1833, 0, 0, 0, 1867, 1870, 0, 0, 0, 0, 0, 0, 
+	1908, 1910, 0, 0, 1917, 1921, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	2005, 0, 2012, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	2077, 0, 0, 2102, 0, 2109, 0, 0, 0, 2123, 0, 0, 0, 0, 0, 2147, 0, 0, 2160, 0, 
+	0, 0, 0, 0, 0, 0, 2192, 2196, 0, 0, 0, 0, 0, 0, 2213, 0, 0, 0, 2221, 0, 
+	0, 0, 0, 9, 8, 0, 0, 17, 0, 24, 0, 0, 0, 0, 0, 0, 38, 41, 0, 0, 
+	0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 70, 0, 71, 0, 0, 0, 0, 0, 84, 
+	0, 0, 94, 0, 0, 0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 
+	126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 0, 0, 0, 158, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 258, 
+	262, 0, 0, 268, 269, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 317, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 337, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 374, 0, 0, 0, 381, 0, 
+	0, 0, 389, 0, 0, 403, 0, 0, 407, 0, 0, 0, 0, 0, 0, 0, 420, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 494, 0, 0, 502, 0, 508, 0, 0, 513, 514, 0, 0, 0, 0, 527, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 561, 564, 
+	569, 0, 0, 0, 0, 0, 0, 579, 0, 0, 0, 0, 585, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 641, 0, 0, 629, 0, 0, 636, 0, 642, 643, 0, 0, 646, 
+	0, 0, 0, 654, 657, 0, 0, 663, 662, 664, 667, 0, 668, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 756, 0, 0, 
+	762, 764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 793, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 830, 0, 834, 836, 0, 0, 0, 0, 0, 
+	0, 0, 852, 854, 0, 0, 0, 0, 0, 0, 0, 0, 0, 955, 0, 0, 0, 0, 0, 0, 
+	875, 0, 0, 890, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 910, 0, 0, 0, 0, 0, 
+	0, 956, 957, 0, 0, 960, 0, 0, 0, 0, 0, 0, 982, 984, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 1005, 0, 1006, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1034, 
+	0, 0, 0, 0, 0, 0, 1043, 0, 0, 0, 1049, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1079, 0, 0, 1084, 0, 0, 0, 1092, 0, 0, 1099, 
+	1100, 0, 1103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1180, 1182, 0, 0, 
+	1209, 1211, 0, 0, 0, 0, 0, 0, 0, 1131, 0, 0, 0, 0, 0, 1140, 0, 0, 0, 0, 
+	0, 0, 1152, 0, 0, 0, 0, 0, 0, 0, 0, 1173, 1174, 1175, 0, 0, 0, 1183, 0, 0, 
+	0, 0, 1190, 0, 1192, 0, 0, 1198, 0, 0, 1199, 0, 0, 0, 0, 1212, 0, 0, 0, 1222, 
+	0, 0, 0, 0, 1290, 0, 0, 0, 0, 0, 0, 1303, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 1343, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1378, 0, 0, 0, 0, 0, 0, 0, 1389, 0, 0, 
+	1395, 0, 1397, 0, 0, 0, 0, 0, 1403, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1422, 
+	0, 1426, 1428, 0, 0, 0, 1432, 0, 0, 0, 0, 0, 1451, 0, 1457, 1459, 0, 0, 1466, 0, 
+	0, 0, 0, 0, 1473, 1475, 0, 0, 0, 0, 1482, 0, 0, 0, 0, 0, 1509, 0, 0, 1510, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1543, 0, 1546, 0, 0, 0, 0, 0, 0, 
+	1560, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 1609, 0, 0, 0, 0, 0, 0, 1623, 0, 0, 1631, 0, 1637, 0, 0, 0, 0, 
+	0, 0, 1675, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1697, 0, 0, 
+	0, 0, 0, 0, 0, 0, 1719, 0, 0, 0, 1720, 0, 0, 0, 0, 0, 0, 0, 1731, 0, 
+	0, 0, 1740, 0, 0, 0, 0, 1747, 0, 0, 0, 0, 0, 1760, 0, 1766, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1784, 0, 0, 1789, 0, 0, 0, 0, 0, 0, 0, 
+	1810, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1834, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 1868, 0, 1873, 1875, 1877, 1871, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 1911, 0, 0, 0, 1918, 0, 0, 1922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	1953, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 2006, 0, 0, 0, 0, 2013, 0, 0, 0, 0, 0, 0, 
+	0, 2028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2079, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2103, 0, 2110, 0, 0, 0, 0, 0, 
+	2124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2148, 0, 0, 0, 0, 0, 
+	0, 0, 2161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 2193, 2194, 2197, 0, 0, 0, 0, 2208, 0, 0, 2214, 0, 0, 0, 2222, 0, 
+	0, 0, 0, 2230, 0, 19, 0, 0, 11, 0, 0, 0, 0, 66, 0, 78, 81, 0, 0, 91, 
+	0, 103, 0, 0, 0, 121, 156, 0, 210, 0, 263, 314, 0, 0, 0, 0, 0, 0, 0, 251, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 310, 0, 0, 0, 323, 0, 0, 412, 466, 477, 0, 
+	363, 0, 0, 0, 0, 0, 0, 417, 0, 0, 0, 0, 0, 0, 0, 0, 0, 464, 0, 0, 
+	0, 489, 496, 0, 0, 0, 0, 0, 531, 0, 0, 0, 555, 558, 566, 0, 0, 0, 594, 0, 
+	0, 622, 659, 0, 0, 0, 0, 637, 672, 0, 682, 0, 0, 0, 0, 733, 0, 737, 0, 0, 
+	0, 758, 0, 803, 0, 752, 757, 0, 0, 0, 0, 0, 0, 0, 0, 807, 809, 814, 0, 0, 
+	827, 0, 838, 840, 0, 0, 856, 858, 0, 0, 860, 862, 990, 0, 0, 871, 0, 879, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 1026, 0, 1046, 0, 0, 0, 0, 1117, 1120, 1193, 0, 0, 0, 0, 0, 0, 0, 0, 
+	1219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1306, 0, 
+	0, 0, 1374, 0, 0, 0, 0, 0, 1412, 0, 1434, 0, 0, 0, 1448, 0, 0, 0, 0, 0, 
+	1501, 0, 0, 0, 0, 1540, 1557, 1548, 1551, 0, 0, 1567, 1574, 0, 0, 0, 0, 0, 1683, 0, 
+	0, 1694, 0, 0, 1752, 0, 0, 0, 0, 0, 0, 0, 0, 1792, 1801, 0, 1822, 1827, 0, 0, 
+	0, 0, 0, 1938, 0, 0, 1980, 0, 0, 0, 0, 0, 0, 0, 1956, 0, 1978, 0, 0, 1993, 
+	0, 0, 0, 2002, 0, 0, 0, 0, 0, 0, 2038, 0, 0, 0, 0, 0, 0, 0, 2054, 0, 
+	0, 2068, 0, 2076, 0, 2099, 0, 0, 2116, 0, 0, 2128, 2132, 0, 0, 0, 2149, 2154, 2171, 2177, 
+	2188, 2198, 2204, 0, 0, 2200, 2202, 2206, 2223, 0, 0, 2215, 0, 2219, 2226, 2228, 0, 0, 13, 15, 
+	21, 0, 0, 0, 0, 0, 0, 0, 43, 0, 45, 47, 0, 0, 0, 0, 0, 0, 0, 67, 
+	0, 72, 73, 0, 80, 82, 0, 0, 93, 0, 0, 154, 0, 0, 0, 0, 0, 0, 108, 0, 
+	0, 0, 0, 0, 0, 0, 122, 123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 155, 157, 0, 0, 0, 0, 0, 0, 170, 0, 0, 
+	0, 0, 0, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 171, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	211, 0, 213, 0, 215, 0, 0, 218, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 235, 0, 
+	0, 0, 0, 0, 0, 0, 252, 254, 0, 257, 0, 264, 0, 283, 270, 0, 0, 284, 0, 0, 
+	0, 0, 0, 0, 300, 0, 0, 304, 0, 0, 311, 0, 316, 0, 0, 0, 324, 325, 0, 327, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 344, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 364, 390, 0, 0, 365, 366, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 398, 
+	0, 0, 0, 0, 0, 0, 413, 0, 0, 0, 418, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 465, 467, 468, 0, 0, 472, 0, 0, 0, 0, 478, 0, 0, 497, 0, 0, 0, 487, 
+	491, 0, 498, 0, 0, 0, 0, 0, 0, 0, 0, 523, 528, 0, 532, 533, 0, 0, 536, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 556, 0, 559, 568, 570, 571, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 590, 0, 0, 593, 595, 0, 598, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 623, 0, 0, 0, 0, 638, 644, 0, 0, 0, 651, 0, 0, 660, 665, 0, 
+	669, 0, 0, 673, 0, 683, 684, 0, 0, 692, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 705, 712, 0, 708, 0, 0, 713, 0, 0, 717, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 734, 0, 738, 0, 0, 0, 0, 0, 754, 759, 761, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 784, 0, 0, 0, 0, 0, 0, 0, 0, 0, 804, 0, 808, 810, 0, 0, 815, 
+	816, 0, 0, 0, 0, 0, 0, 829, 0, 0, 839, 841, 0, 0, 0, 0, 0, 857, 859, 861, 
+	863, 0, 880, 0, 0, 985, 0, 0, 0, 0, 872, 0, 0, 878, 881, 0, 0, 0, 0, 0, 
+	0, 0, 0, 893, 0, 0, 0, 0, 0, 0, 0, 0, 0, 908, 911, 0, 0, 0, 916, 0, 
+	0, 0, 0, 0, 958, 0, 0, 0, 965, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	991, 0, 0, 0, 0, 0, 0, 1003, 0, 1007, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	1027, 0, 0, 0, 0, 0, 1036, 1037, 0, 0, 0, 0, 0, 0, 1047, 1050, 0, 0, 1053, 0, 
+	0, 1063, 0, 0, 0, 0, 0, 0, 0, 1070, 0, 0, 0, 0, 0, 1077, 0, 1078, 1080, 1081, 
+	0, 0, 0, 0, 0, 0, 1102, 0, 0, 0, 0, 1113, 1114, 0, 0, 1118, 1121, 0, 0, 0, 
+	1185, 0, 1215, 0, 0, 0, 0, 0, 1130, 1132, 0, 0, 0, 0, 1139, 0, 1143, 0, 0, 0, 
+	1150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1176, 0, 0, 1179, 0, 1184, 0, 0, 0, 1191, 
+	1194, 0, 0, 1197, 0, 1204, 0, 0, 1207, 0, 0, 0, 1216, 1220, 0, 0, 1285, 0, 0, 0, 
+	0, 0, 1292, 0, 0, 0, 0, 0, 0, 1305, 1307, 0, 1310, 0, 0, 0, 0, 1317, 0, 0, 
+	0, 0, 1325, 0, 0, 0, 1331, 0, 1336, 0, 0, 0, 0, 0, 1346, 0, 1351, 1352, 0, 0, 
+	1356, 1357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1371, 1372, 1376, 0, 0, 1382, 1383, 0, 0, 
+	0, 1390, 0, 0, 1398, 0, 0, 0, 0, 0, 0, 0, 1410, 0, 1413, 1414, 0, 0, 0, 0, 
+	1425, 1427, 0, 1430, 0, 1435, 0, 1440, 0, 0, 1450, 0, 1458, 0, 0, 0, 1463, 0, 0, 0, 
+	1470, 0, 1476, 0, 0, 0, 0, 0, 1486, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1502, 1504, 
+	1507, 0, 1511, 0, 0, 0, 0, 0, 0, 1527, 0, 0, 1529, 0, 0, 0, 1534, 0, 0, 0, 
+	1541, 0, 1547, 1549, 0, 1552, 0, 0, 0, 1559, 0, 1575, 0, 0, 1632, 1562, 0, 0, 0, 1568, 
+	0, 0, 0, 1573, 1576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 1607, 1610, 0, 0, 1614, 1616, 0, 0, 0, 1620, 0, 0, 0, 0, 1638, 
+	0, 1671, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1684, 0, 0, 1688, 0, 0, 0, 0, 1695, 
+	1698, 0, 0, 0, 1703, 0, 0, 0, 0, 0, 0, 1715, 0, 0, 0, 0, 1726, 0, 0, 0, 
+	0, 1732, 0, 0, 0, 0, 0, 1739, 1741, 0, 0, 0, 1745, 0, 0, 0, 1753, 0, 0, 0, 
+	1768, 0, 1770, 0, 1772, 0, 0, 0, 0, 0, 0, 0, 0, 1782, 0, 1785, 0, 0, 1790, 0, 
+	1793, 0, 1796, 0, 0, 0, 0, 0, 1820, 0, 1823, 0, 0, 0, 1828, 0, 0, 0, 1836, 0, 
+	1837, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1854, 0, 0, 0, 0, 0, 1869, 1872, 1874, 1876, 
+	1880, 0, 0, 1881, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1907, 0, 
+	1912, 0, 0, 1919, 0, 0, 0, 0, 0, 0, 0, 1940, 0, 1947, 1951, 1952, 0, 0, 1957, 0, 
+	1959, 0, 0, 0, 0, 1971, 0, 0, 0, 0, 0, 1979, 1981, 0, 0, 0, 0, 1994, 2018, 0, 
+	1995, 0, 0, 2004, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2039, 0, 0, 
+	0, 0, 2055, 0, 0, 0, 0, 0, 0, 0, 2069, 0, 0, 2073, 0, 0, 2078, 0, 2088, 2100, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2089, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	2117, 0, 0, 0, 2129, 0, 0, 2133, 0, 0, 0, 0, 0, 0, 0, 2150, 0, 2155, 2156, 0, 
+	2158, 0, 0, 0, 0, 0, 2168, 2169, 0, 2172, 0, 0, 0, 0, 2178, 0, 0, 0, 2182, 0, 
+	0, 2189, 0, 2199, 2201, 2203, 2205, 2207, 0, 0, 2216, 0, 2220, 2224, 0, 2227, 2229, 2231, 18, 2, 
+	0, 10, 26, 31, 33, 64, 0, 77, 0, 88, 0, 0, 0, 0, 206, 0, 0, 0, 0, 0, 
+	243, 246, 0, 0, 0, 0, 0, 0, 293, 0, 0, 0, 0, 0, 0, 321, 0, 0, 0, 367, 
+	0, 384, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 481, 0, 488, 505, 0, 
+	516, 0, 0, 529, 0, 545, 0, 0, 0, 0, 0, 0, 0, 625, 0, 0, 0, 633, 0, 0, 
+	706, 718, 0, 0, 0, 0, 0, 774, 747, 751, 766, 777, 0, 0, 0, 0, 0, 805, 0, 825, 
+	831, 0, 844, 846, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 1333, 1385, 1368, 1373, 0, 1392, 1404, 1406, 0, 0, 1437, 1442, 
+	0, 0, 0, 0, 0, 0, 0, 0, 1523, 0, 0, 1593, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1723, 0, 0, 0, 0, 1762, 0, 
+	0, 0, 0, 0, 0, 0, 1937, 1961, 1982, 0, 0, 0, 1926, 0, 0, 1941, 0, 0, 0, 0, 
+	0, 1990, 0, 1997, 0, 2001, 0, 2015, 2026, 0, 0, 2034, 0, 2036, 0, 0, 0, 2059, 0, 0, 
+	0, 0, 0, 0, 2065, 0, 2104, 2105, 0, 0, 0, 0, 0, 2140, 2143, 2185, 2190, 0, 0, 0, 
+	4, 0, 12, 14, 20, 28, 0, 30, 32, 34, 35, 0, 0, 48, 0, 58, 0, 0, 62, 0, 
+	65, 0, 0, 79, 85, 0, 90, 0, 96, 0, 0, 0, 0, 0, 0, 0, 110, 113, 0, 0, 
+	118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 147, 
+	148, 149, 150, 151, 0, 0, 0, 162, 166, 163, 167, 172, 176, 173, 177, 183, 187, 184, 188, 193, 
+	197, 201, 194, 198, 202, 0, 164, 168, 165, 169, 174, 178, 175, 179, 0, 0, 0, 185, 189, 186, 
+	190, 195, 199, 203, 196, 200, 204, 0, 207, 209, 212, 214, 216, 0, 0, 221, 222, 0, 0, 0, 
+	0, 0, 0, 0, 236, 237, 239, 0, 245, 247, 249, 0, 253, 0, 0, 265, 0, 0, 0, 0, 
+	0, 0, 291, 0, 294, 0, 298, 0, 0, 0, 0, 0, 0, 0, 320, 322, 326, 328, 329, 0, 
+	332, 333, 0, 0, 0, 0, 0, 343, 0, 0, 0, 0, 352, 0, 355, 356, 0, 358, 0, 0, 
+	0, 368, 0, 370, 0, 0, 378, 0, 385, 0, 0, 391, 392, 0, 402, 0, 406, 409, 0, 0, 
+	0, 0, 422, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 471, 473, 474, 475, 0, 
+	0, 495, 483, 0, 0, 490, 0, 500, 507, 0, 0, 0, 517, 518, 0, 0, 0, 0, 530, 0, 
+	535, 0, 539, 0, 0, 542, 0, 0, 0, 550, 0, 0, 554, 553, 557, 572, 0, 0, 0, 0, 
+	0, 582, 0, 586, 589, 591, 592, 0, 599, 0, 603, 0, 606, 0, 0, 0, 0, 0, 613, 0, 
+	0, 0, 0, 0, 0, 620, 621, 0, 626, 0, 0, 634, 0, 647, 0, 0, 658, 0, 670, 671, 
+	674, 685, 686, 693, 694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 715, 
+	719, 0, 0, 0, 0, 0, 729, 0, 0, 0, 0, 0, 0, 0, 0, 749, 753, 760, 768, 0, 
+	771, 0, 773, 775, 778, 779, 0, 0, 783, 785, 0, 789, 0, 0, 0, 0, 0, 0, 0, 806, 
+	811, 813, 818, 0, 819, 0, 821, 0, 826, 832, 837, 0, 845, 847, 0, 0, 0, 864, 0, 895, 
+	0, 0, 0, 0, 873, 0, 877, 882, 0, 0, 0, 0, 0, 0, 0, 0, 894, 896, 897, 0, 
+	0, 900, 0, 0, 0, 907, 912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 961, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 986, 987, 0, 989, 994, 0, 0, 998, 0, 0, 0, 1008, 1009, 1010, 
+	1011, 1012, 0, 0, 0, 0, 1025, 0, 0, 0, 0, 0, 0, 1039, 0, 1041, 0, 1044, 0, 1051, 
+	1052, 1054, 0, 0, 1064, 1065, 0, 0, 0, 0, 0, 1071, 1072, 0, 0, 0, 1094, 0, 0, 0, 
+	0, 1093, 0, 1101, 0, 0, 1107, 1108, 0, 0, 0, 0, 0, 0, 1126, 0, 0, 0, 0, 0, 
+	1127, 0, 1133, 1134, 0, 1136, 0, 1141, 0, 0, 0, 1148, 0, 1153, 1156, 0, 1157, 0, 1159, 0, 
+	0, 1166, 0, 1177, 0, 1181, 1186, 1187, 1188, 1195, 1196, 0, 0, 1205, 0, 1208, 1210, 1213, 0, 1240, 
+	0, 0, 0, 1257, 0, 0, 0, 1288, 0, 0, 1293, 0, 1295, 1296, 0, 0, 0, 1301, 0, 0, 
+	0, 1311, 0, 1313, 1314, 0, 0, 1318, 1319, 0, 1323, 0, 1326, 1327, 0, 1335, 0, 0, 1345, 0, 
+	0, 0, 0, 0, 0, 0, 0, 1361, 1363, 0, 1364, 0, 0, 1370, 1375, 1379, 0, 0, 1386, 1387, 
+	1394, 1396, 1399, 1400, 0, 1402, 1405, 1407, 0, 0, 1417, 1418, 1421, 1423, 0, 0, 0, 1439, 1444, 0, 
+	1452, 0, 0, 1462, 0, 0, 0, 0, 0, 1478, 0, 0, 0, 0, 1488, 0, 0, 0, 1492, 1495, 
+	0, 0, 0, 1503, 1508, 0, 0, 0, 0, 0, 0, 0, 1524, 0, 1526, 0, 0, 0, 0, 0, 
+	1538, 0, 0, 0, 0, 0, 1555, 0, 1561, 0, 1594, 0, 1565, 0, 1569, 1570, 0, 1572, 0, 1578, 
+	0, 1580, 0, 0, 0, 0, 0, 0, 1588, 0, 1591, 0, 1595, 1596, 0, 0, 1599, 0, 0, 0, 
+	1606, 0, 1612, 0, 0, 0, 1619, 0, 0, 1633, 1634, 0, 0, 0, 0, 0, 0, 0, 0, 1673, 
+	1674, 0, 1678, 1679, 1680, 1681, 1682, 0, 0, 0, 0, 1691, 0, 1699, 0, 0, 0, 1704, 1705, 0, 
+	0, 0, 1712, 0, 1718, 0, 1724, 1725, 0, 0, 1729, 1733, 1734, 1736, 0, 1737, 0, 0, 0, 1744, 
+	0, 1749, 0, 0, 0, 1763, 0, 0, 0, 1769, 1771, 1773, 1774, 0, 0, 1777, 0, 0, 0, 1783, 
+	1786, 0, 0, 0, 1797, 0, 1799, 0, 1802, 0, 0, 1806, 0, 0, 0, 0, 1821, 0, 0, 0, 
+	1829, 0, 1832, 0, 0, 0, 1840, 1841, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 1889, 1890, 0, 0, 0, 0, 0, 1902, 0, 1903, 0, 0, 
+	1906, 0, 0, 0, 0, 0, 0, 1927, 0, 0, 0, 0, 0, 1935, 0, 1939, 1942, 1946, 0, 0, 
+	0, 0, 0, 0, 1962, 0, 0, 0, 0, 1975, 0, 0, 1983, 0, 1986, 0, 1992, 1998, 0, 2003, 
+	2007, 0, 2010, 0, 2017, 2019, 2020, 2021, 0, 0, 2025, 2027, 2037, 0, 0, 0, 2051, 2056, 0, 0, 
+	0, 0, 2066, 2067, 2070, 0, 2074, 2075, 0, 2101, 2106, 0, 0, 0, 0, 0, 2086, 0, 0, 0, 
+	0, 0, 0, 0, 2107, 0, 2112, 0, 0, 2125, 2126, 2127, 2130, 2131, 0, 0, 0, 0, 0, 2141, 
+	0, 2144, 0, 0, 0, 2157, 2159, 2162, 2163, 2166, 2167, 2170, 0, 0, 2175, 2176, 0, 0, 2181, 0, 
+	2187, 2191, 0, 0, 0, 0, 1, 5, 25, 0, 83, 87, 0, 105, 0, 0, 223, 225, 0, 0, 
+	240, 242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 295, 0, 307, 0, 0, 0, 339, 0, 360, 
+	371, 0, 0, 0, 421, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 469, 480, 
+	485, 504, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 596, 0, 627, 630, 632, 0, 710, 0, 
+	0, 740, 0, 0, 746, 765, 0, 0, 0, 0, 0, 823, 842, 849, 865, 869, 0, 903, 905, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 999, 0, 0, 0, 0, 0, 0, 1056, 0, 0, 0, 1128, 1144, 1146, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 1332, 1367, 1380, 1391, 0, 0, 1436, 1441, 1445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1563, 
+	1586, 1602, 1604, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1750, 1787, 1710, 
+	1716, 1721, 0, 0, 0, 0, 0, 1811, 0, 0, 0, 1844, 0, 0, 0, 0, 1892, 1913, 1915, 0, 
+	0, 0, 0, 0, 0, 0, 1984, 1989, 0, 1999, 2008, 2014, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 2071, 2108, 2114, 0, 0, 2138, 2184, 2209, 2211, 0, 3, 6, 27, 0, 42, 
+	0, 49, 0, 0, 61, 0, 69, 75, 0, 0, 89, 0, 0, 0, 0, 0, 104, 106, 0, 0, 
+	114, 0, 0, 119, 0, 127, 0, 129, 0, 0, 0, 0, 0, 0, 0, 138, 0, 140, 0, 0, 
+	0, 0, 159, 160, 161, 0, 0, 0, 205, 208, 0, 219, 224, 226, 229, 0, 231, 232, 233, 241, 
+	244, 0, 0, 0, 0, 271, 0, 0, 0, 286, 0, 0, 296, 0, 299, 301, 0, 0, 0, 308, 
+	312, 318, 0, 0, 334, 0, 0, 340, 341, 342, 345, 0, 0, 0, 0, 351, 0, 0, 359, 361, 
+	362, 0, 372, 0, 0, 0, 387, 0, 0, 408, 0, 411, 414, 415, 416, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 462, 463, 470, 0, 0, 482, 484, 486, 492, 506, 509, 0, 515, 0, 521, 524, 
+	525, 534, 0, 540, 0, 0, 546, 548, 0, 0, 0, 0, 0, 580, 581, 583, 597, 0, 602, 604, 
+	605, 607, 608, 609, 610, 611, 612, 614, 615, 616, 617, 618, 619, 624, 628, 631, 0, 648, 0, 652, 
+	0, 695, 0, 0, 698, 699, 0, 0, 0, 703, 0, 707, 709, 711, 0, 720, 0, 722, 723, 0, 
+	0, 730, 0, 0, 735, 739, 741, 744, 745, 748, 767, 770, 772, 0, 0, 788, 0, 791, 794, 0, 
+	0, 0, 0, 812, 0, 820, 824, 843, 848, 850, 855, 891, 866, 0, 868, 870, 874, 0, 884, 885, 
+	886, 887, 0, 889, 892, 898, 899, 0, 0, 904, 906, 913, 0, 0, 0, 0, 0, 0, 0, 0, 
+	962, 0, 966, 0, 0, 0, 0, 0, 0, 979, 980, 988, 0, 997, 1000, 1001, 0, 0, 0, 0, 
+	0, 0, 1028, 0, 1030, 1031, 0, 1038, 0, 1042, 1045, 1055, 1057, 1066, 1067, 1068, 0, 1073, 0, 0, 
+	0, 0, 1085, 0, 0, 0, 1089, 1090, 0, 1104, 1105, 1106, 1109, 1110, 0, 1115, 1116, 1122, 0, 0, 
+	0, 0, 1347, 1348, 1129, 0, 0, 1142, 1145, 1147, 0, 1155, 0, 1164, 1165, 1170, 0, 0, 0, 0, 
+	0, 1214, 1242, 0, 0, 0, 0, 0, 0, 0, 0, 1287, 0, 1291, 0, 1297, 1298, 0, 1302, 1304, 
+	0, 0, 1312, 0, 0, 0, 0, 0, 1334, 0, 1344, 1349, 1353, 1350, 0, 1355, 0, 1359, 0, 1362, 
+	0, 1366, 1369, 1381, 1384, 1393, 0, 0, 1411, 0, 1429, 0, 1438, 1443, 1446, 0, 0, 1461, 1467, 1468, 
+	1469, 0, 1477, 0, 1483, 0, 1485, 0, 0, 1490, 1491, 1494, 0, 0, 0, 0, 0, 1518, 0, 0, 
+	0, 0, 1525, 1528, 0, 0, 0, 1537, 1539, 1544, 1550, 0, 0, 0, 1589, 1564, 0, 1571, 1577, 0, 
+	1581, 1582, 1583, 1584, 0, 1587, 1590, 0, 1597, 1598, 0, 0, 1603, 1605, 0, 1613, 0, 0, 1628, 1629, 
+	1635, 0, 0, 0, 0, 0, 0, 0, 1676, 0, 1685, 0, 1689, 0, 1693, 1700, 1701, 1702, 0, 0, 
+	1711, 1717, 1722, 1727, 0, 1735, 0, 1742, 0, 1748, 1751, 0, 0, 1764, 1765, 1767, 0, 0, 0, 1780, 
+	0, 1788, 1791, 1794, 0, 1798, 1800, 1803, 0, 1807, 0, 1812, 1819, 1824, 1825, 1826, 0, 1835, 0, 0, 
+	0, 0, 1845, 0, 0, 1851, 1852, 1853, 0, 0, 1861, 0, 0, 0, 0, 1878, 0, 0, 0, 0, 
+	0, 0, 0, 1893, 0, 0, 1898, 1899, 1900, 1901, 0, 1905, 1909, 1914, 1916, 1920, 1923, 0, 0, 1929, 
+	0, 0, 1933, 1936, 1948, 0, 1950, 1954, 1955, 0, 1960, 0, 1970, 0, 0, 0, 0, 1985, 0, 1991, 
+	2000, 2009, 2011, 2016, 2022, 0, 2024, 0, 0, 0, 0, 0, 2062, 0, 2064, 2072, 0, 2081, 0, 0, 
+	0, 2085, 0, 2090, 0, 0, 0, 0, 0, 2111, 2113, 2115, 2134, 2135, 2136, 2137, 0, 2142, 2145, 2146, 
+	2153, 2173, 2174, 2179, 2180, 2183, 2186, 2210, 2212, 2217, 0, 0, 0, 115, 0, 0, 238, 248, 255, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 399, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 459, 0, 0, 511, 0, 0, 537, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 786, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1169, 1217, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 1249, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	1408, 0, 1453, 0, 0, 0, 0, 0, 0, 1530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2040, 0, 0, 0, 0, 0, 2041, 
+	0, 0, 0, 2057, 0, 0, 0, 29, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 63, 
+	0, 86, 0, 0, 0, 0, 100, 0, 0, 0, 116, 117, 124, 128, 130, 0, 0, 0, 134, 0, 
+	0, 0, 0, 0, 0, 153, 0, 181, 0, 0, 0, 250, 256, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 287, 0, 297, 0, 0, 305, 330, 331, 335, 0, 346, 0, 0, 0, 0, 0, 0, 369, 
+	377, 380, 386, 400, 0, 405, 0, 0, 0, 426, 0, 0, 0, 0, 0, 0, 476, 0, 0, 0, 
+	538, 541, 0, 0, 551, 0, 0, 0, 0, 0, 0, 649, 0, 0, 696, 0, 0, 0, 702, 0, 
+	714, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 800, 817, 0, 883, 888, 901, 902, 914, 
+	0, 0, 0, 0, 0, 0, 0, 963, 0, 0, 968, 0, 0, 974, 976, 0, 0, 0, 0, 0, 
+	0, 0, 1029, 1035, 0, 1069, 0, 1075, 0, 1082, 0, 0, 0, 0, 1111, 0, 0, 0, 0, 1135, 
+	1137, 0, 0, 1158, 1171, 0, 0, 0, 0, 0, 1243, 1244, 1245, 1258, 1259, 1260, 0, 1289, 1294, 0, 
+	0, 0, 1315, 1316, 1320, 0, 1324, 1328, 0, 0, 1354, 1358, 1360, 1365, 1401, 1409, 1424, 1431, 0, 0, 
+	1471, 0, 1484, 0, 1489, 1496, 1497, 0, 0, 0, 0, 0, 0, 1522, 0, 0, 0, 0, 1554, 1556, 
+	0, 1579, 1585, 0, 1600, 1601, 1611, 1617, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1686, 0, 0, 
+	1708, 0, 1738, 0, 0, 0, 1775, 1776, 0, 0, 0, 0, 0, 0, 1838, 1839, 1842, 1843, 0, 0, 
+	0, 0, 0, 0, 0, 1865, 1879, 1882, 1885, 1886, 1887, 1888, 1891, 0, 0, 1904, 0, 0, 0, 0, 
+	0, 1958, 0, 0, 1974, 1976, 0, 0, 0, 0, 2042, 0, 0, 2058, 0, 0, 2080, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 2139, 2225, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 379, 0, 0, 424, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 975, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1228, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 
+	0, 1464, 0, 0, 1514, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1658, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	1857, 0, 0, 0, 1866, 1883, 0, 0, 0, 0, 0, 0, 0, 0, 1996, 2030, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 50, 51, 52, 53, 54, 55, 
+	56, 57, 60, 76, 95, 97, 0, 0, 0, 107, 109, 131, 0, 133, 0, 137, 139, 0, 0, 0, 
+	180, 182, 217, 230, 0, 0, 0, 278, 279, 0, 0, 0, 285, 292, 0, 0, 338, 0, 0, 349, 
+	0, 0, 357, 0, 0, 423, 425, 0, 0, 0, 0, 0, 461, 479, 512, 519, 0, 0, 552, 0, 
+	0, 0, 601, 645, 650, 666, 0, 0, 0, 0, 0, 727, 728, 0, 0, 781, 782, 790, 795, 797, 
+	799, 867, 915, 0, 0, 0, 0, 0, 959, 964, 0, 0, 0, 995, 0, 1004, 0, 0, 0, 0, 
+	0, 1040, 1074, 0, 0, 0, 1088, 0, 1125, 0, 0, 0, 1138, 1149, 0, 0, 0, 0, 1241, 0, 
+	0, 0, 0, 0, 0, 0, 1447, 1460, 0, 1487, 1500, 0, 0, 0, 1520, 1521, 1531, 1532, 1533, 0, 
+	1566, 0, 1618, 0, 0, 0, 0, 0, 0, 0, 0, 1690, 1706, 1728, 1743, 1756, 0, 0, 1781, 0, 
+	1804, 0, 1808, 0, 0, 0, 1846, 0, 0, 0, 0, 0, 1863, 1864, 1894, 0, 0, 0, 1928, 0, 
+	1931, 1949, 1963, 0, 0, 0, 0, 1972, 1977, 0, 0, 2023, 0, 0, 0, 2063, 0, 2083, 0, 0, 
+	2091, 0, 0, 2096, 0, 0, 102, 0, 0, 259, 277, 0, 0, 0, 0, 0, 306, 0, 313, 0, 
+	0, 0, 0, 430, 0, 0, 0, 0, 0, 0, 0, 443, 0, 0, 448, 0, 0, 0, 0, 0, 
+	0, 444, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 743, 
+	0, 0, 0, 0, 0, 0, 920, 0, 0, 0, 0, 0, 0, 931, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 921, 0, 0, 0, 0, 0, 978, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	1097, 1112, 0, 0, 0, 0, 0, 0, 0, 1225, 0, 0, 0, 1230, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1272, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1454, 
+	0, 0, 1493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 1924, 0, 1934, 0, 0, 0, 1973, 0, 0, 0, 2035, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 101, 132, 0, 0, 0, 0, 260, 266, 0, 0, 
+	0, 0, 0, 303, 0, 0, 0, 0, 0, 0, 427, 0, 445, 0, 0, 0, 0, 0, 0, 0, 
+	697, 700, 0, 704, 721, 0, 0, 922, 0, 0, 0, 0, 0, 0, 0, 0, 969, 0, 0, 0, 
+	0, 0, 0, 0, 0, 1076, 0, 0, 0, 0, 0, 0, 1178, 0, 0, 1206, 1286, 0, 1308, 0, 
+	1321, 0, 1329, 0, 0, 0, 1481, 0, 0, 0, 0, 1592, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 1795, 0, 0, 0, 0, 1847, 1849, 0, 0, 0, 0, 1895, 1896, 0, 1925, 0, 0, 
+	0, 1967, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2087, 0, 0, 0, 0, 120, 0, 0, 281, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 547, 0, 0, 0, 0, 600, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 780, 0, 0, 0, 876, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 953, 0, 0, 0, 0, 0, 0, 996, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1227, 0, 1231, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 1535, 0, 0, 0, 0, 0, 1640, 0, 0, 0, 0, 0, 0, 
+	1651, 0, 0, 0, 0, 0, 0, 0, 1641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 1932, 1943, 0, 1945, 2031, 0, 0, 2043, 0, 0, 0, 2060, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 274, 0, 0, 302, 0, 0, 350, 
+	0, 0, 0, 0, 0, 0, 0, 543, 0, 0, 0, 0, 701, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 967, 970, 1002, 0, 0, 1019, 0, 0, 0, 1086, 1087, 0, 1200, 0, 0, 1201, 0, 0, 
+	0, 1322, 1330, 0, 0, 1512, 0, 0, 0, 1642, 0, 0, 0, 0, 0, 0, 0, 0, 1677, 0, 
+	0, 1805, 1809, 0, 0, 1850, 1855, 0, 0, 1897, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2061, 
+	2082, 2084, 0, 0, 0, 0, 0, 280, 282, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 549, 0, 0, 0, 0, 0, 0, 679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	926, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 973, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 1096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 1252, 0, 0, 0, 0, 1261, 0, 0, 0, 0, 0, 0, 
+	0, 1274, 0, 0, 0, 1278, 0, 0, 0, 0, 0, 0, 0, 1455, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1669, 0, 0, 1692, 
+	1707, 0, 0, 0, 0, 1778, 0, 0, 0, 1818, 1848, 0, 0, 0, 0, 0, 0, 0, 0, 2045, 
+	0, 2046, 0, 0, 2118, 0, 0, 0, 0, 0, 98, 0, 0, 0, 142, 0, 0, 0, 275, 276, 
+	347, 348, 0, 0, 401, 0, 0, 0, 0, 0, 544, 574, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1299, 0, 1300, 0, 0, 0, 1513, 1519, 1553, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1831, 1856, 1862, 1930, 0, 0, 0, 0, 0, 
+	2047, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 0, 0, 0, 0, 0, 0, 460, 0, 
+	0, 575, 0, 0, 675, 0, 0, 0, 0, 681, 726, 0, 742, 798, 0, 0, 0, 923, 0, 0, 
+	0, 0, 0, 0, 943, 0, 946, 0, 0, 0, 0, 951, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1224, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 1239, 0, 1250, 0, 0, 1254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1536, 0, 0, 0, 0, 0, 0, 
+	1646, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1687, 0, 0, 0, 1759, 0, 1814, 0, 0, 
+	0, 0, 0, 0, 0, 2032, 0, 0, 0, 0, 0, 2119, 0, 0, 0, 0, 0, 0, 141, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 576, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	1672, 0, 0, 0, 1964, 1965, 0, 0, 0, 0, 0, 0, 2092, 0, 2094, 0, 0, 0, 74, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 404, 0, 0, 0, 0, 434, 0, 0, 0, 0, 
+	440, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 944, 0, 0, 0, 0, 0, 954, 0, 0, 972, 0, 1013, 0, 
+	0, 1014, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1229, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1281, 0, 
+	1283, 0, 0, 0, 0, 1499, 1515, 0, 1517, 0, 0, 0, 0, 1643, 0, 0, 0, 0, 1659, 0, 
+	1662, 0, 0, 0, 0, 1667, 0, 0, 0, 0, 0, 0, 0, 0, 1858, 0, 1860, 1884, 0, 0, 
+	0, 2048, 0, 0, 0, 2121, 2122, 0, 0, 136, 143, 0, 0, 0, 0, 0, 0, 0, 410, 0, 
+	0, 0, 0, 577, 731, 0, 925, 0, 933, 0, 0, 0, 0, 0, 1015, 0, 0, 1023, 0, 1095, 
+	0, 0, 0, 1337, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1757, 1779, 0, 0, 1968, 0, 
+	0, 0, 2049, 0, 2093, 2095, 0, 0, 0, 0, 0, 0, 0, 0, 0, 394, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 439, 0, 0, 0, 0, 0, 454, 0, 0, 0, 0, 0, 0, 
+	0, 0, 0, 678, 0, 736, 801, 802, 0, 0, 0, 0, 929, 0, 935, 0, 0, 0, 0, 0, 
+	0, 936, 0, 977, 0, 1020, 0, 1021, 1032, 0, 0, 0, 0, 0, 0, 1168, 0, 0, 0, 0, 
+	0, 1235, 0, 0, 0, 0, 1251, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1273, 0, 0, 0, 
+	0, 0, 1284, 0, 1416, 0, 0, 1625, 0, 0, 0, 0, 0, 0, 0, 1660, 0, 0, 0, 0, 
+	0, 1670, 1754, 1755, 0, 0, 0, 1816, 0, 0, 1944, 0, 0, 2052, 0, 0, 2218, 0, 0, 0, 
+	0, 0, 0, 353, 0, 428, 449, 0, 0, 732, 0, 934, 937, 0, 0, 0, 945, 0, 1022, 1024, 
+	0, 0, 1309, 0, 1339, 0, 1645, 0, 1653, 0, 0, 0, 0, 0, 0, 1966, 0, 0, 0, 2050, 
+	0, 0, 0, 0, 0, 290, 309, 0, 0, 0, 0, 0, 0, 431, 432, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 0, 457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+	0, 941, 947, 0, 0, 950, 952, 0, 0, 0, 1033, 0, 0, 0, 0, 0, 0, 0, 1232, 0, 
+	0, 0, 1237, 1238, 1246, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1268, 0, 0, 0, 0, 0, 
+	0, 0, 0, 1456, 0, 0, 0, 0, 0, 0, 0, 1649, 0, 0, 0, 0, 0, 0, 1758, 0, 
+	0, 0, 0, 0, 0, 2053, 0, 135, 0, 0, 0, 272, 0, 354, 450, 0, 932, 938, 0, 0, 
+	0, 1202, 1203, 1338, 0, 0, 1654, 0, 0, 1657, 1661, 1830, 1969, 0, 0, 2097, 0, 0, 0, 0, 
+	0, 393, 0, 396, 397, 0, 0, 0, 0, 0, 438, 0, 0, 447, 0, 0, 0, 0, 0, 520, 
+	0, 0, 0, 676, 677, 0, 919, 0, 0, 0, 0, 0, 949, 971, 0, 0, 0, 0, 0, 0, 
+	0, 1218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1262, 0, 0, 1265, 0, 0, 0, 0, 1275, 
+	0, 1277, 1279, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1663, 0, 0, 1666, 1668, 0, 0, 
+	0, 0, 2033, 2044, 0, 0, 0, 0, 273, 451, 0, 0, 0, 1340, 1652, 0, 1656, 1987, 0, 2098, 
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 441, 442, 0, 453, 455, 0, 0, 0, 587, 0, 
+	680, 0, 927, 928, 930, 948, 0, 0, 0, 0, 1162, 0, 0, 0, 0, 1234, 0, 0, 0, 1253, 
+	0, 1256, 0, 1264, 0, 0, 0, 1270, 0, 0, 1282, 0, 0, 0, 0, 1639, 0, 0, 0, 0, 
+	0, 1665, 0, 1815, 0, 0, 2120, 144, 145, 0, 939, 0, 0, 1655, 1988, 0, 0, 0, 0, 0, 
+	0, 0, 0, 0, 0, 0, 456, 458, 0, 0, 0, 1016, 1017, 0, 1161, 0, 0, 0, 0, 0, 
+	1247, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1516, 1626, 0, 0, 1647, 1648, 1650, 1664, 1813, 0, 
+	1859, 146, 0, 1018, 0, 0, 0, 0, 0, 0, 0, 435, 0, 0, 452, 0, 0, 924, 1160, 0, 
+	0, 0, 1233, 0, 0, 0, 0, 1266, 0, 0, 0, 0, 0, 0, 1644, 1817, 940, 234, 0, 0, 
+	0, 0, 0, 433, 0, 437, 522, 0, 0, 1167, 1226, 1236, 1248, 0, 0, 0, 1269, 0, 0, 1415, 
+	1627, 0, 289, 0, 0, 429, 0, 588, 1163, 0, 1263, 1267, 0, 1276, 0, 0, 395, 0, 0, 1271, 
+	0, 0, 0, 1255, 288, 0, 436, 0, 0, 0, 0, 0, 0, 319, 
+}};
+
 std::unordered_map<char32_t, char32_t> const wordring::whatwg::html::parsing::character_reference_code_tbl = {
 	{ 0x80, 0x20AC }, { 0x82, 0x201A }, { 0x83, 0x0192 }, { 0x84, 0x201E }, { 0x85, 0x2026 }, { 0x86, 0x2020 }, { 0x87, 0x2021 }, { 0x88, 0x02C6 }, { 0x89, 0x2030 }, { 0x8A, 0x0160 }, 
 	{ 0x8B, 0x2039 }, { 0x8C, 0x0152 }, { 0x8E, 0x017D }, { 0x91, 0x2018 }, { 0x92, 0x2019 }, { 0x93, 0x201C }, { 0x94, 0x201D }, { 0x95, 0x2022 }, { 0x96, 0x2013 }, { 0x97, 0x2014 }, 
@@ -0,0 +1,86 @@
+﻿// test/html/batch_parser.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/html/batch_parser.hpp>
+#include <wordring/html/simple_html.hpp>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+	std::u8string serialize(wordring::html::u8simple_tree const& t)
+	{
+		std::u8string out;
+		wordring::html::to_string(t.begin(), std::back_inserter(out));
+		return out;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(batch_parser_test)
+
+BOOST_AUTO_TEST_CASE(batch_parser_parse_batch_1)
+{
+	using namespace wordring::html;
+
+	std::vector<std::string> in;
+	for (int i = 0; i < 37; ++i)
+	{
+		in.push_back("<p>" + std::to_string(i) + "<b>" + std::string(i, 'x') + "</p>");
+	}
+
+	std::vector<u8simple_tree> out;
+	auto results = parse_batch(in, out, 4);
+
+	BOOST_CHECK(out.size() == in.size());
+	BOOST_CHECK(results.size() == in.size());
+	for (std::size_t i = 0; i < in.size(); ++i)
+	{
+		auto expected = make_document<u8simple_tree>(in[i].begin(), in[i].end());
+		BOOST_CHECK(serialize(out[i]) == serialize(expected));
+		BOOST_CHECK(results[i].m_encoding_name == wordring::whatwg::encoding_name::UTF_8);
+		BOOST_CHECK(!results[i].m_exception);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(batch_parser_parse_batch_2)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	std::vector<std::string> in = {
+		"<meta charset=\"shift_jis\"><p>a",
+		"<p>b",
+		"\xEF\xBB\xBF<p>c" };
+
+	std::vector<u8simple_tree> out(5);
+	auto results = parse_batch(in, out, 8);
+
+	BOOST_CHECK(out.size() == 3);
+	BOOST_CHECK(results[0].m_encoding_name == encoding_name::Shift_JIS);
+	BOOST_CHECK(results[1].m_encoding_name == encoding_name::UTF_8);
+	BOOST_CHECK(results[1].m_confidence == encoding_confidence_name::tentative);
+	BOOST_CHECK(results[2].m_confidence == encoding_confidence_name::certain);
+	BOOST_CHECK(serialize(out[1]) == u8"<html><head></head><body><p>b</p></body></html>");
+
+	std::vector<std::string> empty;
+	BOOST_CHECK(parse_batch(empty, out).empty());
+	BOOST_CHECK(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(batch_parser_parse_batch_3)
+{
+	using namespace wordring::html;
+
+	std::vector<std::string> in = { "<!DOCTYPE html><p>a", "<p>b</i>" };
+
+	std::vector<u8simple_tree> out;
+	auto results = parse_batch<u8simple_tree, collect_parse_errors>(in, out, 2);
+
+	BOOST_CHECK(results[0].m_errors.empty());
+	BOOST_CHECK(!results[1].m_errors.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
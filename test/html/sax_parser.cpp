@@ -0,0 +1,176 @@
+﻿// test/html/sax_parser.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/html/sax_parser.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+	using namespace wordring::html;
+
+	class test_parser : public sax_parser_base<test_parser>
+	{
+	public:
+		void on_start_tag(start_tag_token const& token)
+		{
+			m_events.push_back(U"<" + token.m_tag_name + U">");
+			if (token.m_tag_name_id == tag_name::A)
+			{
+				auto it = token.find(attribute_name::Href);
+				if (it != token.end()) m_links.push_back(it->m_value);
+			}
+		}
+
+		void on_end_tag(end_tag_token const& token) { m_events.push_back(U"</" + token.m_tag_name + U">"); }
+
+		void on_text(std::u32string const& text) { m_events.push_back(text); }
+
+		void on_comment(std::u32string const& data) { m_events.push_back(U"<!--" + data + U"-->"); }
+
+		void on_doctype(DOCTYPE_token const& token) { m_events.push_back(U"<!DOCTYPE " + token.m_name + U">"); }
+
+		void on_end_of_file() { m_eof = true; }
+
+		std::vector<std::u32string> m_events;
+		std::vector<std::u32string> m_links;
+		bool m_eof = false;
+	};
+
+	struct test_handler
+	{
+		void on_start_tag(start_tag_token const& token) { ++m_start; }
+		void on_end_tag(end_tag_token const& token) { ++m_end; }
+		void on_text(std::u32string const& text) {}
+		void on_comment(std::u32string const& data) {}
+		void on_doctype(DOCTYPE_token const& token) {}
+		void on_end_of_file() {}
+		void on_report_error(error_name e) { ++m_error; }
+
+		int m_start = 0;
+		int m_end   = 0;
+		int m_error = 0;
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(sax_parser_test)
+
+BOOST_AUTO_TEST_CASE(sax_parser_parse_1)
+{
+	test_parser p;
+	std::u32string s = U"<!DOCTYPE html><p class=a>Hello <b>World</b><!--c-->";
+	p.parse(s.begin(), s.end());
+
+	std::vector<std::u32string> v = { U"<!DOCTYPE html>", U"<p>", U"Hello ", U"<b>", U"World", U"</b>", U"<!--c-->" };
+	BOOST_CHECK(p.m_events == v);
+	BOOST_CHECK(p.m_eof);
+}
+
+BOOST_AUTO_TEST_CASE(sax_parser_parse_2)
+{
+	test_parser p;
+	std::string s = u8"<a href='https://example.com/'>E</a><A HREF=/x>X</A><area href=y>";
+	p.parse(s.begin(), s.end());
+
+	std::vector<std::u32string> v = { U"https://example.com/", U"/x" };
+	BOOST_CHECK(p.m_links == v);
+}
+
+BOOST_AUTO_TEST_CASE(sax_parser_parse_3)
+{
+	test_parser p;
+	std::u32string s = U"<script>if (a<b) x = '<p>';</script><style><b></style><title><i>&amp;</title>";
+	p.parse(s.begin(), s.end());
+
+	std::vector<std::u32string> v = {
+		U"<script>", U"if (a<b) x = '<p>';", U"</script>",
+		U"<style>", U"<b>", U"</style>",
+		U"<title>", U"<i>&", U"</title>" };
+	BOOST_CHECK(p.m_events == v);
+}
+
+BOOST_AUTO_TEST_CASE(sax_parser_parse_4)
+{
+	test_parser p;
+	std::u32string s = U"<svg><style><b></b></style></svg><style><b></style>";
+	p.parse(s.begin(), s.end());
+
+	std::vector<std::u32string> v = {
+		U"<svg>", U"<style>", U"<b>", U"</b>", U"</style>", U"</svg>", U"<style>", U"<b>", U"</style>" };
+	BOOST_CHECK(p.m_events == v);
+}
+
+BOOST_AUTO_TEST_CASE(sax_parser_parse_5)
+{
+	test_parser p;
+	std::u32string s = U"<math><mi><style><b></style></mi></math><plaintext><b></b>";
+	p.parse(s.begin(), s.end());
+
+	std::vector<std::u32string> v = {
+		U"<math>", U"<mi>", U"<style>", U"<b>", U"</style>", U"</mi>", U"</math>", U"<plaintext>", U"<b></b>" };
+	BOOST_CHECK(p.m_events == v);
+}
+
+BOOST_AUTO_TEST_CASE(sax_parser_parse_6)
+{
+	test_parser p;
+	std::u32string s = U"<svg><foreignObject><style>a<b>c</style></foreignObject></svg>";
+	p.parse(s.begin(), s.end());
+
+	std::vector<std::u32string> v = {
+		U"<svg>", U"<foreignobject>", U"<style>", U"a<b>c", U"</style>", U"</foreignobject>", U"</svg>" };
+	BOOST_CHECK(p.m_events == v);
+}
+
+BOOST_AUTO_TEST_CASE(sax_parser_parse_7)
+{
+	// encoding 属性が HTML を示す annotation-xml 要素は HTML 統合点となる
+	test_parser p;
+	std::u32string s = U"<math><annotation-xml encoding=\"Text/HTML\"><style>a<b</style></annotation-xml></math>";
+	p.parse(s.begin(), s.end());
+
+	std::vector<std::u32string> v = {
+		U"<math>", U"<annotation-xml>", U"<style>", U"a<b", U"</style>", U"</annotation-xml>", U"</math>" };
+	BOOST_CHECK(p.m_events == v);
+
+	// encoding 属性が無ければ外来要素のまま
+	test_parser q;
+	s = U"<math><annotation-xml><style><b></b></style></annotation-xml></math>";
+	q.parse(s.begin(), s.end());
+
+	v = { U"<math>", U"<annotation-xml>", U"<style>", U"<b>", U"</b>", U"</style>", U"</annotation-xml>", U"</math>" };
+	BOOST_CHECK(q.m_events == v);
+}
+
+BOOST_AUTO_TEST_CASE(sax_parser_parse_8)
+{
+	// MathML テキスト統合点の直下でも mglyph 、 malignmark は外来要素のまま
+	test_parser p;
+	std::u32string s = U"<math><mi><mglyph><style><b></b></style></mglyph><malignmark><style><i></style></malignmark></mi></math>";
+	p.parse(s.begin(), s.end());
+
+	std::vector<std::u32string> v = {
+		U"<math>", U"<mi>", U"<mglyph>", U"<style>", U"<b>", U"</b>", U"</style>", U"</mglyph>",
+		U"<malignmark>", U"<style>", U"<i>", U"</style>", U"</malignmark>", U"</mi>", U"</math>" };
+	BOOST_CHECK(p.m_events == v);
+}
+
+BOOST_AUTO_TEST_CASE(sax_parser_basic_sax_parser_1)
+{
+	test_handler h;
+	basic_sax_parser<test_handler> p(h);
+	std::u32string s = U"<div><p>a</p></div></>";
+	p.parse(s.begin(), s.end());
+
+	BOOST_CHECK(h.m_start == 2);
+	BOOST_CHECK(h.m_end == 2);
+	BOOST_CHECK(h.m_error == 1);
+
+	p.clear();
+	p.parse(s.begin(), s.end());
+	BOOST_CHECK(h.m_start == 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,7 @@
 
 #include <iterator>
 #include <string>
+#include <vector>
 
 namespace
 {
@@ -64,4 +65,251 @@ BOOST_AUTO_TEST_CASE(simple_html_make_document_2)
 	BOOST_CHECK(s == out);
 }
 
+BOOST_AUTO_TEST_CASE(simple_html_make_document_3)
+{
+	using namespace wordring::html;
+
+	// 事前走査の範囲外にある meta 要素で読み直す
+	std::u8string const in = u8"<!--" + std::u8string(5000, u8'a') + u8"--><meta charset=\"shift-jis\">\x82\xA0\x82\xA2\x82\xA4\x82\xA6\x82\xA8";
+
+	std::u8string const s = u8"<!--" + std::u8string(5000, u8'a') + u8R"*(--><html><head><meta charset="shift-jis"></head><body>あいうえお</body></html>)*";
+
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+	auto doc = get_document(tree);
+
+	std::u8string out;
+	to_string(doc, std::back_inserter(out));
+
+	BOOST_CHECK(s == out);
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_make_document_4)
+{
+	using namespace wordring::html;
+
+	// 分割デコードの境界をまたぐ多バイト文字
+	std::u8string const head = u8"<meta charset=\"shift-jis\">";
+	std::u8string const text(4095 - head.size(), u8'a');
+	std::u8string const in = head + text + u8"\x82\xA0\x82\xA2\x82\xA4\x82\xA6\x82\xA8";
+
+	std::u8string const s = u8R"*(<html><head><meta charset="shift-jis"></head><body>)*" + text + u8"あいうえお</body></html>";
+
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+	auto doc = get_document(tree);
+
+	std::u8string out;
+	to_string(doc, std::back_inserter(out));
+
+	BOOST_CHECK(s == out);
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_make_document_5)
+{
+	using namespace wordring::html;
+
+	// annotation-xml の encoding 属性による HTML 統合点
+	std::u8string const in = u8R"*(<math><annotation-xml encoding="Text/HTML"><div>a</div></annotation-xml></math><math><annotation-xml><div>b</div></annotation-xml></math>)*";
+
+	std::u8string const s = u8R"*(<html><head></head><body><math><annotation-xml encoding="Text/HTML"><div>a</div></annotation-xml></math><math><annotation-xml></annotation-xml></math><div>b</div></body></html>)*";
+
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+	auto doc = get_document(tree);
+
+	std::u8string out;
+	to_string(doc, std::back_inserter(out));
+
+	BOOST_CHECK(s == out);
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_make_document_6)
+{
+	using namespace wordring::html;
+
+	// 外来コンテンツ内の color 属性を持つ font 要素
+	std::u8string const in = u8R"*(<svg><font color="red">a</font></svg><svg><p>b</p></svg>)*";
+
+	std::u8string const s = u8R"*(<html><head></head><body><svg></svg><font color="red">a</font><svg></svg><p>b</p></body></html>)*";
+
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+	auto doc = get_document(tree);
+
+	std::u8string out;
+	to_string(doc, std::back_inserter(out));
+
+	BOOST_CHECK(s == out);
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_make_document_7)
+{
+	using namespace wordring::html;
+
+	// Noah's Ark 条項は属性値まで比較する
+	std::u8string const in = u8R"*(<p><b class=x><b class=x><b class=y><b class=x><b class=x><p>X)*";
+
+	std::u8string const s = u8R"*(<html><head></head><body>)*"
+		u8R"*(<p><b class="x"><b class="x"><b class="y"><b class="x"><b class="x"></b></b></b></b></b></p>)*"
+		u8R"*(<p><b class="x"><b class="y"><b class="x"><b class="x">X</b></b></b></b></p></body></html>)*";
+
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+	auto doc = get_document(tree);
+
+	std::u8string out;
+	to_string(doc, std::back_inserter(out));
+
+	BOOST_CHECK(s == out);
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_make_document_8)
+{
+	using namespace wordring::html;
+
+	// 養子縁組エージェント・アルゴリズム
+	std::u8string const in = u8R"*(<p>1<b>2<i>3</b>4</i>5</p><a>6<div>7</a>8</div>)*";
+
+	std::u8string const s = u8R"*(<html><head></head><body>)*"
+		u8R"*(<p>1<b>2<i>3</i></b><i>4</i>5</p><a>6</a><div><a>7</a>8</div></body></html>)*";
+
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+	auto doc = get_document(tree);
+
+	std::u8string out;
+	to_string(doc, std::back_inserter(out));
+
+	BOOST_CHECK(s == out);
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_to_string_1)
+{
+	using namespace wordring::html;
+
+	// エスケープ、生テキスト要素、 VOID 要素、外来要素
+	std::u8string const in = u8"<!DOCTYPE html><p title='a\"b&amp;c&nbsp;d'>x &lt; y &amp;&amp; y &gt; z&nbsp;あ</p>"
+		u8"<script>if (a < b && c > d) {}</script><br><img src=\"1.png\"><!-- c -->"
+		u8"<svg viewBox=\"0 0 1 1\" xlink:href=\"#a\"><foreignObject>t</foreignObject></svg>";
+
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+
+	std::u8string s1, s2;
+	wordring::whatwg::html::to_string(tree.begin(), std::back_inserter(s1));
+	to_string(tree.begin(), std::back_inserter(s2));
+
+	BOOST_CHECK(s1 == s2);
+	BOOST_CHECK(s2 == u8"<!DOCTYPE html><html><head></head><body>"
+		u8"<p title=\"a&quot;b&amp;c&nbsp;d\">x &lt; y &amp;&amp; y &gt; z&nbsp;あ</p>"
+		u8"<script>if (a < b && c > d) {}</script><br><img src=\"1.png\"><!-- c -->"
+		u8"<svg viewbox=\"0 0 1 1\" xlink:href=\"#a\"><foreignobject>t</foreignobject></svg></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_to_string_2)
+{
+	using namespace wordring::html;
+
+	// 8 バイトのブロックの境界をまたぐ位置にエスケープする文字を置く
+	std::u8string text;
+	for (int i = 0; i < 40; ++i)
+	{
+		text += std::u8string(i % 9, u8'a');
+		text += (i % 4 == 0) ? u8"&amp;" : (i % 4 == 1) ? u8"&lt;" : (i % 4 == 2) ? u8"&gt;" : u8"&nbsp;";
+	}
+	text += u8"Â¡";
+
+	std::u8string const in = u8"<p>" + text + u8"</p>";
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+
+	std::u8string s1, s2;
+	wordring::whatwg::html::to_string(tree.begin(), std::back_inserter(s1));
+	to_string(tree.begin(), std::back_inserter(s2));
+
+	BOOST_CHECK(s1 == s2);
+	BOOST_CHECK(s2 == u8"<html><head></head><body><p>" + text + u8"</p></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_to_string_3)
+{
+	using namespace wordring::html;
+
+	// 木と異なる文字エンコーディングへ出力する
+	std::u8string const in = u8"<p a=\"あ\">い&amp;😀</p>";
+	auto tree = make_document<u16simple_tree>(in.begin(), in.end());
+
+	std::u8string s1;
+	to_string(tree.begin(), std::back_inserter(s1));
+	BOOST_CHECK(s1 == u8"<html><head></head><body><p a=\"あ\">い&amp;😀</p></body></html>");
+
+	std::u32string s2;
+	to_string(tree.begin(), std::back_inserter(s2));
+	BOOST_CHECK(s2 == U"<html><head></head><body><p a=\"あ\">い&amp;😀</p></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_serialize_1)
+{
+	using namespace wordring::html;
+
+	std::u8string const in = u8"<p>a</p><p>b&amp;c</p>";
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+
+	auto body = std::next(tree.begin().begin().begin());
+	std::u8string buf;
+	std::vector<std::u8string> v;
+	for (auto it = body.begin(); it != body.end(); ++it)
+	{
+		buf.clear();
+		serialize(it, buf);
+		v.push_back(buf);
+	}
+
+	BOOST_REQUIRE(v.size() == 2);
+	BOOST_CHECK(v[0] == u8"a");
+	BOOST_CHECK(v[1] == u8"b&amp;c");
+
+	// 子を持たないノードは何も出力しない
+	buf.clear();
+	serialize(body.begin().begin(), buf);
+	BOOST_CHECK(buf.empty());
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_text_content_1)
+{
+	using namespace wordring::html;
+
+	std::u8string const in = u8"<p>a <b>b</b>\n c<!-- d --></p><script>e</script><style>f</style><template>g</template><p>  h  </p>";
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+
+	BOOST_CHECK(text_content(tree.begin()) == u8"a b\n cefg  h  ");
+
+	auto p = std::next(tree.begin().begin().begin()).begin();
+	BOOST_CHECK(text_content(p) == u8"a b\n c");
+	BOOST_CHECK(text_content(std::next(p.begin(), 3)) == u8" d ");
+
+	// 末尾へ追加する
+	std::u8string s = u8"x";
+	text_content(p.begin(), s);
+	BOOST_CHECK(s == u8"xa ");
+}
+
+BOOST_AUTO_TEST_CASE(simple_html_visible_text_1)
+{
+	using namespace wordring::html;
+
+	std::u8string const in = u8"<p> a <b>b</b>\n c<!-- d --></p><script>e</script><style>f</style><template>g</template><p>  h\t</p>";
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+
+	BOOST_CHECK(visible_text(tree.begin()) == u8"a b c h");
+
+	text_options opt;
+	opt.m_collapse_whitespace = false;
+	BOOST_CHECK(visible_text(tree.begin(), opt) == u8" a b\n c  h\t");
+
+	opt.m_skip_hidden = false;
+	BOOST_CHECK(visible_text(tree.begin(), opt) == u8" a b\n cefg  h\t");
+
+	opt.m_collapse_whitespace = true;
+	BOOST_CHECK(visible_text(tree.begin(), opt) == u8"a b cefg h");
+
+	// 追加する部分の前後のみ空白を取り除く
+	std::u8string s = u8"x ";
+	visible_text(std::next(tree.begin().begin().begin()).begin(), s);
+	BOOST_CHECK(s == u8"x a b c");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
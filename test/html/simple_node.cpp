@@ -91,6 +91,53 @@ BOOST_AUTO_TEST_CASE(simple_node_simple_element_find_1)
 	BOOST_CHECK(it->local_name_name() == attribute_name::Href);
 }
 
+BOOST_AUTO_TEST_CASE(simple_node_simple_element_local_name_2)
+{
+	using namespace wordring::html;
+
+	simple_element<std::u8string> be1(u8"my-element");
+	BOOST_CHECK(be1.local_name_name() == static_cast<tag_name>(0));
+	BOOST_CHECK(be1.local_name() == u8"my-element");
+	BOOST_CHECK(be1.qualified_name() == u8"my-element");
+
+	simple_element<std::u8string> be2 = be1;
+	be1.local_name(u8"p");
+	BOOST_CHECK(be1.local_name_name() == tag_name::P);
+	BOOST_CHECK(be1.local_name() == u8"p");
+	BOOST_CHECK(be2.local_name() == u8"my-element");
+}
+
+BOOST_AUTO_TEST_CASE(simple_node_simple_attr_equal_2)
+{
+	using namespace wordring::html;
+
+	simple_attr<std::u8string> ba1(ns_name::XLink, u8"xlink", u8"href");
+	simple_attr<std::u8string> ba2(ns_name::XLink, u8"xlink", attribute_name::Href);
+	simple_attr<std::u8string> ba3(u8"data-x");
+	simple_attr<std::u8string> ba4(u8"data-y");
+
+	BOOST_CHECK(ba1 == ba2);
+	BOOST_CHECK(ba1.qualified_name() == u8"xlink:href");
+	BOOST_CHECK(ba3 != ba4);
+	BOOST_CHECK(ba3 == simple_attr<std::u8string>(u8"data-x"));
+	BOOST_CHECK(ba3.local_name() == u8"data-x");
+}
+
+/*
+名前は列挙体の値のみを保持し、列挙体に無い名前と接頭辞はノードの外に置く
+*/
+BOOST_AUTO_TEST_CASE(simple_node_size_1)
+{
+	using namespace wordring::html;
+
+	using element_type = simple_element<std::u8string>;
+	using attribute_type = simple_attr<std::u8string>;
+
+	BOOST_CHECK(sizeof(element_type) <= sizeof(ns_name) + sizeof(tag_name) + sizeof(void*) + sizeof(std::vector<attribute_type>));
+	BOOST_CHECK(sizeof(attribute_type) <= sizeof(ns_name) + sizeof(attribute_name) + sizeof(void*) + sizeof(std::u8string));
+	BOOST_CHECK(sizeof(simple_node<std::u8string>) <= sizeof(element_type) + sizeof(void*));
+}
+
 /*
 ノードの文字列データを参照する
 */
@@ -134,6 +181,32 @@ BOOST_AUTO_TEST_CASE(simple_node_data_4)
 	BOOST_CHECK(data(sn) == u8"text");
 }
 
+BOOST_AUTO_TEST_CASE(simple_node_data_5)
+{
+	using namespace wordring::html;
+
+	// 文字列データを持たないノードは、共有の文字列を返さず例外を送出する
+	simple_node<std::u8string> sn = simple_element<std::u8string>(tag_name::P);
+
+	BOOST_CHECK_THROW(sn.data(), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(simple_node_document_type_1)
+{
+	using namespace wordring::html;
+
+	simple_document_type<std::u8string> dt1(u8"html", u8"", u8"");
+	simple_document_type<std::u8string> dt2(std::move(dt1));
+	BOOST_CHECK(dt2.name() == u8"html");
+
+	// ムーブ元は空の文字列を返し、再び値を設定できる
+	BOOST_CHECK(dt1.name().empty());
+	BOOST_CHECK(dt1.public_id().empty());
+	BOOST_CHECK(dt1.system_id().empty());
+	dt1.name(u8"svg");
+	BOOST_CHECK(dt1.name() == u8"svg");
+}
+
 /*
 ノードを要素と解釈して属性の開始を返す
 ノードを要素と解釈して属性の終端を返す
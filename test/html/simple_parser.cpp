@@ -9,6 +9,8 @@
 
 #include <wordring/tag_tree/tag_tree.hpp>
 
+#include <memory_resource>
+
 namespace
 {
 	using test_tree = wordring::tag_tree<wordring::html::simple_node<std::u8string>>;
@@ -62,4 +64,677 @@ BOOST_AUTO_TEST_CASE(simple_parser_find_attribute_1)
 	BOOST_CHECK(it != p.get_document().end());
 }
 
+BOOST_AUTO_TEST_CASE(simple_parser_parse_fragment_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u8string::const_iterator>;
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	u8simple_tree t;
+
+	std::u8string s = u8"<p>a<b>b</p>c";
+	p.parse_fragment(s.begin(), s.end(), t);
+
+	std::u8string out;
+	for (auto it = t.begin(); it != t.end(); ++it)
+	{
+		out += u8"<" + node_traits<u8simple_tree::iterator>::get_qualified_name(it) + u8">";
+		to_string(it, std::back_inserter(out));
+	}
+	BOOST_CHECK(out == u8"<p>a<b>b</b><b>c");
+
+	// 同じパーサーと木コンテナを再利用する
+	s = u8"<li>1<li>2";
+	p.parse_fragment(s.begin(), s.end(), t);
+
+	out.clear();
+	for (auto it = t.begin(); it != t.end(); ++it) to_string(it, std::back_inserter(out));
+	BOOST_CHECK(std::distance(t.begin(), t.end()) == 2);
+	BOOST_CHECK(out == u8"12");
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_parse_fragment_2)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u8string::const_iterator>;
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	u8simple_tree t;
+
+	// 文脈要素により挿入モードが決まる
+	std::u8string s = u8"<tr><td>x</td></tr>";
+	p.parse_fragment(s.begin(), s.end(), t, tag_name::Tbody);
+	BOOST_CHECK(t.begin()->is_element());
+	BOOST_CHECK(node_traits<u8simple_tree::iterator>::get_local_name_name(t.begin()) == tag_name::Tr);
+
+	p.parse_fragment(s.begin(), s.end(), t);
+	BOOST_CHECK(t.begin()->is_text());
+
+	// 文脈要素によりトークン化器の状態が決まる
+	s = u8"<b>a</b>&lt;";
+	p.parse_fragment(s.begin(), s.end(), t, tag_name::Textarea);
+	BOOST_CHECK(std::distance(t.begin(), t.end()) == 1);
+	BOOST_CHECK(t.begin()->data() == u8"<b>a</b><");
+
+	// 断片の後に文書を解析できる
+	s = u8"<p>x";
+	p.clear(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.parse(s.begin(), s.end());
+	p.get(t);
+	BOOST_CHECK(t.begin()->is_document());
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_parse_fragment_3)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::string::const_iterator>;
+
+	// エンコーディングの変更で読み直しても、断片の解析と文脈要素を保つ
+	std::string const in = "<tr><td>\x82\xA0" + std::string(5000, 'a') + "<meta charset=\"shift_jis\"></td></tr>";
+
+	parser p(encoding_confidence_name::tentative, encoding_name::UTF_8);
+	p.set_context(tag_name::Tbody);
+	p.parse(in.begin(), in.end());
+	p.push_eof();
+	BOOST_CHECK(p.reparse_count() == 1);
+	BOOST_CHECK(p.current_encoding() == encoding_name::Shift_JIS);
+
+	u8simple_tree t;
+	p.get(t);
+	BOOST_REQUIRE(t.begin() != t.end());
+	BOOST_CHECK(node_traits<u8simple_tree::iterator>::get_local_name_name(t.begin()) == tag_name::Tr);
+
+	std::u8string out;
+	to_string(t.begin(), std::back_inserter(out));
+	BOOST_CHECK(out == u8"<td>\u3042" + std::u8string(5000, u8'a') + u8"<meta charset=\"shift_jis\"></td>");
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_parse_fragment_4)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u8string::const_iterator>;
+
+	// 構築時に指定した断片の解析は clear() 後も保たれる
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8, true);
+	u8simple_tree t;
+
+	std::u8string s = u8"<p>a<b>b</p>c";
+	for (int i = 0; i < 2; ++i)
+	{
+		p.clear(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+		p.parse(s.begin(), s.end());
+		p.push_eof();
+		p.get(t);
+
+		std::u8string out;
+		for (auto it = t.begin(); it != t.end(); ++it)
+		{
+			out += u8"<" + node_traits<u8simple_tree::iterator>::get_qualified_name(it) + u8">";
+			to_string(it, std::back_inserter(out));
+		}
+		BOOST_CHECK(out == u8"<p>a<b>b</b><b>c");
+	}
+
+	// clear() 後に指定した文脈要素は、構築時の文脈要素に優先する
+	s = u8"<tr><td>x</td></tr>";
+	p.clear(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.set_context(tag_name::Tbody);
+	p.parse(s.begin(), s.end());
+	p.push_eof();
+	p.get(t);
+	BOOST_REQUIRE(t.begin() != t.end());
+	BOOST_CHECK(std::distance(t.begin(), t.end()) == 1);
+	BOOST_CHECK(node_traits<u8simple_tree::iterator>::get_local_name_name(t.begin()) == tag_name::Tr);
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_parse_speculative_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::string::const_iterator>;
+
+	std::string in = "<!DOCTYPE html><title>a <b> c</title><p>x&amp;y &not z<table><tr><td>1<td>2</table>"
+		"<textarea><p>t</textarea><script>if (a < b) document.write('<p>');</script><!-- c < d -->"
+		"<svg><![CDATA[<p>]]><p>q</svg><math><mi>1</mi></math><pre>\r\nline</pre><b><i>m</b>n</i>"
+		"<div a='<' b=\"<\">e\r\nf\rg</div><plaintext><p>end";
+
+	auto expected = make_document<u8simple_tree>(in.begin(), in.end());
+	std::u8string s1;
+	to_string(expected.begin(), std::back_inserter(s1));
+
+	for (std::uint32_t chunk_length = 1; chunk_length <= 64; chunk_length *= 2)
+	{
+		parser p(encoding_confidence_name::tentative, encoding_name::UTF_8);
+		p.parse_speculative(in.begin(), in.end(), 3, chunk_length);
+		u8simple_tree t = p.get();
+
+		std::u8string s2;
+		to_string(t.begin(), std::back_inserter(s2));
+		BOOST_CHECK(s1 == s2);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_error_policy_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+	using wordring::whatwg::html::parsing::detail::input_position_tracking;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u32string::const_iterator, collect_parse_errors>;
+
+	static_assert(!input_position_tracking<basic_simple_parser<u8simple_tree, std::u32string::const_iterator>>::value);
+	static_assert(input_position_tracking<parser>::value);
+
+	std::u32string in = U"<!DOCTYPE html><p>a\r\nb";
+	in.push_back(U'\0');
+	in += U"c";
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.parse(in.begin(), in.end());
+
+	auto const& errors = p.get_error_policy().m_errors;
+	BOOST_REQUIRE(!errors.empty());
+	BOOST_CHECK(errors.front().m_name == error_name::unexpected_null_character);
+	BOOST_CHECK(errors.front().m_position.m_offset == 21);
+	BOOST_CHECK(errors.front().m_position.m_line == 2);
+	BOOST_CHECK(errors.front().m_position.m_column == 2);
+
+	p.clear(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	BOOST_CHECK(p.get_error_policy().m_errors.empty());
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_source_policy_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u32string::const_iterator, ignore_parse_errors, record_source_ranges>;
+
+	std::u32string in = U"<!--c--><div>ab<p>x</div>";
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.parse(in.begin(), in.end());
+	u8simple_tree c;
+	p.get(c);
+
+	auto range = [&](auto it) { return p.get_source_policy().range(c.index(it)); };
+
+	auto doc  = c.begin();
+	auto cmt  = doc.begin();
+	auto html = std::next(cmt);
+	auto body = std::next(html.begin());
+	auto div  = body.begin();
+	auto ab   = div.begin();
+	auto pel  = std::next(ab);
+	auto x    = pel.begin();
+
+	BOOST_CHECK(range(cmt).m_begin == 0);
+	BOOST_CHECK(range(cmt).m_end == 8);
+	// 暗黙に作成された要素
+	BOOST_CHECK(range(html).m_begin == 8);
+	BOOST_CHECK(range(html).m_end == 25);
+	BOOST_CHECK(range(div).m_begin == 8);
+	BOOST_CHECK(range(div).m_end == 25);
+	BOOST_CHECK(range(ab).m_begin == 13);
+	BOOST_CHECK(range(ab).m_end == 15);
+	// 終了タグを持たない要素
+	BOOST_CHECK(range(pel).m_begin == 15);
+	BOOST_CHECK(range(pel).m_end == 19);
+	BOOST_CHECK(range(x).m_begin == 18);
+	BOOST_CHECK(range(x).m_end == 19);
+
+	p.clear(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	BOOST_CHECK(p.get_source_policy().m_ranges.empty());
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_source_policy_2)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u32string::const_iterator, ignore_parse_errors, record_source_ranges>;
+
+	std::u32string in = U"<p>a</p><p>b</p><p>c</p>";
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.parse(in.begin(), in.end());
+	u8simple_tree c;
+	p.get(c);
+
+	auto range = [&](auto it) { return p.get_source_policy().range(c.index(it)); };
+
+	// 先頭の段落を削除して詰め直すと、格納位置が変わる
+	auto body = std::next(c.begin().begin().begin());
+	c.erase(body.begin());
+	std::uint32_t before = c.index(std::next(body.begin()));
+	p.get_source_policy().remap(c.compact());
+
+	body = std::next(c.begin().begin().begin());
+	auto p3 = std::next(body.begin());
+	BOOST_CHECK(c.index(p3) != before);
+	BOOST_CHECK(range(p3).m_begin == 16);
+	BOOST_CHECK(range(p3).m_end == 24);
+	BOOST_CHECK(range(p3.begin()).m_begin == 19);
+	BOOST_CHECK(range(p3.begin()).m_end == 20);
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_source_policy_3)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::string::const_iterator, ignore_parse_errors, record_source_ranges>;
+
+	// 範囲はバイト位置であり、入力を切り出すとノードのソースとなる
+	std::string const in = "<p>\x82\xA0\r\n\x82\xA2</p>\r\n<!--\x82\xA4-->";
+
+	parser p(encoding_confidence_name::certain, encoding_name::Shift_JIS);
+	p.parse(in.begin(), in.end());
+	p.push_eof();
+	u8simple_tree c;
+	p.get(c);
+
+	auto slice = [&](auto it)
+	{
+		source_range r = p.get_source_policy().range(c.index(it));
+		return in.substr(r.m_begin, r.m_end - r.m_begin);
+	};
+
+	auto body = std::next(c.begin().begin().begin());
+	auto pel  = body.begin();
+	auto lf   = std::next(pel);
+	auto cmt  = std::next(lf);
+
+	BOOST_CHECK(slice(pel) == "<p>\x82\xA0\r\n\x82\xA2</p>");
+	BOOST_CHECK(slice(pel.begin()) == "\x82\xA0\r\n\x82\xA2");
+	BOOST_CHECK(slice(lf) == "\r\n");
+	BOOST_CHECK(slice(cmt) == "<!--\x82\xA4-->");
+	BOOST_CHECK(slice(body) == in);
+
+	// 段階的な解析でも BOM を除いたバイト位置となる
+	std::string const in2 = "\xEF\xBB\xBF<b>\xE3\x81\x82\r\nx<br></b>\r";
+
+	parser p2(encoding_confidence_name::certain, encoding_name::UTF_8);
+	for (std::size_t i = 0; i < in2.size(); i += 2) p2.feed(std::next(in2.begin(), i), std::next(in2.begin(), std::min(i + 2, in2.size())));
+	p2.finish();
+	while (!p2.resume(parse_budget{ 1, 1 }));
+	p2.get(c);
+
+	auto slice2 = [&](auto it)
+	{
+		source_range r = p2.get_source_policy().range(c.index(it));
+		return in2.substr(r.m_begin, r.m_end - r.m_begin);
+	};
+
+	body = std::next(c.begin().begin().begin());
+	auto b = body.begin();
+	BOOST_CHECK(slice2(b) == "<b>\xE3\x81\x82\r\nx<br></b>");
+	BOOST_CHECK(slice2(b.begin()) == "\xE3\x81\x82\r\nx");
+	// 空要素
+	BOOST_CHECK(slice2(std::next(b.begin())) == "<br>");
+	BOOST_CHECK(slice2(std::next(b)) == "\r");
+	BOOST_CHECK(slice2(body) == in2.substr(3));
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_instrumentation_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u32string::const_iterator, ignore_parse_errors, ignore_source_ranges, collect_parse_statistics>;
+
+	std::u32string in = U"<p><b>x</p>y<!--c-->";
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.parse(in.begin(), in.end());
+	p.push_eof();
+
+	parse_statistics const& st = p.get_instrumentation_policy().m_statistics;
+	BOOST_CHECK(st.m_tokenizer_calls >= in.size() + 1);
+	BOOST_CHECK(st.m_start_tag_tokens == 2);
+	BOOST_CHECK(st.m_end_tag_tokens == 1);
+	BOOST_CHECK(st.m_character_tokens == 2);
+	BOOST_CHECK(st.m_comment_tokens == 1);
+	BOOST_CHECK(st.m_end_of_file_tokens == 1);
+	// html, body, p, b
+	BOOST_CHECK(st.m_max_stack_depth == 4);
+	// b の push と、 y の前の reconstruct
+	BOOST_CHECK(st.m_formatting_operations[0] == 1);
+	BOOST_CHECK(st.m_formatting_operations[2] == 1);
+	// html, head, body, p, b, x, b, y, コメント
+	BOOST_CHECK(st.m_nodes_created == 9);
+
+	std::uint64_t n = 0;
+	for (std::uint64_t m : st.m_mode_tokens) n += m;
+	BOOST_CHECK(n == 7);
+
+	p.clear(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	BOOST_CHECK(p.get_instrumentation_policy().m_statistics.m_tokenizer_calls == 0);
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_limits_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u32string::const_iterator>;
+
+	parse_limits limits;
+	limits.m_max_depth = 4;
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.set_limits(limits);
+	std::u32string in = U"<div><div><div><div>x</div></div></div></div>";
+	p.parse(in.begin(), in.end());
+	p.push_eof();
+
+	BOOST_CHECK(p.limit_status().m_depth);
+	BOOST_CHECK(p.limit_status().truncated());
+
+	std::u8string out;
+	to_string(p.get_document(), std::back_inserter(out));
+	BOOST_CHECK(out == u8"<html><head></head><body><div><div><div></div><div>x</div></div></div></body></html>");
+
+	// 上限は clear() で初期化されない
+	p.clear(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	BOOST_CHECK(!p.limit_status().truncated());
+	BOOST_CHECK(p.get_limits().m_max_depth == 4);
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_limits_2)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u32string::const_iterator>;
+
+	parse_limits limits;
+	limits.m_max_attributes             = 2;
+	limits.m_max_attribute_value_length = 3;
+	limits.m_max_text_bytes             = 5;
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.set_limits(limits);
+	std::u32string in = U"<p a=1 a=2 b=12345 c=3>abc</p><!--d--><p>\u3042</p>";
+	p.parse(in.begin(), in.end());
+	p.push_eof();
+
+	BOOST_CHECK(p.limit_status().m_attributes);
+	BOOST_CHECK(p.limit_status().m_attribute_value);
+	BOOST_CHECK(p.limit_status().m_text);
+	BOOST_CHECK(!p.limit_status().m_nodes);
+
+	std::u8string out;
+	to_string(p.get_document(), std::back_inserter(out));
+	BOOST_CHECK(out == u8"<html><head></head><body><p a=\"1\" b=\"123\">abc</p><!--d--><p></p></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_limits_3)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u32string::const_iterator>;
+
+	parse_limits limits;
+	limits.m_max_nodes = 5;
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.set_limits(limits);
+	std::u32string in = U"<p>a</p><p>b</p><p>c</p>";
+	p.parse(in.begin(), in.end());
+	p.push_eof();
+
+	BOOST_CHECK(p.limit_status().m_nodes);
+
+	std::u8string out;
+	to_string(p.get_document(), std::back_inserter(out));
+	BOOST_CHECK(out == u8"<html><head></head><body><p>a</p></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_limits_4)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::u32string::const_iterator>;
+
+	parse_limits limits;
+	limits.m_max_attributes = 1;
+
+	// 上限で省かれた type 属性は、木構築の判断にも使われない
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.set_limits(limits);
+	std::u32string in = U"<table><input name=a type=hidden></table>";
+	p.parse(in.begin(), in.end());
+	p.push_eof();
+
+	BOOST_CHECK(p.limit_status().m_attributes);
+
+	std::u8string out;
+	to_string(p.get_document(), std::back_inserter(out));
+	BOOST_CHECK(out == u8"<html><head></head><body><input name=\"a\"><table></table></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_resume_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::string::const_iterator>;
+
+	std::string const head = "<html><head><title>T</title></head>";
+	std::string const body = "<body><p>a<b>b</p>c &amp; d</body></html>";
+
+	parser q(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	std::string const all = head + body;
+	q.parse(all.begin(), all.end());
+	q.push_eof();
+	std::u8string s1;
+	to_string(q.get_document(), std::back_inserter(s1));
+
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	p.feed(head.begin(), head.end());
+
+	parse_budget budget;
+	budget.m_tokens = 1;
+	std::uint32_t n = 1;
+	while (!p.resume(budget)) ++n;
+	BOOST_CHECK(4 < n);
+
+	// body の到着前に head を参照できる
+	auto html = p.get_document().begin();
+	auto h    = html.begin();
+	BOOST_REQUIRE(h != html.end());
+	BOOST_CHECK(!p.is_open(h));
+	BOOST_CHECK(p.is_open(html));
+	std::u8string s2;
+	to_string(h, std::back_inserter(s2));
+	BOOST_CHECK(s2 == u8"<title>T</title>");
+
+	for (auto it = body.begin(); it != body.end(); )
+	{
+		auto last = std::next(it, std::min<std::ptrdiff_t>(7, std::distance(it, body.end())));
+		p.feed(it, last);
+		it = last;
+		p.resume(budget);
+	}
+	p.finish();
+	while (!p.resume());
+	BOOST_CHECK(p.finished());
+
+	std::u8string s3;
+	to_string(p.get_document(), std::back_inserter(s3));
+	BOOST_CHECK(s1 == s3);
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_resume_2)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::string::const_iterator>;
+
+	std::string const in = "<meta charset=\"shift_jis\"><p>\x82\xA0</p>";
+
+	parser p(encoding_confidence_name::tentative, encoding_name::UTF_8);
+	p.feed(in.begin(), std::next(in.begin(), 10));
+	// 先頭 1024 バイトが揃うまでデコードを待つ
+	BOOST_CHECK(p.resume());
+	BOOST_CHECK(p.get_document().begin() == p.get_document().end());
+
+	p.feed(std::next(in.begin(), 10), in.end());
+	p.finish();
+	BOOST_CHECK(p.resume());
+	BOOST_CHECK(p.current_encoding() == encoding_name::Shift_JIS);
+
+	std::u8string out;
+	to_string(p.get_document(), std::back_inserter(out));
+	BOOST_CHECK(out == u8"<html><head><meta charset=\"shift_jis\"></head><body><p>\u3042</p></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_resume_3)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::string::const_iterator>;
+
+	// 先頭 1024 バイトの走査で見つからない meta 要素で、デコードし直す
+	std::string const meta = "<meta charset=\"shift_jis\">";
+	auto run = [&](parser& p, std::string const& in)
+	{
+		parse_budget budget;
+		budget.m_tokens = 3;
+		for (auto it = in.begin(); it != in.end(); )
+		{
+			auto last = std::next(it, std::min<std::ptrdiff_t>(100, std::distance(it, in.end())));
+			p.feed(it, last);
+			it = last;
+			p.resume(budget);
+		}
+		p.finish();
+		while (!p.resume());
+
+		std::u8string out;
+		to_string(p.get_document(), std::back_inserter(out));
+		return out;
+	};
+
+	// 解析済みの部分が ASCII のみなら、未解析の部分だけをデコードし直す
+	{
+		std::string const in = "<!--" + std::string(2000, 'a') + "-->" + meta + "<p>\x82\xA0</p>";
+		parser p(encoding_confidence_name::tentative, encoding_name::UTF_8);
+		std::u8string out = run(p, in);
+		BOOST_CHECK(p.current_encoding() == encoding_name::Shift_JIS);
+		BOOST_CHECK(p.reparse_count() == 0);
+		BOOST_CHECK(out == u8"<!--" + std::u8string(2000, u8'a') + u8"--><html><head><meta charset=\"shift_jis\"></head><body><p>\u3042</p></body></html>");
+	}
+
+	// ASCII 以外のバイトが先にあれば、最初から解析し直す
+	{
+		std::string const in = "<!--\x82\xA0" + std::string(2000, 'a') + "-->" + meta + "<p>\x82\xA2</p>";
+		parser p(encoding_confidence_name::tentative, encoding_name::UTF_8);
+		std::u8string out = run(p, in);
+		BOOST_CHECK(p.current_encoding() == encoding_name::Shift_JIS);
+		BOOST_CHECK(p.reparse_count() == 1);
+		BOOST_CHECK(out == u8"<!--\u3042" + std::u8string(2000, u8'a') + u8"--><html><head><meta charset=\"shift_jis\"></head><body><p>\u3044</p></body></html>");
+	}
+
+	// 保持するバイト列が上限を超えると、エンコーディングを確定する
+	{
+		std::string const in = "<!--\x82\xA0" + std::string(parser::replay_buffer_length, 'a') + "-->" + meta;
+		parser p(encoding_confidence_name::tentative, encoding_name::UTF_8);
+		run(p, in);
+		BOOST_CHECK(p.current_encoding() == encoding_name::UTF_8);
+		BOOST_CHECK(p.current_confidence() == encoding_confidence_name::certain);
+		BOOST_CHECK(p.reparse_count() == 0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_change_encoding_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::string::const_iterator>;
+
+	std::string const a(5000, 'a');
+	std::string const meta = "<meta charset=\"shift_jis\">";
+
+	// meta 要素より前が ASCII のみなら、変換器をその場で切り替える
+	{
+		std::string const in = "<!--" + a + "-->" + meta + "\x82\xA0";
+		parser p(encoding_confidence_name::tentative, encoding_name::UTF_8);
+		p.parse(in.begin(), in.end());
+		p.push_eof();
+		BOOST_CHECK(p.current_encoding() == encoding_name::Shift_JIS);
+		BOOST_CHECK(p.reparse_count() == 0);
+
+		std::u8string out;
+		to_string(p.get_document(), std::back_inserter(out));
+		BOOST_CHECK(out == u8"<!--" + std::u8string(a.begin(), a.end()) + u8"--><html><head><meta charset=\"shift_jis\"></head><body>\u3042</body></html>");
+	}
+
+	// ASCII 以外のバイトが先にあれば、最初から読み直す
+	{
+		std::string const in = "<!--\x82\xA0" + a + "-->" + meta;
+		parser p(encoding_confidence_name::tentative, encoding_name::UTF_8);
+		p.parse(in.begin(), in.end());
+		p.push_eof();
+		BOOST_CHECK(p.current_encoding() == encoding_name::Shift_JIS);
+		BOOST_CHECK(p.reparse_count() == 1);
+
+		std::u8string out;
+		to_string(p.get_document(), std::back_inserter(out));
+		BOOST_CHECK(out == u8"<!--\u3042" + std::u8string(a.begin(), a.end()) + u8"--><html><head><meta charset=\"shift_jis\"></head><body></body></html>");
+	}
+
+	// 読み直す範囲を超えた meta 要素は無視する
+	{
+		std::string const in = "<!--\x82\xA0" + std::string(parser::replay_buffer_length, 'a') + "-->" + meta;
+		parser p(encoding_confidence_name::tentative, encoding_name::UTF_8);
+		p.parse(in.begin(), in.end());
+		p.push_eof();
+		BOOST_CHECK(p.current_encoding() == encoding_name::UTF_8);
+		BOOST_CHECK(p.current_confidence() == encoding_confidence_name::certain);
+		BOOST_CHECK(p.reparse_count() == 0);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_allocator_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using tree   = pmr::u8simple_tree;
+	using parser = basic_simple_parser<tree, std::string::const_iterator>;
+
+	std::string const in = "<p class=\"a long class attribute value\">a long text node that does not fit in a short string</p>";
+
+	std::pmr::monotonic_buffer_resource arena;
+	parser p{ tree::allocator_type(&arena), encoding_confidence_name::irrelevant, encoding_name::UTF_8 };
+	p.parse(in.begin(), in.end());
+	tree t = p.get();
+
+	BOOST_CHECK(t.get_allocator().resource() == &arena);
+
+	std::u8string out;
+	to_string(t.begin(), std::back_inserter(out));
+	BOOST_CHECK(out == u8"<html><head></head><body><p class=\"a long class attribute value\">a long text node that does not fit in a short string</p></body></html>");
+
+	auto el = std::next(t.begin().begin().begin()).begin();
+	BOOST_CHECK(el->begin()->value().get_allocator().resource() == &arena);
+	BOOST_CHECK(el.begin()->data().get_allocator().resource() == &arena);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,354 @@
+﻿// test/html/simple_parser_benchmark.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/html/batch_parser.hpp>
+#include <wordring/html/simple_html.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define STRING(str) #str
+#define TO_STRING(str) STRING(str)
+
+namespace
+{
+	std::string const current_source_path{ TO_STRING(CURRENT_SOURCE_PATH) };
+
+	std::u32string repeat(std::u32string const& s, std::uint32_t n)
+	{
+		std::u32string result;
+		result.reserve(s.size() * n);
+		while (n--) result.append(s);
+		return result;
+	}
+
+	/*! @brief 入れ子の深さを倍にしながら解析時間を表示する
+
+	解析時間が入れ子の深さに比例していれば、一要素当たりの時間はほぼ一定となる。
+	*/
+	void print_nesting_benchmark(std::u32string const& unit, std::uint32_t first, std::uint32_t last)
+	{
+		using namespace wordring::html;
+
+		for (std::uint32_t n = first; n <= last; n *= 2)
+		{
+			std::u32string in = repeat(unit, n);
+
+			auto start = std::chrono::system_clock::now();
+			auto tree = make_document<u32simple_tree>(in.begin(), in.end());
+			auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+
+			std::cout << "depth: " << n
+				<< "\ttime: " << duration.count() << " us"
+				<< "\tper element: " << duration.count() * 1000 / n << " ns" << std::endl;
+		}
+	}
+
+	/*! @brief simple_html_sample_*.cpp をそのまま HTML 文書として読み込む
+	*/
+	std::vector<std::string> load_sample_corpus()
+	{
+		char const* names[] = {
+			"simple_html_sample_common.cpp", "simple_html_sample_document.cpp", "simple_html_sample_edits.cpp",
+			"simple_html_sample_embedded.cpp", "simple_html_sample_grouping.cpp", "simple_html_sample_images.cpp",
+			"simple_html_sample_introduction.cpp", "simple_html_sample_links.cpp", "simple_html_sample_parsing.cpp",
+			"simple_html_sample_sections.cpp", "simple_html_sample_semantics.cpp", "simple_html_sample_syntax.cpp",
+			"simple_html_sample_text.cpp" };
+
+		std::vector<std::string> corpus;
+		for (char const* name : names)
+		{
+			std::ifstream is(current_source_path + "/" + name, std::ios::binary);
+			corpus.emplace_back(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+		}
+		return corpus;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(simple_parser_benchmark_test)
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_nesting_1)
+{
+	std::cout << "---------- simple_parser_benchmark_nesting_1 ----------" << std::endl;
+	std::cout << "<div> * n" << std::endl;
+
+	print_nesting_benchmark(U"<div>", 1000, 16000);
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_nesting_2)
+{
+	std::cout << "---------- simple_parser_benchmark_nesting_2 ----------" << std::endl;
+	std::cout << "<ul><li> * n" << std::endl;
+
+	print_nesting_benchmark(U"<ul><li>", 1000, 16000);
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_nesting_3)
+{
+	std::cout << "---------- simple_parser_benchmark_nesting_3 ----------" << std::endl;
+	std::cout << "<table><tr><td> * n" << std::endl;
+
+	print_nesting_benchmark(U"<table><tr><td>", 1000, 16000);
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_misnesting_1)
+{
+	std::cout << "---------- simple_parser_benchmark_misnesting_1 ----------" << std::endl;
+	std::cout << "<b><i>a</b>b</i> * n" << std::endl;
+
+	print_nesting_benchmark(U"<b><i>a</b>b</i>", 500, 4000);
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_batch_1)
+{
+	using namespace wordring::html;
+
+	std::cout << "---------- simple_parser_benchmark_batch_1 ----------" << std::endl;
+	std::cout << "simple_html_sample_*.cpp * 4, hardware_concurrency: " << std::thread::hardware_concurrency() << std::endl;
+
+	std::vector<std::string> corpus = load_sample_corpus();
+	std::vector<std::string> in;
+	for (std::uint32_t i = 0; i < 4; ++i) in.insert(in.end(), corpus.begin(), corpus.end());
+
+	std::vector<u8simple_tree> out;
+	for (std::uint32_t threads = 1; threads <= 8; threads *= 2)
+	{
+		auto start = std::chrono::system_clock::now();
+		parse_batch(in, out, threads);
+		auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+
+		std::cout << "threads: " << threads
+			<< "\ttime: " << duration.count() / 1000 << " ms"
+			<< "\tdocs/sec: " << in.size() * 1000000 / std::max<std::int64_t>(duration.count(), 1) << std::endl;
+	}
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_serialize_1)
+{
+	using namespace wordring::html;
+
+	std::cout << "---------- simple_parser_benchmark_serialize_1 ----------" << std::endl;
+	std::cout << "simple_html_sample_*.cpp * 4" << std::endl;
+
+	std::vector<std::string> corpus = load_sample_corpus();
+	std::vector<std::string> in;
+	for (std::uint32_t i = 0; i < 4; ++i) in.insert(in.end(), corpus.begin(), corpus.end());
+
+	std::vector<u8simple_tree> trees;
+	parse_batch(in, trees);
+
+	std::size_t n = 0;
+	auto start = std::chrono::system_clock::now();
+	for (u8simple_tree const& t : trees)
+	{
+		std::u8string out;
+		wordring::whatwg::html::to_string(t.begin(), std::back_inserter(out));
+		n += out.size();
+	}
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+	std::cout << "whatwg::html::to_string()\ttime: " << duration.count() << " us\tbytes: " << n << std::endl;
+
+	n = 0;
+	start = std::chrono::system_clock::now();
+	for (u8simple_tree const& t : trees)
+	{
+		std::u8string out;
+		to_string(t.begin(), std::back_inserter(out));
+		n += out.size();
+	}
+	duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+	std::cout << "html::to_string()\ttime: " << duration.count() << " us\tbytes: " << n << std::endl;
+
+	n = 0;
+	std::u8string buf;
+	start = std::chrono::system_clock::now();
+	for (u8simple_tree const& t : trees)
+	{
+		buf.clear();
+		serialize(t.begin(), buf);
+		n += buf.size();
+	}
+	duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+	std::cout << "html::serialize()\ttime: " << duration.count() << " us\tbytes: " << n << std::endl;
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_text_content_1)
+{
+	using namespace wordring::html;
+
+	std::cout << "---------- simple_parser_benchmark_text_content_1 ----------" << std::endl;
+	std::cout << "simple_html_sample_*.cpp * 4" << std::endl;
+
+	std::vector<std::string> corpus = load_sample_corpus();
+	std::vector<std::string> in;
+	for (std::uint32_t i = 0; i < 4; ++i) in.insert(in.end(), corpus.begin(), corpus.end());
+
+	std::vector<u8simple_tree> trees;
+	parse_batch(in, trees);
+
+	std::size_t n = 0;
+	auto start = std::chrono::system_clock::now();
+	for (u8simple_tree& t : trees)
+	{
+		std::u8string out;
+		auto it1 = u8simple_tree::const_character_iterator(t.begin());
+		auto it2 = it1.end();
+		while (it1 != it2) out.push_back(*it1++);
+		n += out.size();
+	}
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+	std::cout << "const_character_iterator\ttime: " << duration.count() << " us\tcharacters: " << n << std::endl;
+
+	n = 0;
+	std::u8string buf;
+	start = std::chrono::system_clock::now();
+	for (u8simple_tree const& t : trees)
+	{
+		buf.clear();
+		text_content(t.begin(), buf);
+		n += buf.size();
+	}
+	duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+	std::cout << "text_content()\ttime: " << duration.count() << " us\tcharacters: " << n << std::endl;
+
+	n = 0;
+	start = std::chrono::system_clock::now();
+	for (u8simple_tree const& t : trees)
+	{
+		buf.clear();
+		visible_text(t.begin(), buf);
+		n += buf.size();
+	}
+	duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+	std::cout << "visible_text()\ttime: " << duration.count() << " us\tcharacters: " << n << std::endl;
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_error_policy_1)
+{
+	using namespace wordring::html;
+
+	std::cout << "---------- simple_parser_benchmark_error_policy_1 ----------" << std::endl;
+	std::cout << "simple_html_sample_*.cpp" << std::endl;
+
+	std::vector<std::string> in = load_sample_corpus();
+	std::vector<u8simple_tree> out;
+
+	auto start = std::chrono::system_clock::now();
+	parse_batch(in, out, 1);
+	auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
+	std::cout << "ignore_parse_errors\ttime: " << duration.count() << " ms" << std::endl;
+
+	start = std::chrono::system_clock::now();
+	auto results = parse_batch<u8simple_tree, collect_parse_errors>(in, out, 1);
+	duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
+
+	std::size_t n = 0;
+	for (batch_result const& r : results) n += r.m_errors.size();
+	std::cout << "collect_parse_errors\ttime: " << duration.count() << " ms\terrors: " << n << std::endl;
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_speculative_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::string::const_iterator>;
+
+	std::cout << "---------- simple_parser_benchmark_speculative_1 ----------" << std::endl;
+	std::cout << "<table> <tr><td>cell</td><td>1 &amp; 2</td></tr> * 5000 </table>" << std::endl;
+
+	std::string in = "<table>";
+	for (std::uint32_t i = 0; i < 5000; ++i) in += "<tr><td>cell</td><td>1 &amp; 2</td></tr>";
+	in += "</table>";
+
+	{
+		parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+		auto start = std::chrono::system_clock::now();
+		p.parse(in.begin(), in.end());
+		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "parse()\t\t\ttime: " << duration.count() << " ms" << std::endl;
+	}
+
+	for (std::uint32_t threads = 2; threads <= 8; threads *= 2)
+	{
+		parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+		auto start = std::chrono::system_clock::now();
+		p.parse_speculative(in.begin(), in.end(), threads);
+		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "parse_speculative()\tthreads: " << threads << "\ttime: " << duration.count() << " ms" << std::endl;
+	}
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(simple_parser_benchmark_instrumentation_1)
+{
+	using namespace wordring::html;
+	using wordring::whatwg::encoding_name;
+
+	using parser = basic_simple_parser<u8simple_tree, std::string::const_iterator, ignore_parse_errors, ignore_source_ranges, collect_parse_statistics>;
+
+	std::cout << "---------- simple_parser_benchmark_instrumentation_1 ----------" << std::endl;
+	std::cout << "simple_html_sample_*.cpp" << std::endl;
+
+	parse_statistics total;
+	parser p(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+	for (std::string const& s : load_sample_corpus())
+	{
+		p.clear(encoding_confidence_name::irrelevant, encoding_name::UTF_8);
+		p.parse(s.begin(), s.end());
+		p.push_eof();
+
+		parse_statistics const& st = p.get_instrumentation_policy().m_statistics;
+		total.m_tokenizer_calls  += st.m_tokenizer_calls;
+		total.m_start_tag_tokens += st.m_start_tag_tokens;
+		total.m_character_tokens += st.m_character_tokens;
+		total.m_tree_time        += st.m_tree_time;
+		total.m_tokenizer_time   += st.m_tokenizer_time;
+		total.m_max_stack_depth   = std::max(total.m_max_stack_depth, st.m_max_stack_depth);
+		for (std::size_t i = 0; i < parse_statistics::insertion_mode_count; ++i)
+		{
+			total.m_mode_tokens[i] += st.m_mode_tokens[i];
+			total.m_mode_time[i]   += st.m_mode_time[i];
+		}
+	}
+
+	auto ms = [](std::chrono::nanoseconds d) { return std::chrono::duration_cast<std::chrono::milliseconds>(d).count(); };
+
+	std::cout << "tokenizer calls: " << total.m_tokenizer_calls << "\tstart tags: " << total.m_start_tag_tokens << "\tcharacters: " << total.m_character_tokens << std::endl;
+	std::cout << "tokenizer: " << ms(total.m_tokenizer_time) << " ms\ttree construction: " << ms(total.m_tree_time) << " ms" << std::endl;
+	std::cout << "max stack depth: " << total.m_max_stack_depth << std::endl;
+	for (std::size_t i = 0; i < parse_statistics::insertion_mode_count; ++i)
+	{
+		if (total.m_mode_tokens[i] == 0) continue;
+		std::cout << "mode " << i << "\ttokens: " << total.m_mode_tokens[i] << "\ttime: " << ms(total.m_mode_time[i]) << " ms" << std::endl;
+	}
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,126 @@
+﻿// test/html/simple_text_index.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/html/simple_html.hpp>
+
+#include <wordring/compatibility.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(simple_text_index_test)
+
+BOOST_AUTO_TEST_CASE(simple_text_index_construct_1)
+{
+	using namespace wordring::html;
+
+	std::u8string const in = u8"<p>a <b>b</b>\n c<!-- d --></p><script>e</script><p>f</p>";
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+
+	simple_text_index<u8simple_tree> idx(tree, tree.begin());
+	BOOST_CHECK(idx.str() == u8"a b\n cef");
+	BOOST_CHECK(idx.str() == text_content(tree.begin()));
+	BOOST_CHECK(idx.node_count() == 5);
+	BOOST_CHECK(idx.size() == 8);
+	BOOST_CHECK(std::u8string(idx.begin(), idx.end()) == idx.str());
+
+	simple_text_index<u8simple_tree> idx2(tree, tree.begin(), true);
+	BOOST_CHECK(idx2.str() == u8"a b\n cf");
+	BOOST_CHECK(idx2.node_count() == 4);
+
+	simple_text_index<u8simple_tree> idx3;
+	BOOST_CHECK(idx3.empty());
+}
+
+BOOST_AUTO_TEST_CASE(simple_text_index_locate_1)
+{
+	using namespace wordring::html;
+
+	std::u8string const in = u8"<p>ab<b>cd</b>ef</p>";
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+	auto p = std::next(tree.begin().begin().begin()).begin();
+
+	simple_text_index<u8simple_tree> idx(tree, p);
+	BOOST_CHECK(idx.str() == u8"abcdef");
+
+	auto [node, offset] = idx.locate(3);
+	BOOST_CHECK(node->data() == u8"cd");
+	BOOST_CHECK(offset == 1);
+	BOOST_CHECK(node.parent()->local_name() == u8"b");
+
+	for (std::size_t i = 0; i < idx.size(); ++i)
+	{
+		auto pos = idx.locate(i);
+		BOOST_CHECK(idx.position(pos.first, pos.second) == i);
+	}
+
+	BOOST_CHECK(idx.position(p) == idx.npos);
+}
+
+BOOST_AUTO_TEST_CASE(simple_text_index_search_1)
+{
+	using namespace wordring::html;
+
+	std::u8string const in = u8"<p>The quick <b>bro</b>wn fox</p><p>jumps</p>";
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+
+	simple_text_index<u8simple_tree> idx(tree, tree.begin());
+
+	// ノード境界をまたぐ語を探す
+	std::u8string const needle = u8"brown";
+	auto it = std::search(idx.begin(), idx.end(), std::boyer_moore_horspool_searcher(needle.begin(), needle.end()));
+	BOOST_REQUIRE(it != idx.end());
+
+	auto [node, offset] = idx.locate(it - idx.begin());
+	BOOST_CHECK(node->data() == u8"bro");
+	BOOST_CHECK(offset == 0);
+
+	auto last = idx.locate(it - idx.begin() + needle.size() - 1);
+	BOOST_CHECK(last.first->data() == u8"wn fox");
+	BOOST_CHECK(last.second == 1);
+
+	BOOST_CHECK(idx.view().find(u8"foxjumps") != idx.npos);
+}
+
+BOOST_AUTO_TEST_CASE(simple_text_index_update_1)
+{
+	using namespace wordring::html;
+
+	std::u8string const in = u8"<p>ab</p><p>cd</p><p>ef</p>";
+	auto tree = make_document<u8simple_tree>(in.begin(), in.end());
+
+	simple_text_index<u8simple_tree> idx(tree, tree.begin());
+	BOOST_CHECK(idx.str() == u8"abcdef");
+
+	auto body = std::next(tree.begin().begin().begin());
+	auto t = std::next(body.begin()).begin();
+	BOOST_CHECK(t->data() == u8"cd");
+
+	// 伸ばす
+	t->data() = u8"CCDD";
+	BOOST_CHECK(idx.update(t));
+	BOOST_CHECK(idx.str() == u8"abCCDDef");
+	BOOST_CHECK(idx.locate(6).first->data() == u8"ef");
+	BOOST_CHECK(idx.locate(6).second == 0);
+
+	// 縮める
+	t->data() = u8"";
+	BOOST_CHECK(idx.update(t));
+	BOOST_CHECK(idx.str() == u8"abef");
+	BOOST_CHECK(idx.locate(2).first->data() == u8"ef");
+	BOOST_CHECK(idx.position(t) == 2);
+
+	// 索引に含まれないノード
+	BOOST_CHECK(!idx.update(body));
+
+	// 構造の変更は作り直す
+	tree.insert(body.end(), simple_text<std::u8string>(u8"gh"));
+	idx.rebuild();
+	BOOST_CHECK(idx.str() == u8"abefgh");
+	BOOST_CHECK(idx.node_count() == 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,150 @@
+﻿// test/tag_tree/frozen_tag_tree.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/tag_tree/frozen_tag_tree.hpp>
+
+#include <wordring/css/selector.hpp>
+#include <wordring/html/simple_html.hpp>
+#include <wordring/html/simple_traits.hpp>
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+	wordring::html::u8simple_tree make_test_tree(std::u8string const& s)
+	{
+		using namespace wordring::html;
+		return make_document<u8simple_tree>(s.begin(), s.end());
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(frozen_tag_tree_test)
+
+BOOST_AUTO_TEST_CASE(frozen_tag_tree_construct_1)
+{
+	using namespace wordring::html;
+
+	u8frozen_simple_tree t;
+	BOOST_CHECK(t.begin() == t.end());
+	BOOST_CHECK(t.empty());
+	BOOST_CHECK(t.size() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(frozen_tag_tree_freeze_1)
+{
+	using namespace wordring::html;
+
+	u8simple_tree t1 = make_test_tree(u8"<p>a<b>b</b>c</p><!-- d --><p>e</p>");
+	u8frozen_simple_tree t2 = wordring::freeze(t1);
+
+	BOOST_CHECK(t2.size() == t1.size());
+
+	std::u8string s1, s2;
+	to_string(t1.begin(), std::back_inserter(s1));
+	to_string(t2.begin(), std::back_inserter(s2));
+	BOOST_CHECK(s1 == s2);
+	BOOST_CHECK(s2 == u8"<html><head></head><body><p>a<b>b</b>c</p><!-- d --><p>e</p></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(frozen_tag_tree_freeze_2)
+{
+	using namespace wordring::html;
+
+	u8simple_tree t1 = make_test_tree(u8"<p>a<b>b</b>c</p>");
+	std::size_t n = t1.size();
+	u8frozen_simple_tree t2 = wordring::freeze(std::move(t1));
+
+	BOOST_CHECK(t1.empty());
+	BOOST_CHECK(t2.size() == n);
+
+	std::u8string s;
+	to_string(t2.begin(), std::back_inserter(s));
+	BOOST_CHECK(s == u8"<html><head></head><body><p>a<b>b</b>c</p></body></html>");
+}
+
+BOOST_AUTO_TEST_CASE(frozen_tag_tree_iterator_1)
+{
+	using namespace wordring::html;
+
+	u8frozen_simple_tree t = wordring::freeze(make_test_tree(u8"<p>a</p><p>b</p><p>c</p>"));
+
+	auto body = t.begin().begin().begin();
+	++body;
+	BOOST_CHECK(body->local_name_name() == tag_name::Body);
+	BOOST_CHECK(body.parent()->local_name_name() == tag_name::Html);
+	BOOST_CHECK(body.end().parent() == body);
+
+	std::u8string s;
+	for (auto it = body.begin(); it != body.end(); ++it) s += it.begin()->data();
+	BOOST_CHECK(s == u8"abc");
+
+	s.clear();
+	for (auto it = body.end(); it != body.begin(); ) s += (--it).begin()->data();
+	BOOST_CHECK(s == u8"cba");
+
+	BOOST_CHECK(t.begin().parent() == u8frozen_simple_tree::const_iterator());
+
+	// 要素の end() は、同じ格納位置を持つ次の兄弟や親の end() と区別される
+	auto p1 = body.begin();
+	BOOST_CHECK(p1.end() != std::next(p1));
+	BOOST_CHECK(std::next(p1, 2).end() != body.end());
+	BOOST_CHECK(t.begin().end() != t.end());
+	BOOST_CHECK(std::next(t.begin()) == t.end());
+}
+
+BOOST_AUTO_TEST_CASE(frozen_tag_tree_subtree_1)
+{
+	using namespace wordring::html;
+
+	u8frozen_simple_tree t = wordring::freeze(make_test_tree(u8"<p>a<b>b</b>c</p><p>d</p>"));
+
+	auto p = t.begin().begin().begin();
+	++p;
+	p = p.begin();
+	BOOST_CHECK(p->local_name_name() == tag_name::P);
+
+	// 子孫は文書順に並ぶ
+	std::u8string s;
+	for (std::uint32_t i = t.index(p) + 1; i < t.subtree_end(p); ++i)
+	{
+		if (t.kind(i) == u8simple_node::type_name::Text) s += t[i].data();
+	}
+	BOOST_CHECK(s == u8"abc");
+
+	BOOST_CHECK(t.at(t.subtree_end(p)) == std::next(p));
+	BOOST_CHECK(t.local_name_name(t.index(p) + 2) == tag_name::B);
+	BOOST_CHECK(t.subtree_end(t.begin()) == t.size() + 1);
+}
+
+BOOST_AUTO_TEST_CASE(frozen_tag_tree_query_selector_all_1)
+{
+	namespace css = wordring::css;
+	using namespace wordring::html;
+
+	u8simple_tree t1 = make_test_tree(u8"<div><p>a</p><span><p>b</p></span></div><p>c</p>");
+	u8frozen_simple_tree t2 = wordring::freeze(t1);
+
+	std::vector<u8simple_tree::const_iterator> v1;
+	css::query_selector_all(t1.begin(), u"div p", std::back_inserter(v1));
+
+	std::vector<u8frozen_simple_tree::const_iterator> v2;
+	css::query_selector_all(t2.begin(), u"div p", std::back_inserter(v2));
+
+	BOOST_REQUIRE(v1.size() == 2);
+	BOOST_REQUIRE(v2.size() == 2);
+
+	for (std::size_t i = 0; i < v1.size(); ++i)
+	{
+		std::u8string s1, s2;
+		to_string(v1[i], std::back_inserter(s1));
+		to_string(v2[i], std::back_inserter(s2));
+		BOOST_CHECK(s1 == s2);
+	}
+
+	BOOST_CHECK(t2.index(v2[0]) < t2.index(v2[1]));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
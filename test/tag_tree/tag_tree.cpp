@@ -9,6 +9,7 @@
 #include <wordring/html/simple_traits.hpp>
 
 #include <iterator>
+#include <memory_resource>
 #include <string>
 
 namespace wordring::html
@@ -86,6 +87,35 @@ BOOST_AUTO_TEST_CASE(tag_tree_copy_assign_1)
 	BOOST_CHECK(u8"1" == print(t2.begin()));
 }
 
+BOOST_AUTO_TEST_CASE(tag_tree_copy_assign_2)
+{
+	using namespace wordring::html;
+	std::u8string const s1 = u8"abcdefghijklmnopqrstuvwxyz0123456789";
+	std::u8string const s2 = u8"0123456789abcdefghijklmnopqrstuvwxyz";
+
+	test_tree t1;
+	t1.insert(t1.end(), simple_text<std::u8string>{ s1 });
+
+	test_tree t2;
+	t2.insert(t2.end(), simple_text<std::u8string>{ s2 });
+	auto it = t2.begin();
+	auto const* nodes = t2.m_c->data();
+	auto const* chars = it->data().data();
+
+	// ノード配列と文字列の記憶域を使い回す
+	t2 = t1;
+	BOOST_CHECK(s1 == print(t2.begin()));
+	BOOST_CHECK(it == t2.begin());
+	BOOST_CHECK(t2.m_c->data() == nodes);
+	BOOST_CHECK(t2.begin()->data().data() == chars);
+	BOOST_CHECK(t2.size() == 1);
+
+	// 移動元へ代入する
+	test_tree t3(std::move(t2));
+	t2 = t1;
+	BOOST_CHECK(s1 == print(t2.begin()));
+}
+
 BOOST_AUTO_TEST_CASE(tag_tree_move_assign_1)
 {
 	using namespace wordring::html;
@@ -231,6 +261,95 @@ BOOST_AUTO_TEST_CASE(tag_tree_size_4)
 	BOOST_CHECK(t1.size() == 0);
 }
 
+BOOST_AUTO_TEST_CASE(tag_tree_size_5)
+{
+	using namespace wordring::html;
+
+	test_tree t1;
+	auto it1 = t1.insert(t1.end(), simple_element<std::u8string>{});
+	auto it2 = t1.insert(it1.end(), simple_element<std::u8string>{});
+	t1.insert(it2.end(), simple_text<std::u8string>{ u8"1" });
+	t1.insert(it1.end(), simple_text<std::u8string>{ u8"2" });
+	BOOST_CHECK(t1.size() == 4);
+
+	t1.erase(it2);
+	BOOST_CHECK(t1.size() == 2);
+
+	test_tree t2;
+	t2.swap(t1);
+	BOOST_CHECK(t1.size() == 0);
+	BOOST_CHECK(t2.size() == 2);
+}
+
+BOOST_AUTO_TEST_CASE(tag_tree_compact_1)
+{
+	using namespace wordring::html;
+
+	test_tree t1;
+	auto it1 = t1.insert(t1.end(), simple_text<std::u8string>{ u8"1" });
+	auto it2 = t1.insert(t1.end(), simple_element<std::u8string>{});
+	auto it3 = t1.insert(it2.end(), simple_text<std::u8string>{ u8"3" });
+	t1.insert(it2.begin(), simple_text<std::u8string>{ u8"2" });
+	t1.erase(it1);
+	t1.insert(t1.begin(), simple_text<std::u8string>{ u8"0" });
+	std::uint32_t i3 = t1.index(it3);
+
+	std::vector<std::uint32_t> map = t1.compact();
+
+	// 対応表で旧格納位置から新格納位置を引ける
+	BOOST_CHECK(map[i3] == t1.index(std::prev(std::next(t1.begin()).end())));
+	BOOST_CHECK(std::prev(std::next(t1.begin()).end())->data() == u8"3");
+
+	// 開放済みノードが取り除かれ、行きがかり順に並ぶ
+	BOOST_CHECK(t1.m_c->size() == 6);
+	for (std::uint32_t i = 0; i < 6; ++i)
+	{
+		BOOST_CHECK((*t1.m_c)[i].m_next == (i + 1) % 6);
+		BOOST_CHECK((*t1.m_c)[(i + 1) % 6].m_prev == i);
+	}
+	BOOST_CHECK((*t1.m_c)[0].m_tail == 0);
+
+	auto it = t1.begin();
+	BOOST_CHECK(print(it) == u8"0");
+	++it;
+	BOOST_CHECK(t1.index(it) == 2);
+	BOOST_CHECK(print(it.begin()) == u8"2");
+	BOOST_CHECK(print(std::next(it.begin())) == u8"3");
+	BOOST_CHECK(it.begin().parent() == it);
+	BOOST_CHECK(std::next(it) == t1.end());
+	BOOST_CHECK(t1.size() == 4);
+}
+
+BOOST_AUTO_TEST_CASE(tag_tree_allocator_1)
+{
+	using namespace wordring::html;
+
+	using tree = pmr::u8simple_tree;
+
+	std::pmr::monotonic_buffer_resource arena;
+	tree t{ tree::allocator_type(&arena) };
+	BOOST_CHECK(t.get_allocator().resource() == &arena);
+
+	// 木の外で既定のリソースから確保した値も、挿入時にアリーナへ移される
+	pmr::u8simple_node::string_type s(u8"0123456789012345678901234567890123456789");
+	auto it1 = t.insert(t.end(), pmr::u8simple_node::element_type(tag_name::P));
+	it1->push_back(pmr::u8simple_node::attribute_type(attribute_name::Class, s));
+	auto it2 = t.insert(it1.end(), pmr::u8simple_node::text_type(s));
+
+	BOOST_CHECK(it2->data() == s);
+	BOOST_CHECK(it2->data().get_allocator().resource() == &arena);
+	BOOST_CHECK(it1->begin()->value().get_allocator().resource() == &arena);
+
+	// 複写は pmr の規則に従い、既定のリソースを使う
+	tree t2 = t;
+	BOOST_CHECK(t2.get_allocator().resource() == std::pmr::get_default_resource());
+	BOOST_CHECK(t2.begin().begin()->data() == s);
+
+	t.compact();
+	BOOST_CHECK(t.get_allocator().resource() == &arena);
+	BOOST_CHECK(t.begin().begin()->data().get_allocator().resource() == &arena);
+}
+
 BOOST_AUTO_TEST_CASE(tag_tree_clear_1)
 {
 	using namespace wordring::html;
@@ -389,6 +508,33 @@ BOOST_AUTO_TEST_CASE(tag_tree_move_4)
 	BOOST_CHECK((*t1.m_c)[4].m_next == 0);
 }
 
+BOOST_AUTO_TEST_CASE(tag_tree_move_parent_1)
+{
+	using namespace wordring::html;
+
+	test_tree t1;
+	auto it1 = t1.insert(t1.end(), simple_element<std::u8string>{});
+	auto it2 = t1.insert(t1.end(), simple_element<std::u8string>{});
+	auto it3 = t1.insert(it2.end(), simple_element<std::u8string>{});
+	auto it4 = t1.insert(it3.end(), simple_text<std::u8string>{ u8"1" });
+	auto it5 = t1.insert(it3, simple_text<std::u8string>{ u8"2" });
+
+	BOOST_CHECK(it3.parent() == it2);
+	BOOST_CHECK(it4.parent() == it3);
+	BOOST_CHECK(it5.parent() == it2);
+
+	t1.move(it1.end(), it3);
+
+	BOOST_CHECK(it3.parent() == it1);
+	BOOST_CHECK(it4.parent() == it3);
+	BOOST_CHECK(it5.parent() == it2);
+
+	t1.move(t1.end(), it3);
+
+	BOOST_CHECK(it3.parent() == decltype(it3)());
+	BOOST_CHECK(it4.parent() == it3);
+}
+
 BOOST_AUTO_TEST_CASE(tag_tree_erase_1)
 {
 	using namespace wordring::html;
@@ -479,16 +625,15 @@ BOOST_AUTO_TEST_CASE(tag_tree_allocate_2)
 	tree.free(i2);
 	tree.free(i3);
 
+	// 最後に開放したノードから再利用する
 	std::uint32_t i4 = tree.allocate(simple_text<std::u8string>{});
-	BOOST_CHECK(i4 == 1);
+	BOOST_CHECK(i4 == 3);
 
-	BOOST_CHECK((*tree.m_c)[0].m_head == 3);
 	BOOST_CHECK((*tree.m_c)[0].m_tail == 2);
+	BOOST_CHECK((*tree.m_c)[2].m_tail == 1);
+	BOOST_CHECK((*tree.m_c)[1].m_tail == 0);
 
-	BOOST_CHECK((*tree.m_c)[2].m_head == 0);
-	BOOST_CHECK((*tree.m_c)[2].m_tail == 3);
-
-	BOOST_CHECK((*tree.m_c)[3].m_head == 2);
+	BOOST_CHECK((*tree.m_c)[3].m_head == 0);
 	BOOST_CHECK((*tree.m_c)[3].m_tail == 0);
 }
 
@@ -500,7 +645,7 @@ BOOST_AUTO_TEST_CASE(tag_tree_free_1)
 	std::uint32_t i1 = tree.allocate(simple_text<std::u8string>{});
 	tree.free(i1);
 
-	BOOST_CHECK((*tree.m_c)[0].m_head == 1);
+	BOOST_CHECK((*tree.m_c)[0].m_head == 0);
 	BOOST_CHECK((*tree.m_c)[0].m_tail == 1);
 
 	BOOST_CHECK((*tree.m_c)[1].m_head == 0);
@@ -519,17 +664,11 @@ BOOST_AUTO_TEST_CASE(tag_tree_free_2)
 	tree.free(i2);
 	tree.free(i3);
 
-	BOOST_CHECK((*tree.m_c)[0].m_head == 3);
-	BOOST_CHECK((*tree.m_c)[0].m_tail == 1);
-
-	BOOST_CHECK((*tree.m_c)[1].m_head == 0);
-	BOOST_CHECK((*tree.m_c)[1].m_tail == 2);
-
-	BOOST_CHECK((*tree.m_c)[2].m_head == 1);
-	BOOST_CHECK((*tree.m_c)[2].m_tail == 3);
-
-	BOOST_CHECK((*tree.m_c)[3].m_head == 2);
-	BOOST_CHECK((*tree.m_c)[3].m_tail == 0);
+	// 番兵の TAIL を先頭とする、開放の逆順の単方向リスト
+	BOOST_CHECK((*tree.m_c)[0].m_tail == 3);
+	BOOST_CHECK((*tree.m_c)[3].m_tail == 2);
+	BOOST_CHECK((*tree.m_c)[2].m_tail == 1);
+	BOOST_CHECK((*tree.m_c)[1].m_tail == 0);
 }
 
 BOOST_AUTO_TEST_CASE(tag_tree_link_1)
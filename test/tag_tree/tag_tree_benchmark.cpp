@@ -0,0 +1,248 @@
+﻿// test/tag_tree/tag_tree_benchmark.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/tag_tree/frozen_tag_tree.hpp>
+#include <wordring/tag_tree/tag_tree.hpp>
+#include <wordring/tag_tree/tag_tree_pool.hpp>
+
+#include <wordring/css/selector.hpp>
+#include <wordring/html/simple_html.hpp>
+#include <wordring/tree/tree_cursor.hpp>
+#include <wordring/tree/tree_iterator.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using test_tree = wordring::html::u8simple_tree;
+
+	/*! @brief 一つの ul 要素に n 個の li 要素を持つ文書を作成する */
+	test_tree make_wide_list(std::uint32_t n)
+	{
+		using namespace wordring::html;
+
+		test_tree t;
+		auto ul = t.insert(t.end(), simple_element<std::u8string>(tag_name::Ul));
+		for (std::uint32_t i = 0; i < n; ++i)
+		{
+			auto li = t.insert(ul.end(), simple_element<std::u8string>(tag_name::Li));
+			t.insert(li.end(), simple_text<std::u8string>(u8"item"));
+		}
+		return t;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(tag_tree_benchmark_test)
+
+BOOST_AUTO_TEST_CASE(tag_tree_benchmark_parent_1)
+{
+	using namespace wordring::html;
+
+	std::cout << "---------- tag_tree_benchmark_parent_1 ----------" << std::endl;
+	std::cout << "<ul> <li>item</li> * n </ul>" << std::endl;
+
+	for (std::uint32_t n : { 1000u, 10000u })
+	{
+		test_tree t = make_wide_list(n);
+		auto ul = t.begin();
+
+		std::uint64_t found = 0;
+		auto start = std::chrono::system_clock::now();
+		for (auto it = ul.begin(); it != ul.end(); ++it) found += it.parent() == ul;
+		auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		BOOST_CHECK(found == n);
+		std::cout << "n: " << n << "\tparent() of every li: " << duration.count() << " us" << std::endl;
+
+		std::u8string out;
+		start = std::chrono::system_clock::now();
+		to_string(t.begin(), std::back_inserter(out));
+		duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\tto_string(): " << duration.count() << " us" << std::endl;
+	}
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(tag_tree_benchmark_erase_1)
+{
+	using namespace wordring::html;
+
+	std::cout << "---------- tag_tree_benchmark_erase_1 ----------" << std::endl;
+	std::cout << "<ul> <li>item</li> * n </ul>" << std::endl;
+
+	for (std::uint32_t n : { 1000u, 10000u })
+	{
+		test_tree t = make_wide_list(n);
+
+		auto start = std::chrono::system_clock::now();
+		t.erase(t.begin());
+		auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		BOOST_CHECK(t.size() == 0);
+		std::cout << "n: " << n << "\terase(): " << duration.count() << " us" << std::endl;
+
+		// 開放済みノードを再利用して作り直し、詰め直す
+		t = make_wide_list(n);
+		auto ul = t.begin();
+		for (auto it = ul.begin(); it != ul.end(); )
+		{
+			it = t.erase(it);
+			if (it != ul.end()) ++it;
+		}
+		for (std::uint32_t i = 0; i < n; ++i) t.insert(ul.end(), simple_text<std::u8string>(u8"item"));
+
+		start = std::chrono::system_clock::now();
+		t.compact();
+		duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\tcompact(): " << duration.count() << " us\tsize(): " << t.size() << std::endl;
+	}
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(tag_tree_benchmark_freeze_1)
+{
+	namespace css = wordring::css;
+	using namespace wordring::html;
+
+	std::cout << "---------- tag_tree_benchmark_freeze_1 ----------" << std::endl;
+	std::cout << "<ul> <li>item</li> * n </ul>" << std::endl;
+
+	for (std::uint32_t n : { 1000u, 10000u })
+	{
+		std::u8string src = u8"<ul>";
+		for (std::uint32_t i = 0; i < n; ++i) src += u8"<li>item</li>";
+		src += u8"</ul>";
+		test_tree t1 = make_document<test_tree>(src.begin(), src.end());
+
+		auto start = std::chrono::system_clock::now();
+		u8frozen_simple_tree t2 = wordring::freeze(t1);
+		auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\tfreeze(): " << duration.count() << " us" << std::endl;
+
+		// 子孫のテキストを集める
+		std::size_t len1 = 0;
+		start = std::chrono::system_clock::now();
+		for (wordring::tree_iterator<test_tree::const_iterator> it(t1.begin()), last; it != last; ++it)
+		{
+			if (it->is_text()) len1 += it->data().size();
+		}
+		duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\ttext of tag_tree: " << duration.count() << " us" << std::endl;
+
+		std::size_t len2 = 0;
+		start = std::chrono::system_clock::now();
+		for (std::uint32_t i = t2.index(t2.begin()), last = t2.subtree_end(t2.begin()); i != last; ++i)
+		{
+			if (t2.kind(i) == u8simple_node::type_name::Text) len2 += t2[i].data().size();
+		}
+		duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\ttext of frozen_tag_tree: " << duration.count() << " us" << std::endl;
+		BOOST_CHECK(len1 == len2);
+
+		std::vector<test_tree::const_iterator> v1;
+		start = std::chrono::system_clock::now();
+		css::query_selector_all(t1.begin(), u"li", std::back_inserter(v1));
+		duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\tquery_selector_all() of tag_tree: " << duration.count() << " us" << std::endl;
+
+		std::vector<u8frozen_simple_tree::const_iterator> v2;
+		start = std::chrono::system_clock::now();
+		css::query_selector_all(t2.begin(), u"li", std::back_inserter(v2));
+		duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\tquery_selector_all() of frozen_tag_tree: " << duration.count() << " us" << std::endl;
+		BOOST_CHECK(v1.size() == v2.size());
+	}
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(tag_tree_benchmark_clone_1)
+{
+	using namespace wordring::html;
+
+	std::cout << "---------- tag_tree_benchmark_clone_1 ----------" << std::endl;
+	std::cout << "<ul> <li class=\"item\">a long list item text</li> * 1000 </ul>, clone and edit * n" << std::endl;
+
+	std::u8string src = u8"<ul>";
+	for (std::uint32_t i = 0; i < 1000; ++i) src += u8"<li class=\"item\">a long list item text</li>";
+	src += u8"</ul>";
+	test_tree const prototype = make_document<test_tree>(src.begin(), src.end());
+
+	// 最初の li のテキストを書き換え、末尾へ li を一つ加える
+	auto edit = [](test_tree& t) {
+		auto ul = std::next(t.begin().begin().begin()).begin();
+		ul.begin().begin()->data() = u8"edited";
+		t.insert(ul.end(), simple_element<std::u8string>(tag_name::Li));
+		return t.size();
+	};
+
+	for (std::uint32_t n : { 10u, 100u })
+	{
+		std::size_t len1 = 0;
+		auto start = std::chrono::system_clock::now();
+		for (std::uint32_t i = 0; i < n; ++i)
+		{
+			test_tree t(prototype);
+			len1 += edit(t);
+		}
+		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\tcopy constructor: " << duration.count() << " ms" << std::endl;
+
+		std::size_t len2 = 0;
+		wordring::tag_tree_pool<test_tree> pool(prototype);
+		start = std::chrono::system_clock::now();
+		for (std::uint32_t i = 0; i < n; ++i)
+		{
+			test_tree t = pool.clone();
+			len2 += edit(t);
+			pool.release(std::move(t));
+		}
+		duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\ttag_tree_pool: " << duration.count() << " ms" << std::endl;
+		BOOST_CHECK(len1 == len2);
+	}
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_CASE(tag_tree_benchmark_cursor_1)
+{
+	using namespace wordring::html;
+
+	std::cout << "---------- tag_tree_benchmark_cursor_1 ----------" << std::endl;
+	std::cout << "<ul> <li>item</li> * n </ul>" << std::endl;
+
+	for (std::uint32_t n : { 1000u, 10000u })
+	{
+		test_tree t = make_wide_list(n);
+
+		std::size_t n1 = 0;
+		auto start = std::chrono::system_clock::now();
+		for (wordring::tree_iterator<test_tree::const_iterator> it(t.begin()), last; it != last; ++it)
+		{
+			if (it->is_text()) ++n1;
+		}
+		auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\ttree_iterator: " << duration.count() << " us" << std::endl;
+
+		std::size_t n2 = 0;
+		start = std::chrono::system_clock::now();
+		for (wordring::pre_order_cursor<test_tree::const_iterator> it(t.begin()), last; it != last; ++it)
+		{
+			if (it->is_text()) ++n2;
+		}
+		duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now() - start);
+		std::cout << "n: " << n << "\tpre_order_cursor: " << duration.count() << " us" << std::endl;
+		BOOST_CHECK(n1 == n2);
+	}
+
+	std::cout << std::endl;
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+﻿// test/tag_tree/tag_tree_cursor.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/tag_tree/tag_tree.hpp>
+#include <wordring/tree/tree_cursor.hpp>
+#include <wordring/tree/tree_iterator.hpp>
+
+#include <wordring/html/simple_html.hpp>
+
+#include <iterator>
+#include <string>
+
+namespace
+{
+	wordring::html::u8simple_tree make_test_tree(std::u8string const& s)
+	{
+		using namespace wordring::html;
+		return make_document<u8simple_tree>(s.begin(), s.end());
+	}
+
+	/*! @brief 要素はローカル名、テキストはデータを連結する */
+	template <typename Cursor>
+	std::u8string print(Cursor first)
+	{
+		std::u8string s;
+		for (Cursor last; first != last; ++first)
+		{
+			if (first->is_element()) s += u8"<" + first->local_name() + u8">";
+			else if (first->is_text()) s += first->data();
+		}
+		return s;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(tag_tree_cursor_test)
+
+BOOST_AUTO_TEST_CASE(tag_tree_pre_order_cursor_1)
+{
+	using namespace wordring;
+	using namespace wordring::html;
+
+	u8simple_tree t = make_test_tree(u8"<p>a<b>b</b><i></i>c</p><p>d</p>");
+	auto body = std::next(t.begin().begin().begin());
+
+	using cursor = pre_order_cursor<u8simple_tree::const_iterator>;
+	BOOST_CHECK(print(cursor(body)) == u8"<body><p>a<b>b<i>c<p>d");
+	BOOST_CHECK(print(cursor(body.begin())) == u8"<p>a<b>b<i>c");
+	BOOST_CHECK(print(cursor(body.begin().begin())) == u8"a");
+	BOOST_CHECK(print(cursor(std::next(body.begin().begin(), 2))) == u8"<i>");
+
+	// tree_iterator と同じ順に走査する
+	std::u8string s;
+	for (tree_iterator<u8simple_tree::const_iterator> it(t.begin()), last; it != last; ++it)
+	{
+		if (it->is_element()) s += u8"<" + it->local_name() + u8">";
+		else if (it->is_text()) s += it->data();
+	}
+	BOOST_CHECK(print(cursor(t.begin())) == s);
+}
+
+BOOST_AUTO_TEST_CASE(tag_tree_pre_order_cursor_2)
+{
+	using namespace wordring;
+	using namespace wordring::html;
+
+	u8simple_tree t = make_test_tree(u8"<p>a<b>b</b><i></i>c</p><p>d</p>");
+	auto body = std::next(t.begin().begin().begin());
+
+	// 書き換えられるイテレータ
+	for (pre_order_cursor<u8simple_tree::iterator> it(body), last; it != last; ++it)
+	{
+		if (it->is_text()) it->data() += u8"!";
+	}
+
+	using cursor = pre_order_cursor<u8simple_tree::const_iterator>;
+	BOOST_CHECK(print(cursor(body)) == u8"<body><p>a!<b>b!<i>c!<p>d!");
+}
+
+BOOST_AUTO_TEST_CASE(tag_tree_pre_order_cursor_skip_subtree_1)
+{
+	using namespace wordring;
+	using namespace wordring::html;
+
+	u8simple_tree t = make_test_tree(u8"<p>a<b>b</b><i></i>c</p><p>d</p>");
+	auto body = std::next(t.begin().begin().begin());
+
+	std::u8string s;
+	pre_order_cursor<u8simple_tree::const_iterator> it(body), last;
+	while (it != last)
+	{
+		if (it->is_element()) s += u8"<" + it->local_name() + u8">";
+		else if (it->is_text()) s += it->data();
+
+		if (it->is_element() && (it->local_name() == u8"b" || it->local_name() == u8"i")) it.skip_subtree();
+		else ++it;
+	}
+	BOOST_CHECK(s == u8"<body><p>a<b><i>c<p>d");
+
+	// 根を読み飛ばすと終端となる
+	it = pre_order_cursor<u8simple_tree::const_iterator>(body);
+	it.skip_subtree();
+	BOOST_CHECK(it == last);
+
+	// 最後の子の部分木を読み飛ばすと終端となる
+	it = pre_order_cursor<u8simple_tree::const_iterator>(body);
+	for (int i = 0; i < 7; ++i) ++it;
+	BOOST_CHECK(it.base() == std::next(body.begin()));
+	it.skip_subtree();
+	BOOST_CHECK(it == last);
+}
+
+BOOST_AUTO_TEST_CASE(tag_tree_post_order_cursor_1)
+{
+	using namespace wordring;
+	using namespace wordring::html;
+
+	u8simple_tree t = make_test_tree(u8"<p>a<b>b</b><i></i>c</p><p>d</p>");
+	auto body = std::next(t.begin().begin().begin());
+
+	using cursor = post_order_cursor<u8simple_tree::const_iterator>;
+	BOOST_CHECK(print(cursor(body)) == u8"ab<b><i>c<p>d<p><body>");
+	BOOST_CHECK(print(cursor(body.begin().begin())) == u8"a");
+	BOOST_CHECK(print(cursor(std::next(body.begin().begin(), 2))) == u8"<i>");
+
+	cursor it(body);
+	BOOST_CHECK(it.base() == body.begin().begin());
+	BOOST_CHECK(it++ == body.begin().begin());
+	BOOST_CHECK(it->data() == u8"b");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
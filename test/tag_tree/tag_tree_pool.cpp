@@ -0,0 +1,63 @@
+﻿// test/tag_tree/tag_tree_pool.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/tag_tree/tag_tree_pool.hpp>
+
+#include <wordring/html/simple_html.hpp>
+
+#include <iterator>
+#include <string>
+
+namespace
+{
+	wordring::html::u8simple_tree make_test_tree(std::u8string const& s)
+	{
+		using namespace wordring::html;
+		return make_document<u8simple_tree>(s.begin(), s.end());
+	}
+
+	std::u8string print(wordring::html::u8simple_tree const& t)
+	{
+		std::u8string s;
+		wordring::html::serialize(t.begin(), s);
+		return s;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(tag_tree_pool_test)
+
+BOOST_AUTO_TEST_CASE(tag_tree_pool_clone_1)
+{
+	using namespace wordring::html;
+
+	std::u8string const s = u8"<html><head></head><body><p>a<b>b</b></p></body></html>";
+	wordring::tag_tree_pool<u8simple_tree> pool(make_test_tree(s));
+	BOOST_CHECK(pool.pooled() == 0);
+
+	u8simple_tree t1 = pool.clone();
+	BOOST_CHECK(print(t1) == s);
+	BOOST_CHECK(t1.size() == pool.prototype().size());
+
+	// 複写を編集しても雛形は変わらない
+	auto body = std::next(t1.begin().begin().begin());
+	t1.insert(body.end(), simple_text<std::u8string>(u8"c"));
+	body.begin().begin()->data() = u8"A";
+	BOOST_CHECK(print(t1) == u8"<html><head></head><body><p>A<b>b</b></p>c</body></html>");
+	BOOST_CHECK(print(pool.prototype()) == s);
+
+	pool.release(std::move(t1));
+	BOOST_CHECK(pool.pooled() == 1);
+
+	// 返却した木を使い回す
+	u8simple_tree t2 = pool.clone();
+	BOOST_CHECK(pool.pooled() == 0);
+	BOOST_CHECK(print(t2) == s);
+	BOOST_CHECK(t2.size() == pool.prototype().size());
+
+	pool.release(std::move(t2));
+	pool.shrink();
+	BOOST_CHECK(pool.pooled() == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,130 @@
+﻿// test/tree/tree_cursor.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/tree/tree.hpp>
+#include <wordring/tree/tree_cursor.hpp>
+#include <wordring/tree/tree_iterator.hpp>
+
+#include <iterator>
+#include <string>
+
+namespace
+{
+	inline wordring::tree<char> make_tree1()
+	{
+		wordring::tree<char> t;
+		auto it0 = t.insert(t.end(), '0');
+		auto it1 = t.insert(it0.end(), '1');
+		auto it2 = t.insert(it0.end(), '2');
+		t.insert(it0.end(), '3');
+		t.insert(it1.end(), '4');
+		t.insert(it1.end(), '5');
+		t.insert(it2.end(), '6');
+
+		return t;
+	}
+}
+
+BOOST_AUTO_TEST_SUITE(tree_cursor_test)
+
+// ----------------------------------------------------------------------------
+// pre_order_cursor
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(pre_order_cursor_construct_1)
+{
+	using namespace wordring;
+
+	pre_order_cursor<tree<char>::iterator> it1, it2;
+	BOOST_CHECK(it1 == it2);
+}
+
+BOOST_AUTO_TEST_CASE(pre_order_cursor_increment_1)
+{
+	using namespace wordring;
+
+	tree<char> t = make_tree1();
+
+	std::string s;
+	for (pre_order_cursor<tree<char>::iterator> it(t.begin()), last; it != last; ++it) s.push_back(*it);
+	BOOST_CHECK(s == "0145263");
+
+	// tree_iterator と同じ順に走査する
+	std::string s2;
+	for (tree_iterator<tree<char>::iterator> it(t.begin()), last; it != last; ++it) s2.push_back(*it);
+	BOOST_CHECK(s == s2);
+}
+
+BOOST_AUTO_TEST_CASE(pre_order_cursor_increment_2)
+{
+	using namespace wordring;
+
+	tree<char> const t = make_tree1();
+
+	// 部分木のみを走査する
+	std::string s;
+	for (pre_order_cursor<tree<char>::const_iterator> it(t.begin().begin()), last; it != last; ++it) s.push_back(*it);
+	BOOST_CHECK(s == "145");
+
+	// 子の無い根
+	s.clear();
+	for (pre_order_cursor<tree<char>::const_iterator> it(std::prev(t.begin().end())), last; it != last; ++it) s.push_back(*it);
+	BOOST_CHECK(s == "3");
+}
+
+BOOST_AUTO_TEST_CASE(pre_order_cursor_skip_subtree_1)
+{
+	using namespace wordring;
+
+	tree<char> t = make_tree1();
+
+	std::string s;
+	pre_order_cursor<tree<char>::iterator> it(t.begin()), last;
+	while (it != last)
+	{
+		s.push_back(*it);
+		if (*it == '1') it.skip_subtree();
+		else ++it;
+	}
+	BOOST_CHECK(s == "01263");
+
+	// 根を読み飛ばすと終端となる
+	it = pre_order_cursor<tree<char>::iterator>(t.begin());
+	it.skip_subtree();
+	BOOST_CHECK(it == last);
+}
+
+BOOST_AUTO_TEST_CASE(pre_order_cursor_base_1)
+{
+	using namespace wordring;
+
+	tree<char> t = make_tree1();
+
+	pre_order_cursor<tree<char>::iterator> it(t.begin());
+	++it;
+	BOOST_CHECK(it.base() == t.begin().begin());
+	BOOST_CHECK(it++ == t.begin().begin());
+	BOOST_CHECK(*it == '4');
+}
+
+// ----------------------------------------------------------------------------
+// post_order_cursor
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(post_order_cursor_increment_1)
+{
+	using namespace wordring;
+
+	tree<char> t = make_tree1();
+
+	std::string s;
+	for (post_order_cursor<tree<char>::iterator> it(t.begin()), last; it != last; ++it) s.push_back(*it);
+	BOOST_CHECK(s == "4516230");
+
+	s.clear();
+	for (post_order_cursor<tree<char>::iterator> it(std::next(t.begin().begin())), last; it != last; ++it) s.push_back(*it);
+	BOOST_CHECK(s == "62");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
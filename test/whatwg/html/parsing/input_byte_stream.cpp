@@ -0,0 +1,105 @@
+﻿// test/whatwg/html/parsing/input_byte_stream.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/whatwg/html/parsing/input_byte_stream.hpp>
+
+#include <wordring/whatwg/html/html_defs.hpp>
+
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(parsing_input_byte_stream_test)
+
+/*
+BOM からエンコーディングを決定する
+
+sniff_byte_order_mark(ForwardIterator first, ForwardIterator last)
+*/
+BOOST_AUTO_TEST_CASE(input_byte_stream_sniff_byte_order_mark_1)
+{
+	using namespace wordring::whatwg::html;
+	using namespace wordring::whatwg::html::parsing;
+
+	std::string s = "\xEF\xBB\xBF<html>";
+	BOOST_CHECK(sniff_byte_order_mark(s.begin(), s.end()) == encoding_name::UTF_8);
+
+	s = "\xFE\xFF";
+	BOOST_CHECK(sniff_byte_order_mark(s.begin(), s.end()) == encoding_name::UTF_16BE);
+
+	s = "\xFF\xFE";
+	BOOST_CHECK(sniff_byte_order_mark(s.begin(), s.end()) == encoding_name::UTF_16LE);
+
+	s = "<html>";
+	BOOST_CHECK(sniff_byte_order_mark(s.begin(), s.end()) == static_cast<encoding_name>(0));
+}
+
+/*
+charset 属性からエンコーディングを決定する
+
+prescan_byte_stream(ForwardIterator first, ForwardIterator last)
+*/
+BOOST_AUTO_TEST_CASE(input_byte_stream_prescan_byte_stream_1)
+{
+	using namespace wordring::whatwg::html;
+	using namespace wordring::whatwg::html::parsing;
+
+	std::string s = "<!DOCTYPE html><html><head><META Charset='Shift_JIS'></head></html>";
+	BOOST_CHECK(prescan_byte_stream(s.begin(), s.end()) == encoding_name::Shift_JIS);
+}
+
+/*
+http-equiv 属性と content 属性からエンコーディングを決定する
+*/
+BOOST_AUTO_TEST_CASE(input_byte_stream_prescan_byte_stream_2)
+{
+	using namespace wordring::whatwg::html;
+	using namespace wordring::whatwg::html::parsing;
+
+	std::string s = "<meta http-equiv=\"Content-Type\" content=\"text/html; charset=euc-jp\">";
+	BOOST_CHECK(prescan_byte_stream(s.begin(), s.end()) == encoding_name::EUC_JP);
+
+	// http-equiv が無い場合、無視される
+	s = "<meta content=\"text/html; charset=euc-jp\">";
+	BOOST_CHECK(prescan_byte_stream(s.begin(), s.end()) == static_cast<encoding_name>(0));
+}
+
+/*
+コメントや他のタグの属性内の meta を無視する
+*/
+BOOST_AUTO_TEST_CASE(input_byte_stream_prescan_byte_stream_3)
+{
+	using namespace wordring::whatwg::html;
+	using namespace wordring::whatwg::html::parsing;
+
+	std::string s = "<!-- <meta charset=euc-jp> --><div title='<meta charset=euc-jp>'><meta charset=shift_jis>";
+	BOOST_CHECK(prescan_byte_stream(s.begin(), s.end()) == encoding_name::Shift_JIS);
+}
+
+/*
+UTF-16 と x-user-defined を置き換える
+*/
+BOOST_AUTO_TEST_CASE(input_byte_stream_prescan_byte_stream_4)
+{
+	using namespace wordring::whatwg::html;
+	using namespace wordring::whatwg::html::parsing;
+
+	std::string s = "<meta charset=utf-16>";
+	BOOST_CHECK(prescan_byte_stream(s.begin(), s.end()) == encoding_name::UTF_8);
+
+	s = "<meta charset=x-user-defined>";
+	BOOST_CHECK(prescan_byte_stream(s.begin(), s.end()) == encoding_name::windows_1252);
+}
+
+/*
+先頭 1024 バイトより後ろは走査しない
+*/
+BOOST_AUTO_TEST_CASE(input_byte_stream_prescan_byte_stream_5)
+{
+	using namespace wordring::whatwg::html;
+	using namespace wordring::whatwg::html::parsing;
+
+	std::string s = "<html>" + std::string(prescan_byte_length, ' ') + "<meta charset=euc-jp>";
+	BOOST_CHECK(prescan_byte_stream(s.begin(), s.end()) == static_cast<encoding_name>(0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -392,6 +392,56 @@ BOOST_AUTO_TEST_CASE(input_stream_match_named_character_reference_6)
 	BOOST_CHECK(a[1] == U'\0');
 }
 
+/*
+照合の確定を調べる
+
+match_named_character_reference(std::uint32_t& len, bool& complete)
+*/
+BOOST_AUTO_TEST_CASE(input_stream_match_named_character_reference_7)
+{
+	test_stream ts;
+	auto s = std::u32string(U"am");
+	for (char32_t cp : s) ts.push_code_point(cp);
+
+	std::uint32_t len;
+	bool complete;
+	ts.match_named_character_reference(len, complete);
+
+	BOOST_CHECK(complete == false);
+
+	// "amp" は一致するが、 "amp;" が続きうる
+	ts.push_code_point(U'p');
+	std::array<char32_t, 2> a = ts.match_named_character_reference(len, complete);
+
+	BOOST_CHECK(complete == false);
+	BOOST_CHECK(len == 3);
+	BOOST_CHECK(a[0] == U'&');
+
+	// 受理状態から先に遷移が無いので、後続を待たずに確定する
+	ts.push_code_point(U';');
+	a = ts.match_named_character_reference(len, complete);
+
+	BOOST_CHECK(complete == true);
+	BOOST_CHECK(len == 4);
+	BOOST_CHECK(a[0] == U'&');
+}
+
+BOOST_AUTO_TEST_CASE(input_stream_match_named_character_reference_8)
+{
+	test_stream ts;
+	auto s = std::u32string(U"notit;");
+	for (char32_t cp : s) ts.push_code_point(cp);
+
+	std::uint32_t len;
+	bool complete;
+	std::array<char32_t, 2> a = ts.match_named_character_reference(len, complete);
+
+	BOOST_CHECK(complete == true);
+	BOOST_CHECK(len == 3);
+	BOOST_CHECK(a[0] == U'\xAC');
+	BOOST_CHECK(a[1] == U'\0');
+}
+
 /*
 次の入力文字を消費する
 
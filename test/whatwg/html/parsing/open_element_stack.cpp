@@ -0,0 +1,196 @@
+﻿// test/whatwg/html/parsing/open_element_stack.cpp
+
+#include <boost/test/unit_test.hpp>
+
+#include <wordring/html/simple_html.hpp>
+#include <wordring/html/simple_node.hpp>
+#include <wordring/html/simple_parser.hpp>
+#include <wordring/html/simple_traits.hpp>
+
+#include <wordring/whatwg/html/parsing/open_element_stack.hpp>
+
+#include <wordring/tag_tree/tag_tree.hpp>
+
+#include <string>
+
+namespace
+{
+	using namespace wordring::html;
+
+	using tree = wordring::tag_tree<simple_node<std::string>>;
+
+	using traits = node_traits<typename tree::iterator>;
+
+	struct test_entry
+	{
+		typename tree::iterator m_it;
+	};
+
+	using test_stack = wordring::whatwg::html::parsing::open_element_stack<traits, test_entry>;
+	using scope_name = typename test_stack::scope_name;
+
+	class test_parser : public simple_parser_base<test_parser, tree>
+	{
+	public:
+		typename tree::iterator append(typename tree::iterator parent, tag_name tag, ns_name ns = ns_name::HTML)
+		{
+			return insert_element(parent.end(), create_element(get_document(), tag, ns));
+		}
+	};
+}
+
+BOOST_AUTO_TEST_SUITE(open_element_stack_test)
+
+BOOST_AUTO_TEST_CASE(open_element_stack_push_back_1)
+{
+	test_parser p;
+	auto HTML = p.append(p.get_document(), tag_name::Html);
+	auto BODY = p.append(HTML, tag_name::Body);
+	auto P    = p.append(BODY, tag_name::P);
+
+	test_stack s;
+	s.push_back({ HTML });
+	s.push_back({ BODY });
+	s.push_back({ P });
+
+	BOOST_CHECK(s.size() == 3);
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::Html) == 1);
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::P) == 3);
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::Div) == 0);
+	BOOST_CHECK(s.boundary(scope_name::default_scope) == 1);
+	BOOST_CHECK(s.in_scope(scope_name::button_scope, ns_name::HTML, tag_name::P));
+}
+
+BOOST_AUTO_TEST_CASE(open_element_stack_pop_back_1)
+{
+	test_parser p;
+	auto HTML   = p.append(p.get_document(), tag_name::Html);
+	auto P1     = p.append(HTML, tag_name::P);
+	auto BUTTON = p.append(P1, tag_name::Button);
+	auto P2     = p.append(BUTTON, tag_name::P);
+
+	test_stack s;
+	s.push_back({ HTML });
+	s.push_back({ P1 });
+	s.push_back({ BUTTON });
+	s.push_back({ P2 });
+
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::P) == 4);
+
+	s.pop_back();
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::P) == 2);
+	BOOST_CHECK(s.boundary(scope_name::button_scope) == 3);
+	BOOST_CHECK(s.in_scope(scope_name::button_scope, ns_name::HTML, tag_name::P) == false);
+	BOOST_CHECK(s.in_scope(scope_name::default_scope, ns_name::HTML, tag_name::P));
+
+	s.pop_back();
+	BOOST_CHECK(s.boundary(scope_name::button_scope) == 1);
+	BOOST_CHECK(s.in_scope(scope_name::button_scope, ns_name::HTML, tag_name::P));
+}
+
+BOOST_AUTO_TEST_CASE(open_element_stack_in_scope_1)
+{
+	test_parser p;
+	auto HTML   = p.append(p.get_document(), tag_name::Html);
+	auto TABLE  = p.append(HTML, tag_name::Table);
+	auto SELECT = p.append(TABLE, tag_name::Select);
+	auto OPTION = p.append(SELECT, tag_name::Option);
+
+	test_stack s;
+	s.push_back({ HTML });
+	s.push_back({ TABLE });
+	s.push_back({ SELECT });
+	s.push_back({ OPTION });
+
+	// 要素自身が境界要素である場合
+	BOOST_CHECK(s.in_scope(scope_name::table_scope, ns_name::HTML, tag_name::Table));
+	BOOST_CHECK(s.in_scope(scope_name::select_scope, ns_name::HTML, tag_name::Select));
+	BOOST_CHECK(s.in_scope(scope_name::select_scope, ns_name::HTML, tag_name::Table) == false);
+	BOOST_CHECK(s.in_scope(scope_name::default_scope, ns_name::HTML, tag_name::Html) == false);
+	BOOST_CHECK(s.in_scope_if(scope_name::select_scope, [&](auto it) { return it == SELECT; }));
+	BOOST_CHECK(s.in_scope_if(scope_name::select_scope, [&](auto it) { return it == TABLE; }) == false);
+}
+
+BOOST_AUTO_TEST_CASE(open_element_stack_in_scope_2)
+{
+	test_parser p;
+	auto HTML = p.append(p.get_document(), tag_name::Html);
+	auto SVG  = p.append(HTML, tag_name::Svg, ns_name::SVG);
+	auto DESC = p.append(SVG, tag_name::Desc, ns_name::SVG);
+	auto P    = p.append(DESC, tag_name::P);
+
+	test_stack s;
+	s.push_back({ HTML });
+	s.push_back({ P });
+	s.push_back({ SVG });
+	s.push_back({ DESC });
+
+	BOOST_CHECK(s.top(ns_name::SVG, tag_name::Desc) == 4);
+	BOOST_CHECK(s.in_scope(scope_name::default_scope, ns_name::HTML, tag_name::P) == false);
+	BOOST_CHECK(s.in_scope(scope_name::table_scope, ns_name::HTML, tag_name::P));
+}
+
+BOOST_AUTO_TEST_CASE(open_element_stack_insert_1)
+{
+	test_parser p;
+	auto HTML = p.append(p.get_document(), tag_name::Html);
+	auto DIV  = p.append(HTML, tag_name::Div);
+	auto B    = p.append(DIV, tag_name::B);
+	auto TD   = p.append(HTML, tag_name::Td);
+
+	test_stack s;
+	s.push_back({ HTML });
+	s.push_back({ DIV });
+
+	s.insert(std::next(s.begin()), { TD });
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::Td) == 2);
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::Div) == 3);
+	BOOST_CHECK(s.boundary(scope_name::default_scope) == 2);
+
+	s.insert(s.end(), { B });
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::B) == 4);
+}
+
+BOOST_AUTO_TEST_CASE(open_element_stack_erase_1)
+{
+	test_parser p;
+	auto HTML = p.append(p.get_document(), tag_name::Html);
+	auto TD   = p.append(HTML, tag_name::Td);
+	auto DIV  = p.append(TD, tag_name::Div);
+	auto B    = p.append(DIV, tag_name::B);
+
+	test_stack s;
+	s.push_back({ HTML });
+	s.push_back({ TD });
+	s.push_back({ DIV });
+	s.push_back({ B });
+
+	s.erase(std::next(s.begin()));
+	BOOST_CHECK(s.size() == 3);
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::Td) == 0);
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::B) == 3);
+	BOOST_CHECK(s.boundary(scope_name::default_scope) == 1);
+
+	s.erase(std::prev(s.end()));
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::B) == 0);
+
+	s.erase(s.begin(), s.end());
+	BOOST_CHECK(s.empty());
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::Html) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(open_element_stack_clear_1)
+{
+	test_parser p;
+	auto HTML = p.append(p.get_document(), tag_name::Html);
+
+	test_stack s;
+	s.push_back({ HTML });
+	s.clear();
+
+	BOOST_CHECK(s.empty());
+	BOOST_CHECK(s.top(ns_name::HTML, tag_name::Html) == 0);
+	BOOST_CHECK(s.boundary(scope_name::select_scope) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -186,6 +186,51 @@ BOOST_AUTO_TEST_CASE(tokenizer_on_attribute_name_state_2)
 	BOOST_CHECK(tt.m_c.empty());
 }
 
+BOOST_AUTO_TEST_CASE(tokenizer_on_attribute_name_state_3)
+{
+	test_tokenizer tt;
+
+	tt.m_state = test_tokenizer::tag_open_state;
+	auto s = std::u32string(U"Tag data-a='1' ID='2' data-b='3' data-a='4' id='5'");
+
+	for (char32_t cp : s) tt.push_code_point(cp);
+
+	auto it = tt.current_tag_token().m_attributes.begin();
+	BOOST_CHECK(it->m_name_id == static_cast<attribute_name>(0));
+	BOOST_CHECK((it++)->m_omitted == false);
+	BOOST_CHECK(it->m_name_id == attribute_name::Id);
+	BOOST_CHECK((it++)->m_omitted == false);
+	BOOST_CHECK((it++)->m_omitted == false);
+	BOOST_CHECK((it++)->m_omitted == true);
+	BOOST_CHECK((it++)->m_omitted == true);
+
+	BOOST_CHECK(tt.current_tag_token().find(attribute_name::Id)->m_value == U"2");
+	BOOST_CHECK(tt.current_tag_token().find(attribute_name::Class) == tt.current_tag_token().end());
+	BOOST_CHECK(tt.current_tag_token().find(U"data-a")->m_value == U"1");
+}
+
+BOOST_AUTO_TEST_CASE(tokenizer_on_attribute_name_state_4)
+{
+	test_tokenizer tt;
+
+	// 65535 個を超える属性の後でも重複を検出する
+	tt.m_state = test_tokenizer::tag_open_state;
+	std::u32string s = U"p";
+	for (std::uint32_t i = 0; i < 65535; ++i) s += U" class";
+	s += U" id='a' id='b'";
+
+	for (char32_t cp : s) tt.push_code_point(cp);
+
+	auto const& token = tt.current_tag_token();
+	BOOST_CHECK(std::prev(token.end())->m_omitted == true);
+	BOOST_CHECK(token.find(attribute_name::Id)->m_value == U"a");
+
+	// 複製したトークンは索引を持たず、線形に検索する
+	auto copy = token;
+	BOOST_CHECK(copy.m_attributes.m_index.empty());
+	BOOST_CHECK(copy.find(attribute_name::Id)->m_value == U"a");
+}
+
 /* 12.2.5.42 Markup declaration open state */
 BOOST_AUTO_TEST_CASE(tokenizer_on_markup_declaration_open_state_1)
 {
@@ -82,9 +82,9 @@ BOOST_AUTO_TEST_CASE(dispatcher_reset_insertion_mode_appropriately_1)
 	auto HTML = p.insert_element(document.end(), p.create_element(document.end(), tag_name::Html, ns_name::HTML));
 	auto TABLE = p.insert_element(HTML.end(), p.create_element(document.end(), tag_name::Table, ns_name::HTML));
 	auto SELECT = p.insert_element(TABLE.end(), p.create_element(document.end(), tag_name::Select, ns_name::HTML));
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), TABLE });
-	p.m_stack.push_back({ start_tag_token(), SELECT });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ TABLE, false });
+	p.m_stack.push_back({ SELECT, false });
 
 	p.reset_insertion_mode_appropriately();
 
@@ -99,10 +99,10 @@ BOOST_AUTO_TEST_CASE(dispatcher_reset_insertion_mode_appropriately_2)
 	auto TABLE = p.insert_element(HTML.end(), p.create_element(document.end(), tag_name::Table, ns_name::HTML));
 	auto TEMPLATE = p.insert_element(TABLE.end(), p.create_element(document.end(), tag_name::Template, ns_name::HTML));
 	auto SELECT = p.insert_element(TEMPLATE.end(), p.create_element(document.end(), tag_name::Select, ns_name::HTML));
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), TABLE });
-	p.m_stack.push_back({ start_tag_token(), TEMPLATE });
-	p.m_stack.push_back({ start_tag_token(), SELECT });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ TABLE, false });
+	p.m_stack.push_back({ TEMPLATE, false });
+	p.m_stack.push_back({ SELECT, false });
 
 	p.reset_insertion_mode_appropriately();
 
@@ -116,9 +116,9 @@ BOOST_AUTO_TEST_CASE(dispatcher_reset_insertion_mode_appropriately_3)
 	auto HTML = p.insert_element(document.end(), p.create_element(document.end(), tag_name::Html, ns_name::HTML));
 	auto HEAD = p.insert_element(HTML.end(), p.create_element(document.end(), tag_name::Head, ns_name::HTML));
 	auto A = p.insert_element(HEAD.end(), p.create_element(document.end(), tag_name::A, ns_name::HTML));
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), HEAD });
-	p.m_stack.push_back({ start_tag_token(), A });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ HEAD, false });
+	p.m_stack.push_back({ A, false });
 
 	p.reset_insertion_mode_appropriately();
 
@@ -132,9 +132,9 @@ BOOST_AUTO_TEST_CASE(dispatcher_reset_insertion_mode_appropriately_4)
 	auto HTML = p.insert_element(document.end(), p.create_element(document.end(), tag_name::Html, ns_name::HTML));
 	auto HTML2 = p.insert_element(HTML.end(), p.create_element(document.end(), tag_name::Html, ns_name::HTML));
 	auto A = p.insert_element(HTML2.end(), p.create_element(document.end(), tag_name::A, ns_name::HTML));
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), HTML2 });
-	p.m_stack.push_back({ start_tag_token(), A });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ HTML2, false });
+	p.m_stack.push_back({ A, false });
 
 	p.reset_insertion_mode_appropriately();
 
@@ -180,8 +180,8 @@ BOOST_AUTO_TEST_CASE(dispatcher_in_specific_scope_1)
 	t.insert(t.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Html));
 	t.insert(t.begin().end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Font));
 	test_parser p;
-	p.m_stack.push_back({ start_tag_token(), t.begin() });
-	p.m_stack.push_back({ start_tag_token(), t.begin().begin() });
+	p.m_stack.push_back({ t.begin(), false });
+	p.m_stack.push_back({ t.begin().begin(), false });
 
 	BOOST_CHECK(p.in_specific_scope(test_parser::default_scope, std::make_pair(ns_name::HTML, tag_name::Font)));
 }
@@ -192,8 +192,8 @@ BOOST_AUTO_TEST_CASE(dispatcher_in_specific_scope_2)
 	t.insert(t.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Html));
 	t.insert(t.begin().end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Font));
 	test_parser p;
-	p.m_stack.push_back({ start_tag_token(), t.begin() });
-	p.m_stack.push_back({ start_tag_token(), t.begin().begin() });
+	p.m_stack.push_back({ t.begin(), false });
+	p.m_stack.push_back({ t.begin().begin(), false });
 
 	BOOST_CHECK(!p.in_specific_scope(test_parser::default_scope, std::make_pair(ns_name::HTML, tag_name::A)));
 }
@@ -207,9 +207,9 @@ BOOST_AUTO_TEST_CASE(dispatcher_pop_until_1)
 	auto BODY = p.m_c.insert(HTML.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Body));
 	auto P = p.m_c.insert(BODY.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::P));
 
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), BODY });
-	p.m_stack.push_back({ start_tag_token(), P });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ BODY, false });
+	p.m_stack.push_back({ P, false });
 
 	p.pop_until(ns_name::HTML, tag_name::Body);
 
@@ -225,9 +225,9 @@ BOOST_AUTO_TEST_CASE(dispatcher_pop_until_2)
 	auto BODY = p.m_c.insert(HTML.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Body));
 	auto P = p.m_c.insert(BODY.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::P));
 
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), BODY });
-	p.m_stack.push_back({ start_tag_token(), P });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ BODY, false });
+	p.m_stack.push_back({ P, false });
 
 	std::array<tag_name, 2> constexpr tags = { tag_name::A, tag_name::Body };
 	p.pop_until(ns_name::HTML, tags);
@@ -244,9 +244,9 @@ BOOST_AUTO_TEST_CASE(dispatcher_pop_until_3)
 	auto BODY = p.m_c.insert(HTML.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Body));
 	auto P = p.m_c.insert(BODY.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::P));
 
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), BODY });
-	p.m_stack.push_back({ start_tag_token(), P });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ BODY, false });
+	p.m_stack.push_back({ P, false });
 
 	p.pop_until(BODY);
 
@@ -314,6 +314,44 @@ BOOST_AUTO_TEST_CASE(dispatcher_push_formatting_element_list_2)
 	BOOST_CHECK(std::next(p.m_list.begin(), 4)->m_it == a5);
 }
 
+BOOST_AUTO_TEST_CASE(dispatcher_push_formatting_element_list_3)
+{
+	tree t;
+	auto html = t.insert(t.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Html));
+	auto b1 = t.insert(html.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::B));
+	auto b2 = t.insert(b1.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::B));
+	auto b3 = t.insert(b2.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::B));
+	auto b4 = t.insert(b3.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::B));
+	test_parser p;
+	start_tag_token token1;
+	token1.m_tag_name = U"b";
+	token1.m_attributes.create().m_name = U"class";
+	token1.m_attributes.current().m_value = U"x";
+	start_tag_token token2 = token1;
+	token2.m_attributes.current().m_value = U"y";
+	p.push_formatting_element_list(b1, token1);
+	p.push_formatting_element_list(b2, token2);
+	p.push_formatting_element_list(b3, token1);
+	p.push_formatting_element_list(b4, token1);
+
+	// 属性値の異なる b2 は数えられない
+	BOOST_CHECK(p.m_list.size() == 4);
+	BOOST_CHECK(p.m_list[0].m_signature == p.m_list[2].m_signature);
+
+	p.push_formatting_element_list(b4, token1);
+	BOOST_CHECK(p.m_list.size() == 4);
+	BOOST_CHECK(p.m_list.front().m_it == b2);
+
+	// タグ名ごとの索引
+	BOOST_CHECK(p.m_list_count[static_cast<std::uint32_t>(tag_name::B)] == 4);
+	BOOST_CHECK(p.find_from_list(html) == p.m_list.end());
+	BOOST_CHECK(p.find_from_list(b2) == p.m_list.begin());
+	p.remove_from_list(b2);
+	p.clear_formatting_element_list();
+	BOOST_CHECK(p.m_list.empty());
+	BOOST_CHECK(p.m_list_count[static_cast<std::uint32_t>(tag_name::B)] == 0);
+}
+
 BOOST_AUTO_TEST_CASE(dispatcher_reconstruct_formatting_element_list_1)
 {
 	test_parser p;
@@ -323,7 +361,7 @@ BOOST_AUTO_TEST_CASE(dispatcher_reconstruct_formatting_element_list_1)
 	BOOST_CHECK(p.m_c.size() == 5);
 	start_tag_token token1;
 	token1.m_tag_name = U"A";
-	p.m_stack.push_back({ token1, HTML });
+	p.m_stack.push_back({ HTML, false });
 	p.push_formatting_element_list(A1, token1);
 	p.push_formatting_element_list();
 	p.push_formatting_element_list(A2, token1);
@@ -373,7 +411,7 @@ BOOST_AUTO_TEST_CASE(dispatcher_is_mathml_text_integration_point_1)
 	auto it = p.insert_element(p.get_document().end(), p.create_element(p.get_document(), tag_name::Mtext, ns_name::MathML));
 	start_tag_token token;
 	token.m_tag_name_id = tag_name::Mtext;
-	test_parser::stack_entry entry{ token, it };
+	test_parser::stack_entry entry{ it, false };
 
 	BOOST_CHECK(p.is_mathml_text_integration_point(entry));
 }
@@ -381,15 +419,18 @@ BOOST_AUTO_TEST_CASE(dispatcher_is_mathml_text_integration_point_1)
 BOOST_AUTO_TEST_CASE(dispatcher_is_html_integration_point_1)
 {
 	test_parser p;
-	auto it = p.insert_element(p.get_document().end(), p.create_element(p.get_document(), tag_name::Annotation_xml, ns_name::MathML));
+	auto HTML = p.insert_element(p.get_document().end(), p.create_element(p.get_document(), tag_name::Html, ns_name::HTML));
+	p.m_stack.push_back({ HTML, false });
 	start_tag_token token;
+	token.m_tag_name = U"annotation-xml";
 	token.m_tag_name_id = tag_name::Annotation_xml;
 	auto& attr = token.m_attributes.create();
 	attr.m_name = U"encoding";// attribute_name::Encoding;
 	attr.m_value = U"Application/xhtml+xml";
-	test_parser::stack_entry entry{ token, it };
+	token.m_attributes.unify();
+	p.insert_foreign_element(token, ns_name::MathML);
 
-	BOOST_CHECK(p.is_html_integration_point(entry));
+	BOOST_CHECK(p.is_html_integration_point(p.current_node()));
 }
 
 // ------------------------------------------------------------------------------------------------
@@ -409,9 +450,9 @@ BOOST_AUTO_TEST_CASE(dispatcher_appropriate_place_for_inserting_node_1)
 	auto TABLE = t.insert(HTML.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Table));
 	auto TEMPLATE = t.insert(TABLE.end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Template));
 	test_parser p;
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), TABLE });
-	p.m_stack.push_back({ start_tag_token(), TEMPLATE });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ TABLE, false });
+	p.m_stack.push_back({ TEMPLATE, false });
 	p.m_foster_parenting = true;
 
 	auto it = p.appropriate_place_for_inserting_node(TABLE);
@@ -426,8 +467,8 @@ BOOST_AUTO_TEST_CASE(dispatcher_appropriate_place_for_inserting_node_2)
 	auto HTML = p.insert_element(document.end(), p.create_element(document.end(), tag_name::Html, ns_name::HTML));
 	auto P = p.insert_element(HTML.end(), p.create_element(document.end(), tag_name::P, ns_name::HTML));
 	auto TABLE = p.insert_element(P.end(), p.create_element(document.end(), tag_name::Table, ns_name::HTML));
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), P });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ P, false });
 	p.m_foster_parenting = true;
 
 	auto it = p.appropriate_place_for_inserting_node(TABLE);
@@ -442,9 +483,9 @@ BOOST_AUTO_TEST_CASE(dispatcher_appropriate_place_for_inserting_node_3)
 	auto HTML = p.insert_element(document.end(), p.create_element(document.end(), tag_name::Html, ns_name::HTML));
 	auto TEMPLATE = p.insert_element(HTML.end(), p.create_element(document.end(), tag_name::Template, ns_name::HTML));
 	auto TABLE = p.insert_element(TEMPLATE.end(), p.create_element(document.end(), tag_name::Table, ns_name::HTML));
-	p.m_stack.push_back({ start_tag_token(), HTML });
-	p.m_stack.push_back({ start_tag_token(), TEMPLATE });
-	p.m_stack.push_back({ start_tag_token(), TABLE });
+	p.m_stack.push_back({ HTML, false });
+	p.m_stack.push_back({ TEMPLATE, false });
+	p.m_stack.push_back({ TABLE, false });
 	p.m_foster_parenting = true;
 
 	auto it = p.appropriate_place_for_inserting_node(TABLE);
@@ -458,8 +499,8 @@ BOOST_AUTO_TEST_CASE(dispatcher_appropriate_place_for_inserting_node_4)
 	auto document = p.get_document();
 	auto TABLE = p.insert_element(document.end(), p.create_element(document.end(), tag_name::Table, ns_name::HTML));
 	auto P = p.insert_element(TABLE.end(), p.create_element(document.end(), tag_name::P, ns_name::HTML));
-	p.m_stack.push_back({ start_tag_token(), P });
-	p.m_stack.push_back({ start_tag_token(), TABLE });
+	p.m_stack.push_back({ P, false });
+	p.m_stack.push_back({ TABLE, false });
 	p.m_foster_parenting = true;
 
 	auto it = p.appropriate_place_for_inserting_node(TABLE);
@@ -473,8 +514,8 @@ BOOST_AUTO_TEST_CASE(dispatcher_appropriate_place_for_inserting_node_5)
 	auto document = p.get_document();
 	auto TABLE = p.insert_element(document.end(), p.create_element(document.end(), tag_name::Table, ns_name::HTML));
 	auto P = p.insert_element(TABLE.end(), p.create_element(document.end(), tag_name::P, ns_name::HTML));
-	p.m_stack.push_back({ start_tag_token(), P });
-	p.m_stack.push_back({ start_tag_token(), TABLE });
+	p.m_stack.push_back({ P, false });
+	p.m_stack.push_back({ TABLE, false });
 
 	auto it = p.appropriate_place_for_inserting_node(TABLE);
 
@@ -657,7 +698,7 @@ BOOST_AUTO_TEST_CASE(dispatcher_insert_character_1)
 {
 	test_parser p;
 	auto HTML = p.m_c.insert(p.get_document().end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Html));
-	p.m_stack.push_back({ start_tag_token(), HTML });
+	p.m_stack.push_back({ HTML, false });
 	p.m_foster_parenting = true;
 
 	auto it = p.appropriate_place_for_inserting_node(HTML);
@@ -672,7 +713,7 @@ BOOST_AUTO_TEST_CASE(dispatcher_insert_character_2)
 {
 	test_parser p;
 	auto HTML = p.m_c.insert(p.get_document().end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Html));
-	p.m_stack.push_back({ start_tag_token(), HTML });
+	p.m_stack.push_back({ HTML, false });
 	p.m_foster_parenting = true;
 
 	auto it = p.appropriate_place_for_inserting_node(HTML);
@@ -703,7 +744,7 @@ BOOST_AUTO_TEST_CASE(dispatcher_insert_comment_2)
 	test_parser p;
 	auto HTML = p.m_c.insert(p.get_document().end(), simple_element<std::string>(ns_name::HTML, "", tag_name::Html));
 
-	p.m_stack.push_back({ start_tag_token(), HTML });
+	p.m_stack.push_back({ HTML, false });
 	p.m_foster_parenting = true;
 
 	auto it = p.appropriate_place_for_inserting_node(HTML);